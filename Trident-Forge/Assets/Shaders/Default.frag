@@ -20,6 +20,11 @@ layout(location = 5) in vec3 inVertexColor;
 
 layout(location = 0) out vec4 outColor;
 
+// Pipeline permutation bits (Pipeline::s_Feature*); constant 0 belongs to the vertex stage. The renderer picks the
+// permutation per draw, so disabled paths cost nothing instead of a uniform branch per fragment.
+layout(constant_id = 1) const bool c_AiBlend = false;
+layout(constant_id = 2) const bool c_AlphaTest = false;
+
 layout(push_constant) uniform RenderablePushConstant
 {
     mat4 ModelMatrix;          // Object to world transform (unused here but kept for parity).
@@ -31,7 +36,7 @@ layout(push_constant) uniform RenderablePushConstant
     int UseMaterialOverride;   // Signals material override usage (future extension point).
     float SortBias;            // Reserved depth bias to match CPU structure.
     int MaterialIndex;         // Material lookup index for extended shading data.
-    int Padding0;              // Padding maintained for std140 alignment.
+    int InstanceIndex;         // Scene buffer record; only read by the vertex stage.
     int Padding1;              // Padding maintained for std140 alignment.
     int Padding2;              // Padding maintained for std140 alignment.
 } pc;
@@ -55,14 +60,21 @@ layout(set = 0, binding = 0) uniform GlobalUniformBuffer
     PointLightUniform PointLights[8];
 } g_Global;
 
-layout(set = 0, binding = 1) uniform MaterialUniformBuffer
+struct MaterialRecord
 {
     vec4 BaseColorFactor;
-    vec4 MaterialFactors; // x = metallic, y = roughness, z = ambient strength, w reserved
-} g_Material;
+    vec4 MaterialFactors; // x = metallic, y = roughness, z = ambient strength, w = alpha cutoff
+    ivec4 TextureSlots;   // x = base color, y = metallic-roughness, z = normal (0 = none), w reserved
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer MaterialBuffer
+{
+    MaterialRecord Materials[];
+} g_Materials;
 
-layout(set = 0, binding = 2) uniform sampler2D BaseColorSamplers[]; // Array lets us bind many textures while reusing the shader.
-layout(set = 0, binding = 5) uniform sampler2D AiBlendTexture;
+layout(set = 0, binding = 2) uniform sampler2D AiBlendTexture;
+// Runtime-sized and last in the set so bindless devices can allocate it with a variable descriptor count.
+layout(set = 0, binding = 6) uniform sampler2D BaseColorSamplers[];
 
 const float PI = 3.14159265359;
 
@@ -122,22 +134,45 @@ vec3 EvaluatePBRLighting(vec3 lightDirection, vec3 radiance, vec3 shadingNormal,
 
 void main()
 {
-    // Transform the default tangent-space normal into world space.
+    // Draws without a material (or with an out-of-range index) shade with neutral factors and no data maps.
+    MaterialRecord l_Material = MaterialRecord(vec4(1.0), vec4(1.0, 1.0, 1.0, 0.0), ivec4(0));
+    if (pc.MaterialIndex >= 0 && pc.MaterialIndex < g_Materials.Materials.length())
+    {
+        l_Material = g_Materials.Materials[pc.MaterialIndex];
+    }
+
+    // Transform the tangent-space normal into world space; slot 0 keeps the geometric normal.
     vec3 l_Tangent = normalize(inTangent);
     vec3 l_Bitangent = normalize(inBitangent);
     vec3 l_Normal = normalize(inNormal);
     mat3 l_TBN = mat3(l_Tangent, l_Bitangent, l_Normal);
-    vec3 l_ShadingNormal = normalize(l_TBN * vec3(0.0, 0.0, 1.0));
+    vec3 l_TangentNormal = vec3(0.0, 0.0, 1.0);
+    int l_NormalSlot = l_Material.TextureSlots.z;
+    if (l_NormalSlot > 0)
+    {
+        l_TangentNormal = texture(BaseColorSamplers[NON_UNIFORM_INDEX(l_NormalSlot)], inTexCoord).rgb * 2.0 - 1.0;
+    }
+    vec3 l_ShadingNormal = normalize(l_TBN * l_TangentNormal);
 
     vec3 l_ViewDirection = normalize(g_Global.CameraPosition.xyz - inWorldPosition);
 
     int l_TextureSlot = pc.TextureSlot; // Copy to a local so we can mark the index non-uniform for Vulkan descriptor indexing.
     // Use the slot pushed from the renderer; mark non-uniform when supported to satisfy Vulkan validation.
     vec4 l_SampledColor = texture(BaseColorSamplers[NON_UNIFORM_INDEX(l_TextureSlot)], inTexCoord);
-    vec3 l_Albedo = l_SampledColor.rgb * g_Material.BaseColorFactor.rgb * pc.TintColor.rgb * inVertexColor;
-    float l_Metallic = clamp(g_Material.MaterialFactors.x, 0.0, 1.0);
-    float l_Roughness = clamp(g_Material.MaterialFactors.y, 0.045, 1.0);
-    float l_AmbientStrength = clamp(g_Material.MaterialFactors.z, 0.0, 1.0);
+    float l_Alpha = l_Material.BaseColorFactor.a * pc.TintColor.a * l_SampledColor.a;
+    if (c_AlphaTest && l_Alpha < l_Material.MaterialFactors.w)
+    {
+        discard;
+    }
+
+    vec3 l_Albedo = l_SampledColor.rgb * l_Material.BaseColorFactor.rgb * pc.TintColor.rgb * inVertexColor;
+
+    // glTF packs roughness in green and metallic in blue; data maps are UNORM and slot 0 is white, so the factors pass through unchanged.
+    int l_MetallicRoughnessSlot = l_Material.TextureSlots.y;
+    vec3 l_MetallicRoughness = texture(BaseColorSamplers[NON_UNIFORM_INDEX(l_MetallicRoughnessSlot)], inTexCoord).rgb;
+    float l_Metallic = clamp(l_Material.MaterialFactors.x * l_MetallicRoughness.b, 0.0, 1.0);
+    float l_Roughness = clamp(l_Material.MaterialFactors.y * l_MetallicRoughness.g, 0.045, 1.0);
+    float l_AmbientStrength = clamp(l_Material.MaterialFactors.z, 0.0, 1.0);
 
     vec3 l_F0 = mix(vec3(0.04), l_Albedo, l_Metallic);
 
@@ -177,9 +212,10 @@ void main()
     l_Color = l_Color / (l_Color + vec3(1.0));
     l_Color = pow(l_Color, vec3(1.0 / 2.2));
 
-    outColor = vec4(l_Color, g_Material.BaseColorFactor.a * pc.TintColor.a * l_SampledColor.a);
+    outColor = vec4(l_Color, l_Alpha);
 
-    if (g_Global.AiBlendConfig.w > 0.0)
+    // The renderer only selects this permutation while an AI frame is resident (AiBlendConfig.w).
+    if (c_AiBlend)
     {
         float l_BlendWeight = clamp(g_Global.AiBlendConfig.x, 0.0, 1.0);
         if (l_BlendWeight > 0.0)
@@ -189,6 +225,4 @@ void main()
             outColor = mix(outColor, l_AiColour, l_BlendWeight);
         }
     }
-
-    // Future enhancement: once the base-color flow is proven we can wire up metallic/roughness and normal textures here.
 }
\ No newline at end of file
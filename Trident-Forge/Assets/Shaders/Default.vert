@@ -7,8 +7,7 @@ layout(location = 2) in vec3 inTangent;
 layout(location = 3) in vec3 inBitangent;
 layout(location = 4) in vec3 inColor;
 layout(location = 5) in vec2 inTexCoord;
-layout(location = 6) in ivec4 inBoneIndices; // Packed as signed ints to match glm::ivec4 layout on the CPU.
-layout(location = 7) in vec4 inBoneWeights;  // Supports four influences; TODO: evaluate dual-quaternion skinning later.
+// Locations 6 and 7 (bone indices and weights) are consumed by Skinning.comp; animated meshes arrive here already skinned.
 
 // Interpolated data consumed by the fragment shader.
 layout(location = 0) out vec3 outWorldPosition;
@@ -18,6 +17,10 @@ layout(location = 3) out vec3 outBitangent;
 layout(location = 4) out vec2 outTexCoord;
 layout(location = 5) out vec3 outVertexColor;
 
+// Pipeline permutation bits (Pipeline::s_Feature*). Meshes read their transform from the scene buffer; sprites
+// keep the push-constant matrix.
+layout(constant_id = 0) const bool c_SceneInstance = true;
+
 layout(push_constant) uniform RenderablePushConstant
 {
     mat4 ModelMatrix;          // Object to world transform shared with the CPU side struct.
@@ -29,15 +32,31 @@ layout(push_constant) uniform RenderablePushConstant
     int UseMaterialOverride;   // Non-zero when material overrides should be honored (reserved).
     float SortBias;            // Depth bias reserved for transparent layering (unused here).
     int MaterialIndex;         // Material lookup index for extended shading data.
-    int Padding0;              // Padding to mirror RenderablePushConstant's std140 layout.
-    int BoneOffset;            // Offset into the global bone palette buffer for this draw.
-    int BoneCount;             // Number of matrices that compose the palette for this mesh.
+    int InstanceIndex;         // Scene buffer record, read by the scene-instance permutation.
+    int BoneOffset;            // Palette range of the draw; skinning already happened in Skinning.comp.
+    int BoneCount;
 } pc;
 
-layout(set = 0, binding = 4) readonly buffer BonePalette
+// Mirrors SceneBuffer::InstanceRecord; only records whose inputs changed are re-uploaded each frame.
+struct InstanceRecord
+{
+    mat4 WorldMatrix;
+    mat4 PreviousWorldMatrix;
+    vec4 BoundingSphere;
+    int MaterialIndex;
+    int TextureSlot;
+    uint FirstIndex;
+    uint IndexCount;
+    int BaseVertex;
+    uint BoneOffset;
+    uint BoneCount;
+    uint Flags;
+};
+
+layout(std430, set = 0, binding = 5) readonly buffer SceneBuffer
 {
-    mat4 BoneMatrices[];
-} g_Bones;
+    InstanceRecord Instances[];
+} g_Scene;
 
 struct PointLightUniform
 {
@@ -59,43 +78,19 @@ layout(set = 0, binding = 0) uniform GlobalUniformBuffer
 
 void main()
 {
-    const int kMaxBoneInfluences = 4;
-
-    mat4 l_SkinMatrix = mat4(1.0);
-    if (pc.BoneCount > 0)
+    mat4 l_ModelMatrix = pc.ModelMatrix;
+    if (c_SceneInstance)
     {
-        l_SkinMatrix = mat4(0.0);
-        for (int it_Index = 0; it_Index < kMaxBoneInfluences; ++it_Index)
-        {
-            float l_Weight = inBoneWeights[it_Index];
-            if (l_Weight <= 0.0)
-            {
-                continue;
-            }
-
-            int l_BoneIndex = inBoneIndices[it_Index];
-            if (l_BoneIndex < 0 || l_BoneIndex >= pc.BoneCount)
-            {
-                continue;
-            }
-
-            uint l_BufferIndex = uint(pc.BoneOffset + l_BoneIndex);
-            l_SkinMatrix += l_Weight * g_Bones.BoneMatrices[l_BufferIndex];
-        }
+        l_ModelMatrix = g_Scene.Instances[pc.InstanceIndex].WorldMatrix;
     }
 
-    vec4 l_SkinnedPosition = l_SkinMatrix * vec4(inPosition, 1.0);
-    vec3 l_SkinnedNormal = mat3(l_SkinMatrix) * inNormal;
-    vec3 l_SkinnedTangent = mat3(l_SkinMatrix) * inTangent;
-    vec3 l_SkinnedBitangent = mat3(l_SkinMatrix) * inBitangent;
-
-    vec4 l_WorldPosition = pc.ModelMatrix * l_SkinnedPosition;
+    vec4 l_WorldPosition = l_ModelMatrix * vec4(inPosition, 1.0);
     outWorldPosition = l_WorldPosition.xyz;
 
-    mat3 l_NormalMatrix = transpose(inverse(mat3(pc.ModelMatrix)));
-    outNormal = normalize(l_NormalMatrix * l_SkinnedNormal);
-    outTangent = normalize(l_NormalMatrix * l_SkinnedTangent);
-    outBitangent = normalize(l_NormalMatrix * l_SkinnedBitangent);
+    mat3 l_NormalMatrix = transpose(inverse(mat3(l_ModelMatrix)));
+    outNormal = normalize(l_NormalMatrix * inNormal);
+    outTangent = normalize(l_NormalMatrix * inTangent);
+    outBitangent = normalize(l_NormalMatrix * inBitangent);
 
     vec2 l_TiledTexCoord = (inTexCoord * pc.TextureScale * pc.TilingFactor) + pc.TextureOffset; // Apply atlas transforms up front.
     outTexCoord = l_TiledTexCoord;
@@ -154,6 +154,16 @@ void ApplicationLayer::Initialize()
             m_GameViewportPanel.SetExportPath(exportPath);
         });
 
+    m_EditorToolbar.SetOnReplayToggle([this](bool enabled)
+        {
+            m_GameViewportPanel.RequestReplayToggle(enabled);
+        });
+
+    m_EditorToolbar.SetOnReplaySave([this]()
+        {
+            m_GameViewportPanel.RequestReplaySave();
+        });
+
     m_EditorToolbar.SetExportPath(m_GameViewportPanel.GetExportPath());
 
     // Wire the hierarchy context menu into the layer so right-click creation routes through our helpers.
@@ -363,6 +373,7 @@ void ApplicationLayer::RenderSceneToolbar()
     l_ExportUiState.m_RawExtent = l_ExportStatus.m_RawExtent;
     l_ExportUiState.m_SanitizedExtent = l_ExportStatus.m_SanitizedExtent;
     l_ExportUiState.m_IsRecording = l_ExportStatus.m_IsRecording;
+    l_ExportUiState.m_IsReplayActive = l_ExportStatus.m_IsReplayActive;
     l_ExportUiState.m_RecordingProgress = l_ExportStatus.m_RecordingProgress;
     l_ExportUiState.m_OutputPath = l_ExportStatus.m_OutputPath;
     l_ExportUiState.m_StatusMessage = l_ExportStatus.m_StatusMessage;
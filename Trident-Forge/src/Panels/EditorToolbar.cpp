@@ -67,6 +67,8 @@ namespace EditorPanels
 
         RenderDatasetCaptureControls();
         RenderExportControls();
+        RenderReplayControls();
+        RenderRenderingControls();
 
         ImGui::End();
     }
@@ -160,6 +162,16 @@ namespace EditorPanels
         m_OnExportPathChanged = callback;
     }
 
+    void EditorToolbar::SetOnReplayToggle(const std::function<void(bool)>& callback)
+    {
+        m_OnReplayToggle = callback;
+    }
+
+    void EditorToolbar::SetOnReplaySave(const std::function<void()>& callback)
+    {
+        m_OnReplaySave = callback;
+    }
+
     void EditorToolbar::SetExportUiState(const ExportUiState& exportUiState)
     {
         m_ExportUiState = exportUiState;
@@ -258,10 +270,46 @@ namespace EditorPanels
             ImGui::TextWrapped("Viewport size is invalid for capture.");
         }
 
+        // When encoding falls behind, queued frames stop at the budget and the policy decides what gives.
+        using QueueOverflowPolicy = Trident::VideoEncoder::QueueOverflowPolicy;
+        int l_PolicyIndex = static_cast<int>(Trident::RenderCommand::GetRecordingQueuePolicy());
+        int l_BudgetMegabytes = static_cast<int>(Trident::RenderCommand::GetRecordingQueueBudget() / (1024 * 1024));
+        const char* l_PolicyItems[] = { "Block", "Drop oldest", "Drop newest", "Lower frame rate" };
+        bool l_QueueSettingsChanged = ImGui::Combo("Queue overflow", &l_PolicyIndex, l_PolicyItems, 4);
+        l_QueueSettingsChanged |= ImGui::SliderInt("Queue budget (MB)", &l_BudgetMegabytes, 16, 2048);
+        if (l_QueueSettingsChanged)
+        {
+            Trident::RenderCommand::SetRecordingQueuePolicy(static_cast<QueueOverflowPolicy>(l_PolicyIndex),
+                static_cast<size_t>(std::max(l_BudgetMegabytes, 1)) * 1024 * 1024);
+        }
+
+        // Extra encoders only help once the queue budget can hold more than one segment of frames.
+        int l_SegmentEncoders = static_cast<int>(Trident::RenderCommand::GetRecordingSegmentEncoders());
+        ImGui::BeginDisabled(m_ExportUiState.m_IsRecording);
+        if (ImGui::SliderInt("Segment encoders", &l_SegmentEncoders, 1, 8))
+        {
+            Trident::RenderCommand::SetRecordingSegmentEncoders(static_cast<uint32_t>(std::max(l_SegmentEncoders, 1)));
+        }
+        ImGui::EndDisabled();
+
         if (m_ExportUiState.m_IsRecording)
         {
             ImGui::TextWrapped("Exporting clip... %.0f%%", m_ExportUiState.m_RecordingProgress * 100.0f);
             ImGui::TextWrapped("Output: %s", m_ExportUiState.m_OutputPath.c_str());
+
+            const Trident::VideoEncoder::QueueStats l_QueueStats = Trident::RenderCommand::GetRecordingQueueStats();
+            ImGui::TextWrapped("Encoder queue: %zu frames, %.1f / %.0f MB", l_QueueStats.m_QueuedFrames,
+                static_cast<double>(l_QueueStats.m_QueuedBytes) / (1024.0 * 1024.0), static_cast<double>(l_QueueStats.m_BudgetBytes) / (1024.0 * 1024.0));
+            ImGui::TextWrapped("Encoded: %llu, dropped: %llu", static_cast<unsigned long long>(l_QueueStats.m_EncodedFrames),
+                static_cast<unsigned long long>(l_QueueStats.m_DroppedFrames));
+            ImGui::TextWrapped("Latency: %.1f ms avg, %.1f ms max, encode %.1f ms", l_QueueStats.m_AverageLatencyMs, l_QueueStats.m_MaxLatencyMs,
+                l_QueueStats.m_AverageEncodeMs);
+            ImGui::TextWrapped("Encode %.1f FPS / capture %.1f FPS (%u encoder%s)", l_QueueStats.m_EncodeFps, l_QueueStats.m_CaptureFps,
+                l_QueueStats.m_SegmentEncoders, (l_QueueStats.m_SegmentEncoders == 1) ? "" : "s");
+            if (l_QueueStats.m_FrameRateDivisor > 1)
+            {
+                ImGui::TextWrapped("Recording every %u frames to keep up.", l_QueueStats.m_FrameRateDivisor);
+            }
             if (RenderToolbarButton("Stop Export", true) && m_OnExportStop)
             {
                 m_OnExportStop();
@@ -282,6 +330,108 @@ namespace EditorPanels
         }
     }
 
+    void EditorToolbar::RenderReplayControls()
+    {
+        ImGui::Separator();
+        ImGui::TextWrapped("Instant Replay");
+
+        // The ring drops its oldest GOPs past the budget, so the budget sets how far back a save reaches.
+        int l_BudgetMegabytes = static_cast<int>(Trident::RenderCommand::GetReplayBudget() / (1024 * 1024));
+        if (ImGui::SliderInt("Replay budget (MB)", &l_BudgetMegabytes, 8, 512))
+        {
+            Trident::RenderCommand::SetReplayBudget(static_cast<size_t>(std::max(l_BudgetMegabytes, 1)) * 1024 * 1024);
+        }
+
+        bool l_ReplayActive = m_ExportUiState.m_IsReplayActive;
+        ImGui::BeginDisabled(m_ExportUiState.m_IsRecording);
+        if (ImGui::Checkbox("Keep replay buffer", &l_ReplayActive) && m_OnReplayToggle)
+        {
+            m_OnReplayToggle(l_ReplayActive);
+        }
+        ImGui::EndDisabled();
+
+        const Trident::ReplayBuffer::Stats l_ReplayStats = Trident::RenderCommand::GetReplayStats();
+        if (RenderToolbarButton("Save Replay", l_ReplayStats.m_BufferedPackets > 0 && !l_ReplayStats.m_Saving) && m_OnReplaySave)
+        {
+            m_OnReplaySave();
+        }
+
+        if (l_ReplayStats.m_BufferedPackets > 0)
+        {
+            ImGui::TextWrapped("Buffered: %.1f s, %.1f / %.0f MB%s", l_ReplayStats.m_BufferedSeconds,
+                static_cast<double>(l_ReplayStats.m_BufferedBytes) / (1024.0 * 1024.0), static_cast<double>(l_ReplayStats.m_BudgetBytes) / (1024.0 * 1024.0),
+                l_ReplayStats.m_Saving ? " (saving...)" : "");
+        }
+    }
+
+    void EditorToolbar::RenderRenderingControls()
+    {
+        ImGui::Separator();
+        ImGui::TextWrapped("Rendering");
+
+        // The bias scales the tolerated pixel error by 2^bias, so each step roughly doubles or halves LOD distances.
+        float l_LodBias = Trident::RenderCommand::GetLodBias();
+        if (ImGui::SliderFloat("LOD bias", &l_LodBias, -4.0f, 4.0f, "%.1f"))
+        {
+            Trident::RenderCommand::SetLodBias(l_LodBias);
+        }
+
+        ImGui::TextWrapped("Triangles saved by LOD: %zu / %zu", Trident::RenderCommand::GetLodTrianglesSaved(), Trident::RenderCommand::GetTriangleCount());
+
+        // Flip this off to measure raw triangle throughput against the culled path on the same scene.
+        bool l_ClusterCulling = Trident::RenderCommand::IsClusterCullingEnabled();
+        if (ImGui::Checkbox("Cluster culling", &l_ClusterCulling))
+        {
+            Trident::RenderCommand::SetClusterCullingEnabled(l_ClusterCulling);
+        }
+
+        bool l_OcclusionCulling = Trident::RenderCommand::IsOcclusionCullingEnabled();
+        if (ImGui::Checkbox("Occlusion culling", &l_OcclusionCulling))
+        {
+            Trident::RenderCommand::SetOcclusionCullingEnabled(l_OcclusionCulling);
+        }
+
+        const Trident::ClusterCuller::CullingStats l_CullingStats = Trident::RenderCommand::GetClusterCullingStats();
+        ImGui::TextWrapped("Clusters visible: %u / %u", l_CullingStats.m_VisibleClusters, l_CullingStats.m_SubmittedClusters);
+        ImGui::TextWrapped("Cluster triangles drawn: %llu / %llu", static_cast<unsigned long long>(l_CullingStats.m_VisibleTriangles),
+            static_cast<unsigned long long>(l_CullingStats.m_SubmittedTriangles));
+        ImGui::TextWrapped("Clusters occluded: %u (%llu triangles)", l_CullingStats.m_OccludedClusters,
+            static_cast<unsigned long long>(l_CullingStats.m_OccludedTriangles));
+
+        const Trident::SceneBuffer::UploadStats l_SceneStats = Trident::RenderCommand::GetSceneBufferStats();
+        ImGui::TextWrapped("Scene records uploaded: %u / %u (%u copies)", l_SceneStats.m_UploadedRecords, l_SceneStats.m_Instances, l_SceneStats.m_CopyRegions);
+
+        // Whole steps keep sampler rebuilds rare while dragging; each change recreates every material sampler.
+        int l_Anisotropy = static_cast<int>(Trident::RenderCommand::GetTextureAnisotropy());
+        if (ImGui::SliderInt("Texture anisotropy", &l_Anisotropy, 1, 16))
+        {
+            Trident::RenderCommand::SetTextureAnisotropy(static_cast<float>(l_Anisotropy));
+        }
+
+        // Only textures uploaded after the change are affected.
+        int l_MipDrop = static_cast<int>(Trident::RenderCommand::GetTextureMipDropCount());
+        if (ImGui::SliderInt("Dropped top mips", &l_MipDrop, 0, 4))
+        {
+            Trident::RenderCommand::SetTextureMipDropCount(static_cast<uint32_t>(l_MipDrop));
+        }
+
+        // Lowering the budget below the resident size shows eviction and mip dropping without needing a large scene.
+        constexpr uint64_t l_MiB = 1024ull * 1024ull;
+        int l_BudgetMiB = static_cast<int>(Trident::RenderCommand::GetTextureMemoryBudget() / l_MiB);
+        if (ImGui::SliderInt("Texture budget (MiB, 0 = auto)", &l_BudgetMiB, 0, 8192))
+        {
+            Trident::RenderCommand::SetTextureMemoryBudget(static_cast<uint64_t>(l_BudgetMiB) * l_MiB);
+        }
+
+        const Trident::Renderer::TextureResidencyStats l_Residency = Trident::RenderCommand::GetTextureResidencyStats();
+        ImGui::TextWrapped("Texture memory: %.1f / %.1f MiB%s (headroom %.1f MiB)", static_cast<double>(l_Residency.m_ResidentBytes) / l_MiB,
+            static_cast<double>(l_Residency.m_BudgetBytes) / l_MiB, l_Residency.m_DriverBudget ? " (driver limited)" : "",
+            static_cast<double>(l_Residency.m_HeadroomBytes) / l_MiB);
+        ImGui::TextWrapped("Textures resident: %u (%u reduced), evicted: %u", l_Residency.m_ResidentTextures, l_Residency.m_ReducedTextures,
+            l_Residency.m_EvictedTextures);
+        ImGui::TextWrapped("Evictions/s: %.1f, mip drops/s: %.1f", l_Residency.m_EvictionsPerSecond, l_Residency.m_MipDropsPerSecond);
+    }
+
     void EditorToolbar::UpdateDatasetDirectoryBuffer()
     {
         // Keep the directory buffer null terminated so ImGui input cannot overrun the storage.
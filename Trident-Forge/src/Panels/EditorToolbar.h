@@ -45,6 +45,8 @@ namespace EditorPanels
         void SetOnExportStart(const std::function<void()>& callback);
         void SetOnExportStop(const std::function<void()>& callback);
         void SetOnExportPathChanged(const std::function<void(const std::string&)>& callback);
+        void SetOnReplayToggle(const std::function<void(bool)>& callback);
+        void SetOnReplaySave(const std::function<void()>& callback);
 
         /**
          * @brief Mirrors the export state from the game viewport so the toolbar can surface export controls.
@@ -56,6 +58,7 @@ namespace EditorPanels
             VkExtent2D m_RawExtent{ 0U, 0U };
             VkExtent2D m_SanitizedExtent{ 0U, 0U };
             bool m_IsRecording = false;
+            bool m_IsReplayActive = false;
             float m_RecordingProgress = 0.0f;
             std::string m_OutputPath;
             std::string m_StatusMessage;
@@ -68,6 +71,8 @@ namespace EditorPanels
         bool RenderToolbarButton(const char* label, bool enabled);
         void RenderDatasetCaptureControls();
         void RenderExportControls();
+        void RenderReplayControls();
+        void RenderRenderingControls();
         void UpdateDatasetDirectoryBuffer();
 
     private:
@@ -88,6 +93,8 @@ namespace EditorPanels
         std::function<void()> m_OnExportStart;
         std::function<void()> m_OnExportStop;
         std::function<void(const std::string&)> m_OnExportPathChanged;
+        std::function<void(bool)> m_OnReplayToggle;
+        std::function<void()> m_OnReplaySave;
 
         ExportUiState m_ExportUiState{};
         std::array<char, 260> m_ExportPathBuffer{};
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <iomanip>
 #include <chrono>
+#include <ctime>
 #include <filesystem>
 #include <system_error>
 
@@ -35,6 +36,7 @@ namespace EditorPanels
 
         // Update State BEFORE submission to prevent "Use-After-Free" validation crash
         UpdateExportState();
+        UpdateReplayState();
 
         // Submit the texture (ImGui will scale it slightly if it's 1px larger than the window, which is fine)
         SubmitViewportTexture(l_Available);
@@ -70,7 +72,8 @@ namespace EditorPanels
         // underlying ImTextureID typedef. This keeps runtime output aligned with the renderer's descriptor ownership.
         if (l_TextureId != ImTextureID{ 0 } && viewportSize.x > 0.0f && viewportSize.y > 0.0f)
         {
-            ImGui::Image(l_TextureId, viewportSize, ImVec2(0, 0), ImVec2(1, 1));
+            const glm::vec2 l_TextureUV = Trident::RenderCommand::GetViewportTextureUV(m_ViewportInfo.ViewportID);
+            ImGui::Image(l_TextureId, viewportSize, ImVec2(0, 0), ImVec2(l_TextureUV.x, l_TextureUV.y));
         }
         else
         {
@@ -111,6 +114,7 @@ namespace EditorPanels
         l_Status.m_RawExtent = { static_cast<uint32_t>(m_ViewportInfo.Size.x), static_cast<uint32_t>(m_ViewportInfo.Size.y) };
         l_Status.m_SanitizedExtent = CalculateSanitizedExtent();
         l_Status.m_IsRecording = m_IsRecording;
+        l_Status.m_IsReplayActive = Trident::RenderCommand::IsViewportReplayActive();
         l_Status.m_RecordingProgress = m_RecordingProgress;
         l_Status.m_OutputPath = m_CurrentOutputPath;
         l_Status.m_StatusMessage = m_ExportStatusMessage;
@@ -144,6 +148,17 @@ namespace EditorPanels
         m_StopExportRequested = true;
     }
 
+    void GameViewportPanel::RequestReplayToggle(bool enabled)
+    {
+        m_ReplayToggleRequested = true;
+        m_ReplayEnableRequested = enabled;
+    }
+
+    void GameViewportPanel::RequestReplaySave()
+    {
+        m_ReplaySaveRequested = true;
+    }
+
     void GameViewportPanel::RenderFrameRateOverlay()
     {
         // Pull averaged frame timing data from the renderer so the runtime viewport can surface the current FPS.
@@ -279,6 +294,59 @@ namespace EditorPanels
         }
     }
 
+    void GameViewportPanel::UpdateReplayState()
+    {
+        if (m_ReplayToggleRequested)
+        {
+            m_ReplayToggleRequested = false;
+
+            const bool l_HasValidViewport = m_ViewportInfo.Size.x > 0.0f && m_ViewportInfo.Size.y > 0.0f;
+            if (m_ReplayEnableRequested && (!l_HasValidViewport || m_IsRecording))
+            {
+                m_ExportStatusMessage = m_IsRecording ? "Stop the clip export before starting the replay buffer." : "Viewport size is invalid for capture.";
+            }
+            else if (!Trident::RenderCommand::SetViewportReplayEnabled(m_ReplayEnableRequested, m_ViewportInfo.ViewportID, CalculateSanitizedExtent()))
+            {
+                m_ExportStatusMessage = "Replay buffer could not start. Verify swapchain and encoder readiness.";
+            }
+        }
+
+        if (m_ReplaySaveRequested)
+        {
+            m_ReplaySaveRequested = false;
+
+            // Replays land next to the clip export, named by the time they were saved.
+            std::filesystem::path l_ReplayDirectory = std::filesystem::path(m_CurrentOutputPath).parent_path();
+            if (l_ReplayDirectory.empty())
+            {
+                l_ReplayDirectory = std::filesystem::path("Assets/Export");
+            }
+
+            std::error_code l_DirectoryError{};
+            std::filesystem::create_directories(l_ReplayDirectory, l_DirectoryError);
+
+            const std::time_t l_Now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+            std::tm l_LocalTime{};
+#ifdef _WIN32
+            localtime_s(&l_LocalTime, &l_Now);
+#else
+            localtime_r(&l_Now, &l_LocalTime);
+#endif
+            std::ostringstream l_FileName{};
+            l_FileName << "Replay_" << std::put_time(&l_LocalTime, "%Y%m%d_%H%M%S") << ".mp4";
+            const std::filesystem::path l_ReplayPath = l_ReplayDirectory / l_FileName.str();
+
+            if (Trident::RenderCommand::SaveViewportReplay(l_ReplayPath))
+            {
+                m_ExportStatusMessage = "Saving replay to " + l_ReplayPath.string();
+            }
+            else
+            {
+                m_ExportStatusMessage = "Replay could not be saved. Is a save already running?";
+            }
+        }
+    }
+
     VkExtent2D GameViewportPanel::CalculateSanitizedExtent() const
     {
         // YUV420P/H.264 encoding requires even-sized planes. Round the viewport size up to the next even pixel so the
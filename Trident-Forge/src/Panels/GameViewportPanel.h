@@ -42,6 +42,7 @@ namespace EditorPanels
             VkExtent2D m_RawExtent{ 0U, 0U };
             VkExtent2D m_SanitizedExtent{ 0U, 0U };
             bool m_IsRecording = false;
+            bool m_IsReplayActive = false;
             float m_RecordingProgress = 0.0f;
             std::string m_OutputPath;
             std::string m_StatusMessage;
@@ -52,11 +53,14 @@ namespace EditorPanels
         [[nodiscard]] const std::string& GetExportPath() const;
         void RequestExportStart();
         void RequestExportStop();
+        void RequestReplayToggle(bool enabled);
+        void RequestReplaySave();
 
     private:
         void SubmitViewportTexture(const ImVec2& viewportSize);
         void RenderFrameRateOverlay();
         void UpdateExportState();
+        void UpdateReplayState();
         [[nodiscard]] VkExtent2D CalculateSanitizedExtent() const;
         float QueryClipDurationSeconds() const;
 
@@ -75,5 +79,8 @@ namespace EditorPanels
         bool m_StartExportRequested = false; // Flags a start request driven by the toolbar.
         bool m_StopExportRequested = false; // Flags a stop request driven by the toolbar.
         std::string m_ExportStatusMessage; // Surfaces the most recent export status to the toolbar.
+        bool m_ReplayToggleRequested = false; // Flags a replay buffer start or stop driven by the toolbar.
+        bool m_ReplayEnableRequested = false; // Requested replay buffer state when a toggle is pending.
+        bool m_ReplaySaveRequested = false; // Flags a replay save driven by the toolbar.
     };
 }
\ No newline at end of file
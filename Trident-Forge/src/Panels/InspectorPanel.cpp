@@ -9,6 +9,7 @@
 #include "ECS/Components/TextureComponent.h"
 #include "ECS/Components/AnimationComponent.h"
 #include "ECS/Components/ScriptComponent.h"
+#include "Renderer/RenderCommand.h"
 
 #include <imgui.h>
 #include <string>
@@ -263,6 +264,27 @@ namespace EditorPanels
                     ImGui::TextWrapped("Source: %s", l_Mesh.m_SourceAssetPath.c_str());
                     ImGui::TextWrapped("Mesh Index: %zu", l_Mesh.m_SourceMeshIndex);
                 }
+
+                // Edits go through the renderer so only this material's record is re-uploaded.
+                const std::vector<Trident::Geometry::Material>& l_Materials = Trident::RenderCommand::GetMaterials();
+                if (l_Mesh.m_MaterialIndex >= 0 && static_cast<size_t>(l_Mesh.m_MaterialIndex) < l_Materials.size())
+                {
+                    Trident::Geometry::Material l_Material = l_Materials[l_Mesh.m_MaterialIndex];
+                    ImGui::Separator();
+                    ImGui::TextWrapped("Material Index: %d", l_Mesh.m_MaterialIndex);
+
+                    bool l_MaterialChanged = false;
+                    l_MaterialChanged |= ImGui::ColorEdit4("Base Color", &l_Material.BaseColorFactor.x);
+                    l_MaterialChanged |= ImGui::SliderFloat("Metallic", &l_Material.MetallicFactor, 0.0f, 1.0f);
+                    l_MaterialChanged |= ImGui::SliderFloat("Roughness", &l_Material.RoughnessFactor, 0.0f, 1.0f);
+                    ImGui::Text("Texture Slots: base %d, metal/rough %d, normal %d", l_Material.BaseColorTextureSlot,
+                        l_Material.MetallicRoughnessTextureSlot, l_Material.NormalTextureSlot);
+
+                    if (l_MaterialChanged)
+                    {
+                        Trident::RenderCommand::SetMaterial(static_cast<size_t>(l_Mesh.m_MaterialIndex), l_Material);
+                    }
+                }
             }
         }
 
@@ -142,7 +142,9 @@ namespace EditorPanels
 
         if (l_TextureId != ImTextureID{ 0 } && viewportSize.x > 0.0f && viewportSize.y > 0.0f)
         {
-            ImGui::Image(l_TextureId, viewportSize, ImVec2(0, 0), ImVec2(1, 1));
+            // The render target is allocated in size buckets, so only the rendered corner of it is shown.
+            const glm::vec2 l_TextureUV = Trident::RenderCommand::GetViewportTextureUV(m_ViewportInfo.ViewportID);
+            ImGui::Image(l_TextureId, viewportSize, ImVec2(0, 0), ImVec2(l_TextureUV.x, l_TextureUV.y));
 
             // Cache the screen-space bounds of the image for ImGuizmo hit testing
             m_BoundsMin = ImGui::GetItemRectMin();
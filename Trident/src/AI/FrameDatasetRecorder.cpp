@@ -68,7 +68,8 @@ namespace Trident
             m_FrameCounter = 0;
         }
 
-        void FrameDatasetRecorder::RecordInputFrame(std::span<const float> frameData, VkExtent2D extent, uint32_t channelCount, std::span<const int64_t> tensorShape)
+        void FrameDatasetRecorder::RecordInputFrame(std::span<const float> frameData, VkExtent2D extent, uint32_t channelCount, std::span<const int64_t> tensorShape,
+            std::shared_ptr<const void> frameOwner)
         {
             if (!m_CaptureEnabled)
             {
@@ -114,7 +115,15 @@ namespace Trident
             l_Job.m_Index = l_Index;
             l_Job.m_TargetPath = l_InputPath;
             l_Job.m_MetadataPath = l_MetadataPath;
-            l_Job.m_Data.assign(frameData.begin(), frameData.end());
+            if (frameOwner)
+            {
+                l_Job.m_DataOwner = std::move(frameOwner);
+                l_Job.m_DataView = frameData;
+            }
+            else
+            {
+                l_Job.m_Data.assign(frameData.begin(), frameData.end());
+            }
             l_Job.m_Shape.assign(l_ShapeSpan.begin(), l_ShapeSpan.end());
             l_Job.m_Extent = extent;
             l_Job.m_ChannelCount = channelCount;
@@ -434,7 +443,12 @@ namespace Trident
         {
             if (job.m_Type == JobType::Input)
             {
-                if (!WriteNpyFile(job.m_TargetPath, job.m_Data, job.m_Shape))
+                const std::span<const float> l_Data = job.m_DataOwner ? job.m_DataView : std::span<const float>(job.m_Data);
+                const bool l_Written = WriteNpyFile(job.m_TargetPath, l_Data, job.m_Shape);
+                // Release shared readback memory as soon as it has been written out.
+                job.m_DataOwner.reset();
+                job.m_DataView = {};
+                if (!l_Written)
                 {
                     TR_CORE_ERROR("FrameDatasetRecorder failed to persist frame input '{}'", job.m_TargetPath.string());
                     return;
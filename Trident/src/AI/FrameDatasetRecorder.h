@@ -3,6 +3,7 @@
 #include <deque>
 #include <filesystem>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
@@ -63,8 +64,12 @@ namespace Trident
 
             /**
              * @brief Record the frame that is about to be submitted to the AI system.
+             *
+             * When frameOwner is supplied the writer reads frameData in place and holds the owner until the file is
+             * written; otherwise the tensor is copied.
              */
-            void RecordInputFrame(std::span<const float> frameData, VkExtent2D extent, uint32_t channelCount, std::span<const int64_t> tensorShape = {});
+            void RecordInputFrame(std::span<const float> frameData, VkExtent2D extent, uint32_t channelCount, std::span<const int64_t> tensorShape = {},
+                std::shared_ptr<const void> frameOwner = {});
 
             /**
              * @brief Record the AI output tensor that corresponds to the next pending frame capture.
@@ -85,6 +90,8 @@ namespace Trident
                 std::filesystem::path m_TargetPath{};                   // Destination file path for the NPY payload.
                 std::filesystem::path m_MetadataPath{};                 // Destination for the JSON metadata (input frames only).
                 std::vector<float> m_Data;                              // Copy of the tensor data so background threads own the memory.
+                std::shared_ptr<const void> m_DataOwner;                // Set instead of m_Data when the caller shares its memory.
+                std::span<const float> m_DataView;                      // Tensor data kept alive by m_DataOwner.
                 std::vector<int64_t> m_Shape;                           // Shape description accompanying the tensor.
                 VkExtent2D m_Extent{ 0, 0 };                            // Captured extent for metadata files.
                 uint32_t m_ChannelCount = 0;                            // Channel count for metadata files.
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <numeric>
 
 namespace Trident
@@ -26,6 +27,20 @@ namespace Trident
                 return modelPath.string();
             }
 
+            /**
+             * @brief Copy a tensor shape with the batch axis of rank-4 (NHWC) tensors set to the size actually run.
+             */
+            std::vector<int64_t> ResolveBatchShape(const std::vector<int64_t>& shape, uint32_t batchSize)
+            {
+                std::vector<int64_t> l_Shape = shape;
+                if (l_Shape.size() == 4)
+                {
+                    l_Shape[0] = static_cast<int64_t>(batchSize);
+                }
+
+                return l_Shape;
+            }
+
             /**
              * @brief Helper to calculate the flattened element count from a tensor shape.
              */
@@ -80,6 +95,9 @@ namespace Trident
 
                     return false;
                 }
+
+                // Tensors are bound to this session once per shape; holding it keeps the bindings valid across UnloadModel.
+                m_BoundSession = m_RuntimeContext->AcquireSession(m_ModelKey);
             }
             catch (const Ort::Exception& l_Exception)
             {
@@ -98,9 +116,13 @@ namespace Trident
 
             if (!m_InputBindings.empty())
             {
-                m_InputStagingBuffer.resize(m_InputBindings.front().m_ElementCount);
+                m_InputStagingBuffer.resize(m_InputBindings.front().m_FrameElementCount);
             }
 
+            if (m_InputBindings.front().m_BatchSize > 1)
+            {
+                TR_CORE_INFO("AI model '{}' runs fixed batches of {} frames; short batches are padded.", m_ModelKey, m_InputBindings.front().m_BatchSize);
+            }
 
             // The model metadata is ready, so spin up the background worker that will service inference jobs.
             m_WorkerShouldStop = false;
@@ -113,25 +135,12 @@ namespace Trident
 
         bool FrameGenerator::ProcessFrame(std::span<const float> frameData)
         {
-            if (!m_IsInitialised)
-            {
-                TR_CORE_WARN("AI frame generator was asked to process a frame before the model finished initialising.");
-                return false;
-            }
-
-            if (m_InputBindings.empty())
+            if (!CanAcceptFrame(frameData.size()))
             {
-                TR_CORE_WARN("The target model did not expose any input tensors. Skipping inference run for now.");
                 return false;
             }
 
             const TensorBinding& l_PrimaryInput = m_InputBindings.front();
-            if (l_PrimaryInput.m_ElementCount != frameData.size())
-            {
-                TR_CORE_WARN("Incoming frame tensor element count ({}) does not match the model requirement ({}).", frameData.size(), l_PrimaryInput.m_ElementCount);
-                return false;
-            }
-
             std::vector<float> l_StagingBuffer;
             {
                 // The staging buffer is shared with the worker thread through the pool, so guard it with the queue mutex.
@@ -147,9 +156,9 @@ namespace Trident
                 }
             }
 
-            if (l_StagingBuffer.size() != l_PrimaryInput.m_ElementCount)
+            if (l_StagingBuffer.size() != l_PrimaryInput.m_FrameElementCount)
             {
-                l_StagingBuffer.resize(l_PrimaryInput.m_ElementCount);
+                l_StagingBuffer.resize(l_PrimaryInput.m_FrameElementCount);
             }
 
             // Copy the frame into a reusable staging buffer so we do not allocate a new vector each frame.
@@ -157,12 +166,72 @@ namespace Trident
 
             FrameJob l_Job{};
             l_Job.m_InputTensor = std::move(l_StagingBuffer);
+            EnqueueJob(std::move(l_Job));
+
+            return true;
+        }
+
+        bool FrameGenerator::ProcessFrame(std::span<const float> frameData, std::shared_ptr<const void> frameOwner)
+        {
+            if (!frameOwner)
+            {
+                return ProcessFrame(frameData);
+            }
+
+            if (!CanAcceptFrame(frameData.size()))
+            {
+                return false;
+            }
+
+            // The runtime reads the caller's memory directly; the owner travels with the job so it outlives the Run call.
+            FrameJob l_Job{};
+            l_Job.m_InputOwner = std::move(frameOwner);
+            l_Job.m_InputView = frameData;
+            EnqueueJob(std::move(l_Job));
+
+            return true;
+        }
+
+        void FrameGenerator::Shutdown()
+        {
+            ResetState();
+        }
+
+        bool FrameGenerator::CanAcceptFrame(size_t elementCount) const
+        {
+            if (!m_IsInitialised)
+            {
+                TR_CORE_WARN("AI frame generator was asked to process a frame before the model finished initialising.");
+                return false;
+            }
+
+            if (m_InputBindings.empty())
+            {
+                TR_CORE_WARN("The target model did not expose any input tensors. Skipping inference run for now.");
+                return false;
+            }
 
+            const TensorBinding& l_PrimaryInput = m_InputBindings.front();
+            if (l_PrimaryInput.m_FrameElementCount != elementCount)
+            {
+                TR_CORE_WARN("Incoming frame tensor element count ({}) does not match the model requirement ({}).", elementCount, l_PrimaryInput.m_FrameElementCount);
+                return false;
+            }
+
+            return true;
+        }
+
+        void FrameGenerator::EnqueueJob(FrameJob job)
+        {
+            const size_t l_ElementCount = m_InputBindings.front().m_FrameElementCount;
+            // Only the copying path stages its next frame; shared frames never touch the staging buffer.
+            const bool l_Copied = !job.m_InputTensor.empty();
+            job.m_SubmitTime = std::chrono::steady_clock::now();
             {
                 std::scoped_lock l_Lock(m_QueueMutex);
-                m_PendingJobs.emplace_back(std::move(l_Job));
+                m_PendingJobs.emplace_back(std::move(job));
                 m_PendingJobCount = m_PendingJobs.size();
-                if (m_InputStagingBuffer.empty())
+                if (l_Copied && m_InputStagingBuffer.empty())
                 {
                     if (!m_InputBufferPool.empty())
                     {
@@ -171,13 +240,25 @@ namespace Trident
                     }
                     else
                     {
-                        m_InputStagingBuffer.resize(l_PrimaryInput.m_ElementCount);
+                        m_InputStagingBuffer.resize(l_ElementCount);
                     }
                 }
             }
             m_QueueCondition.notify_one();
+        }
 
-            return true;
+        void FrameGenerator::RecycleJobInput(FrameJob& job)
+        {
+            // Shared frames go back to their owner; copied frames return their buffer to the pool.
+            job.m_InputOwner.reset();
+            job.m_InputView = {};
+            if (job.m_InputTensor.empty())
+            {
+                return;
+            }
+
+            std::scoped_lock l_Lock(m_QueueMutex);
+            m_InputBufferPool.emplace_back(std::move(job.m_InputTensor));
         }
 
         std::vector<float> FrameGenerator::GetLastOutput() const
@@ -217,12 +298,12 @@ namespace Trident
         {
             std::scoped_lock l_Lock(m_OutputMutex);
 
-            if (m_CompletedInferenceCount == 0)
+            if (m_CompletedRunCount == 0)
             {
                 return 0.0;
             }
 
-            return m_TotalInferenceMilliseconds / static_cast<double>(m_CompletedInferenceCount);
+            return m_TotalInferenceMilliseconds / static_cast<double>(m_CompletedRunCount);
         }
 
         uint64_t FrameGenerator::GetCompletedInferenceCount() const
@@ -239,6 +320,62 @@ namespace Trident
             return m_PendingJobCount;
         }
 
+        void FrameGenerator::SetBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait)
+        {
+            {
+                std::scoped_lock l_Lock(m_QueueMutex);
+                m_MaxBatchSize = std::clamp(maxBatchSize, 1u, s_MaxBatchSize);
+                m_MaxBatchWait = std::max(maxWait, std::chrono::milliseconds{ 0 });
+            }
+
+            // A worker holding a partial batch re-evaluates against the new size and deadline.
+            m_QueueCondition.notify_all();
+        }
+
+        uint32_t FrameGenerator::GetMaxBatchSize() const
+        {
+            std::scoped_lock l_Lock(m_QueueMutex);
+
+            return m_MaxBatchSize;
+        }
+
+        FrameGenerator::InferenceStats FrameGenerator::GetInferenceStats() const
+        {
+            std::array<double, s_LatencySampleCount> l_Samples{};
+            size_t l_SampleCount = 0;
+            InferenceStats l_Stats{};
+            {
+                std::scoped_lock l_Lock(m_OutputMutex);
+                l_Stats.m_LastBatchSize = m_LastBatchSize;
+                if (m_CompletedRunCount > 0)
+                {
+                    l_Stats.m_AverageBatchSize = static_cast<double>(m_CompletedInferenceCount) / static_cast<double>(m_CompletedRunCount);
+                }
+
+                l_SampleCount = m_LatencySampleCount;
+                std::copy_n(m_LatencySamples.begin(), l_SampleCount, l_Samples.begin());
+            }
+
+            if (l_SampleCount == 0)
+            {
+                return l_Stats;
+            }
+
+            // Nearest-rank percentiles over the sampled window; sorting a few hundred doubles is cheap enough for a debug view.
+            std::sort(l_Samples.begin(), l_Samples.begin() + static_cast<std::ptrdiff_t>(l_SampleCount));
+            const auto a_Percentile = [&l_Samples, l_SampleCount](double percentile)
+                {
+                    const size_t l_Rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(l_SampleCount)));
+
+                    return l_Samples[std::clamp<size_t>(l_Rank, 1, l_SampleCount) - 1];
+                };
+            l_Stats.m_LatencyP50Milliseconds = a_Percentile(0.50);
+            l_Stats.m_LatencyP95Milliseconds = a_Percentile(0.95);
+            l_Stats.m_LatencyP99Milliseconds = a_Percentile(0.99);
+
+            return l_Stats;
+        }
+
         std::span<const int64_t> FrameGenerator::GetPrimaryInputShape() const
         {
             if (m_InputBindings.empty())
@@ -277,11 +414,7 @@ namespace Trident
                 Ort::TypeInfo l_TypeInfo = session.GetInputTypeInfo(it_Index);
                 const auto& a_TensorInfo = l_TypeInfo.GetTensorTypeAndShapeInfo();
 
-                TensorBinding l_Binding{};
-                l_Binding.m_Name = a_Name.get();
-                l_Binding.m_Shape = a_TensorInfo.GetShape();
-                l_Binding.m_ElementCount = CalculateElementCount(l_Binding.m_Shape);
-                m_InputBindings.emplace_back(std::move(l_Binding));
+                m_InputBindings.emplace_back(BuildTensorBinding(a_Name.get(), a_TensorInfo.GetShape()));
             }
 
             for (size_t it_Index = 0; it_Index < l_OutputCount; ++it_Index)
@@ -290,16 +423,36 @@ namespace Trident
                 Ort::TypeInfo l_TypeInfo = session.GetOutputTypeInfo(it_Index);
                 const auto& a_TensorInfo = l_TypeInfo.GetTensorTypeAndShapeInfo();
 
-                TensorBinding l_Binding{};
-                l_Binding.m_Name = a_Name.get();
-                l_Binding.m_Shape = a_TensorInfo.GetShape();
-                l_Binding.m_ElementCount = CalculateElementCount(l_Binding.m_Shape);
-                m_OutputBindings.emplace_back(std::move(l_Binding));
+                m_OutputBindings.emplace_back(BuildTensorBinding(a_Name.get(), a_TensorInfo.GetShape()));
             }
 
             return !m_InputBindings.empty() && !m_OutputBindings.empty();
         }
 
+        FrameGenerator::TensorBinding FrameGenerator::BuildTensorBinding(const char* name, std::vector<int64_t> shape)
+        {
+            TensorBinding l_Binding{};
+            l_Binding.m_Name = name;
+            l_Binding.m_Shape = std::move(shape);
+            l_Binding.m_ElementCount = CalculateElementCount(l_Binding.m_Shape);
+
+            // Rank-4 tensors follow the renderer's NHWC contract, so the leading axis is the batch.
+            if (l_Binding.m_Shape.size() == 4)
+            {
+                l_Binding.m_BatchSize = std::max<int64_t>(l_Binding.m_Shape.front(), 0);
+            }
+            l_Binding.m_FrameElementCount = l_Binding.m_ElementCount / static_cast<size_t>(std::max<int64_t>(l_Binding.m_BatchSize, 1));
+
+            const size_t l_FirstExtent = (l_Binding.m_Shape.size() == 4) ? 1 : 0;
+            l_Binding.m_HasDynamicExtent = std::any_of(l_Binding.m_Shape.begin() + static_cast<std::ptrdiff_t>(l_FirstExtent), l_Binding.m_Shape.end(),
+                [](int64_t dimension)
+                {
+                    return dimension <= 0;
+                });
+
+            return l_Binding;
+        }
+
         void FrameGenerator::ResetState()
         {
             // Tear down the asynchronous pipeline so a subsequent Initialise call starts from a clean slate.
@@ -331,8 +484,17 @@ namespace Trident
                 m_LastInferenceMilliseconds = 0.0;
                 m_TotalInferenceMilliseconds = 0.0;
                 m_CompletedInferenceCount = 0;
+                m_CompletedRunCount = 0;
+                m_LastBatchSize = 0;
+                m_LatencySampleCursor = 0;
+                m_LatencySampleCount = 0;
             }
 
+            // The batching settings carry over to the next model; the bound tensors belong to the old session and go with it.
+            ReleaseBindings();
+            m_BoundSession.reset();
+            m_FrameOutputs.clear();
+
             m_IsInitialised = false;
             m_InputBindings.clear();
             m_OutputBindings.clear();
@@ -341,11 +503,13 @@ namespace Trident
         void FrameGenerator::WorkerLoop()
         {
             const Ort::MemoryInfo l_CpuMemoryInfo = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+            std::vector<FrameJob> l_BatchJobs;
+            l_BatchJobs.reserve(s_MaxBatchSize);
 
             // Process frames submitted by the renderer until shutdown is requested.
             while (true)
             {
-                FrameJob l_Job{};
+                uint32_t l_RunBatchSize = 1;
                 {
                     std::unique_lock<std::mutex> l_Lock(m_QueueMutex);
                     m_QueueCondition.wait(l_Lock, [this]()
@@ -358,146 +522,332 @@ namespace Trident
                         break;
                     }
 
-                    l_Job = std::move(m_PendingJobs.front());
-                    m_PendingJobs.pop_front();
+                    l_RunBatchSize = ResolveRunBatchSize();
+                    if (l_RunBatchSize > 1)
+                    {
+                        // Trade latency for throughput: hold the run until the batch fills or the oldest frame has waited long enough.
+                        const std::chrono::steady_clock::time_point l_Deadline = m_PendingJobs.front().m_SubmitTime + m_MaxBatchWait;
+                        m_QueueCondition.wait_until(l_Lock, l_Deadline, [this, l_RunBatchSize]()
+                            {
+                                return m_WorkerShouldStop || m_PendingJobs.size() >= l_RunBatchSize;
+                            });
+
+                        if (m_WorkerShouldStop)
+                        {
+                            break;
+                        }
+                    }
+
+                    const size_t l_TakeCount = std::min<size_t>(l_RunBatchSize, m_PendingJobs.size());
+                    for (size_t it_Index = 0; it_Index < l_TakeCount; ++it_Index)
+                    {
+                        l_BatchJobs.emplace_back(std::move(m_PendingJobs.front()));
+                        m_PendingJobs.pop_front();
+                    }
                     m_PendingJobCount = m_PendingJobs.size();
                 }
 
-                if (l_Job.m_InputTensor.empty())
-                {
-                    continue;
-                }
+                // Dynamic batch axes run exactly the frames collected; fixed ones keep the model's size and pad the rest.
+                const TensorBinding& l_PrimaryInput = m_InputBindings.front();
+                const uint32_t l_PackedSize = (l_PrimaryInput.m_BatchSize > 0) ? l_RunBatchSize : static_cast<uint32_t>(l_BatchJobs.size());
+                RunBatch(l_BatchJobs, l_PackedSize, l_CpuMemoryInfo);
+                l_BatchJobs.clear();
+
+                // TODO: Investigate temporal accumulation and GPU buffer interop to further optimise the asynchronous path.
+            }
+        }
+
+        uint32_t FrameGenerator::ResolveRunBatchSize() const
+        {
+            // Called with m_QueueMutex held. Only NHWC inputs carry a batch axis the frames can be stacked along.
+            const TensorBinding& l_PrimaryInput = m_InputBindings.front();
+            if (l_PrimaryInput.m_Shape.size() != 4)
+            {
+                return 1;
+            }
+
+            if (l_PrimaryInput.m_BatchSize > 0)
+            {
+                return static_cast<uint32_t>(l_PrimaryInput.m_BatchSize);
+            }
+
+            return m_MaxBatchSize;
+        }
+
+        void FrameGenerator::RunBatch(std::vector<FrameJob>& jobs, uint32_t runBatchSize, const Ort::MemoryInfo& memoryInfo)
+        {
+            const TensorBinding& l_PrimaryInput = m_InputBindings.front();
+            const size_t l_FrameElements = l_PrimaryInput.m_FrameElementCount;
 
-                std::vector<float> l_CombinedOutput;
-                double l_RunMilliseconds = 0.0;
-                bool l_RecordedTiming = false;
+            const auto a_JobInput = [](const FrameJob& job)
+                {
+                    return job.m_InputOwner ? job.m_InputView : std::span<const float>(job.m_InputTensor);
+                };
 
-                try
+            const auto a_RecycleJobs = [this, &jobs]()
                 {
-                    std::vector<const char*> l_InputNames;
-                    l_InputNames.reserve(m_InputBindings.size());
-                    for (const TensorBinding& it_Binding : m_InputBindings)
+                    for (FrameJob& it_Job : jobs)
                     {
-                        l_InputNames.push_back(it_Binding.m_Name.c_str());
+                        RecycleJobInput(it_Job);
                     }
+                };
 
-                    std::vector<Ort::Value> l_InputTensors;
-                    l_InputTensors.reserve(m_InputBindings.size());
+            double l_RunMilliseconds = 0.0;
+            m_FrameOutputs.resize(jobs.size());
 
-                    // TODO: Extend this to support multi-input models when the engine begins to leverage them.
-                    // The input buffer must stay alive for the duration of the Run call, so it lives in l_Job until after inference finishes.
-                    Ort::Value l_FrameTensor = Ort::Value::CreateTensor<float>(l_CpuMemoryInfo, l_Job.m_InputTensor.data(), l_Job.m_InputTensor.size(),
-                        m_InputBindings.front().m_Shape.data(), m_InputBindings.front().m_Shape.size());
-                    l_InputTensors.emplace_back(std::move(l_FrameTensor));
+            try
+            {
+                PreparedBinding& l_Binding = PrepareBindings(runBatchSize, memoryInfo);
+
+                // TODO: Extend this to support multi-input models when the engine begins to leverage them.
+                // Bound inputs are only read, so wrapping shared readback memory in a non-const tensor is safe.
+                const float* l_InputData = nullptr;
+                const Ort::Value* l_InputTensor = nullptr;
+                if (jobs.size() == 1 && runBatchSize == 1)
+                {
+                    // A single frame is read in place: readback slots and pooled buffers keep their addresses, so each
+                    // maps to a tensor created the first time it is seen.
+                    const std::span<const float> l_Input = a_JobInput(jobs.front());
+                    if (l_Input.size() != l_FrameElements)
+                    {
+                        a_RecycleJobs();
+                        return;
+                    }
 
-                    std::vector<const char*> l_OutputNames;
-                    l_OutputNames.reserve(m_OutputBindings.size());
-                    for (const TensorBinding& it_Binding : m_OutputBindings)
+                    l_InputData = l_Input.data();
+                    l_InputTensor = &ResolveInputView(l_Input, l_Binding.m_InputShape, memoryInfo);
+                }
+                else
+                {
+                    float* l_BatchData = l_Binding.m_BatchInputTensor.GetTensorMutableData<float>();
+                    for (uint32_t it_Slot = 0; it_Slot < runBatchSize; ++it_Slot)
                     {
-                        l_OutputNames.push_back(it_Binding.m_Name.c_str());
+                        // Padding slots repeat the last frame; their outputs are discarded below.
+                        const std::span<const float> l_Frame = a_JobInput(jobs[std::min<size_t>(it_Slot, jobs.size() - 1)]);
+                        std::copy(l_Frame.begin(), l_Frame.end(), l_BatchData + static_cast<size_t>(it_Slot) * l_FrameElements);
                     }
 
+                    l_InputData = l_BatchData;
+                    l_InputTensor = &l_Binding.m_BatchInputTensor;
+                }
+
+                if (l_InputData != l_Binding.m_BoundInputData)
+                {
+                    l_Binding.m_IoBinding.BindInput(l_PrimaryInput.m_Name.c_str(), *l_InputTensor);
+                    l_Binding.m_BoundInputData = l_InputData;
+                }
+
+                size_t l_ExpectedOutputElementCount = 0;
+                for (const TensorBinding& it_Binding : m_OutputBindings)
+                {
+                    l_ExpectedOutputElementCount += it_Binding.m_FrameElementCount;
+                }
+
+                {
+                    // The output buffer pool is shared with the main thread, so always hold the output mutex.
+                    std::scoped_lock l_Lock(m_OutputMutex);
+                    for (std::vector<float>& it_Output : m_FrameOutputs)
                     {
-                        // The output buffer pool is shared with the main thread, so always hold the output mutex.
-                        std::scoped_lock l_Lock(m_OutputMutex);
-                        if (!m_OutputBufferPool.empty())
+                        if (m_OutputBufferPool.empty())
                         {
-                            l_CombinedOutput = std::move(m_OutputBufferPool.front());
-                            m_OutputBufferPool.pop_front();
+                            break;
                         }
-                    }
 
-                    l_CombinedOutput.clear();
-                    size_t l_ExpectedOutputElementCount = 0;
-                    for (const TensorBinding& it_Binding : m_OutputBindings)
-                    {
-                        l_ExpectedOutputElementCount += it_Binding.m_ElementCount;
+                        it_Output = std::move(m_OutputBufferPool.front());
+                        m_OutputBufferPool.pop_front();
                     }
+                }
 
+                for (std::vector<float>& it_Output : m_FrameOutputs)
+                {
+                    it_Output.clear();
                     if (l_ExpectedOutputElementCount > 0)
                     {
-                        l_CombinedOutput.reserve(l_ExpectedOutputElementCount);
+                        it_Output.reserve(l_ExpectedOutputElementCount);
                     }
+                }
+
+                // Capture the inference duration so the renderer can expose accurate timing data for debugging.
+                const auto l_RunStart = std::chrono::steady_clock::now();
+                m_RuntimeContext->RunWithBinding(*m_BoundSession, l_Binding.m_IoBinding);
+                const auto l_RunEnd = std::chrono::steady_clock::now();
+                l_RunMilliseconds = std::chrono::duration<double, std::milli>(l_RunEnd - l_RunStart).count();
 
-                    // Capture the inference duration so the renderer can expose accurate timing data for debugging.
-                    const auto l_RunStart = std::chrono::steady_clock::now();
-                    auto a_OutputTensors = m_RuntimeContext->Run(m_ModelKey, l_InputNames, l_InputTensors, l_OutputNames);
-                    const auto l_RunEnd = std::chrono::steady_clock::now();
-                    l_RunMilliseconds = std::chrono::duration<double, std::milli>(l_RunEnd - l_RunStart).count();
-                    l_RecordedTiming = true;
+                // Preallocated outputs were written in place; only dynamically sized ones come back as new values.
+                std::vector<Ort::Value> l_RuntimeOutputs;
+                if (!m_OutputsPreallocated)
+                {
+                    l_RuntimeOutputs = l_Binding.m_IoBinding.GetOutputValues();
+                }
+                const std::vector<Ort::Value>& l_Outputs = m_OutputsPreallocated ? l_Binding.m_OutputTensors : l_RuntimeOutputs;
 
-                    for (size_t it_Index = 0; it_Index < a_OutputTensors.size(); ++it_Index)
+                for (size_t it_Index = 0; it_Index < l_Outputs.size(); ++it_Index)
+                {
+                    const Ort::Value& l_Output = l_Outputs[it_Index];
+                    const size_t l_ElementCount = m_OutputsPreallocated ? l_Binding.m_OutputElementCounts[it_Index]
+                        : static_cast<size_t>(l_Output.GetTensorTypeAndShapeInfo().GetElementCount());
+                    const float* l_Data = l_Output.GetTensorData<float>();
+                    if (l_Data == nullptr)
                     {
-                        const Ort::Value& l_Output = a_OutputTensors[it_Index];
-                        const Ort::TensorTypeAndShapeInfo l_Info = l_Output.GetTensorTypeAndShapeInfo();
-                        const size_t l_ElementCount = static_cast<size_t>(l_Info.GetElementCount());
-                        const float* l_Data = l_Output.GetTensorData<float>();
-                        if (l_Data == nullptr)
-                        {
-                            TR_CORE_WARN("Output tensor {} did not contain any data.", it_Index);
-                            continue;
-                        }
+                        TR_CORE_WARN("Output tensor {} did not contain any data.", it_Index);
+                        continue;
+                    }
 
-                        const size_t l_WriteOffset = l_CombinedOutput.size();
-                        l_CombinedOutput.resize(l_WriteOffset + l_ElementCount);
-                        std::copy(l_Data, l_Data + l_ElementCount, l_CombinedOutput.begin() + static_cast<std::ptrdiff_t>(l_WriteOffset));
+                    // Every output is expected to share the input's leading batch axis; fan each frame's slice back out.
+                    if (l_ElementCount % runBatchSize != 0)
+                    {
+                        TR_CORE_WARN("Output tensor {} holds {} elements, which does not split across a batch of {}.", it_Index, l_ElementCount, runBatchSize);
+                        continue;
                     }
-                }
-                catch (const Ort::Exception& l_Exception)
-                {
-                    TR_CORE_ERROR("ONNX runtime rejected a frame submission: {}", l_Exception.what());
+
+                    const size_t l_SliceCount = l_ElementCount / runBatchSize;
+                    for (size_t it_Frame = 0; it_Frame < m_FrameOutputs.size(); ++it_Frame)
                     {
-                        std::scoped_lock l_Lock(m_QueueMutex);
-                        m_InputBufferPool.emplace_back(std::move(l_Job.m_InputTensor));
+                        const float* l_Slice = l_Data + it_Frame * l_SliceCount;
+                        m_FrameOutputs[it_Frame].insert(m_FrameOutputs[it_Frame].end(), l_Slice, l_Slice + l_SliceCount);
                     }
-                    continue;
                 }
-                catch (const std::exception& l_Exception)
+            }
+            catch (const Ort::Exception& l_Exception)
+            {
+                TR_CORE_ERROR("ONNX runtime rejected a frame submission: {}", l_Exception.what());
+                ReleaseBindings();
+                a_RecycleJobs();
+                return;
+            }
+            catch (const std::exception& l_Exception)
+            {
+                TR_CORE_ERROR("Unexpected failure during AI frame processing: {}", l_Exception.what());
+                ReleaseBindings();
+                a_RecycleJobs();
+                return;
+            }
+
+            // Return the inputs to their owners or the pool now that the runtime no longer reads from them.
+            a_RecycleJobs();
+
+            const std::chrono::steady_clock::time_point l_Completed = std::chrono::steady_clock::now();
+            {
+                // Output buffers live in the completed queue until consumers pull them, so the pool only holds unused buffers.
+                std::scoped_lock l_Lock(m_OutputMutex);
+                m_LastInferenceMilliseconds = l_RunMilliseconds;
+                if (m_FrameOutputs.empty() || m_FrameOutputs.front().empty())
                 {
-                    TR_CORE_ERROR("Unexpected failure during AI frame processing: {}", l_Exception.what());
+                    // Recycle the output buffers because no results were produced.
+                    for (std::vector<float>& it_Output : m_FrameOutputs)
                     {
-                        std::scoped_lock l_Lock(m_QueueMutex);
-                        m_InputBufferPool.emplace_back(std::move(l_Job.m_InputTensor));
+                        m_OutputBufferPool.emplace_back(std::move(it_Output));
                     }
-                    continue;
+
+                    return;
                 }
 
+                m_TotalInferenceMilliseconds += l_RunMilliseconds;
+                ++m_CompletedRunCount;
+                m_LastBatchSize = static_cast<uint32_t>(jobs.size());
+                for (size_t it_Frame = 0; it_Frame < m_FrameOutputs.size(); ++it_Frame)
                 {
-                    // Return the input buffer to the pool now that the runtime no longer reads from it.
-                    std::scoped_lock l_Lock(m_QueueMutex);
-                    m_InputBufferPool.emplace_back(std::move(l_Job.m_InputTensor));
+                    RecordFrameLatency(std::chrono::duration<double, std::milli>(l_Completed - jobs[it_Frame].m_SubmitTime).count());
+                    m_CompletedOutputs.emplace_back(std::move(m_FrameOutputs[it_Frame]));
+                    ++m_CompletedInferenceCount;
                 }
+                m_LastOutputTensor = m_CompletedOutputs.back();
+            }
+        }
+
+        FrameGenerator::PreparedBinding& FrameGenerator::PrepareBindings(uint32_t runBatchSize, const Ort::MemoryInfo& memoryInfo)
+        {
+            auto a_Existing = m_PreparedBindings.find(runBatchSize);
+            if (a_Existing != m_PreparedBindings.end())
+            {
+                return a_Existing->second;
+            }
+
+            // Shapes only change with the batch size or a new model, so each size gets its own binding and tensors the
+            // first time it runs, and a partial batch never disturbs the binding of a full one.
+            PreparedBinding l_Binding{};
+            l_Binding.m_IoBinding = Ort::IoBinding(*m_BoundSession);
 
-                if (l_CombinedOutput.empty())
+            // The runtime's CPU allocator hands out 64-byte aligned blocks, which the packing copy and the kernels both like.
+            Ort::AllocatorWithDefaultOptions l_Allocator;
+            l_Binding.m_InputShape = ResolveBatchShape(m_InputBindings.front().m_Shape, runBatchSize);
+            if (runBatchSize > 1)
+            {
+                l_Binding.m_BatchInputTensor = Ort::Value::CreateTensor<float>(l_Allocator, l_Binding.m_InputShape.data(), l_Binding.m_InputShape.size());
+            }
+
+            m_OutputsPreallocated = std::none_of(m_OutputBindings.begin(), m_OutputBindings.end(), [](const TensorBinding& binding)
                 {
-                    if (l_RecordedTiming)
-                    {
-                        std::scoped_lock l_Lock(m_OutputMutex);
-                        m_LastInferenceMilliseconds = l_RunMilliseconds;
-                    }
+                    return binding.m_HasDynamicExtent;
+                });
 
-                    // Recycle the output buffer because no results were produced.
-                    std::scoped_lock l_Lock(m_OutputMutex);
-                    m_OutputBufferPool.emplace_back(std::move(l_CombinedOutput));
-                    continue;
+            for (const TensorBinding& it_Binding : m_OutputBindings)
+            {
+                if (m_OutputsPreallocated)
+                {
+                    const std::vector<int64_t> l_Shape = ResolveBatchShape(it_Binding.m_Shape, runBatchSize);
+                    l_Binding.m_OutputTensors.emplace_back(Ort::Value::CreateTensor<float>(l_Allocator, l_Shape.data(), l_Shape.size()));
+                    l_Binding.m_OutputElementCounts.push_back(CalculateElementCount(l_Shape));
+                    l_Binding.m_IoBinding.BindOutput(it_Binding.m_Name.c_str(), l_Binding.m_OutputTensors.back());
+                }
+                else
+                {
+                    // Outputs whose extents depend on the data cannot be sized up front, so the runtime allocates them per run.
+                    l_Binding.m_IoBinding.BindOutput(it_Binding.m_Name.c_str(), memoryInfo);
                 }
+            }
+
+            return m_PreparedBindings.emplace(runBatchSize, std::move(l_Binding)).first->second;
+        }
 
-                std::vector<float> l_FinalOutput = std::move(l_CombinedOutput);
+        void FrameGenerator::ReleaseBindings()
+        {
+            for (auto& it_Entry : m_PreparedBindings)
+            {
+                it_Entry.second.m_IoBinding.ClearBoundInputs();
+                it_Entry.second.m_IoBinding.ClearBoundOutputs();
+            }
+
+            m_PreparedBindings.clear();
+            m_InputViews.clear();
+            m_NextInputView = 0;
+        }
+
+        const Ort::Value& FrameGenerator::ResolveInputView(std::span<const float> input, const std::vector<int64_t>& shape, const Ort::MemoryInfo& memoryInfo)
+        {
+            for (const BoundInputView& it_View : m_InputViews)
+            {
+                if (it_View.m_Data == input.data())
                 {
-                    // Output buffers live in the completed queue until consumers pull them, so the pool only holds unused buffers.
-                    std::scoped_lock l_Lock(m_OutputMutex);
-                    m_LastOutputTensor = l_FinalOutput;
-                    m_CompletedOutputs.emplace_back(std::move(l_FinalOutput));
-                    if (l_RecordedTiming)
-                    {
-                        m_LastInferenceMilliseconds = l_RunMilliseconds;
-                        m_TotalInferenceMilliseconds += l_RunMilliseconds;
-                        ++m_CompletedInferenceCount;
-                    }
+                    return it_View.m_Tensor;
                 }
+            }
+
+            BoundInputView l_View{};
+            l_View.m_Data = input.data();
+            l_View.m_Tensor = Ort::Value::CreateTensor<float>(memoryInfo, const_cast<float*>(input.data()), input.size(), shape.data(), shape.size());
 
-                // TODO: Investigate temporal accumulation, adaptive batching, and GPU buffer interop to further optimise the asynchronous path.
+            // The readback ring and the input pool are small, so once they are all cached no new tensors are created.
+            if (m_InputViews.size() < s_MaxInputViews)
+            {
+                m_InputViews.emplace_back(std::move(l_View));
+
+                return m_InputViews.back().m_Tensor;
             }
+
+            BoundInputView& l_Slot = m_InputViews[m_NextInputView];
+            m_NextInputView = (m_NextInputView + 1) % s_MaxInputViews;
+            l_Slot = std::move(l_View);
+
+            return l_Slot.m_Tensor;
+        }
+
+        void FrameGenerator::RecordFrameLatency(double latencyMilliseconds)
+        {
+            // Called with m_OutputMutex held.
+            m_LatencySamples[m_LatencySampleCursor] = latencyMilliseconds;
+            m_LatencySampleCursor = (m_LatencySampleCursor + 1) % s_LatencySampleCount;
+            m_LatencySampleCount = std::min(m_LatencySampleCount + 1, s_LatencySampleCount);
         }
     }
 }
\ No newline at end of file
@@ -3,9 +3,13 @@
 #include "AI/OnnxRuntimeContext.h"
 
 #include <filesystem>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <condition_variable>
 #include <deque>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <string>
@@ -24,12 +28,24 @@ namespace Trident
          * (for example to drive interpolation or denoising passes). This class centralises the wiring to
          * the ONNX runtime so the main rendering loop can stay focused on GPU work. By caching tensor
          * metadata during initialisation we avoid redundant queries every frame and keep the per-frame
-         * hot path lightweight. Future improvements could extend the helper with batching or asynchronous
-         * execution once the engine grows more demanding AI workloads.
+         * hot path lightweight. Inference runs asynchronously on a worker thread, which can optionally pack
+         * several queued frames into one batched run when throughput matters more than latency.
          */
         class FrameGenerator
         {
         public:
+            /**
+             * @brief Snapshot of batching and per-frame latency, sampled over the most recent frames.
+             */
+            struct InferenceStats
+            {
+                uint32_t m_LastBatchSize = 0;        // Frames packed into the most recent run, padding excluded.
+                double m_AverageBatchSize = 0.0;     // Frames per run since initialisation.
+                double m_LatencyP50Milliseconds = 0.0; // Submit to output ready, per frame.
+                double m_LatencyP95Milliseconds = 0.0;
+                double m_LatencyP99Milliseconds = 0.0;
+            };
+
             FrameGenerator();
             ~FrameGenerator();
 
@@ -54,6 +70,20 @@ namespace Trident
              */
             bool ProcessFrame(std::span<const float> frameData);
 
+            /**
+             * @brief Enqueue a frame the worker reads in place instead of copying.
+             *
+             * @param frameData Input tensor representing the rendered frame.
+             * @param frameOwner Keeps frameData valid; held until inference on it finishes or the job is dropped.
+             * @return true when the job was accepted by the queue.
+             */
+            bool ProcessFrame(std::span<const float> frameData, std::shared_ptr<const void> frameOwner);
+
+            /**
+             * @brief Stop the worker and drop queued frames, releasing any memory they share with the caller.
+             */
+            void Shutdown();
+
             /**
              * @brief Attempt to retrieve the most recent output tensor produced by the worker thread.
              *
@@ -101,6 +131,23 @@ namespace Trident
              */
             size_t GetPendingJobCount() const;
 
+            /**
+             * @brief Let the worker pack up to maxBatchSize queued frames into a single run.
+             *
+             * The worker starts a run once the batch is full or the oldest queued frame has waited maxWait. Only
+             * rank-4 (NHWC) inputs have a batch axis: a dynamic batch runs however many frames were collected, a
+             * fixed batch always runs at the model's size and pads short batches with the last frame. Bindings are
+             * kept per batch size, so a size seen before reuses its tensors. A size of one keeps the default
+             * one-frame-per-run path. Kept across Initialise calls.
+             */
+            void SetBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait);
+            uint32_t GetMaxBatchSize() const;
+
+            /**
+             * @brief Report batch sizes and per-frame latency percentiles for debugging tools.
+             */
+            InferenceStats GetInferenceStats() const;
+
         private:
             /**
              * @brief Lightweight job object used by the background worker when dispatching inference.
@@ -108,6 +155,9 @@ namespace Trident
             struct FrameJob
             {
                 std::vector<float> m_InputTensor; // Flattened tensor data copied from the renderer readback.
+                std::shared_ptr<const void> m_InputOwner; // Set instead of m_InputTensor when the renderer shares its readback.
+                std::span<const float> m_InputView;       // Tensor data kept alive by m_InputOwner.
+                std::chrono::steady_clock::time_point m_SubmitTime{}; // Start of the per-frame latency and the batch wait.
             };
 
             struct TensorBinding
@@ -115,11 +165,50 @@ namespace Trident
                 std::string m_Name{};                // Graph binding name used during inference runs.
                 std::vector<int64_t> m_Shape{};      // Cached tensor shape describing the expected dimensions.
                 size_t m_ElementCount = 0;           // Flattened element count derived from the shape for validation.
+                int64_t m_BatchSize = 1;             // Leading dimension of rank-4 tensors; 0 when dynamic.
+                size_t m_FrameElementCount = 0;      // Elements of a single frame, i.e. m_ElementCount without the batch.
+                bool m_HasDynamicExtent = false;     // A non-batch dimension is only known at run time.
+            };
+
+            /**
+             * @brief Input tensor wrapping caller memory, kept so each readback slot or pooled buffer is wrapped only once.
+             */
+            struct BoundInputView
+            {
+                const float* m_Data = nullptr;
+                Ort::Value m_Tensor{ nullptr };
+            };
+
+            /**
+             * @brief IoBinding and tensors sized for one batch size, built the first time a run of that size is made.
+             */
+            struct PreparedBinding
+            {
+                Ort::IoBinding m_IoBinding{ nullptr };
+                std::vector<int64_t> m_InputShape;                  // Primary input shape with the batch dimension resolved.
+                Ort::Value m_BatchInputTensor{ nullptr };           // Runtime-allocated input the frames of a batch are packed into.
+                const float* m_BoundInputData = nullptr;            // Address of the input currently bound, so unchanged inputs skip rebinding.
+                std::vector<Ort::Value> m_OutputTensors;            // Preallocated outputs the runtime writes into on every run.
+                std::vector<size_t> m_OutputElementCounts;
             };
 
             bool CacheModelBindings(const Ort::Session& session);
+            static TensorBinding BuildTensorBinding(const char* name, std::vector<int64_t> shape);
+            bool CanAcceptFrame(size_t elementCount) const;
+            void EnqueueJob(FrameJob job);
+            void RecycleJobInput(FrameJob& job);
             void ResetState();
             void WorkerLoop();
+            uint32_t ResolveRunBatchSize() const;
+            void RunBatch(std::vector<FrameJob>& jobs, uint32_t runBatchSize, const Ort::MemoryInfo& memoryInfo);
+            PreparedBinding& PrepareBindings(uint32_t runBatchSize, const Ort::MemoryInfo& memoryInfo);
+            void ReleaseBindings();
+            const Ort::Value& ResolveInputView(std::span<const float> input, const std::vector<int64_t>& shape, const Ort::MemoryInfo& memoryInfo);
+            void RecordFrameLatency(double latencyMilliseconds);
+
+            static constexpr uint32_t s_MaxBatchSize = 64;
+            static constexpr size_t s_LatencySampleCount = 256;
+            static constexpr size_t s_MaxInputViews = 16;   // Covers the readback ring plus the pooled copies of frames.
 
         private:
             std::string m_ModelKey{};                                   // Identifier supplied to OnnxRuntimeContext.
@@ -141,7 +230,22 @@ namespace Trident
             double m_LastInferenceMilliseconds = 0.0;                    // Timing for the most recent inference run measured in milliseconds.
             double m_TotalInferenceMilliseconds = 0.0;                   // Accumulated duration of all completed inference runs.
             uint64_t m_CompletedInferenceCount = 0;                      // Number of jobs that produced an output tensor.
+            uint64_t m_CompletedRunCount = 0;                            // Run calls behind those jobs; the timing average is per run.
             size_t m_PendingJobCount = 0;                                // Cached size of the pending job queue for quick inspection.
+            uint32_t m_MaxBatchSize = 1;                                 // Requested batch size, guarded by m_QueueMutex.
+            std::chrono::milliseconds m_MaxBatchWait{ 0 };               // Longest a queued frame waits for its batch to fill.
+
+            // Worker-owned IoBinding state. Tensors are created the first time a batch size runs, so steady-state runs allocate nothing.
+            std::shared_ptr<Ort::Session> m_BoundSession;                // Session the bindings below were created against.
+            std::map<uint32_t, PreparedBinding> m_PreparedBindings;      // Keyed by run batch size, so at most s_MaxBatchSize entries.
+            std::vector<BoundInputView> m_InputViews;                    // Single-frame inputs wrapped in place, looked up by address.
+            size_t m_NextInputView = 0;                                  // Round-robin slot replaced once m_InputViews is full.
+            bool m_OutputsPreallocated = false;                          // False when an output has data-dependent extents.
+            std::vector<std::vector<float>> m_FrameOutputs;              // Per-frame results of the current run, reused across runs.
+            uint32_t m_LastBatchSize = 0;                                // Output-mutex guarded batching statistics.
+            std::array<double, s_LatencySampleCount> m_LatencySamples{}; // Ring of recent per-frame latencies.
+            size_t m_LatencySampleCursor = 0;
+            size_t m_LatencySampleCount = 0;
         };
     }
 }
\ No newline at end of file
@@ -270,6 +270,26 @@ namespace Trident
             return a_OutputTensors;
         }
 
+        std::shared_ptr<Ort::Session> OnnxRuntimeContext::AcquireSession(std::string_view modelName)
+        {
+            const std::string l_Key{ modelName };
+
+            std::scoped_lock l_Lock{ m_SessionMutex };
+            const auto l_It = m_Sessions.find(l_Key);
+            if (l_It == m_Sessions.end())
+            {
+                throw std::runtime_error("Requested model has not been loaded");
+            }
+
+            return l_It->second;
+        }
+
+        void OnnxRuntimeContext::RunWithBinding(Ort::Session& session, const Ort::IoBinding& binding) const
+        {
+            // Outputs land in whatever the binding holds, so the run itself neither allocates tensors nor copies names.
+            session.Run(Ort::RunOptions{ nullptr }, binding);
+        }
+
         Ort::Value OnnxRuntimeContext::CreateTensorFloat(std::span<const float> values, std::span<const int64_t> shape) const
         {
             // Copy the incoming data into a runtime-managed buffer. Later we can optimise this by allowing callers to supply their own allocator or use OrtValue::CreateTensor with
@@ -79,6 +79,19 @@ namespace Trident
             std::vector<Ort::Value> Run(std::string_view modelName, std::span<const char* const> inputNames, std::span<const Ort::Value> inputs,
                 std::span<const char* const> outputNames);
 
+            /**
+             * Fetch the shared session behind a loaded model so callers can bind
+             * persistent tensors to it with Ort::IoBinding. The returned pointer
+             * keeps the session alive even if the model is unloaded meanwhile.
+             */
+            std::shared_ptr<Ort::Session> AcquireSession(std::string_view modelName);
+
+            /**
+             * Execute an inference run against inputs and outputs bound up
+             * front. Unlike Run, no tensors or name arrays are created per call.
+             */
+            void RunWithBinding(Ort::Session& session, const Ort::IoBinding& binding) const;
+
             /**
              * Helper to allocate a CPU-backed tensor that feeds directly into a
              * model. More overloads can be introduced later as we support more
@@ -170,7 +170,7 @@ namespace Trident
 
         m_HasShutdown = true;
 
-        vkDeviceWaitIdle(Startup::GetDevice());
+        Startup::WaitForDeviceIdle("application shutdown");
 
         // Ask the active layer to release its resources while the renderer context is still valid.
         if (m_ActiveLayer)
@@ -3,6 +3,8 @@
 #include "Core/Utilities.h"
 #include "Window/Window.h"
 
+#include <algorithm>
+#include <cstring>
 #include <set>
 #include <stdexcept>
 #include <GLFW/glfw3.h>
@@ -10,6 +12,7 @@
 namespace Trident
 {
     Startup* Startup::s_Instance = nullptr;
+    std::atomic<uint64_t> Startup::s_DeviceIdleCount{ 0 };
 
     Startup::Startup(Window& window) : m_Window(window)
     {
@@ -52,7 +55,10 @@ namespace Trident
     {
         TR_CORE_TRACE("Shutting down Vulkan");
 
-        vkDeviceWaitIdle(m_Device);
+        if (m_Device != VK_NULL_HANDLE)
+        {
+            WaitForDeviceIdle("device shutdown");
+        }
 
         if (m_Surface != VK_NULL_HANDLE)
         {
@@ -243,6 +249,14 @@ namespace Trident
         }
     }
 
+    void Startup::WaitForDeviceIdle(const char* reason)
+    {
+        const uint64_t l_Count = s_DeviceIdleCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        TR_CORE_TRACE("Waiting for device idle ({}, #{})", reason, l_Count);
+
+        vkDeviceWaitIdle(Get().m_Device);
+    }
+
     void Startup::PickPhysicalDevice()
     {
         TR_CORE_TRACE("Selecting Physical Device (GPU)");
@@ -313,7 +327,8 @@ namespace Trident
 
             return;
         }
-        std::set<uint32_t> l_UniqueFamilies = { a_QueueFamily.GraphicsFamily.value(), a_QueueFamily.PresentFamily.value() };
+        const uint32_t l_TransferFamily = a_QueueFamily.TransferFamily.value_or(a_QueueFamily.GraphicsFamily.value());
+        std::set<uint32_t> l_UniqueFamilies = { a_QueueFamily.GraphicsFamily.value(), a_QueueFamily.PresentFamily.value(), l_TransferFamily };
 
         float l_Priority = 1.0f;
         std::vector<VkDeviceQueueCreateInfo> l_QueueCreateInfo;
@@ -354,6 +369,43 @@ namespace Trident
         m_TimelineSemaphoreSupported = l_AvailableVulkan12Features.timelineSemaphore == VK_TRUE;
         l_EnabledVulkan12Features.timelineSemaphore = m_TimelineSemaphoreSupported ? VK_TRUE : VK_FALSE;
 
+        // Bindless material textures: slots are written individually (partially bound), may change while a set is bound in a
+        // command buffer that has not been submitted yet (update-after-bind), and sets only allocate the slots they need.
+        const bool l_BindlessSupported = l_AvailableVulkan12Features.descriptorBindingPartiallyBound == VK_TRUE
+            && l_AvailableVulkan12Features.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE
+            && l_AvailableVulkan12Features.descriptorBindingVariableDescriptorCount == VK_TRUE;
+        if (l_BindlessSupported)
+        {
+            l_EnabledVulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+            l_EnabledVulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            l_EnabledVulkan12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;
+
+            VkPhysicalDeviceVulkan12Properties l_Vulkan12Properties{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES };
+            VkPhysicalDeviceProperties2 l_Properties2{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2 };
+            l_Properties2.pNext = &l_Vulkan12Properties;
+            vkGetPhysicalDeviceProperties2(m_PhysicalDevice, &l_Properties2);
+
+            // The skybox, AI blend and any future fragment samplers in the same layout count against the same limits.
+            constexpr uint32_t l_ReservedSamplers = 8;
+            const uint32_t l_Limit = std::min({ l_Vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers,
+                l_Vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages, l_Vulkan12Properties.maxDescriptorSetUpdateAfterBindSamplers,
+                l_Vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages, l_Vulkan12Properties.maxPerStageUpdateAfterBindResources });
+            m_BindlessTextureLimit = l_Limit > l_ReservedSamplers ? l_Limit - l_ReservedSamplers : 0;
+            m_UpdateAfterBindDescriptorLimit = l_Vulkan12Properties.maxUpdateAfterBindDescriptorsInAllPools;
+        }
+
+        // Cluster culling issues one indirect draw per surviving meshlet; batching them needs multiDrawIndirect.
+        m_MultiDrawIndirectSupported = l_Features2.features.multiDrawIndirect == VK_TRUE;
+        l_Features.multiDrawIndirect = m_MultiDrawIndirectSupported ? VK_TRUE : VK_FALSE;
+
+        // Material samplers use anisotropic filtering for grazing-angle surfaces when the device allows it.
+        m_SamplerAnisotropySupported = l_Features2.features.samplerAnisotropy == VK_TRUE;
+        l_Features.samplerAnisotropy = m_SamplerAnisotropySupported ? VK_TRUE : VK_FALSE;
+
+        // Cooked KTX2 textures transcode to BC7/BC1 when sampled BC formats are available, otherwise to RGBA8.
+        m_TextureCompressionBCSupported = l_Features2.features.textureCompressionBC == VK_TRUE;
+        l_Features.textureCompressionBC = m_TextureCompressionBCSupported ? VK_TRUE : VK_FALSE;
+
         VkDeviceCreateInfo l_DeviceCreateInfo{};
 
         l_DeviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -361,9 +413,24 @@ namespace Trident
         l_DeviceCreateInfo.pQueueCreateInfos = l_QueueCreateInfo.data();
         l_DeviceCreateInfo.pEnabledFeatures = &l_Features;
         l_DeviceCreateInfo.pNext = &l_EnabledVulkan12Features;
-        const char* l_Extensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-        l_DeviceCreateInfo.enabledExtensionCount = 1;
-        l_DeviceCreateInfo.ppEnabledExtensionNames = l_Extensions;
+
+        // VK_EXT_memory_budget lets the texture residency manager size its budget from what the driver actually has free.
+        uint32_t l_AvailableExtensionCount = 0;
+        vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &l_AvailableExtensionCount, nullptr);
+        std::vector<VkExtensionProperties> l_AvailableExtensions(l_AvailableExtensionCount);
+        vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &l_AvailableExtensionCount, l_AvailableExtensions.data());
+        m_MemoryBudgetSupported = std::any_of(l_AvailableExtensions.begin(), l_AvailableExtensions.end(), [](const VkExtensionProperties& extension)
+            {
+                return std::strcmp(extension.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0;
+            });
+
+        std::vector<const char*> l_Extensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+        if (m_MemoryBudgetSupported)
+        {
+            l_Extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+        l_DeviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(l_Extensions.size());
+        l_DeviceCreateInfo.ppEnabledExtensionNames = l_Extensions.data();
 
         if (vkCreateDevice(m_PhysicalDevice, &l_DeviceCreateInfo, nullptr, &m_Device) != VK_SUCCESS)
         {
@@ -372,8 +439,10 @@ namespace Trident
 
         vkGetDeviceQueue(m_Device, *a_QueueFamily.GraphicsFamily, 0, &m_GraphicsQueue);
         vkGetDeviceQueue(m_Device, *a_QueueFamily.PresentFamily, 0, &m_PresentQueue);
+        vkGetDeviceQueue(m_Device, l_TransferFamily, 0, &m_TransferQueue);
 
-        TR_CORE_TRACE("Logical Device And Queues ready (GFX = {}, Present = {})", *a_QueueFamily.GraphicsFamily, *a_QueueFamily.PresentFamily);
+        TR_CORE_TRACE("Logical Device And Queues ready (GFX = {}, Present = {}, Transfer = {})", *a_QueueFamily.GraphicsFamily, *a_QueueFamily.PresentFamily,
+            l_TransferFamily);
     }
 
     //----------------------------------------------------------------------------------------------------------------------------------------------------------//
@@ -417,6 +486,25 @@ namespace Trident
             }
         }
 
+        // Texture streaming prefers a family that only does transfers (usually a DMA engine) so uploads overlap rendering.
+        for (uint32_t i = 0; i < l_Count; ++i)
+        {
+            // Mip tails are smaller than any coarse copy granularity, so only families that copy texel-exact regions qualify.
+            const VkQueueFlags l_Flags = l_Families[i].queueFlags;
+            const VkExtent3D l_Granularity = l_Families[i].minImageTransferGranularity;
+            const bool l_TexelGranularity = l_Granularity.width == 1 && l_Granularity.height == 1 && l_Granularity.depth == 1;
+            if ((l_Flags & VK_QUEUE_TRANSFER_BIT) && !(l_Flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && l_TexelGranularity)
+            {
+                l_Indices.TransferFamily = i;
+                break;
+            }
+        }
+
+        if (!l_Indices.TransferFamily.has_value())
+        {
+            l_Indices.TransferFamily = l_Indices.GraphicsFamily;
+        }
+
         return l_Indices;
     }
 
@@ -4,6 +4,7 @@
 #include "Renderer/Renderer.h"
 #include "ECS/Registry.h"
 
+#include <atomic>
 #include <optional>
 #include <vector>
 
@@ -15,6 +16,7 @@ namespace Trident
     {
         std::optional<uint32_t> GraphicsFamily;
         std::optional<uint32_t> PresentFamily;
+        std::optional<uint32_t> TransferFamily;   // Transfer-only family when the device exposes one, otherwise the graphics family.
 
         bool IsComplete() const { return GraphicsFamily.has_value() && PresentFamily.has_value(); }
     };
@@ -32,8 +34,16 @@ namespace Trident
         static VkSurfaceKHR GetSurface() { return Get().m_Surface; }
         static VkQueue GetGraphicsQueue() { return Get().m_GraphicsQueue; }
         static VkQueue GetPresentQueue() { return Get().m_PresentQueue; }
+        static VkQueue GetTransferQueue() { return Get().m_TransferQueue; }
         static QueueFamilyIndices GetQueueFamilyIndices() { return Get().m_QueueFamilyIndices; }
         static bool SupportsTimelineSemaphores() { return Get().m_TimelineSemaphoreSupported; }
+        static bool SupportsMultiDrawIndirect() { return Get().m_MultiDrawIndirectSupported; }
+        static bool SupportsSamplerAnisotropy() { return Get().m_SamplerAnisotropySupported; }
+        static bool SupportsTextureCompressionBC() { return Get().m_TextureCompressionBCSupported; }
+        static bool SupportsMemoryBudget() { return Get().m_MemoryBudgetSupported; }
+        // Largest bindless material texture array the device accepts; 0 when update-after-bind descriptor indexing is missing.
+        static uint32_t GetBindlessTextureLimit() { return Get().m_BindlessTextureLimit; }
+        static uint32_t GetUpdateAfterBindDescriptorLimit() { return Get().m_UpdateAfterBindDescriptorLimit; }
         static Window& GetWindow() { return Get().m_Window; }
         static Renderer& GetRenderer() { return Get().m_Renderer; }
         static Renderer* TryGetRenderer()
@@ -46,6 +56,10 @@ namespace Trident
         static void RegisterSurface(VkSurfaceKHR surface);
         static void UnregisterSurface(VkSurfaceKHR surface);
 
+        // Every vkDeviceWaitIdle goes through here so the renderer can prove steady-state frames never drain the device.
+        static void WaitForDeviceIdle(const char* reason);
+        static uint64_t GetDeviceIdleCount() { return s_DeviceIdleCount.load(std::memory_order_relaxed); }
+
     private:
         void Initialize();
         void Shutdown();
@@ -76,9 +90,17 @@ namespace Trident
         VkDevice m_Device = VK_NULL_HANDLE;
         VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
         VkQueue m_PresentQueue = VK_NULL_HANDLE;
+        VkQueue m_TransferQueue = VK_NULL_HANDLE;
         QueueFamilyIndices m_QueueFamilyIndices;
         bool m_TimelineSemaphoreSupported = false;
+        bool m_MultiDrawIndirectSupported = false;
+        bool m_SamplerAnisotropySupported = false;
+        bool m_TextureCompressionBCSupported = false;
+        bool m_MemoryBudgetSupported = false;
+        uint32_t m_BindlessTextureLimit = 0;
+        uint32_t m_UpdateAfterBindDescriptorLimit = 0;
 
         static Startup* s_Instance;
+        static std::atomic<uint64_t> s_DeviceIdleCount;
     };
 }
\ No newline at end of file
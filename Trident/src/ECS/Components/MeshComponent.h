@@ -44,6 +44,8 @@ namespace Trident
         int32_t m_BaseVertex{ 0 };
         /// Quick toggle that allows tooling to hide meshes without removing components.
         bool m_Visible{ true };
+        /// LOD picked by the renderer last frame; kept here so hysteresis survives between frames. Not serialised.
+        uint32_t m_LodLevel{ 0 };
         /// Indicates which primitive (if any) should be procedurally generated by the renderer.
         PrimitiveType m_Primitive{ PrimitiveType::None };
         /// Normalised asset path captured when the mesh was imported so the scene loader can rebuild geometry.
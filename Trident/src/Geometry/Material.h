@@ -15,7 +15,11 @@ namespace Trident
             int BaseColorTextureIndex = -1;                        // Index of the base color texture in the glTF texture array
             int BaseColorTextureSlot = 0;                          // Resolved GPU texture slot (0 always points at the fallback white texture)
             int MetallicRoughnessTextureIndex = -1;                // Index of the metallic-roughness texture (if any)
+            int MetallicRoughnessTextureSlot = 0;                  // Resolved GPU slot; 0 samples white so the factors pass through
             int NormalTextureIndex = -1;                           // Optional normal map texture index
+            int NormalTextureSlot = 0;                             // Resolved GPU slot; 0 disables normal mapping
+            bool AlphaMask = false;                                // glTF alphaMode MASK; draws with the alpha-test pipeline permutation
+            float AlphaCutoff = 0.5f;                              // Fragments below this alpha are discarded when AlphaMask is set
         };
     }
 }
\ No newline at end of file
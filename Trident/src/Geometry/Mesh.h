@@ -9,11 +9,31 @@ namespace Trident
 {
     namespace Geometry
     {
+        // Simplified index list generated at import; every LOD references the parent mesh's vertex array.
+        struct MeshLod
+        {
+            std::vector<uint32_t> Indices;  // Triangle list addressing Mesh::Vertices
+            float Error = 0.0f;             // Object-space geometric deviation from the full-resolution surface
+        };
+
+        // Contiguous run of LOD0 triangles with bounds used for per-cluster frustum and backface-cone culling.
+        struct Meshlet
+        {
+            uint32_t FirstIndex = 0;            // Offset into Mesh::Indices
+            uint32_t IndexCount = 0;            // Multiple of three
+            glm::vec3 Center{ 0.0f };           // Object-space bounding sphere centre
+            float Radius = 0.0f;                // Object-space bounding sphere radius
+            glm::vec3 ConeAxis{ 0.0f, 0.0f, 1.0f }; // Average facing direction of the cluster's triangles
+            float ConeCutoff = 1.0f;            // Sine of the cone spread; >= 1 disables backface culling for the cluster
+        };
+
         struct Mesh
         {
             std::vector<Vertex> Vertices;
             std::vector<uint32_t> Indices;
             int MaterialIndex = -1; // Index into the material table populated during loading (-1 when unassigned)
+            std::vector<MeshLod> Lods; // Progressively coarser index lists (LOD1..N); Indices remains LOD0
+            std::vector<Meshlet> Meshlets; // Partition of Indices into culling clusters (empty for small meshes)
         };
     }
 }
\ No newline at end of file
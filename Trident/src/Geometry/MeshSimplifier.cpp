@@ -0,0 +1,453 @@
+#include "Geometry/MeshSimplifier.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace Trident
+{
+    namespace Geometry
+    {
+        namespace
+        {
+            constexpr float s_NormalWeight = 0.5f;      // Penalty applied per unit of normal deviation (1 - cos).
+            constexpr float s_TexCoordWeight = 1.0f;    // Penalty applied per squared UV unit travelled by the collapse.
+            constexpr float s_ColorWeight = 0.25f;      // Vertex colours rarely carry detail, so weight them lightly.
+            constexpr float s_MaxRelativeError = 0.05f; // LODs stop once deviation exceeds 5% of the mesh extent.
+            constexpr float s_FlipThreshold = 0.25f;    // Minimum cosine between a triangle normal before and after a collapse.
+
+            // Area-weighted symmetric 4x4 matrix stored as the upper triangle so accumulation stays cheap.
+            struct Quadric
+            {
+                double m_A00 = 0.0, m_A01 = 0.0, m_A02 = 0.0, m_A03 = 0.0;
+                double m_A11 = 0.0, m_A12 = 0.0, m_A13 = 0.0;
+                double m_A22 = 0.0, m_A23 = 0.0;
+                double m_A33 = 0.0;
+                double m_Weight = 0.0; // Accumulated plane area so Evaluate reports a mean squared distance.
+
+                void AddPlane(const glm::vec3& normal, float distance, float weight)
+                {
+                    const double l_A = normal.x;
+                    const double l_B = normal.y;
+                    const double l_C = normal.z;
+                    const double l_D = distance;
+                    const double l_W = weight;
+
+                    m_A00 += l_W * l_A * l_A; m_A01 += l_W * l_A * l_B; m_A02 += l_W * l_A * l_C; m_A03 += l_W * l_A * l_D;
+                    m_A11 += l_W * l_B * l_B; m_A12 += l_W * l_B * l_C; m_A13 += l_W * l_B * l_D;
+                    m_A22 += l_W * l_C * l_C; m_A23 += l_W * l_C * l_D;
+                    m_A33 += l_W * l_D * l_D;
+                    m_Weight += l_W;
+                }
+
+                void Add(const Quadric& other)
+                {
+                    m_A00 += other.m_A00; m_A01 += other.m_A01; m_A02 += other.m_A02; m_A03 += other.m_A03;
+                    m_A11 += other.m_A11; m_A12 += other.m_A12; m_A13 += other.m_A13;
+                    m_A22 += other.m_A22; m_A23 += other.m_A23;
+                    m_A33 += other.m_A33;
+                    m_Weight += other.m_Weight;
+                }
+
+                double Evaluate(const glm::vec3& point) const
+                {
+                    const double l_X = point.x;
+                    const double l_Y = point.y;
+                    const double l_Z = point.z;
+
+                    const double l_Result = m_A00 * l_X * l_X + 2.0 * m_A01 * l_X * l_Y + 2.0 * m_A02 * l_X * l_Z + 2.0 * m_A03 * l_X
+                        + m_A11 * l_Y * l_Y + 2.0 * m_A12 * l_Y * l_Z + 2.0 * m_A13 * l_Y
+                        + m_A22 * l_Z * l_Z + 2.0 * m_A23 * l_Z
+                        + m_A33;
+
+                    return m_Weight > 0.0 ? std::max(l_Result / m_Weight, 0.0) : 0.0;
+                }
+            };
+
+            struct PositionKey
+            {
+                uint32_t m_X = 0;
+                uint32_t m_Y = 0;
+                uint32_t m_Z = 0;
+
+                bool operator==(const PositionKey& other) const { return m_X == other.m_X && m_Y == other.m_Y && m_Z == other.m_Z; }
+            };
+
+            struct PositionKeyHash
+            {
+                size_t operator()(const PositionKey& key) const
+                {
+                    return (static_cast<size_t>(key.m_X) * 73856093u) ^ (static_cast<size_t>(key.m_Y) * 19349663u) ^ (static_cast<size_t>(key.m_Z) * 83492791u);
+                }
+            };
+
+            struct Collapse
+            {
+                uint32_t m_From = 0;
+                uint32_t m_To = 0;
+                float m_Cost = 0.0f;
+            };
+
+            PositionKey BuildPositionKey(const glm::vec3& position)
+            {
+                PositionKey l_Key{};
+                std::memcpy(&l_Key.m_X, &position.x, sizeof(float));
+                std::memcpy(&l_Key.m_Y, &position.y, sizeof(float));
+                std::memcpy(&l_Key.m_Z, &position.z, sizeof(float));
+
+                return l_Key;
+            }
+
+            uint64_t BuildEdgeKey(uint32_t a, uint32_t b)
+            {
+                const uint32_t l_Min = std::min(a, b);
+                const uint32_t l_Max = std::max(a, b);
+
+                return (static_cast<uint64_t>(l_Min) << 32) | static_cast<uint64_t>(l_Max);
+            }
+
+            float ComputeAttributePenalty(const Vertex& from, const Vertex& to)
+            {
+                const float l_NormalLength = glm::length(from.Normal) * glm::length(to.Normal);
+                const float l_NormalCos = l_NormalLength > 0.0f ? glm::dot(from.Normal, to.Normal) / l_NormalLength : 1.0f;
+                const glm::vec2 l_TexCoordDelta = from.TexCoord - to.TexCoord;
+                const glm::vec3 l_ColorDelta = from.Color - to.Color;
+
+                return s_NormalWeight * std::max(0.0f, 1.0f - l_NormalCos)
+                    + s_TexCoordWeight * glm::dot(l_TexCoordDelta, l_TexCoordDelta)
+                    + s_ColorWeight * glm::dot(l_ColorDelta, l_ColorDelta);
+            }
+        }
+
+        std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, size_t targetIndexCount,
+            float maxError, float& outError)
+        {
+            outError = 0.0f;
+
+            std::vector<uint32_t> l_Result = indices;
+            const size_t l_VertexCount = vertices.size();
+            if (l_VertexCount == 0 || indices.size() < 3 || indices.size() <= targetIndexCount)
+            {
+                return l_Result;
+            }
+
+            // Weld vertices that share a position so quadrics and topology ignore attribute splits.
+            std::vector<uint32_t> l_PositionRemap(l_VertexCount);
+            std::vector<uint32_t> l_GroupSize(l_VertexCount, 0);
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> l_PositionLookup{};
+            l_PositionLookup.reserve(l_VertexCount);
+            for (uint32_t it_Vertex = 0; it_Vertex < l_VertexCount; ++it_Vertex)
+            {
+                auto [it_Entry, l_Inserted] = l_PositionLookup.try_emplace(BuildPositionKey(vertices[it_Vertex].Position), it_Vertex);
+                l_PositionRemap[it_Vertex] = it_Entry->second;
+                ++l_GroupSize[it_Entry->second];
+            }
+
+            // Seams (several vertices per position) and open borders are locked so collapses never tear the surface.
+            std::vector<uint8_t> l_Locked(l_VertexCount, 0);
+            for (uint32_t it_Vertex = 0; it_Vertex < l_VertexCount; ++it_Vertex)
+            {
+                if (l_GroupSize[l_PositionRemap[it_Vertex]] > 1)
+                {
+                    l_Locked[it_Vertex] = 1;
+                }
+            }
+
+            std::unordered_map<uint64_t, uint32_t> l_EdgeUsage{};
+            l_EdgeUsage.reserve(indices.size());
+            for (size_t it_Index = 0; it_Index + 2 < indices.size(); it_Index += 3)
+            {
+                for (size_t it_Edge = 0; it_Edge < 3; ++it_Edge)
+                {
+                    const uint32_t l_A = l_PositionRemap[indices[it_Index + it_Edge]];
+                    const uint32_t l_B = l_PositionRemap[indices[it_Index + (it_Edge + 1) % 3]];
+                    ++l_EdgeUsage[BuildEdgeKey(l_A, l_B)];
+                }
+            }
+
+            for (size_t it_Index = 0; it_Index + 2 < indices.size(); it_Index += 3)
+            {
+                for (size_t it_Edge = 0; it_Edge < 3; ++it_Edge)
+                {
+                    const uint32_t l_A = indices[it_Index + it_Edge];
+                    const uint32_t l_B = indices[it_Index + (it_Edge + 1) % 3];
+                    if (l_EdgeUsage[BuildEdgeKey(l_PositionRemap[l_A], l_PositionRemap[l_B])] == 1)
+                    {
+                        l_Locked[l_A] = 1;
+                        l_Locked[l_B] = 1;
+                    }
+                }
+            }
+
+            // Quadrics are seeded from the full-resolution surface and accumulated on collapse so the reported error stays absolute.
+            std::vector<Quadric> l_Quadrics(l_VertexCount);
+            for (size_t it_Index = 0; it_Index + 2 < indices.size(); it_Index += 3)
+            {
+                const glm::vec3& l_P0 = vertices[indices[it_Index + 0]].Position;
+                const glm::vec3& l_P1 = vertices[indices[it_Index + 1]].Position;
+                const glm::vec3& l_P2 = vertices[indices[it_Index + 2]].Position;
+
+                glm::vec3 l_Normal = glm::cross(l_P1 - l_P0, l_P2 - l_P0);
+                const float l_DoubleArea = glm::length(l_Normal);
+                if (l_DoubleArea <= 0.0f)
+                {
+                    continue;
+                }
+
+                l_Normal /= l_DoubleArea;
+                const float l_Distance = -glm::dot(l_Normal, l_P0);
+                const float l_Weight = l_DoubleArea * 0.5f;
+
+                for (size_t it_Corner = 0; it_Corner < 3; ++it_Corner)
+                {
+                    l_Quadrics[l_PositionRemap[indices[it_Index + it_Corner]]].AddPlane(l_Normal, l_Distance, l_Weight);
+                }
+            }
+
+            const double l_MaxErrorSquared = static_cast<double>(maxError) * static_cast<double>(maxError);
+            double l_ResultErrorSquared = 0.0;
+
+            std::vector<uint32_t> l_AdjacencyOffsets(l_VertexCount + 1);
+            std::vector<uint32_t> l_Adjacency{};
+            std::vector<Collapse> l_Candidates{};
+            std::vector<uint32_t> l_CollapseTarget(l_VertexCount);
+            std::vector<uint8_t> l_Touched(l_VertexCount);
+
+            while (l_Result.size() > targetIndexCount)
+            {
+                const size_t l_TriangleCount = l_Result.size() / 3;
+
+                // Rebuild vertex->triangle adjacency for the current topology (CSR layout keeps it allocation-light).
+                std::fill(l_AdjacencyOffsets.begin(), l_AdjacencyOffsets.end(), 0u);
+                for (uint32_t it_Index : l_Result)
+                {
+                    ++l_AdjacencyOffsets[it_Index + 1];
+                }
+                for (size_t it_Vertex = 0; it_Vertex < l_VertexCount; ++it_Vertex)
+                {
+                    l_AdjacencyOffsets[it_Vertex + 1] += l_AdjacencyOffsets[it_Vertex];
+                }
+
+                l_Adjacency.assign(l_Result.size(), 0u);
+                std::vector<uint32_t> l_Cursor(l_AdjacencyOffsets.begin(), l_AdjacencyOffsets.end() - 1);
+                for (size_t it_Triangle = 0; it_Triangle < l_TriangleCount; ++it_Triangle)
+                {
+                    for (size_t it_Corner = 0; it_Corner < 3; ++it_Corner)
+                    {
+                        l_Adjacency[l_Cursor[l_Result[it_Triangle * 3 + it_Corner]]++] = static_cast<uint32_t>(it_Triangle);
+                    }
+                }
+
+                l_Candidates.clear();
+                l_Candidates.reserve(l_Result.size() * 2);
+                for (size_t it_Triangle = 0; it_Triangle < l_TriangleCount; ++it_Triangle)
+                {
+                    for (size_t it_Edge = 0; it_Edge < 3; ++it_Edge)
+                    {
+                        const uint32_t l_A = l_Result[it_Triangle * 3 + it_Edge];
+                        const uint32_t l_B = l_Result[it_Triangle * 3 + (it_Edge + 1) % 3];
+
+                        const std::array<std::pair<uint32_t, uint32_t>, 2> l_Directions{ { { l_A, l_B }, { l_B, l_A } } };
+                        for (const auto& [it_From, it_To] : l_Directions)
+                        {
+                            if (l_Locked[it_From] || l_PositionRemap[it_From] == l_PositionRemap[it_To])
+                            {
+                                continue;
+                            }
+
+                            Quadric l_Combined = l_Quadrics[l_PositionRemap[it_From]];
+                            l_Combined.Add(l_Quadrics[l_PositionRemap[it_To]]);
+
+                            const glm::vec3 l_EdgeDelta = vertices[it_To].Position - vertices[it_From].Position;
+                            const double l_AttributeCost = static_cast<double>(glm::dot(l_EdgeDelta, l_EdgeDelta))
+                                * static_cast<double>(ComputeAttributePenalty(vertices[it_From], vertices[it_To]));
+
+                            Collapse l_Collapse{};
+                            l_Collapse.m_From = it_From;
+                            l_Collapse.m_To = it_To;
+                            l_Collapse.m_Cost = static_cast<float>(l_Combined.Evaluate(vertices[it_To].Position) + l_AttributeCost);
+                            l_Candidates.push_back(l_Collapse);
+                        }
+                    }
+                }
+
+                if (l_Candidates.empty())
+                {
+                    break;
+                }
+
+                std::sort(l_Candidates.begin(), l_Candidates.end(), [](const Collapse& a_Left, const Collapse& a_Right)
+                    {
+                        return a_Left.m_Cost < a_Right.m_Cost;
+                    });
+
+                for (uint32_t it_Vertex = 0; it_Vertex < l_VertexCount; ++it_Vertex)
+                {
+                    l_CollapseTarget[it_Vertex] = it_Vertex;
+                }
+                std::fill(l_Touched.begin(), l_Touched.end(), static_cast<uint8_t>(0));
+
+                // Interior collapses remove two triangles each; stop once the pass would overshoot the target.
+                const size_t l_TrianglesToRemove = (l_Result.size() - targetIndexCount) / 3;
+                size_t l_EstimatedRemoved = 0;
+                size_t l_CollapseCount = 0;
+
+                for (const Collapse& it_Collapse : l_Candidates)
+                {
+                    if (l_EstimatedRemoved >= l_TrianglesToRemove)
+                    {
+                        break;
+                    }
+
+                    if (static_cast<double>(it_Collapse.m_Cost) > l_MaxErrorSquared)
+                    {
+                        break;
+                    }
+
+                    if (l_Touched[it_Collapse.m_From] || l_Touched[it_Collapse.m_To])
+                    {
+                        continue;
+                    }
+
+                    // Reject collapses that would fold any surviving triangle around the removed vertex.
+                    bool l_Flips = false;
+                    for (uint32_t it_Adjacent = l_AdjacencyOffsets[it_Collapse.m_From]; it_Adjacent < l_AdjacencyOffsets[it_Collapse.m_From + 1]; ++it_Adjacent)
+                    {
+                        const size_t l_Triangle = l_Adjacency[it_Adjacent];
+                        const uint32_t l_I0 = l_Result[l_Triangle * 3 + 0];
+                        const uint32_t l_I1 = l_Result[l_Triangle * 3 + 1];
+                        const uint32_t l_I2 = l_Result[l_Triangle * 3 + 2];
+                        if (l_I0 == it_Collapse.m_To || l_I1 == it_Collapse.m_To || l_I2 == it_Collapse.m_To)
+                        {
+                            continue;
+                        }
+
+                        const glm::vec3 l_P0 = vertices[l_I0].Position;
+                        const glm::vec3 l_P1 = vertices[l_I1].Position;
+                        const glm::vec3 l_P2 = vertices[l_I2].Position;
+                        const glm::vec3 l_Before = glm::cross(l_P1 - l_P0, l_P2 - l_P0);
+
+                        const glm::vec3& l_Moved = vertices[it_Collapse.m_To].Position;
+                        const glm::vec3 l_Q0 = l_I0 == it_Collapse.m_From ? l_Moved : l_P0;
+                        const glm::vec3 l_Q1 = l_I1 == it_Collapse.m_From ? l_Moved : l_P1;
+                        const glm::vec3 l_Q2 = l_I2 == it_Collapse.m_From ? l_Moved : l_P2;
+                        const glm::vec3 l_After = glm::cross(l_Q1 - l_Q0, l_Q2 - l_Q0);
+
+                        const float l_Denominator = glm::length(l_Before) * glm::length(l_After);
+                        if (glm::dot(l_Before, l_After) <= s_FlipThreshold * l_Denominator)
+                        {
+                            l_Flips = true;
+                            break;
+                        }
+                    }
+
+                    if (l_Flips)
+                    {
+                        continue;
+                    }
+
+                    l_CollapseTarget[it_Collapse.m_From] = it_Collapse.m_To;
+                    l_Quadrics[l_PositionRemap[it_Collapse.m_To]].Add(l_Quadrics[l_PositionRemap[it_Collapse.m_From]]);
+                    l_ResultErrorSquared = std::max(l_ResultErrorSquared, static_cast<double>(it_Collapse.m_Cost));
+
+                    // Freeze the one-ring so simultaneous collapses in this pass cannot invalidate the flip test above.
+                    for (uint32_t it_Adjacent = l_AdjacencyOffsets[it_Collapse.m_From]; it_Adjacent < l_AdjacencyOffsets[it_Collapse.m_From + 1]; ++it_Adjacent)
+                    {
+                        const size_t l_Triangle = l_Adjacency[it_Adjacent];
+                        l_Touched[l_Result[l_Triangle * 3 + 0]] = 1;
+                        l_Touched[l_Result[l_Triangle * 3 + 1]] = 1;
+                        l_Touched[l_Result[l_Triangle * 3 + 2]] = 1;
+                    }
+
+                    l_EstimatedRemoved += 2;
+                    ++l_CollapseCount;
+                }
+
+                if (l_CollapseCount == 0)
+                {
+                    break;
+                }
+
+                size_t l_WriteCursor = 0;
+                for (size_t it_Triangle = 0; it_Triangle < l_TriangleCount; ++it_Triangle)
+                {
+                    const uint32_t l_I0 = l_CollapseTarget[l_Result[it_Triangle * 3 + 0]];
+                    const uint32_t l_I1 = l_CollapseTarget[l_Result[it_Triangle * 3 + 1]];
+                    const uint32_t l_I2 = l_CollapseTarget[l_Result[it_Triangle * 3 + 2]];
+
+                    const uint32_t l_P0 = l_PositionRemap[l_I0];
+                    const uint32_t l_P1 = l_PositionRemap[l_I1];
+                    const uint32_t l_P2 = l_PositionRemap[l_I2];
+                    if (l_P0 == l_P1 || l_P1 == l_P2 || l_P0 == l_P2)
+                    {
+                        continue;
+                    }
+
+                    l_Result[l_WriteCursor++] = l_I0;
+                    l_Result[l_WriteCursor++] = l_I1;
+                    l_Result[l_WriteCursor++] = l_I2;
+                }
+
+                l_Result.resize(l_WriteCursor);
+            }
+
+            outError = static_cast<float>(std::sqrt(l_ResultErrorSquared));
+
+            return l_Result;
+        }
+
+        void MeshSimplifier::GenerateLods(Mesh& mesh)
+        {
+            mesh.Lods.clear();
+
+            if (mesh.Vertices.empty() || mesh.Indices.size() / 3 < s_MinTrianglesForLod)
+            {
+                return;
+            }
+
+            glm::vec3 l_Min{ std::numeric_limits<float>::max() };
+            glm::vec3 l_Max{ std::numeric_limits<float>::lowest() };
+            for (const Vertex& it_Vertex : mesh.Vertices)
+            {
+                l_Min = glm::min(l_Min, it_Vertex.Position);
+                l_Max = glm::max(l_Max, it_Vertex.Position);
+            }
+
+            const float l_Extent = glm::length(l_Max - l_Min);
+            if (l_Extent <= 0.0f)
+            {
+                return;
+            }
+
+            const float l_MaxError = l_Extent * s_MaxRelativeError;
+            size_t l_PreviousIndexCount = mesh.Indices.size();
+
+            for (uint32_t it_Level = 1; it_Level < s_MaxLodCount; ++it_Level)
+            {
+                const size_t l_TargetIndexCount = (l_PreviousIndexCount / 2) / 3 * 3;
+                if (l_TargetIndexCount < s_MinTrianglesForLod * 3 / 2)
+                {
+                    break;
+                }
+
+                // Always simplify from LOD0 so each level's quadrics describe deviation from the authored surface.
+                MeshLod l_Lod{};
+                l_Lod.Indices = Simplify(mesh.Vertices, mesh.Indices, l_TargetIndexCount, l_MaxError, l_Lod.Error);
+
+                // Locked seams or the error budget can stall simplification; a level that barely shrinks is not worth a switch.
+                if (l_Lod.Indices.empty() || l_Lod.Indices.size() * 10 > l_PreviousIndexCount * 9)
+                {
+                    break;
+                }
+
+                l_PreviousIndexCount = l_Lod.Indices.size();
+                mesh.Lods.emplace_back(std::move(l_Lod));
+            }
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Geometry/Mesh.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Trident
+{
+    namespace Geometry
+    {
+        /**
+         * @brief Builds index-only LODs with quadric error metrics.
+         *
+         * Collapses always move a vertex onto one of its neighbours, so every LOD reuses the parent vertex
+         * array and the renderer can keep a single vertex buffer. UV/normal seams and open borders are locked
+         * and attribute deltas are charged to the collapse cost so shading stays stable as triangles disappear.
+         */
+        class MeshSimplifier
+        {
+        public:
+            static constexpr uint32_t s_MaxLodCount = 4;           // LOD0 plus up to three simplified levels.
+            static constexpr size_t s_MinTrianglesForLod = 128;    // Small meshes are cheaper to draw than to switch.
+
+            /**
+             * @brief Simplify a triangle list towards targetIndexCount without exceeding maxError.
+             * @param outError Receives the object-space deviation of the returned index list.
+             */
+            static std::vector<uint32_t> Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, size_t targetIndexCount,
+                float maxError, float& outError);
+
+            /**
+             * @brief Populate mesh.Lods with a halving chain until the error budget or lock set stops progress.
+             */
+            static void GenerateLods(Mesh& mesh);
+        };
+    }
+}
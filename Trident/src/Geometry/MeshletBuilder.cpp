@@ -0,0 +1,246 @@
+#include "Geometry/MeshletBuilder.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Trident
+{
+    namespace Geometry
+    {
+        namespace
+        {
+            constexpr float s_MinConeSpread = 0.05f; // Clusters whose normals spread past ~87 degrees cannot be backface culled.
+
+            void ComputeMeshletBounds(const std::vector<Vertex>& vertices, const uint32_t* indices, Meshlet& meshlet)
+            {
+                glm::vec3 l_Min{ std::numeric_limits<float>::max() };
+                glm::vec3 l_Max{ std::numeric_limits<float>::lowest() };
+                for (uint32_t it_Index = 0; it_Index < meshlet.IndexCount; ++it_Index)
+                {
+                    const glm::vec3& l_Position = vertices[indices[it_Index]].Position;
+                    l_Min = glm::min(l_Min, l_Position);
+                    l_Max = glm::max(l_Max, l_Position);
+                }
+
+                meshlet.Center = (l_Min + l_Max) * 0.5f;
+                meshlet.Radius = 0.0f;
+                for (uint32_t it_Index = 0; it_Index < meshlet.IndexCount; ++it_Index)
+                {
+                    meshlet.Radius = std::max(meshlet.Radius, glm::length(vertices[indices[it_Index]].Position - meshlet.Center));
+                }
+
+                // Average the face normals, then measure the widest deviation to bound every triangle inside one cone.
+                std::vector<glm::vec3> l_Normals;
+                l_Normals.reserve(meshlet.IndexCount / 3);
+                glm::vec3 l_AxisSum{ 0.0f };
+                for (uint32_t it_Index = 0; it_Index + 2 < meshlet.IndexCount; it_Index += 3)
+                {
+                    const glm::vec3& l_P0 = vertices[indices[it_Index + 0]].Position;
+                    const glm::vec3& l_P1 = vertices[indices[it_Index + 1]].Position;
+                    const glm::vec3& l_P2 = vertices[indices[it_Index + 2]].Position;
+                    const glm::vec3 l_Normal = glm::cross(l_P1 - l_P0, l_P2 - l_P0);
+                    const float l_Length = glm::length(l_Normal);
+                    if (l_Length <= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    l_Normals.push_back(l_Normal * (1.0f / l_Length));
+                    l_AxisSum = l_AxisSum + l_Normals.back();
+                }
+
+                meshlet.ConeAxis = glm::vec3{ 0.0f, 0.0f, 1.0f };
+                meshlet.ConeCutoff = 1.0f;
+
+                const float l_AxisLength = glm::length(l_AxisSum);
+                if (l_Normals.empty() || l_AxisLength <= 0.0f)
+                {
+                    return;
+                }
+
+                const glm::vec3 l_Axis = l_AxisSum * (1.0f / l_AxisLength);
+                float l_MinDot = 1.0f;
+                for (const glm::vec3& it_Normal : l_Normals)
+                {
+                    l_MinDot = std::min(l_MinDot, glm::dot(it_Normal, l_Axis));
+                }
+
+                if (l_MinDot <= s_MinConeSpread)
+                {
+                    return;
+                }
+
+                meshlet.ConeAxis = l_Axis;
+                meshlet.ConeCutoff = std::sqrt(1.0f - l_MinDot * l_MinDot);
+            }
+        }
+
+        void MeshletBuilder::Build(Mesh& mesh)
+        {
+            mesh.Meshlets.clear();
+
+            const size_t l_TriangleCount = mesh.Indices.size() / 3;
+            if (mesh.Vertices.empty() || mesh.Indices.size() % 3 != 0 || l_TriangleCount < s_MinTrianglesForMeshlets)
+            {
+                return;
+            }
+
+            const size_t l_VertexCount = mesh.Vertices.size();
+
+            // Vertex -> triangle adjacency in CSR form so growth only visits triangles touching the current cluster.
+            std::vector<uint32_t> l_AdjacencyOffsets(l_VertexCount + 1, 0);
+            for (uint32_t it_Index : mesh.Indices)
+            {
+                ++l_AdjacencyOffsets[it_Index + 1];
+            }
+            for (size_t it_Vertex = 0; it_Vertex < l_VertexCount; ++it_Vertex)
+            {
+                l_AdjacencyOffsets[it_Vertex + 1] += l_AdjacencyOffsets[it_Vertex];
+            }
+
+            std::vector<uint32_t> l_AdjacencyCursor(l_AdjacencyOffsets.begin(), l_AdjacencyOffsets.end() - 1);
+            std::vector<uint32_t> l_AdjacentTriangles(mesh.Indices.size());
+            for (size_t it_Triangle = 0; it_Triangle < l_TriangleCount; ++it_Triangle)
+            {
+                for (size_t it_Corner = 0; it_Corner < 3; ++it_Corner)
+                {
+                    l_AdjacentTriangles[l_AdjacencyCursor[mesh.Indices[it_Triangle * 3 + it_Corner]]++] = static_cast<uint32_t>(it_Triangle);
+                }
+            }
+
+            std::vector<glm::vec3> l_Centroids(l_TriangleCount);
+            for (size_t it_Triangle = 0; it_Triangle < l_TriangleCount; ++it_Triangle)
+            {
+                l_Centroids[it_Triangle] = (mesh.Vertices[mesh.Indices[it_Triangle * 3 + 0]].Position
+                    + mesh.Vertices[mesh.Indices[it_Triangle * 3 + 1]].Position
+                    + mesh.Vertices[mesh.Indices[it_Triangle * 3 + 2]].Position) * (1.0f / 3.0f);
+            }
+
+            // Tags store (cluster id + 1) so nothing needs clearing between clusters.
+            std::vector<uint32_t> l_VertexTag(l_VertexCount, 0);
+            std::vector<uint32_t> l_CandidateTag(l_TriangleCount, 0);
+            std::vector<bool> l_Emitted(l_TriangleCount, false);
+            std::vector<uint32_t> l_Candidates;
+            std::vector<uint32_t> l_Reordered;
+            l_Reordered.reserve(mesh.Indices.size());
+
+            size_t l_SeedCursor = 0;
+            uint32_t l_ClusterTag = 0;
+
+            while (true)
+            {
+                while (l_SeedCursor < l_TriangleCount && l_Emitted[l_SeedCursor])
+                {
+                    ++l_SeedCursor;
+                }
+
+                if (l_SeedCursor >= l_TriangleCount)
+                {
+                    break;
+                }
+
+                ++l_ClusterTag;
+                l_Candidates.clear();
+
+                Meshlet l_Meshlet{};
+                l_Meshlet.FirstIndex = static_cast<uint32_t>(l_Reordered.size());
+                uint32_t l_ClusterVertices = 0;
+                uint32_t l_ClusterTriangles = 0;
+                glm::vec3 l_CentroidSum{ 0.0f };
+
+                auto a_AddTriangle = [&](uint32_t triangle)
+                    {
+                        l_Emitted[triangle] = true;
+                        ++l_ClusterTriangles;
+                        l_CentroidSum = l_CentroidSum + l_Centroids[triangle];
+
+                        for (size_t it_Corner = 0; it_Corner < 3; ++it_Corner)
+                        {
+                            const uint32_t l_Vertex = mesh.Indices[triangle * 3 + it_Corner];
+                            l_Reordered.push_back(l_Vertex);
+
+                            if (l_VertexTag[l_Vertex] == l_ClusterTag)
+                            {
+                                continue;
+                            }
+
+                            l_VertexTag[l_Vertex] = l_ClusterTag;
+                            ++l_ClusterVertices;
+
+                            for (uint32_t it_Slot = l_AdjacencyOffsets[l_Vertex]; it_Slot < l_AdjacencyOffsets[l_Vertex + 1]; ++it_Slot)
+                            {
+                                const uint32_t l_Neighbour = l_AdjacentTriangles[it_Slot];
+                                if (!l_Emitted[l_Neighbour] && l_CandidateTag[l_Neighbour] != l_ClusterTag)
+                                {
+                                    l_CandidateTag[l_Neighbour] = l_ClusterTag;
+                                    l_Candidates.push_back(l_Neighbour);
+                                }
+                            }
+                        }
+                    };
+
+                a_AddTriangle(static_cast<uint32_t>(l_SeedCursor));
+
+                while (l_ClusterTriangles < s_MaxTriangles)
+                {
+                    const glm::vec3 l_ClusterCentre = l_CentroidSum * (1.0f / static_cast<float>(l_ClusterTriangles));
+                    size_t l_BestSlot = l_Candidates.size();
+                    uint32_t l_BestNewVertices = 4;
+                    float l_BestDistance = std::numeric_limits<float>::max();
+
+                    for (size_t it_Slot = 0; it_Slot < l_Candidates.size();)
+                    {
+                        const uint32_t l_Triangle = l_Candidates[it_Slot];
+                        if (l_Emitted[l_Triangle])
+                        {
+                            l_Candidates[it_Slot] = l_Candidates.back();
+                            l_Candidates.pop_back();
+                            continue;
+                        }
+
+                        uint32_t l_NewVertices = 0;
+                        for (size_t it_Corner = 0; it_Corner < 3; ++it_Corner)
+                        {
+                            l_NewVertices += l_VertexTag[mesh.Indices[l_Triangle * 3 + it_Corner]] == l_ClusterTag ? 0u : 1u;
+                        }
+
+                        // Prefer triangles that reuse cluster vertices, then the one closest to the cluster centre to keep bounds tight.
+                        if (l_ClusterVertices + l_NewVertices <= s_MaxVertices)
+                        {
+                            const glm::vec3 l_Delta = l_Centroids[l_Triangle] - l_ClusterCentre;
+                            const float l_Distance = glm::dot(l_Delta, l_Delta);
+                            if (l_NewVertices < l_BestNewVertices || (l_NewVertices == l_BestNewVertices && l_Distance < l_BestDistance))
+                            {
+                                l_BestSlot = it_Slot;
+                                l_BestNewVertices = l_NewVertices;
+                                l_BestDistance = l_Distance;
+                            }
+                        }
+
+                        ++it_Slot;
+                    }
+
+                    if (l_BestSlot == l_Candidates.size())
+                    {
+                        break;
+                    }
+
+                    const uint32_t l_Chosen = l_Candidates[l_BestSlot];
+                    l_Candidates[l_BestSlot] = l_Candidates.back();
+                    l_Candidates.pop_back();
+                    a_AddTriangle(l_Chosen);
+                }
+
+                l_Meshlet.IndexCount = static_cast<uint32_t>(l_Reordered.size()) - l_Meshlet.FirstIndex;
+                ComputeMeshletBounds(mesh.Vertices, l_Reordered.data() + l_Meshlet.FirstIndex, l_Meshlet);
+                mesh.Meshlets.push_back(l_Meshlet);
+            }
+
+            mesh.Indices = std::move(l_Reordered);
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Geometry/Mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Trident
+{
+    namespace Geometry
+    {
+        /**
+         * @brief Partitions a mesh's LOD0 triangles into small clusters for GPU culling.
+         *
+         * Triangles are grown greedily from shared vertices so each cluster stays spatially compact, then the index
+         * list is rewritten so every cluster is a contiguous range. No mesh-shader features are assumed: the renderer
+         * draws surviving clusters through ordinary indexed indirect commands.
+         */
+        class MeshletBuilder
+        {
+        public:
+            static constexpr uint32_t s_MaxVertices = 64;            // Unique vertices referenced by one cluster.
+            static constexpr uint32_t s_MaxTriangles = 124;          // Keeps clusters inside the 64-128 triangle sweet spot.
+            static constexpr size_t s_MinTrianglesForMeshlets = 512; // Below this a single draw beats the culling overhead.
+
+            /**
+             * @brief Reorder mesh.Indices into clusters and populate mesh.Meshlets with their bounds.
+             */
+            static void Build(Mesh& mesh);
+        };
+    }
+}
@@ -1,6 +1,8 @@
 #include "Loader/ModelLoader.h"
 
 #include "Core/Utilities.h"
+#include "Geometry/MeshSimplifier.h"
+#include "Geometry/MeshletBuilder.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
@@ -381,6 +383,14 @@ namespace Trident
                 l_Material.MetallicFactor = l_Metallic;
                 l_Material.RoughnessFactor = l_Roughness;
 
+                // Raw keys behind AI_MATKEY_GLTF_ALPHAMODE / AI_MATKEY_GLTF_ALPHACUTOFF, whose header moved between assimp releases.
+                aiString l_AlphaMode{};
+                if (l_AssimpMaterial->Get("$mat.gltf.alphaMode", 0, 0, l_AlphaMode) == AI_SUCCESS)
+                {
+                    l_Material.AlphaMask = std::string(l_AlphaMode.C_Str()) == "MASK";
+                }
+                l_AssimpMaterial->Get("$mat.gltf.alphaCutoff", 0, 0, l_Material.AlphaCutoff);
+
                 l_Material.BaseColorTextureIndex = ResolveTextureIndex(l_AssimpMaterial, aiTextureType_BASE_COLOR, l_ModelDirectory, l_ModelData.m_Textures, l_TextureLookup);
                 if (l_Material.BaseColorTextureIndex < 0)
                 {
@@ -497,6 +507,11 @@ namespace Trident
                     NormaliseBoneWeights(it_Vertex);
                 }
 
+                // Build the simplified index chain once at import so the renderer can swap LODs without touching vertex data.
+                Geometry::MeshSimplifier::GenerateLods(l_Mesh);
+                // Cluster LOD0 afterwards; the reorder only permutes triangles so the LOD chain stays valid.
+                Geometry::MeshletBuilder::Build(l_Mesh);
+
                 l_MeshIndexMap[it_Mesh] = l_ModelData.m_Meshes.size();
                 l_ModelData.m_Meshes.emplace_back(std::move(l_Mesh));
             }
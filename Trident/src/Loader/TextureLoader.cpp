@@ -10,9 +10,11 @@
 #include <nanosvg.h>
 #define NANOSVGRAST_IMPLEMENTATION
 #include <nanosvgrast.h>
+#include <ktx.h>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cmath>
 #include <cctype>
@@ -42,6 +44,8 @@ namespace
     };
     constexpr std::array<std::string_view, 6> s_FaceFriendlyNames{ "+X", "-X", "+Y", "-Y", "+Z", "-Z" };
 
+    std::atomic<bool> s_BlockCompressionSupported{ false };
+
     void FlipImageVertically(std::vector<uint8_t>& pixels, int width, int height, int channels)
     {
         if (pixels.empty() || width <= 0 || height <= 0 || channels <= 0)
@@ -258,20 +262,69 @@ namespace
         std::string l_Normalized = Trident::Utilities::FileManagement::NormalizePath(path.string());
         return std::filesystem::path(l_Normalized);
     }
+
+    // Same block layout, no decode on sampling.
+    VkFormat ToUnormFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        default:
+            return format;
+        }
+    }
 }
 
 namespace Trident
 {
     namespace Loader
     {
-        TextureData TextureLoader::Load(const std::string& filePath)
+        TextureData TextureLoader::Load(const std::string& filePath, bool linear)
         {
             TextureData l_Texture{};
+            l_Texture.Format = linear ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB;
             std::string l_PathUtf8 = Utilities::FileManagement::NormalizePath(filePath);
 
             std::filesystem::path l_Path = std::filesystem::u8path(l_PathUtf8);
             std::string l_ExtensionLower = ToLowerCopy(l_Path.extension().string());
 
+            if (l_ExtensionLower == ".ktx2")
+            {
+                // There is no source to fall back to, so an sRGB file requested as data is only reinterpreted.
+                TextureData l_Ktx2 = LoadKtx2(l_PathUtf8);
+                if (linear)
+                {
+                    l_Ktx2.Format = ToUnormFormat(l_Ktx2.Format);
+                }
+
+                return l_Ktx2;
+            }
+
+            // Cooked textures skip decoding and stay block compressed; a stale cook is ignored so source edits show up immediately,
+            // as is one cooked for the other colour space.
+            std::error_code l_Error;
+            const std::filesystem::path l_CookedPath = GetCookedPath(l_Path);
+            if (std::filesystem::exists(l_CookedPath, l_Error))
+            {
+                const auto l_CookedTime = std::filesystem::last_write_time(l_CookedPath, l_Error);
+                const auto l_SourceTime = std::filesystem::last_write_time(l_Path, l_Error);
+                if (l_Error || l_CookedTime >= l_SourceTime)
+                {
+                    TextureData l_Cooked = LoadKtx2(l_CookedPath.u8string());
+                    if (!l_Cooked.Pixels.empty() && IsSrgbFormat(l_Cooked.Format) != linear)
+                    {
+                        return l_Cooked;
+                    }
+                }
+            }
+
             if (l_ExtensionLower == ".svg")
             {
                 // Vector icons must be rasterized before the renderer can upload them to a GPU texture.
@@ -306,6 +359,184 @@ namespace Trident
             return l_Texture;
         }
 
+        void TextureLoader::SetBlockCompressionSupported(bool supported)
+        {
+            s_BlockCompressionSupported.store(supported);
+        }
+
+        bool TextureLoader::IsSrgbFormat(VkFormat format)
+        {
+            return ToUnormFormat(format) != format;
+        }
+
+        std::filesystem::path TextureLoader::GetCookedPath(const std::filesystem::path& sourcePath)
+        {
+            std::filesystem::path l_Cooked = sourcePath;
+            l_Cooked.replace_extension(".ktx2");
+
+            return l_Cooked;
+        }
+
+        TextureData TextureLoader::LoadKtx2(const std::string& filePath)
+        {
+            TextureData l_Texture{};
+
+            ktxTexture2* l_Ktx = nullptr;
+            KTX_error_code l_Result = ktxTexture2_CreateFromNamedFile(filePath.c_str(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &l_Ktx);
+            if (l_Result != KTX_SUCCESS || l_Ktx == nullptr)
+            {
+                TR_CORE_ERROR("Failed to open KTX2 texture '{}' ({})", filePath, ktxErrorString(l_Result));
+                return l_Texture;
+            }
+
+            if (l_Ktx->numDimensions != 2 || l_Ktx->numFaces != 1 || l_Ktx->numLayers != 1)
+            {
+                TR_CORE_ERROR("KTX2 texture '{}' is not a plain 2D texture", filePath);
+                ktxTexture_Destroy(ktxTexture(l_Ktx));
+                return l_Texture;
+            }
+
+            const bool l_BlockCompression = s_BlockCompressionSupported.load();
+            if (ktxTexture2_NeedsTranscoding(l_Ktx))
+            {
+                // UASTC maps almost losslessly onto BC7; opaque ETC1S loses nothing further in BC1 at half the size.
+                const bool l_IsEtc1s = l_Ktx->supercompressionScheme == KTX_SS_BASIS_LZ;
+                const bool l_HasAlpha = ktxTexture2_GetNumComponents(l_Ktx) == 4;
+                ktx_transcode_fmt_e l_Target = KTX_TTF_RGBA32;
+                if (l_BlockCompression)
+                {
+                    l_Target = (l_IsEtc1s && !l_HasAlpha) ? KTX_TTF_BC1_RGB : KTX_TTF_BC7_RGBA;
+                }
+
+                l_Result = ktxTexture2_TranscodeBasis(l_Ktx, l_Target, 0);
+                if (l_Result != KTX_SUCCESS)
+                {
+                    TR_CORE_ERROR("Failed to transcode KTX2 texture '{}' ({})", filePath, ktxErrorString(l_Result));
+                    ktxTexture_Destroy(ktxTexture(l_Ktx));
+                    return l_Texture;
+                }
+            }
+
+            const VkFormat l_Format = static_cast<VkFormat>(l_Ktx->vkFormat);
+            bool l_Supported = l_Format == VK_FORMAT_R8G8B8A8_SRGB || l_Format == VK_FORMAT_R8G8B8A8_UNORM;
+            if (l_BlockCompression)
+            {
+                l_Supported = l_Supported || l_Format == VK_FORMAT_BC7_SRGB_BLOCK || l_Format == VK_FORMAT_BC7_UNORM_BLOCK
+                    || l_Format == VK_FORMAT_BC1_RGB_SRGB_BLOCK || l_Format == VK_FORMAT_BC1_RGB_UNORM_BLOCK
+                    || l_Format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK || l_Format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            }
+
+            if (!l_Supported)
+            {
+                TR_CORE_ERROR("KTX2 texture '{}' uses unsupported format {}", filePath, static_cast<int>(l_Format));
+                ktxTexture_Destroy(ktxTexture(l_Ktx));
+                return l_Texture;
+            }
+
+            const ktx_uint8_t* l_Data = ktxTexture_GetData(ktxTexture(l_Ktx));
+            const size_t l_DataSize = ktxTexture_GetDataSize(ktxTexture(l_Ktx));
+            l_Texture.Pixels.assign(l_Data, l_Data + l_DataSize);
+            l_Texture.Width = static_cast<int>(l_Ktx->baseWidth);
+            l_Texture.Height = static_cast<int>(l_Ktx->baseHeight);
+            l_Texture.Channels = 4;
+            l_Texture.Format = l_Format;
+
+            l_Texture.Mips.reserve(l_Ktx->numLevels);
+            for (uint32_t it_Level = 0; it_Level < l_Ktx->numLevels; ++it_Level)
+            {
+                ktx_size_t l_Offset = 0;
+                ktxTexture_GetImageOffset(ktxTexture(l_Ktx), it_Level, 0, 0, &l_Offset);
+
+                TextureMipRegion l_Region{};
+                l_Region.m_Offset = static_cast<size_t>(l_Offset);
+                l_Region.m_Size = static_cast<size_t>(ktxTexture_GetImageSize(ktxTexture(l_Ktx), it_Level));
+                l_Region.m_Width = std::max(l_Ktx->baseWidth >> it_Level, 1u);
+                l_Region.m_Height = std::max(l_Ktx->baseHeight >> it_Level, 1u);
+                l_Texture.Mips.push_back(l_Region);
+            }
+
+            ktxTexture_Destroy(ktxTexture(l_Ktx));
+
+            return l_Texture;
+        }
+
+        TextureData TextureLoader::Downsample(const TextureData& texture)
+        {
+            TextureData l_Result{};
+            // Cooked textures already carry their chain (and may be block compressed), so only plain RGBA8 is filtered here.
+            if (texture.Width <= 0 || texture.Height <= 0 || texture.Channels != 4 || texture.Pixels.empty() || !texture.Mips.empty() || texture.IsBlockCompressed())
+            {
+                return l_Result;
+            }
+
+            l_Result.Width = std::max(texture.Width / 2, 1);
+            l_Result.Height = std::max(texture.Height / 2, 1);
+            l_Result.Channels = 4;
+            l_Result.Format = texture.Format;
+            l_Result.Pixels.resize(static_cast<size_t>(l_Result.Width) * static_cast<size_t>(l_Result.Height) * 4u);
+
+            // Data maps store values rather than colours, so UNORM images average every channel as stored.
+            const size_t l_SrgbChannels = IsSrgbFormat(texture.Format) ? 3u : 0u;
+
+            // Averaging encoded sRGB values darkens distant mips, so filter in linear space and re-encode.
+            static const std::array<float, 256> s_SrgbToLinear = []()
+                {
+                    std::array<float, 256> l_Table{};
+                    for (size_t it_Value = 0; it_Value < l_Table.size(); ++it_Value)
+                    {
+                        const float l_Encoded = static_cast<float>(it_Value) / 255.0f;
+                        l_Table[it_Value] = l_Encoded <= 0.04045f ? l_Encoded / 12.92f : std::pow((l_Encoded + 0.055f) / 1.055f, 2.4f);
+                    }
+
+                    return l_Table;
+                }();
+
+            auto a_LinearToSrgb = [](float linear)
+                {
+                    const float l_Encoded = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+
+                    return static_cast<unsigned char>(std::clamp(l_Encoded * 255.0f + 0.5f, 0.0f, 255.0f));
+                };
+
+            const size_t l_SourceStride = static_cast<size_t>(texture.Width) * 4u;
+            for (int it_Y = 0; it_Y < l_Result.Height; ++it_Y)
+            {
+                const int l_Y0 = std::min(it_Y * 2, texture.Height - 1);
+                const int l_Y1 = std::min(it_Y * 2 + 1, texture.Height - 1);
+                for (int it_X = 0; it_X < l_Result.Width; ++it_X)
+                {
+                    const int l_X0 = std::min(it_X * 2, texture.Width - 1);
+                    const int l_X1 = std::min(it_X * 2 + 1, texture.Width - 1);
+                    const std::array<const unsigned char*, 4> l_Taps{
+                        texture.Pixels.data() + static_cast<size_t>(l_Y0) * l_SourceStride + static_cast<size_t>(l_X0) * 4u,
+                        texture.Pixels.data() + static_cast<size_t>(l_Y0) * l_SourceStride + static_cast<size_t>(l_X1) * 4u,
+                        texture.Pixels.data() + static_cast<size_t>(l_Y1) * l_SourceStride + static_cast<size_t>(l_X0) * 4u,
+                        texture.Pixels.data() + static_cast<size_t>(l_Y1) * l_SourceStride + static_cast<size_t>(l_X1) * 4u };
+
+                    unsigned char* l_Target = l_Result.Pixels.data() + (static_cast<size_t>(it_Y) * static_cast<size_t>(l_Result.Width) + static_cast<size_t>(it_X)) * 4u;
+                    for (size_t it_Channel = 0; it_Channel < l_SrgbChannels; ++it_Channel)
+                    {
+                        float l_Sum = 0.0f;
+                        for (const unsigned char* it_Tap : l_Taps)
+                        {
+                            l_Sum += s_SrgbToLinear[it_Tap[it_Channel]];
+                        }
+
+                        l_Target[it_Channel] = a_LinearToSrgb(l_Sum * 0.25f);
+                    }
+
+                    // Alpha is always stored linearly.
+                    for (size_t it_Channel = l_SrgbChannels; it_Channel < 4; ++it_Channel)
+                    {
+                        const uint32_t l_Sum = static_cast<uint32_t>(l_Taps[0][it_Channel]) + l_Taps[1][it_Channel] + l_Taps[2][it_Channel] + l_Taps[3][it_Channel];
+                        l_Target[it_Channel] = static_cast<unsigned char>((l_Sum + 2u) / 4u);
+                    }
+                }
+            }
+
+            return l_Result;
+        }
+
         CubemapTextureData CubemapTextureData::CreateSolidColor(uint32_t rgba8888)
         {
             CubemapTextureData l_Data{};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -11,18 +12,43 @@ namespace Trident
 {
     namespace Loader
     {
+        struct TextureMipRegion
+        {
+            size_t m_Offset = 0;               // Byte offset of the level inside TextureData::Pixels.
+            size_t m_Size = 0;
+            uint32_t m_Width = 0;
+            uint32_t m_Height = 0;
+        };
+
         struct TextureData
         {
             int Width = 0;
             int Height = 0;
             int Channels = 0;
             std::vector<unsigned char> Pixels;
+            VkFormat Format = VK_FORMAT_R8G8B8A8_SRGB;
+            // Precomputed levels from a cooked texture, largest first. Empty means Pixels holds a single RGBA8 level.
+            std::vector<TextureMipRegion> Mips;
+
+            bool IsBlockCompressed() const { return Format != VK_FORMAT_R8G8B8A8_SRGB && Format != VK_FORMAT_R8G8B8A8_UNORM; }
         };
 
         class TextureLoader
         {
         public:
-            static TextureData Load(const std::string& filePath);
+            // Prefers a cooked sibling (<name>.ktx2) that is at least as new as the source image. Data maps (normals,
+            // metallic-roughness) pass linear: they come back UNORM and only use a cook made with the cooker's --linear option.
+            static TextureData Load(const std::string& filePath, bool linear = false);
+            // Halves an RGBA8 image with a 2x2 box filter, gamma-correct for sRGB and plain for UNORM; odd edges reuse the last row/column.
+            static TextureData Downsample(const TextureData& texture);
+            static bool IsSrgbFormat(VkFormat format);
+
+            // Set once the device is known; Basis textures transcode to BC7/BC1 when true and to RGBA8 otherwise.
+            static void SetBlockCompressionSupported(bool supported);
+            static std::filesystem::path GetCookedPath(const std::filesystem::path& sourcePath);
+
+        private:
+            static TextureData LoadKtx2(const std::string& filePath);
         };
 
         struct CubemapFaceRegion
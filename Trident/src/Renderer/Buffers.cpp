@@ -1,14 +1,21 @@
 #include "Renderer/Buffers.h"
 
+#include "Renderer/Commands.h"
 #include "Application/Startup.h"
 #include "Core/Utilities.h"
 
 #include <cstring>
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 namespace Trident
 {
+    void Buffers::Init(Commands& commands)
+    {
+        m_Commands = &commands;
+    }
+
     void Buffers::Cleanup()
     {
         // Ensure any queued destruction requests are processed before clearing tracked allocations.
@@ -28,14 +35,15 @@ namespace Trident
         }
 
         m_Allocations.clear();
+        m_Commands = nullptr;
     }
 
-    void Buffers::CreateVertexBuffer(const std::vector<Vertex>& vertices, CommandBufferPool& pool, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory)
+    void Buffers::CreateVertexBuffer(const std::vector<Vertex>& vertices, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory)
     {
-        CreateVertexBuffer(vertices.data(), vertices.size(), sizeof(Vertex), pool, vertexBuffer, vertexBufferMemory);
+        CreateVertexBuffer(vertices.data(), vertices.size(), sizeof(Vertex), vertexBuffer, vertexBufferMemory);
     }
 
-    void Buffers::CreateVertexBuffer(const void* vertexData, size_t vertexCount, size_t vertexStride, CommandBufferPool& pool, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory)
+    void Buffers::CreateVertexBuffer(const void* vertexData, size_t vertexCount, size_t vertexStride, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory)
     {
         TR_CORE_TRACE("Creating Vertex Buffer");
 
@@ -59,14 +67,16 @@ namespace Trident
         std::memcpy(l_Data, vertexData, static_cast<size_t>(l_BufferSize));
         vkUnmapMemory(Startup::GetDevice(), l_StagingBufferMemory);
 
-        CreateBuffer(l_BufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory);
+        // Storage usage lets compute passes such as skinning read the vertices directly.
+        CreateBuffer(l_BufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory);
         if (vertexBuffer != VK_NULL_HANDLE)
         {
-            CopyBuffer(l_StagingBuffer, vertexBuffer, l_BufferSize, pool);
+            CopyBuffer(l_StagingBuffer, vertexBuffer, l_BufferSize);
         }
 
-        vkDestroyBuffer(Startup::GetDevice(), l_StagingBuffer, nullptr);
-        vkFreeMemory(Startup::GetDevice(), l_StagingBufferMemory, nullptr);
+        // The copy may still be executing; the staging buffer is released once its submission completes.
+        DestroyBuffer(l_StagingBuffer, l_StagingBufferMemory);
 
         if (vertexBuffer != VK_NULL_HANDLE)
         {
@@ -74,7 +84,7 @@ namespace Trident
         }
     }
 
-    void Buffers::CreateIndexBuffer(const std::vector<uint32_t>& indices, CommandBufferPool& pool, VkBuffer& indexBuffer, VkDeviceMemory& indexBufferMemory, uint32_t& indexCount)
+    void Buffers::CreateIndexBuffer(const std::vector<uint32_t>& indices, VkBuffer& indexBuffer, VkDeviceMemory& indexBufferMemory, uint32_t& indexCount)
     {
         TR_CORE_TRACE("Creating Index Buffer");
 
@@ -102,11 +112,10 @@ namespace Trident
         CreateBuffer(l_BufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferMemory);
         if (indexBuffer != VK_NULL_HANDLE)
         {
-            CopyBuffer(l_StagingBuffer, indexBuffer, l_BufferSize, pool);
+            CopyBuffer(l_StagingBuffer, indexBuffer, l_BufferSize);
         }
 
-        vkDestroyBuffer(Startup::GetDevice(), l_StagingBuffer, nullptr);
-        vkFreeMemory(Startup::GetDevice(), l_StagingBufferMemory, nullptr);
+        DestroyBuffer(l_StagingBuffer, l_StagingBufferMemory);
 
         if (indexBuffer != VK_NULL_HANDLE)
         {
@@ -246,141 +255,88 @@ namespace Trident
         vkBindBufferMemory(Startup::GetDevice(), buffer, bufferMemory, 0);
     }
 
-    void Buffers::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, CommandBufferPool& pool)
+    uint64_t Buffers::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
     {
-        VkCommandBuffer l_CommandBuffer = pool.Acquire();
+        VkCommandBuffer l_CommandBuffer = m_Commands->BeginSingleTimeCommands();
 
-        VkCommandBufferBeginInfo l_BeginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-        l_BeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-
-        vkBeginCommandBuffer(l_CommandBuffer, &l_BeginInfo);
         VkBufferCopy l_CopyRegion{};
         l_CopyRegion.srcOffset = 0;
         l_CopyRegion.dstOffset = 0;
         l_CopyRegion.size = size;
         vkCmdCopyBuffer(l_CommandBuffer, srcBuffer, dstBuffer, 1, &l_CopyRegion);
-        vkEndCommandBuffer(l_CommandBuffer);
-
-        VkSubmitInfo l_SubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
-        l_SubmitInfo.commandBufferCount = 1;
-        l_SubmitInfo.pCommandBuffers = &l_CommandBuffer;
 
-        vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_SubmitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(Startup::GetGraphicsQueue());
-
-        pool.Release(l_CommandBuffer);
+        // Later frames are ordered behind this submission on the same queue, so nothing has to wait for the copy here.
+        return m_Commands->SubmitSingleTimeCommands(l_CommandBuffer);
     }
 
-    void Buffers::DestroyBuffer(VkBuffer buffer, VkDeviceMemory memory, VkFence fence, size_t frameIndex)
+    void Buffers::DestroyBuffer(VkBuffer buffer, VkDeviceMemory memory)
     {
         if (buffer == VK_NULL_HANDLE && memory == VK_NULL_HANDLE)
         {
             return;
         }
 
-        // Track the most recent frame so callers that do not provide an explicit frame index still schedule the
-        // destruction against the frame currently in flight.
-        const size_t l_FrameIndex = (frameIndex == std::numeric_limits<size_t>::max()) ? m_CurrentFrame : frameIndex;
-
-        // Queue the request so it can be drained once the GPU finishes using the resource.
-        m_PendingDestroys.push_back({ buffer, memory, fence, l_FrameIndex });
+        Retire([this, buffer, memory]()
+            {
+                ReleaseBuffer(buffer, memory);
+            });
     }
 
-    void Buffers::ProcessPendingDestroys(VkFence completedFence, size_t completedFrameIndex)
+    void Buffers::Retire(std::function<void()> release)
     {
-        VkDevice l_Device = Startup::GetDevice();
-        auto l_DestroyImmediate = [&](const PendingDestruction& l_Pending)
-            {
-                // Clean up the buffer and memory once it is safe to do so.
-                if (l_Pending.Buffer != VK_NULL_HANDLE)
-                {
-                    vkDestroyBuffer(l_Device, l_Pending.Buffer, nullptr);
-                }
-
-                if (l_Pending.Memory != VK_NULL_HANDLE)
-                {
-                    vkFreeMemory(l_Device, l_Pending.Memory, nullptr);
-                }
-
-                auto l_Tracked = std::find_if(m_Allocations.begin(), m_Allocations.end(),
-                    [&](const Allocation& l_Alloc)
-                    {
-                        return l_Alloc.Buffer == l_Pending.Buffer && l_Alloc.Memory == l_Pending.Memory;
-                    });
-
-                if (l_Tracked != m_Allocations.end())
-                {
-                    m_Allocations.erase(l_Tracked);
-                }
-            };
-
-        auto it_Pending = m_PendingDestroys.begin();
-        while (it_Pending != m_PendingDestroys.end())
+        if (m_Commands == nullptr)
         {
-            const bool l_MatchesFence = (it_Pending->Fence != VK_NULL_HANDLE && it_Pending->Fence == completedFence);
-            const bool l_MatchesFrame = (it_Pending->Fence == VK_NULL_HANDLE && it_Pending->FrameIndex == completedFrameIndex);
+            // Nothing can have been submitted before the command timeline exists.
+            release();
 
-            bool l_CanDestroy = false;
-            if (l_MatchesFence)
-            {
-                // Only recycle the resource once the fence indicates GPU work is complete.
-                l_CanDestroy = (vkGetFenceStatus(l_Device, it_Pending->Fence) == VK_SUCCESS);
-            }
-            else if (l_MatchesFrame)
-            {
-                // The caller has already waited for the frame fence, so the queued resource can be released.
-                l_CanDestroy = true;
-            }
+            return;
+        }
 
-            if (l_CanDestroy)
-            {
-                l_DestroyImmediate(*it_Pending);
-                it_Pending = m_PendingDestroys.erase(it_Pending);
-            }
-            else
-            {
-                ++it_Pending;
-            }
+        // The next value is signalled by a submission that follows every command recorded so far, including any frame
+        // still being recorded, so it covers all work that could reference the resource.
+        m_Retirement.Retire(m_Commands->GetNextTimelineValue(), std::move(release));
+    }
+
+    void Buffers::CollectRetired()
+    {
+        if (m_Commands != nullptr && !m_Retirement.IsEmpty())
+        {
+            m_Retirement.Collect(m_Commands->GetCompletedTimelineValue());
         }
     }
 
     void Buffers::FlushPendingDestroys()
     {
         // Ensure the device is idle before forcing destruction so that queued work cannot access freed resources.
-        if (!m_PendingDestroys.empty())
+        if (!m_Retirement.IsEmpty())
         {
-            vkDeviceWaitIdle(Startup::GetDevice());
+            Startup::WaitForDeviceIdle("buffer teardown");
         }
 
-        auto l_DestroyImmediate = [&](const PendingDestruction& l_Pending)
-            {
-                if (l_Pending.Buffer != VK_NULL_HANDLE)
-                {
-                    vkDestroyBuffer(Startup::GetDevice(), l_Pending.Buffer, nullptr);
-                }
-
-                if (l_Pending.Memory != VK_NULL_HANDLE)
-                {
-                    vkFreeMemory(Startup::GetDevice(), l_Pending.Memory, nullptr);
-                }
-
-                auto l_Tracked = std::find_if(m_Allocations.begin(), m_Allocations.end(),
-                    [&](const Allocation& l_Alloc)
-                    {
-                        return l_Alloc.Buffer == l_Pending.Buffer && l_Alloc.Memory == l_Pending.Memory;
-                    });
-
-                if (l_Tracked != m_Allocations.end())
-                {
-                    m_Allocations.erase(l_Tracked);
-                }
-            };
-
-        for (const PendingDestruction& it_Pending : m_PendingDestroys)
+        m_Retirement.ReleaseAll();
+    }
+
+    void Buffers::ReleaseBuffer(VkBuffer buffer, VkDeviceMemory memory)
+    {
+        if (buffer != VK_NULL_HANDLE)
+        {
+            vkDestroyBuffer(Startup::GetDevice(), buffer, nullptr);
+        }
+
+        if (memory != VK_NULL_HANDLE)
         {
-            l_DestroyImmediate(it_Pending);
+            vkFreeMemory(Startup::GetDevice(), memory, nullptr);
         }
 
-        m_PendingDestroys.clear();
+        auto l_Tracked = std::find_if(m_Allocations.begin(), m_Allocations.end(),
+            [&](const Allocation& l_Alloc)
+            {
+                return l_Alloc.Buffer == buffer && l_Alloc.Memory == memory;
+            });
+
+        if (l_Tracked != m_Allocations.end())
+        {
+            m_Allocations.erase(l_Tracked);
+        }
     }
 }
\ No newline at end of file
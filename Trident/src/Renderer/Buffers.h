@@ -5,35 +5,44 @@
 #include <vector>
 #include <cstddef>
 #include <cstdint>
-#include <limits>
+#include <functional>
 
 #include "Renderer/Vertex.h"
 #include "Renderer/UniformBuffer.h"
-#include "Renderer/CommandBufferPool.h"
+#include "Renderer/ResourceRetirement.h"
 
 namespace Trident
 {
+    class Commands;
+
     class Buffers
     {
     public:
+        // Binds the command timeline that uploads are submitted on and that retired resources are released against.
+        void Init(Commands& commands);
         void Cleanup();
 
-        void CreateVertexBuffer(const std::vector<Vertex>& vertices, CommandBufferPool& pool, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory);
-        void CreateVertexBuffer(const void* vertexData, size_t vertexCount, size_t vertexStride, CommandBufferPool& pool, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory);
-        void CreateIndexBuffer(const std::vector<uint32_t>& indices, CommandBufferPool& pool, VkBuffer& indexBuffer, VkDeviceMemory& indexBufferMemory, uint32_t& indexCount);
+        void CreateVertexBuffer(const std::vector<Vertex>& vertices, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory);
+        void CreateVertexBuffer(const void* vertexData, size_t vertexCount, size_t vertexStride, VkBuffer& vertexBuffer, VkDeviceMemory& vertexBufferMemory);
+        void CreateIndexBuffer(const std::vector<uint32_t>& indices, VkBuffer& indexBuffer, VkDeviceMemory& indexBufferMemory, uint32_t& indexCount);
         void CreateUniformBuffers(uint32_t imageCount, VkDeviceSize bufferSize, std::vector<VkBuffer>& uniformBuffers, std::vector<VkDeviceMemory>& uniformBuffersMemory);
         void CreateStorageBuffers(uint32_t imageCount, VkDeviceSize bufferSize, std::vector<VkBuffer>& storageBuffers, std::vector<VkDeviceMemory>& storageBuffersMemory);
 
         uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
         void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
-        void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, CommandBufferPool& pool);
-        void DestroyBuffer(VkBuffer buffer, VkDeviceMemory memory, VkFence fence = VK_NULL_HANDLE, size_t frameIndex = std::numeric_limits<size_t>::max());
-        void ProcessPendingDestroys(VkFence completedFence, size_t completedFrameIndex);
+        // Submits the copy without waiting and returns the timeline value that marks its completion.
+        uint64_t CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+        // Destruction is deferred until every submission made so far has finished, so callers never idle the device first.
+        void DestroyBuffer(VkBuffer buffer, VkDeviceMemory memory);
+        // Same deferral for any other GPU object; release runs once the current timeline value has completed.
+        void Retire(std::function<void()> release);
+        // Releases everything whose timeline value the GPU has reached. Called once per frame after the frame wait.
+        void CollectRetired();
         void FlushPendingDestroys();
-        void SetCurrentFrame(size_t frameIndex) { m_CurrentFrame = frameIndex; }
+        size_t GetPendingRetirementCount() const { return m_Retirement.GetPendingCount(); }
 
     private:
-        // Utility helpers
+        void ReleaseBuffer(VkBuffer buffer, VkDeviceMemory memory);
 
     private:
         struct Allocation
@@ -42,16 +51,8 @@ namespace Trident
             VkDeviceMemory Memory = VK_NULL_HANDLE;
         };
 
-        struct PendingDestruction
-        {
-            VkBuffer Buffer = VK_NULL_HANDLE;
-            VkDeviceMemory Memory = VK_NULL_HANDLE;
-            VkFence Fence = VK_NULL_HANDLE;
-            size_t FrameIndex = 0;
-        };
-
+        Commands* m_Commands = nullptr;
         std::vector<Allocation> m_Allocations;
-        std::vector<PendingDestruction> m_PendingDestroys;
-        size_t m_CurrentFrame = 0;
+        ResourceRetirement m_Retirement;
     };
 }
\ No newline at end of file
@@ -0,0 +1,951 @@
+#include "Renderer/ClusterCuller.h"
+
+#include "Renderer/Buffers.h"
+#include "Renderer/Camera/Camera.h"
+#include "Renderer/Pipeline.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Trident
+{
+    namespace
+    {
+        constexpr uint32_t s_CullFrustum = 1u << 0;
+        constexpr uint32_t s_CullCone = 1u << 1;
+        constexpr uint32_t s_CullOcclusion = 1u << 2;
+        constexpr uint32_t s_CullLatePhase = 1u << 3;
+        constexpr uint32_t s_CullHistoryValid = 1u << 4;
+        constexpr uint32_t s_StatCounterCount = 4;
+
+        struct PyramidPushConstants
+        {
+            uint32_t m_SourceWidth = 0;
+            uint32_t m_SourceHeight = 0;
+            uint32_t m_TargetWidth = 0;
+            uint32_t m_TargetHeight = 0;
+        };
+
+        static_assert(sizeof(ClusterCuller::ClusterData) == 48, "ClusterData must match the std430 layout in ClusterCull.comp");
+    }
+
+    void ClusterCuller::Init(Pipeline& pipeline, Buffers& buffers)
+    {
+        m_Buffers = &buffers;
+
+        static_assert(sizeof(CullPushConstants) == 112, "CullPushConstants must match ClusterCull.comp");
+        static_assert(sizeof(InstanceData) == 96, "InstanceData must match the std430 layout in ClusterCull.comp");
+
+        VkPhysicalDeviceProperties l_Properties{};
+        vkGetPhysicalDeviceProperties(Startup::GetPhysicalDevice(), &l_Properties);
+        m_MultiDrawIndirect = Startup::SupportsMultiDrawIndirect();
+        m_MaxDrawIndirectCount = m_MultiDrawIndirect ? std::max(1u, l_Properties.limits.maxDrawIndirectCount) : 1u;
+
+        CreateDescriptorResources();
+
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(CullPushConstants);
+
+        // Set 0 carries the per-frame tables, set 1 the per-viewport history and depth pyramid.
+        const std::array<VkDescriptorSetLayout, 2> l_SetLayouts{ m_DescriptorSetLayout, m_ViewSetLayout };
+        VkPipelineLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.setLayoutCount = static_cast<uint32_t>(l_SetLayouts.size());
+        l_LayoutInfo.pSetLayouts = l_SetLayouts.data();
+        l_LayoutInfo.pushConstantRangeCount = 1;
+        l_LayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (vkCreatePipelineLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create cluster culling pipeline layout");
+            return;
+        }
+
+        m_ComputePipeline = pipeline.CreateComputePipeline("ClusterCull.comp", m_PipelineLayout);
+        if (m_ComputePipeline == VK_NULL_HANDLE)
+        {
+            TR_CORE_WARN("Cluster culling disabled; meshes will be drawn without per-cluster rejection");
+        }
+
+        CreatePyramidResources(pipeline);
+
+        TR_CORE_TRACE("ClusterCuller initialised (MultiDrawIndirect = {}, MaxDrawIndirectCount = {}, Occlusion = {})", m_MultiDrawIndirect,
+            m_MaxDrawIndirectCount, m_PyramidPipeline != VK_NULL_HANDLE);
+    }
+
+    void ClusterCuller::Shutdown()
+    {
+        VkDevice l_Device = Startup::GetDevice();
+
+        for (FrameResources& it_Frame : m_Frames)
+        {
+            DestroyFrame(it_Frame);
+        }
+        m_Frames.clear();
+
+        for (auto& it_View : m_Views)
+        {
+            DestroyView(it_View.second);
+        }
+        m_Views.clear();
+
+        if (m_Buffers && m_ClusterBuffer != VK_NULL_HANDLE)
+        {
+            m_Buffers->DestroyBuffer(m_ClusterBuffer, m_ClusterMemory);
+        }
+
+        // Retired view descriptor sets are freed from the pools below, so they must be released before the pools go.
+        if (m_Buffers)
+        {
+            m_Buffers->FlushPendingDestroys();
+        }
+        m_ClusterBuffer = VK_NULL_HANDLE;
+        m_ClusterMemory = VK_NULL_HANDLE;
+        m_Clusters.clear();
+
+        if (m_ComputePipeline != VK_NULL_HANDLE)
+        {
+            vkDestroyPipeline(l_Device, m_ComputePipeline, nullptr);
+            m_ComputePipeline = VK_NULL_HANDLE;
+        }
+
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(l_Device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_PyramidPipeline != VK_NULL_HANDLE)
+        {
+            vkDestroyPipeline(l_Device, m_PyramidPipeline, nullptr);
+            m_PyramidPipeline = VK_NULL_HANDLE;
+        }
+
+        if (m_PyramidPipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(l_Device, m_PyramidPipelineLayout, nullptr);
+            m_PyramidPipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_PyramidSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(l_Device, m_PyramidSetLayout, nullptr);
+            m_PyramidSetLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_PyramidSampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(l_Device, m_PyramidSampler, nullptr);
+            m_PyramidSampler = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(l_Device, m_DescriptorPool, nullptr);
+            m_DescriptorPool = VK_NULL_HANDLE;
+        }
+
+        if (m_ViewDescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(l_Device, m_ViewDescriptorPool, nullptr);
+            m_ViewDescriptorPool = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(l_Device, m_DescriptorSetLayout, nullptr);
+            m_DescriptorSetLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_ViewSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(l_Device, m_ViewSetLayout, nullptr);
+            m_ViewSetLayout = VK_NULL_HANDLE;
+        }
+
+        m_PendingInstances.clear();
+        m_PreviousLayout.clear();
+        m_CurrentLayout.clear();
+        m_PendingCommandCount = 0;
+        m_LastStats = {};
+        m_Buffers = nullptr;
+    }
+
+    void ClusterCuller::UploadClusters(const std::vector<ClusterData>& clusters)
+    {
+        if (!m_Buffers)
+        {
+            return;
+        }
+
+        if (m_ClusterBuffer != VK_NULL_HANDLE)
+        {
+            // Frames still in flight keep their descriptor sets pointing at the old table until the deferred destroy fires.
+            m_Buffers->DestroyBuffer(m_ClusterBuffer, m_ClusterMemory);
+            m_ClusterBuffer = VK_NULL_HANDLE;
+            m_ClusterMemory = VK_NULL_HANDLE;
+        }
+
+        m_Clusters = clusters;
+        ++m_ClusterGeneration;
+
+        if (clusters.empty())
+        {
+            return;
+        }
+
+        const VkDeviceSize l_Size = static_cast<VkDeviceSize>(clusters.size() * sizeof(ClusterData));
+
+        VkBuffer l_StagingBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory l_StagingMemory = VK_NULL_HANDLE;
+        m_Buffers->CreateBuffer(l_Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            l_StagingBuffer, l_StagingMemory);
+
+        void* l_Mapped = nullptr;
+        if (vkMapMemory(Startup::GetDevice(), l_StagingMemory, 0, l_Size, 0, &l_Mapped) == VK_SUCCESS)
+        {
+            std::memcpy(l_Mapped, clusters.data(), static_cast<size_t>(l_Size));
+            vkUnmapMemory(Startup::GetDevice(), l_StagingMemory);
+
+            m_Buffers->CreateBuffer(l_Size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                m_ClusterBuffer, m_ClusterMemory);
+            m_Buffers->CopyBuffer(l_StagingBuffer, m_ClusterBuffer, l_Size);
+        }
+        else
+        {
+            TR_CORE_ERROR("Failed to map cluster staging buffer ({} clusters)", clusters.size());
+        }
+
+        m_Buffers->DestroyBuffer(l_StagingBuffer, l_StagingMemory);
+
+        TR_CORE_TRACE("Uploaded {} mesh clusters for GPU culling", clusters.size());
+    }
+
+    void ClusterCuller::BeginFrame(uint32_t frameIndex)
+    {
+        m_PendingInstances.clear();
+        m_PendingCommandCount = 0;
+        m_PreviousLayout.swap(m_CurrentLayout);
+        m_CurrentLayout.clear();
+        ++m_FrameCounter;
+
+        if (frameIndex >= m_Frames.size())
+        {
+            return;
+        }
+
+        // The caller has already waited on this swapchain image, so the counters from its previous submission are final.
+        FrameResources& l_Frame = m_Frames[frameIndex];
+        if (!l_Frame.m_StatsPending || l_Frame.m_StatsMemory == VK_NULL_HANDLE)
+        {
+            // Nothing was culled in this slot last time, so report an idle pass rather than stale counters.
+            m_LastStats = {};
+
+            return;
+        }
+
+        void* l_Mapped = nullptr;
+        if (vkMapMemory(Startup::GetDevice(), l_Frame.m_StatsMemory, 0, sizeof(uint32_t) * s_StatCounterCount, 0, &l_Mapped) == VK_SUCCESS)
+        {
+            uint32_t l_Counters[s_StatCounterCount]{};
+            std::memcpy(l_Counters, l_Mapped, sizeof(l_Counters));
+            vkUnmapMemory(Startup::GetDevice(), l_Frame.m_StatsMemory);
+
+            m_LastStats.m_SubmittedClusters = l_Frame.m_SubmittedClusters;
+            m_LastStats.m_SubmittedTriangles = l_Frame.m_SubmittedTriangles;
+            m_LastStats.m_VisibleClusters = l_Counters[0];
+            m_LastStats.m_VisibleTriangles = l_Counters[1];
+            m_LastStats.m_OccludedClusters = l_Counters[2];
+            m_LastStats.m_OccludedTriangles = l_Counters[3];
+        }
+
+        l_Frame.m_StatsPending = false;
+    }
+
+    uint32_t ClusterCuller::QueueInstance(uint64_t key, const glm::mat4& modelMatrix, uint32_t firstCluster, uint32_t clusterCount, int32_t baseVertex)
+    {
+        InstanceData l_Instance{};
+        l_Instance.m_ModelMatrix = modelMatrix;
+        l_Instance.m_FirstCluster = firstCluster;
+        l_Instance.m_ClusterCount = clusterCount;
+        l_Instance.m_FirstCommand = m_PendingCommandCount;
+        l_Instance.m_BaseVertex = baseVertex;
+        l_Instance.m_PreviousFirstCommand = s_NoHistory;
+
+        // History only carries over while the instance keeps the same cluster range; a LOD switch re-tests from scratch.
+        const auto it_Previous = m_PreviousLayout.find(key);
+        if (it_Previous != m_PreviousLayout.end() && it_Previous->second.m_FirstCluster == firstCluster && it_Previous->second.m_ClusterCount == clusterCount)
+        {
+            l_Instance.m_PreviousFirstCommand = it_Previous->second.m_FirstCommand;
+        }
+
+        m_CurrentLayout[key] = InstanceLayout{ l_Instance.m_FirstCommand, firstCluster, clusterCount };
+        m_PendingInstances.push_back(l_Instance);
+
+        m_PendingCommandCount += clusterCount;
+
+        return l_Instance.m_FirstCommand;
+    }
+
+    bool ClusterCuller::UploadInstances(uint32_t frameIndex)
+    {
+        if (!IsReady() || m_PendingInstances.empty())
+        {
+            if (frameIndex < m_Frames.size())
+            {
+                m_Frames[frameIndex].m_InstanceCount = 0;
+            }
+
+            return m_PendingInstances.empty();
+        }
+
+        EnsureFrame(frameIndex);
+        if (frameIndex >= m_Frames.size() || m_Frames[frameIndex].m_DescriptorSet == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        FrameResources& l_Frame = m_Frames[frameIndex];
+        const uint32_t l_InstanceCount = static_cast<uint32_t>(m_PendingInstances.size());
+
+        // Grow by 1.5x so a steadily growing scene does not reallocate every frame.
+        if (l_InstanceCount > l_Frame.m_InstanceCapacity)
+        {
+            if (l_Frame.m_InstanceBuffer != VK_NULL_HANDLE)
+            {
+                m_Buffers->DestroyBuffer(l_Frame.m_InstanceBuffer, l_Frame.m_InstanceMemory);
+            }
+
+            l_Frame.m_InstanceCapacity = std::max(l_InstanceCount, l_Frame.m_InstanceCapacity + l_Frame.m_InstanceCapacity / 2);
+            m_Buffers->CreateBuffer(static_cast<VkDeviceSize>(l_Frame.m_InstanceCapacity) * sizeof(InstanceData), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, l_Frame.m_InstanceBuffer, l_Frame.m_InstanceMemory);
+            l_Frame.m_DescriptorDirty = true;
+        }
+
+        if (m_PendingCommandCount > l_Frame.m_CommandCapacity)
+        {
+            if (l_Frame.m_CommandBuffer != VK_NULL_HANDLE)
+            {
+                m_Buffers->DestroyBuffer(l_Frame.m_CommandBuffer, l_Frame.m_CommandMemory);
+            }
+
+            // Early and late commands live side by side so the late pass never overwrites commands still queued for drawing.
+            l_Frame.m_CommandCapacity = std::max(m_PendingCommandCount, l_Frame.m_CommandCapacity + l_Frame.m_CommandCapacity / 2);
+            m_Buffers->CreateBuffer(static_cast<VkDeviceSize>(l_Frame.m_CommandCapacity) * 2 * sizeof(VkDrawIndexedIndirectCommand),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                l_Frame.m_CommandBuffer, l_Frame.m_CommandMemory);
+            l_Frame.m_DescriptorDirty = true;
+        }
+
+        if (l_Frame.m_ClusterGeneration != m_ClusterGeneration)
+        {
+            l_Frame.m_DescriptorDirty = true;
+        }
+
+        if (l_Frame.m_DescriptorDirty)
+        {
+            UpdateDescriptorSet(l_Frame);
+            if (l_Frame.m_DescriptorDirty)
+            {
+                l_Frame.m_InstanceCount = 0;
+
+                return false;
+            }
+        }
+
+        const VkDeviceSize l_CopySize = static_cast<VkDeviceSize>(l_InstanceCount) * sizeof(InstanceData);
+        void* l_Mapped = nullptr;
+        if (vkMapMemory(Startup::GetDevice(), l_Frame.m_InstanceMemory, 0, l_CopySize, 0, &l_Mapped) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to map cluster instance buffer for frame {}", frameIndex);
+            l_Frame.m_InstanceCount = 0;
+
+            return false;
+        }
+
+        std::memcpy(l_Mapped, m_PendingInstances.data(), static_cast<size_t>(l_CopySize));
+        vkUnmapMemory(Startup::GetDevice(), l_Frame.m_InstanceMemory);
+
+        l_Frame.m_InstanceCount = l_InstanceCount;
+        l_Frame.m_MaxClustersPerInstance = 0;
+        l_Frame.m_SubmittedClusters = m_PendingCommandCount;
+        l_Frame.m_SubmittedTriangles = 0;
+        for (const InstanceData& it_Instance : m_PendingInstances)
+        {
+            l_Frame.m_MaxClustersPerInstance = std::max(l_Frame.m_MaxClustersPerInstance, it_Instance.m_ClusterCount);
+            for (uint32_t it_Cluster = 0; it_Cluster < it_Instance.m_ClusterCount; ++it_Cluster)
+            {
+                l_Frame.m_SubmittedTriangles += m_Clusters[it_Instance.m_FirstCluster + it_Cluster].m_IndexCount / 3;
+            }
+        }
+
+        return true;
+    }
+
+    ClusterCuller::CullResult ClusterCuller::RecordCulling(VkCommandBuffer commandBuffer, uint32_t frameIndex, const Camera* camera, const ViewTarget& target,
+        bool occlusionEnabled)
+    {
+        if (!IsReady() || frameIndex >= m_Frames.size() || m_Frames[frameIndex].m_InstanceCount == 0)
+        {
+            return CullResult::Unculled;
+        }
+
+        FrameResources& l_Frame = m_Frames[frameIndex];
+        ViewState* l_View = EnsureView(target, frameIndex, l_Frame.m_SubmittedClusters);
+        if (l_View == nullptr)
+        {
+            return CullResult::Unculled;
+        }
+
+        const bool l_TwoPhase = occlusionEnabled && camera != nullptr && m_PyramidPipeline != VK_NULL_HANDLE && l_View->m_Pyramid.IsValid();
+
+        CullPushConstants l_Constants{};
+        l_Constants.m_InstanceCount = l_Frame.m_InstanceCount;
+        l_Constants.m_DepthSize = glm::vec2(static_cast<float>(target.m_Extent.width), static_cast<float>(target.m_Extent.height));
+        l_Constants.m_PyramidLevels = l_View->m_Pyramid.GetLevelCount();
+        if (camera)
+        {
+            l_Constants.m_ViewProjection = camera->GetProjectionMatrix() * camera->GetViewMatrix();
+
+            if (camera->GetProjectionType() == Camera::ProjectionType::Orthographic)
+            {
+                // Orthographic rays are parallel, so the cone test only needs the view direction.
+                const glm::mat4 l_InverseView = glm::inverse(camera->GetViewMatrix());
+                l_Constants.m_CameraPosition = glm::vec4(-glm::normalize(glm::vec3(l_InverseView[2])), 0.0f);
+            }
+            else
+            {
+                l_Constants.m_CameraPosition = glm::vec4(camera->GetPosition(), 1.0f);
+            }
+
+            l_Constants.m_Flags = s_CullFrustum | s_CullCone;
+        }
+
+        if (l_TwoPhase)
+        {
+            l_Constants.m_Flags |= s_CullOcclusion;
+            if (l_View->m_HistoryValid && l_View->m_LastOcclusionFrame + 1 == m_FrameCounter)
+            {
+                l_Constants.m_Flags |= s_CullHistoryValid;
+            }
+        }
+
+        // Earlier viewports (and earlier frames) may still be reading the indirect, stats and history buffers.
+        VkMemoryBarrier l_ReuseBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        l_ReuseBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        l_ReuseBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &l_ReuseBarrier, 0, nullptr, 0, nullptr);
+
+        vkCmdFillBuffer(commandBuffer, l_Frame.m_StatsBuffer, 0, sizeof(uint32_t) * s_StatCounterCount, 0);
+
+        VkMemoryBarrier l_ClearBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        l_ClearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        l_ClearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &l_ClearBarrier, 0, nullptr, 0, nullptr);
+
+        RecordDispatch(commandBuffer, l_Frame, l_View->m_FrameSets[frameIndex][l_View->m_ReadIndex], l_Constants);
+
+        l_Frame.m_StatsPending = true;
+        l_View->m_PendingLate = l_TwoPhase;
+        if (l_TwoPhase)
+        {
+            l_View->m_LateConstants = l_Constants;
+            l_View->m_LateConstants.m_Flags |= s_CullLatePhase;
+            l_View->m_LateConstants.m_CommandBase = l_Frame.m_CommandCapacity;
+
+            return CullResult::TwoPhase;
+        }
+
+        return CullResult::SinglePass;
+    }
+
+    void ClusterCuller::RecordOcclusionPass(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t viewportId)
+    {
+        const auto it_View = m_Views.find(viewportId);
+        if (it_View == m_Views.end() || !it_View->second.m_PendingLate || frameIndex >= m_Frames.size())
+        {
+            return;
+        }
+
+        ViewState& l_View = it_View->second;
+        l_View.m_PendingLate = false;
+
+        VkImageMemoryBarrier l_DepthBarrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        l_DepthBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_DepthBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_DepthBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        l_DepthBarrier.subresourceRange.baseMipLevel = 0;
+        l_DepthBarrier.subresourceRange.levelCount = 1;
+        l_DepthBarrier.subresourceRange.baseArrayLayer = 0;
+        l_DepthBarrier.subresourceRange.layerCount = 1;
+        l_DepthBarrier.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        l_DepthBarrier.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        l_DepthBarrier.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        l_DepthBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        l_DepthBarrier.image = l_View.m_DepthImage;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_DepthBarrier);
+
+        l_View.m_Pyramid.Record(commandBuffer, m_PyramidPipeline, m_PyramidPipelineLayout);
+
+        // Hand depth back to the continuation pass; only an execution dependency is needed after the reads.
+        l_DepthBarrier.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        l_DepthBarrier.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        l_DepthBarrier.srcAccessMask = 0;
+        l_DepthBarrier.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &l_DepthBarrier);
+
+        RecordDispatch(commandBuffer, m_Frames[frameIndex], l_View.m_FrameSets[frameIndex][l_View.m_ReadIndex], l_View.m_LateConstants);
+
+        // The late pass wrote the other history buffer; it becomes next frame's input.
+        l_View.m_ReadIndex ^= 1u;
+        l_View.m_LastOcclusionFrame = m_FrameCounter;
+        l_View.m_HistoryValid = true;
+    }
+
+    void ClusterCuller::RecordDispatch(VkCommandBuffer commandBuffer, const FrameResources& frame, VkDescriptorSet viewSet, const CullPushConstants& constants)
+    {
+        const std::array<VkDescriptorSet, 2> l_Sets{ frame.m_DescriptorSet, viewSet };
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_ComputePipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, static_cast<uint32_t>(l_Sets.size()), l_Sets.data(), 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullPushConstants), &constants);
+
+        const uint32_t l_GroupsX = (frame.m_MaxClustersPerInstance + s_WorkGroupSize - 1) / s_WorkGroupSize;
+        vkCmdDispatch(commandBuffer, l_GroupsX, frame.m_InstanceCount, 1);
+
+        VkMemoryBarrier l_ResultBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        l_ResultBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        l_ResultBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+            0, 1, &l_ResultBarrier, 0, nullptr, 0, nullptr);
+    }
+
+    void ClusterCuller::DrawClusters(VkCommandBuffer commandBuffer, uint32_t frameIndex, CullPhase phase, uint32_t firstCommand, uint32_t commandCount) const
+    {
+        if (frameIndex >= m_Frames.size() || m_Frames[frameIndex].m_CommandBuffer == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        const FrameResources& l_Frame = m_Frames[frameIndex];
+        const uint32_t l_Base = phase == CullPhase::Late ? l_Frame.m_CommandCapacity : 0u;
+        constexpr uint32_t l_Stride = sizeof(VkDrawIndexedIndirectCommand);
+
+        // Culled clusters carry a zero index count, so the whole block can be submitted without a count buffer.
+        uint32_t l_Issued = 0;
+        while (l_Issued < commandCount)
+        {
+            const uint32_t l_Batch = std::min(commandCount - l_Issued, m_MaxDrawIndirectCount);
+            const VkDeviceSize l_Offset = static_cast<VkDeviceSize>(l_Base + firstCommand + l_Issued) * l_Stride;
+            vkCmdDrawIndexedIndirect(commandBuffer, l_Frame.m_CommandBuffer, l_Offset, l_Batch, l_Stride);
+            l_Issued += l_Batch;
+        }
+    }
+
+    void ClusterCuller::ReleaseView(uint32_t viewportId)
+    {
+        const auto it_View = m_Views.find(viewportId);
+        if (it_View == m_Views.end())
+        {
+            return;
+        }
+
+        DestroyView(it_View->second);
+        m_Views.erase(it_View);
+    }
+
+    void ClusterCuller::CreateDescriptorResources()
+    {
+        std::array<VkDescriptorSetLayoutBinding, 4> l_Bindings{};
+        for (uint32_t it_Binding = 0; it_Binding < l_Bindings.size(); ++it_Binding)
+        {
+            // 0 -> Cluster table, 1 -> Instance table, 2 -> Indirect commands, 3 -> Visibility counters.
+            l_Bindings[it_Binding].binding = it_Binding;
+            l_Bindings[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            l_Bindings[it_Binding].descriptorCount = 1;
+            l_Bindings[it_Binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_Bindings.size());
+        l_LayoutInfo.pBindings = l_Bindings.data();
+
+        if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create cluster culling descriptor set layout");
+            return;
+        }
+
+        VkDescriptorPoolSize l_PoolSize{};
+        l_PoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_PoolSize.descriptorCount = static_cast<uint32_t>(l_Bindings.size()) * s_MaxFrames;
+
+        VkDescriptorPoolCreateInfo l_PoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        l_PoolInfo.maxSets = s_MaxFrames;
+        l_PoolInfo.poolSizeCount = 1;
+        l_PoolInfo.pPoolSizes = &l_PoolSize;
+
+        if (vkCreateDescriptorPool(Startup::GetDevice(), &l_PoolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create cluster culling descriptor pool");
+        }
+
+        // 0 -> History read by this frame, 1 -> History written by the late phase, 2 -> Depth pyramid.
+        std::array<VkDescriptorSetLayoutBinding, 3> l_ViewBindings{};
+        for (uint32_t it_Binding = 0; it_Binding < l_ViewBindings.size(); ++it_Binding)
+        {
+            l_ViewBindings[it_Binding].binding = it_Binding;
+            l_ViewBindings[it_Binding].descriptorType = it_Binding == 2 ? VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            l_ViewBindings[it_Binding].descriptorCount = 1;
+            l_ViewBindings[it_Binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_ViewBindings.size());
+        l_LayoutInfo.pBindings = l_ViewBindings.data();
+        if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_ViewSetLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create occlusion culling descriptor set layout");
+            return;
+        }
+
+        // Each view holds one set per frame and history parity.
+        const uint32_t l_ViewSetCount = s_MaxViews * s_MaxFrames * 2;
+        std::array<VkDescriptorPoolSize, 2> l_ViewPoolSizes{};
+        l_ViewPoolSizes[0] = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, l_ViewSetCount * 2 };
+        l_ViewPoolSizes[1] = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, l_ViewSetCount };
+
+        VkDescriptorPoolCreateInfo l_ViewPoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        l_ViewPoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        l_ViewPoolInfo.maxSets = l_ViewSetCount;
+        l_ViewPoolInfo.poolSizeCount = static_cast<uint32_t>(l_ViewPoolSizes.size());
+        l_ViewPoolInfo.pPoolSizes = l_ViewPoolSizes.data();
+
+        if (vkCreateDescriptorPool(Startup::GetDevice(), &l_ViewPoolInfo, nullptr, &m_ViewDescriptorPool) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create occlusion culling descriptor pool");
+        }
+    }
+
+    void ClusterCuller::CreatePyramidResources(Pipeline& pipeline)
+    {
+        std::array<VkDescriptorSetLayoutBinding, 2> l_Bindings{};
+        l_Bindings[0].binding = 0;
+        l_Bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_Bindings[0].descriptorCount = 1;
+        l_Bindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_Bindings[1].binding = 1;
+        l_Bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        l_Bindings[1].descriptorCount = 1;
+        l_Bindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        VkDescriptorSetLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_Bindings.size());
+        l_LayoutInfo.pBindings = l_Bindings.data();
+
+        if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_PyramidSetLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create depth pyramid descriptor set layout");
+            return;
+        }
+
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(PyramidPushConstants);
+
+        VkPipelineLayoutCreateInfo l_PipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_PipelineLayoutInfo.setLayoutCount = 1;
+        l_PipelineLayoutInfo.pSetLayouts = &m_PyramidSetLayout;
+        l_PipelineLayoutInfo.pushConstantRangeCount = 1;
+        l_PipelineLayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (vkCreatePipelineLayout(Startup::GetDevice(), &l_PipelineLayoutInfo, nullptr, &m_PyramidPipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create depth pyramid pipeline layout");
+            return;
+        }
+
+        // Only texelFetch is used, so filtering never blends depths across texels.
+        VkSamplerCreateInfo l_SamplerInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+        l_SamplerInfo.magFilter = VK_FILTER_NEAREST;
+        l_SamplerInfo.minFilter = VK_FILTER_NEAREST;
+        l_SamplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        l_SamplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.minLod = 0.0f;
+        l_SamplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+        l_SamplerInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+
+        if (vkCreateSampler(Startup::GetDevice(), &l_SamplerInfo, nullptr, &m_PyramidSampler) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create depth pyramid sampler");
+            return;
+        }
+
+        m_PyramidPipeline = pipeline.CreateComputePipeline("DepthPyramid.comp", m_PyramidPipelineLayout);
+        if (m_PyramidPipeline == VK_NULL_HANDLE)
+        {
+            TR_CORE_WARN("Depth pyramid pipeline unavailable; occlusion culling disabled");
+        }
+    }
+
+    void ClusterCuller::EnsureFrame(uint32_t frameIndex)
+    {
+        if (frameIndex < m_Frames.size())
+        {
+            return;
+        }
+
+        if (frameIndex >= s_MaxFrames || m_DescriptorPool == VK_NULL_HANDLE)
+        {
+            TR_CORE_ERROR("Cluster culling supports at most {} frames; frame {} will draw unculled", s_MaxFrames, frameIndex);
+            return;
+        }
+
+        const size_t l_FirstNew = m_Frames.size();
+        m_Frames.resize(static_cast<size_t>(frameIndex) + 1);
+
+        for (size_t it_Index = l_FirstNew; it_Index < m_Frames.size(); ++it_Index)
+        {
+            FrameResources& l_Frame = m_Frames[it_Index];
+
+            VkDescriptorSetAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+            l_AllocateInfo.descriptorPool = m_DescriptorPool;
+            l_AllocateInfo.descriptorSetCount = 1;
+            l_AllocateInfo.pSetLayouts = &m_DescriptorSetLayout;
+            if (vkAllocateDescriptorSets(Startup::GetDevice(), &l_AllocateInfo, &l_Frame.m_DescriptorSet) != VK_SUCCESS)
+            {
+                TR_CORE_ERROR("Failed to allocate cluster culling descriptor set for frame {}", it_Index);
+            }
+
+            m_Buffers->CreateBuffer(sizeof(uint32_t) * s_StatCounterCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, l_Frame.m_StatsBuffer, l_Frame.m_StatsMemory);
+        }
+    }
+
+    void ClusterCuller::DestroyFrame(FrameResources& frame)
+    {
+        if (m_Buffers)
+        {
+            m_Buffers->DestroyBuffer(frame.m_InstanceBuffer, frame.m_InstanceMemory);
+            m_Buffers->DestroyBuffer(frame.m_CommandBuffer, frame.m_CommandMemory);
+            m_Buffers->DestroyBuffer(frame.m_StatsBuffer, frame.m_StatsMemory);
+        }
+
+        // Descriptor sets are released together with the pool.
+        frame = {};
+    }
+
+    void ClusterCuller::UpdateDescriptorSet(FrameResources& frame)
+    {
+        if (frame.m_DescriptorSet == VK_NULL_HANDLE || m_ClusterBuffer == VK_NULL_HANDLE || frame.m_InstanceBuffer == VK_NULL_HANDLE
+            || frame.m_CommandBuffer == VK_NULL_HANDLE || frame.m_StatsBuffer == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        std::array<VkDescriptorBufferInfo, 4> l_BufferInfos{};
+        l_BufferInfos[0] = { m_ClusterBuffer, 0, VK_WHOLE_SIZE };
+        l_BufferInfos[1] = { frame.m_InstanceBuffer, 0, VK_WHOLE_SIZE };
+        l_BufferInfos[2] = { frame.m_CommandBuffer, 0, VK_WHOLE_SIZE };
+        l_BufferInfos[3] = { frame.m_StatsBuffer, 0, VK_WHOLE_SIZE };
+
+        std::array<VkWriteDescriptorSet, 4> l_Writes{};
+        for (uint32_t it_Binding = 0; it_Binding < l_Writes.size(); ++it_Binding)
+        {
+            l_Writes[it_Binding] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            l_Writes[it_Binding].dstSet = frame.m_DescriptorSet;
+            l_Writes[it_Binding].dstBinding = it_Binding;
+            l_Writes[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            l_Writes[it_Binding].descriptorCount = 1;
+            l_Writes[it_Binding].pBufferInfo = &l_BufferInfos[it_Binding];
+        }
+
+        vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+
+        frame.m_ClusterGeneration = m_ClusterGeneration;
+        frame.m_DescriptorDirty = false;
+    }
+
+    ClusterCuller::ViewState* ClusterCuller::EnsureView(const ViewTarget& target, uint32_t frameIndex, uint32_t commandCount)
+    {
+        if (target.m_DepthImage == VK_NULL_HANDLE || target.m_DepthView == VK_NULL_HANDLE || m_ViewDescriptorPool == VK_NULL_HANDLE
+            || m_PyramidSetLayout == VK_NULL_HANDLE || m_PyramidSampler == VK_NULL_HANDLE || frameIndex >= s_MaxFrames)
+        {
+            return nullptr;
+        }
+
+        auto it_View = m_Views.find(target.m_ViewportId);
+        if (it_View == m_Views.end())
+        {
+            if (m_Views.size() >= s_MaxViews)
+            {
+                return nullptr;
+            }
+
+            it_View = m_Views.try_emplace(target.m_ViewportId).first;
+        }
+
+        ViewState& l_View = it_View->second;
+
+        // Attachments are recreated without idling the device; Create retires the previous pyramid instead of destroying it.
+        if (!l_View.m_Pyramid.IsValid() || l_View.m_TargetRevision != target.m_Revision || l_View.m_DepthImage != target.m_DepthImage)
+        {
+            if (!l_View.m_Pyramid.Create(*m_Buffers, target.m_DepthView, target.m_AttachmentExtent, m_PyramidSetLayout, m_PyramidSampler))
+            {
+                return nullptr;
+            }
+
+            l_View.m_TargetRevision = target.m_Revision;
+            l_View.m_DepthImage = target.m_DepthImage;
+            l_View.m_HistoryValid = false;
+            ++l_View.m_Generation;
+        }
+
+        if (commandCount > l_View.m_HistoryCapacity)
+        {
+            for (size_t it_Index = 0; it_Index < l_View.m_HistoryBuffers.size(); ++it_Index)
+            {
+                if (l_View.m_HistoryBuffers[it_Index] != VK_NULL_HANDLE)
+                {
+                    m_Buffers->DestroyBuffer(l_View.m_HistoryBuffers[it_Index], l_View.m_HistoryMemory[it_Index]);
+                }
+            }
+
+            l_View.m_HistoryCapacity = std::max(commandCount, l_View.m_HistoryCapacity + l_View.m_HistoryCapacity / 2);
+            for (size_t it_Index = 0; it_Index < l_View.m_HistoryBuffers.size(); ++it_Index)
+            {
+                m_Buffers->CreateBuffer(static_cast<VkDeviceSize>(l_View.m_HistoryCapacity) * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, l_View.m_HistoryBuffers[it_Index], l_View.m_HistoryMemory[it_Index]);
+            }
+
+            l_View.m_HistoryValid = false;
+            ++l_View.m_Generation;
+        }
+
+        if (l_View.m_FrameSets.size() <= frameIndex)
+        {
+            l_View.m_FrameSets.resize(static_cast<size_t>(frameIndex) + 1, { VK_NULL_HANDLE, VK_NULL_HANDLE });
+            l_View.m_FrameSetGenerations.resize(static_cast<size_t>(frameIndex) + 1, 0);
+        }
+
+        // This frame slot's previous submission has retired, so its sets can be rewritten without racing the GPU.
+        if (l_View.m_FrameSetGenerations[frameIndex] != l_View.m_Generation)
+        {
+            std::array<VkDescriptorSet, 2>& l_Sets = l_View.m_FrameSets[frameIndex];
+            if (l_Sets[0] == VK_NULL_HANDLE)
+            {
+                const std::array<VkDescriptorSetLayout, 2> l_Layouts{ m_ViewSetLayout, m_ViewSetLayout };
+                VkDescriptorSetAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+                l_AllocateInfo.descriptorPool = m_ViewDescriptorPool;
+                l_AllocateInfo.descriptorSetCount = static_cast<uint32_t>(l_Layouts.size());
+                l_AllocateInfo.pSetLayouts = l_Layouts.data();
+                if (vkAllocateDescriptorSets(Startup::GetDevice(), &l_AllocateInfo, l_Sets.data()) != VK_SUCCESS)
+                {
+                    TR_CORE_ERROR("Failed to allocate occlusion culling descriptor sets for viewport {}", target.m_ViewportId);
+                    l_Sets = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+
+                    return nullptr;
+                }
+            }
+
+            VkDescriptorImageInfo l_PyramidInfo{};
+            l_PyramidInfo.sampler = m_PyramidSampler;
+            l_PyramidInfo.imageView = l_View.m_Pyramid.GetView();
+            l_PyramidInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+            for (uint32_t it_Read = 0; it_Read < 2; ++it_Read)
+            {
+                const std::array<VkDescriptorBufferInfo, 2> l_HistoryInfos{
+                    VkDescriptorBufferInfo{ l_View.m_HistoryBuffers[it_Read], 0, VK_WHOLE_SIZE },
+                    VkDescriptorBufferInfo{ l_View.m_HistoryBuffers[1 - it_Read], 0, VK_WHOLE_SIZE } };
+
+                std::array<VkWriteDescriptorSet, 3> l_Writes{};
+                for (uint32_t it_Binding = 0; it_Binding < l_Writes.size(); ++it_Binding)
+                {
+                    l_Writes[it_Binding] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+                    l_Writes[it_Binding].dstSet = l_Sets[it_Read];
+                    l_Writes[it_Binding].dstBinding = it_Binding;
+                    l_Writes[it_Binding].descriptorCount = 1;
+                    if (it_Binding < 2)
+                    {
+                        l_Writes[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                        l_Writes[it_Binding].pBufferInfo = &l_HistoryInfos[it_Binding];
+                    }
+                    else
+                    {
+                        l_Writes[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+                        l_Writes[it_Binding].pImageInfo = &l_PyramidInfo;
+                    }
+                }
+
+                vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+            }
+
+            l_View.m_FrameSetGenerations[frameIndex] = l_View.m_Generation;
+        }
+
+        return &l_View;
+    }
+
+    void ClusterCuller::DestroyView(ViewState& view)
+    {
+        if (m_Buffers)
+        {
+            view.m_Pyramid.Retire(*m_Buffers);
+        }
+        else
+        {
+            view.m_Pyramid.Destroy();
+        }
+
+        for (size_t it_Index = 0; it_Index < view.m_HistoryBuffers.size(); ++it_Index)
+        {
+            if (m_Buffers && view.m_HistoryBuffers[it_Index] != VK_NULL_HANDLE)
+            {
+                m_Buffers->DestroyBuffer(view.m_HistoryBuffers[it_Index], view.m_HistoryMemory[it_Index]);
+            }
+
+            view.m_HistoryBuffers[it_Index] = VK_NULL_HANDLE;
+            view.m_HistoryMemory[it_Index] = VK_NULL_HANDLE;
+        }
+
+        for (std::array<VkDescriptorSet, 2>& it_Sets : view.m_FrameSets)
+        {
+            if (it_Sets[0] == VK_NULL_HANDLE || m_ViewDescriptorPool == VK_NULL_HANDLE)
+            {
+                continue;
+            }
+
+            // In-flight frames may still have the sets bound; free them once those submissions complete.
+            const VkDescriptorPool l_Pool = m_ViewDescriptorPool;
+            const std::array<VkDescriptorSet, 2> l_Sets = it_Sets;
+            auto a_Free = [l_Pool, l_Sets]()
+                {
+                    vkFreeDescriptorSets(Startup::GetDevice(), l_Pool, static_cast<uint32_t>(l_Sets.size()), l_Sets.data());
+                };
+
+            if (m_Buffers)
+            {
+                m_Buffers->Retire(a_Free);
+            }
+            else
+            {
+                a_Free();
+            }
+        }
+
+        view.m_FrameSets.clear();
+        view.m_FrameSetGenerations.clear();
+        view.m_HistoryCapacity = 0;
+        view.m_HistoryValid = false;
+        view.m_PendingLate = false;
+    }
+}
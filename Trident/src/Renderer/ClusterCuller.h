@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Renderer/DepthPyramid.h"
+
+#include <vulkan/vulkan.h>
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Trident
+{
+    class Buffers;
+    class Camera;
+    class Pipeline;
+
+    /**
+     * @brief Runs per-cluster frustum, backface-cone and hierarchical-Z occlusion culling in compute ahead of the main draw.
+     *
+     * Each mesh instance queued for the frame owns a contiguous block of VkDrawIndexedIndirectCommand records, one per
+     * cluster. Meshes without meshlets are represented by a single cluster covering the selected LOD, so every unskinned
+     * draw shares the same indirect path. Only core Vulkan features are used so the path runs on software rasterisers
+     * such as lavapipe; devices without multiDrawIndirect fall back to one indirect draw per cluster.
+     *
+     * Occlusion runs in two phases per viewport. The early phase draws clusters that were visible last frame; its depth
+     * is reduced into a pyramid and the late phase re-tests every cluster against it, drawing the ones the early phase
+     * skipped and recording visibility for the next frame. Newly revealed geometry therefore appears without a frame of lag.
+     */
+    class ClusterCuller
+    {
+    public:
+        // Mirrors the std430 layout consumed by ClusterCull.comp.
+        struct ClusterData
+        {
+            glm::vec4 m_BoundingSphere{ 0.0f }; // xyz = object-space centre, w = radius.
+            glm::vec4 m_Cone{ 0.0f, 0.0f, 1.0f, 1.0f }; // xyz = cone axis, w = cutoff (>= 1 disables backface culling).
+            uint32_t m_FirstIndex = 0;          // Absolute offset into the shared index buffer.
+            uint32_t m_IndexCount = 0;          // Number of indices drawn when the cluster survives.
+            uint32_t m_Padding0 = 0;
+            uint32_t m_Padding1 = 0;
+        };
+
+        // Aggregated culling results from the most recently completed frame.
+        struct CullingStats
+        {
+            uint32_t m_SubmittedClusters = 0;   // Clusters tested by the compute pass.
+            uint32_t m_VisibleClusters = 0;     // Clusters that survived every test.
+            uint32_t m_OccludedClusters = 0;    // Clusters inside the frustum but hidden behind the depth pyramid.
+            uint64_t m_SubmittedTriangles = 0;  // Triangles represented by the tested clusters.
+            uint64_t m_VisibleTriangles = 0;    // Triangles that actually reached the rasteriser.
+            uint64_t m_OccludedTriangles = 0;   // Triangles rejected by occlusion alone.
+        };
+
+        enum class CullPhase : uint8_t
+        {
+            Early,  // Clusters visible last frame, or every surviving cluster when occlusion is off.
+            Late    // Clusters revealed by this frame's depth pyramid.
+        };
+
+        enum class CullResult : uint8_t
+        {
+            Unculled,   // Nothing was recorded; draw the queued instances directly.
+            SinglePass, // Early commands hold the full visible set.
+            TwoPhase    // Record RecordOcclusionPass after the early draws, then draw the late commands.
+        };
+
+        // Describes the depth attachment the occlusion pass reduces.
+        struct ViewTarget
+        {
+            uint32_t m_ViewportId = 0;
+            VkImage m_DepthImage = VK_NULL_HANDLE;
+            VkImageView m_DepthView = VK_NULL_HANDLE;
+            VkExtent2D m_Extent{ 0, 0 };        // Rendered region of the attachment; culling projects into it.
+            VkExtent2D m_AttachmentExtent{ 0, 0 }; // Full attachment size the pyramid is built over, so cropping never rebuilds it.
+            uint32_t m_Revision = 0;            // Bumped whenever the attachment is recreated.
+        };
+
+        void Init(Pipeline& pipeline, Buffers& buffers);
+        void Shutdown();
+
+        void UploadClusters(const std::vector<ClusterData>& clusters);
+
+        void BeginFrame(uint32_t frameIndex);
+        // Returns the first command slot reserved for the instance; clusters are drawn from that slot onward.
+        // The key identifies the instance across frames so occlusion history can follow it.
+        uint32_t QueueInstance(uint64_t key, const glm::mat4& modelMatrix, uint32_t firstCluster, uint32_t clusterCount, int32_t baseVertex);
+        // Returns false when the queued instances could not be uploaded and must be drawn without culling.
+        bool UploadInstances(uint32_t frameIndex);
+
+        CullResult RecordCulling(VkCommandBuffer commandBuffer, uint32_t frameIndex, const Camera* camera, const ViewTarget& target, bool occlusionEnabled);
+        // Recorded between the early and late render passes while depth is in DEPTH_STENCIL_ATTACHMENT_OPTIMAL; restores that layout.
+        void RecordOcclusionPass(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t viewportId);
+        void DrawClusters(VkCommandBuffer commandBuffer, uint32_t frameIndex, CullPhase phase, uint32_t firstCommand, uint32_t commandCount) const;
+
+        // Releases the pyramid and history of a viewport; the caller guarantees the GPU is idle.
+        void ReleaseView(uint32_t viewportId);
+
+        bool IsReady() const { return m_ComputePipeline != VK_NULL_HANDLE && m_ClusterBuffer != VK_NULL_HANDLE; }
+        const CullingStats& GetStats() const { return m_LastStats; }
+
+    private:
+        // 112 bytes, inside the 128-byte push constant budget every Vulkan implementation guarantees.
+        struct CullPushConstants
+        {
+            glm::mat4 m_ViewProjection{ 1.0f };
+            glm::vec4 m_CameraPosition{ 0.0f }; // xyz = eye (perspective) or view direction (orthographic); w = 1 for perspective.
+            glm::vec2 m_DepthSize{ 0.0f };      // Depth attachment size in pixels that the pyramid was reduced from.
+            uint32_t m_PyramidLevels = 0;
+            uint32_t m_InstanceCount = 0;
+            uint32_t m_Flags = 0;
+            uint32_t m_CommandBase = 0;         // 0 for the early block, the frame's command capacity for the late block.
+            uint32_t m_Padding0 = 0;
+            uint32_t m_Padding1 = 0;
+        };
+
+        struct InstanceData
+        {
+            glm::mat4 m_ModelMatrix{ 1.0f };
+            uint32_t m_FirstCluster = 0;
+            uint32_t m_ClusterCount = 0;
+            uint32_t m_FirstCommand = 0;
+            int32_t m_BaseVertex = 0;
+            uint32_t m_PreviousFirstCommand = 0; // Command slot the same instance used last frame, or s_NoHistory.
+            uint32_t m_Padding0 = 0;
+            uint32_t m_Padding1 = 0;
+            uint32_t m_Padding2 = 0;
+        };
+
+        struct InstanceLayout
+        {
+            uint32_t m_FirstCommand = 0;
+            uint32_t m_FirstCluster = 0;
+            uint32_t m_ClusterCount = 0;
+        };
+
+        struct FrameResources
+        {
+            VkBuffer m_InstanceBuffer = VK_NULL_HANDLE;        // Host-visible instance table rewritten every frame.
+            VkDeviceMemory m_InstanceMemory = VK_NULL_HANDLE;
+            VkBuffer m_CommandBuffer = VK_NULL_HANDLE;         // Device-local early and late command blocks written by compute.
+            VkDeviceMemory m_CommandMemory = VK_NULL_HANDLE;
+            VkBuffer m_StatsBuffer = VK_NULL_HANDLE;           // Four counters read back once the frame retires.
+            VkDeviceMemory m_StatsMemory = VK_NULL_HANDLE;
+            VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+            uint32_t m_InstanceCapacity = 0;
+            uint32_t m_CommandCapacity = 0;                    // Per phase; the late block starts at this offset.
+            uint32_t m_InstanceCount = 0;                      // Instances uploaded for the frame being recorded.
+            uint32_t m_MaxClustersPerInstance = 0;             // Drives the dispatch width.
+            uint64_t m_ClusterGeneration = 0;                  // Cluster buffer revision bound in m_DescriptorSet.
+            bool m_DescriptorDirty = true;
+            bool m_StatsPending = false;                       // Set once a culling pass was recorded for this slot.
+            uint32_t m_SubmittedClusters = 0;
+            uint64_t m_SubmittedTriangles = 0;
+        };
+
+        // Per-viewport occlusion state; history buffers ping-pong so one frame reads what the previous one wrote.
+        struct ViewState
+        {
+            DepthPyramid m_Pyramid;
+            uint32_t m_TargetRevision = 0;
+            VkImage m_DepthImage = VK_NULL_HANDLE;
+            std::array<VkBuffer, 2> m_HistoryBuffers{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+            std::array<VkDeviceMemory, 2> m_HistoryMemory{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+            uint32_t m_HistoryCapacity = 0;
+            uint32_t m_ReadIndex = 0;                          // History buffer holding the latest visibility.
+            uint64_t m_LastOcclusionFrame = 0;                 // m_FrameCounter of the last late phase.
+            bool m_HistoryValid = false;                       // Cleared whenever history buffers are recreated.
+            uint64_t m_Generation = 1;                         // Bumped when the pyramid or history buffers change.
+            std::vector<std::array<VkDescriptorSet, 2>> m_FrameSets; // [frame][read index].
+            std::vector<uint64_t> m_FrameSetGenerations;
+            CullPushConstants m_LateConstants{};               // Replayed by the late phase with the late flag set.
+            bool m_PendingLate = false;
+        };
+
+        void CreateDescriptorResources();
+        void CreatePyramidResources(Pipeline& pipeline);
+        void EnsureFrame(uint32_t frameIndex);
+        void DestroyFrame(FrameResources& frame);
+        void UpdateDescriptorSet(FrameResources& frame);
+        ViewState* EnsureView(const ViewTarget& target, uint32_t frameIndex, uint32_t commandCount);
+        void DestroyView(ViewState& view);
+        void RecordDispatch(VkCommandBuffer commandBuffer, const FrameResources& frame, VkDescriptorSet viewSet, const CullPushConstants& constants);
+
+    private:
+        static constexpr uint32_t s_MaxFrames = 8;        // Upper bound on swapchain images served by the descriptor pools.
+        static constexpr uint32_t s_MaxViews = 4;         // Viewports that can hold occlusion state at the same time.
+        static constexpr uint32_t s_WorkGroupSize = 64;   // Must match local_size_x in ClusterCull.comp.
+        static constexpr uint32_t s_NoHistory = 0xFFFFFFFFu;
+
+        Buffers* m_Buffers = nullptr;
+
+        VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
+        VkDescriptorSetLayout m_ViewSetLayout = VK_NULL_HANDLE;
+        VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+        VkDescriptorPool m_ViewDescriptorPool = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        VkPipeline m_ComputePipeline = VK_NULL_HANDLE;
+
+        VkDescriptorSetLayout m_PyramidSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout m_PyramidPipelineLayout = VK_NULL_HANDLE;
+        VkPipeline m_PyramidPipeline = VK_NULL_HANDLE;
+        VkSampler m_PyramidSampler = VK_NULL_HANDLE;
+
+        VkBuffer m_ClusterBuffer = VK_NULL_HANDLE;         // Device-local cluster table shared by every frame.
+        VkDeviceMemory m_ClusterMemory = VK_NULL_HANDLE;
+        std::vector<ClusterData> m_Clusters;               // CPU copy used to total triangles for stats.
+        uint64_t m_ClusterGeneration = 0;
+
+        std::vector<FrameResources> m_Frames;
+        std::vector<InstanceData> m_PendingInstances;
+        uint32_t m_PendingCommandCount = 0;
+        std::unordered_map<uint64_t, InstanceLayout> m_PreviousLayout; // Instance placement from the previous frame.
+        std::unordered_map<uint64_t, InstanceLayout> m_CurrentLayout;
+        uint64_t m_FrameCounter = 0;
+        uint32_t m_MaxDrawIndirectCount = 1;
+        bool m_MultiDrawIndirect = false;
+
+        std::unordered_map<uint32_t, ViewState> m_Views;
+
+        CullingStats m_LastStats{};
+    };
+}
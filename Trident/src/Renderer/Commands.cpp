@@ -3,6 +3,8 @@
 #include "Application/Startup.h"
 #include "Core/Utilities.h"
 
+#include <algorithm>
+
 namespace Trident
 {
     void Commands::Init(uint32_t commandBufferCount)
@@ -22,7 +24,8 @@ namespace Trident
 
         // Wait for all submitted command buffers to retire so we do not destroy semaphores or fences
         // that may still be referenced by work queued on the device.
-        vkDeviceWaitIdle(l_Device);
+        Startup::WaitForDeviceIdle("command teardown");
+        m_OneTimeRetirement.ReleaseAll();
 
         // Tear down per-image semaphores before pool destruction so presentation never observes recycled handles mid-teardown.
         for (VkSemaphore l_RenderFinished : m_RenderFinishedSemaphoresPerImage)
@@ -49,6 +52,13 @@ namespace Trident
             }
         }
 
+        if (m_OneTimeFence != VK_NULL_HANDLE)
+        {
+            vkDestroyFence(l_Device, m_OneTimeFence, nullptr);
+
+            m_OneTimeFence = VK_NULL_HANDLE;
+        }
+
         if (m_FrameTimelineSemaphore != VK_NULL_HANDLE)
         {
             vkDestroySemaphore(l_Device, m_FrameTimelineSemaphore, nullptr);
@@ -76,7 +86,9 @@ namespace Trident
         m_RenderFinishedSemaphoresPerImage.clear();
         m_InFlightFences.clear();
         m_ImagesInFlight.clear();
+        m_FrameSubmissionValues.clear();
         m_TimelineValue = 0;
+        m_FenceCompletedValue = 0;
     }
 
     void Commands::Recreate(uint32_t commandBufferCount)
@@ -85,7 +97,8 @@ namespace Trident
 
         // Ensure any in-flight frames referencing the old command pool are completed before releasing
         // synchronization primitives and recycling command buffers for the refreshed swapchain.
-        vkDeviceWaitIdle(l_Device);
+        Startup::WaitForDeviceIdle("swapchain recreation");
+        m_OneTimeRetirement.ReleaseAll();
 
         for (VkSemaphore l_RenderFinished : m_RenderFinishedSemaphoresPerImage)
         {
@@ -122,7 +135,10 @@ namespace Trident
         m_RenderFinishedSemaphoresPerImage.clear();
         m_InFlightFences.clear();
         m_ImagesInFlight.clear();
-        m_TimelineValue = 0;
+        m_FrameSubmissionValues.clear();
+        // The timeline keeps counting across recreation: retirements elsewhere are tagged with values from before the idle,
+        // and the new semaphore starts at the last value so all of them read as complete.
+        m_FenceCompletedValue = m_TimelineValue;
 
         m_CurrentFrame = 0;
 
@@ -137,6 +153,8 @@ namespace Trident
 
     VkCommandBuffer Commands::BeginSingleTimeCommands()
     {
+        CollectCompletedCommands();
+
         VkCommandBuffer l_CommandBuffer = m_OneTimePool.Acquire();
 
         VkCommandBufferBeginInfo l_BeginInfo{};
@@ -150,17 +168,117 @@ namespace Trident
 
     void Commands::EndSingleTimeCommands(VkCommandBuffer l_CommandBuffer)
     {
-        vkEndCommandBuffer(l_CommandBuffer);
+        // Waits for this submission's own timeline value rather than draining the queue, so transfer-queue streaming and
+        // presentation are left alone.
+        WaitForTimelineValue(SubmitSingleTimeCommands(l_CommandBuffer));
+    }
 
-        VkSubmitInfo l_SubmitInfo{};
-        l_SubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    uint64_t Commands::SubmitSingleTimeCommands(VkCommandBuffer commandBuffer)
+    {
+        vkEndCommandBuffer(commandBuffer);
+
+        const uint64_t l_Value = IncrementTimelineValue();
+
+        VkTimelineSemaphoreSubmitInfo l_TimelineSubmitInfo{ VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO };
+        l_TimelineSubmitInfo.signalSemaphoreValueCount = 1;
+        l_TimelineSubmitInfo.pSignalSemaphoreValues = &l_Value;
+
+        VkSubmitInfo l_SubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
         l_SubmitInfo.commandBufferCount = 1;
-        l_SubmitInfo.pCommandBuffers = &l_CommandBuffer;
+        l_SubmitInfo.pCommandBuffers = &commandBuffer;
+        if (m_TimelineSemaphoreSupported)
+        {
+            l_SubmitInfo.pNext = &l_TimelineSubmitInfo;
+            l_SubmitInfo.signalSemaphoreCount = 1;
+            l_SubmitInfo.pSignalSemaphores = &m_FrameTimelineSemaphore;
+        }
 
-        vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_SubmitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(Startup::GetGraphicsQueue());
+        const VkFence l_Fence = m_TimelineSemaphoreSupported ? VK_NULL_HANDLE : m_OneTimeFence;
+        if (vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_SubmitInfo, l_Fence) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to submit one-time command buffer");
+
+            RollbackTimelineValue();
+            m_OneTimePool.Release(commandBuffer);
+
+            return m_TimelineValue;
+        }
+
+        if (!m_TimelineSemaphoreSupported)
+        {
+            // Without a timeline there is no value to poll, so the fallback blocks on this submission's own fence.
+            vkWaitForFences(Startup::GetDevice(), 1, &m_OneTimeFence, VK_TRUE, UINT64_MAX);
+            vkResetFences(Startup::GetDevice(), 1, &m_OneTimeFence);
+            m_OneTimePool.Release(commandBuffer);
+            m_FenceCompletedValue = std::max(m_FenceCompletedValue, l_Value);
+
+            return l_Value;
+        }
 
-        m_OneTimePool.Release(l_CommandBuffer);
+        m_OneTimeRetirement.Retire(l_Value, [this, commandBuffer]()
+            {
+                m_OneTimePool.Release(commandBuffer);
+            });
+
+        return l_Value;
+    }
+
+    void Commands::CollectCompletedCommands()
+    {
+        if (!m_OneTimeRetirement.IsEmpty())
+        {
+            m_OneTimeRetirement.Collect(GetCompletedTimelineValue());
+        }
+    }
+
+    uint64_t Commands::GetCompletedTimelineValue() const
+    {
+        if (!m_TimelineSemaphoreSupported || m_FrameTimelineSemaphore == VK_NULL_HANDLE)
+        {
+            return m_FenceCompletedValue;
+        }
+
+        uint64_t l_Value = 0;
+        if (vkGetSemaphoreCounterValue(Startup::GetDevice(), m_FrameTimelineSemaphore, &l_Value) != VK_SUCCESS)
+        {
+            return 0;
+        }
+
+        return l_Value;
+    }
+
+    void Commands::WaitForTimelineValue(uint64_t value)
+    {
+        // One-time submissions already block on their fence in the fallback path, and frames are paced by theirs.
+        if (!m_TimelineSemaphoreSupported || m_FrameTimelineSemaphore == VK_NULL_HANDLE || value == 0)
+        {
+            return;
+        }
+
+        VkSemaphoreWaitInfo l_WaitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        l_WaitInfo.semaphoreCount = 1;
+        l_WaitInfo.pSemaphores = &m_FrameTimelineSemaphore;
+        l_WaitInfo.pValues = &value;
+        vkWaitSemaphores(Startup::GetDevice(), &l_WaitInfo, UINT64_MAX);
+
+        CollectCompletedCommands();
+    }
+
+    void Commands::TrackFrameSubmission(size_t frameIndex, uint64_t value)
+    {
+        if (frameIndex < m_FrameSubmissionValues.size())
+        {
+            m_FrameSubmissionValues[frameIndex] = value;
+        }
+    }
+
+    void Commands::MarkFrameFenceSignaled(size_t frameIndex)
+    {
+        // The queue retires work in submission order, so everything up to the slot's last value has finished too.
+        if (frameIndex < m_FrameSubmissionValues.size())
+        {
+            m_FenceCompletedValue = std::max(m_FenceCompletedValue, m_FrameSubmissionValues[frameIndex]);
+        }
     }
 
     uint64_t Commands::IncrementTimelineValue()
@@ -219,6 +337,7 @@ namespace Trident
         m_RenderFinishedSemaphoresPerImage.resize(swapchainImageCount);
         m_InFlightFences.resize(l_FrameCount);
         m_ImagesInFlight.resize(swapchainImageCount);
+        m_FrameSubmissionValues.assign(l_FrameCount, m_FenceCompletedValue);
 
         // Each swapchain image gets its own render-finished semaphore so the handle is only reused after vkAcquireNextImageKHR
         // returns that same image again. Frames in flight still use a fence ring to rate-limit CPU submissions.
@@ -231,7 +350,7 @@ namespace Trident
 
         VkSemaphoreTypeCreateInfo l_TimelineCreateInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
         l_TimelineCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
-        l_TimelineCreateInfo.initialValue = 0;
+        l_TimelineCreateInfo.initialValue = m_TimelineValue;
         VkSemaphoreCreateInfo l_TimelineSemaphoreInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
         l_TimelineSemaphoreInfo.pNext = &l_TimelineCreateInfo;
 
@@ -262,9 +381,15 @@ namespace Trident
 
                 m_TimelineSemaphoreSupported = false;
             }
-            else
+        }
+
+        if (!m_TimelineSemaphoreSupported && m_OneTimeFence == VK_NULL_HANDLE)
+        {
+            // The fence outlives swapchain recreation; it is only ever waited on right after the submission that signals it.
+            VkFenceCreateInfo l_OneTimeFenceInfo{ VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            if (vkCreateFence(Startup::GetDevice(), &l_OneTimeFenceInfo, nullptr, &m_OneTimeFence) != VK_SUCCESS)
             {
-                m_TimelineValue = 0;
+                TR_CORE_CRITICAL("Failed to create one-time submission fence");
             }
         }
 
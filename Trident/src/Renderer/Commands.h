@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Renderer/CommandBufferPool.h"
+#include "Renderer/ResourceRetirement.h"
 
 namespace Trident
 {
@@ -29,6 +30,18 @@ namespace Trident
         VkSemaphore GetFrameTimelineSemaphore() const { return m_FrameTimelineSemaphore; }
         uint64_t GetTimelineValue() const { return m_TimelineValue; }
         uint64_t IncrementTimelineValue();
+        // Returns the most recent value after its submission failed, so nothing waits on a value that will never signal.
+        void RollbackTimelineValue() { --m_TimelineValue; }
+
+        // Every graphics-queue submission, frame or one-time, takes the next timeline value. Values are handed out in
+        // submission order, so reaching one implies every earlier submission has finished as well.
+        uint64_t GetNextTimelineValue() const { return m_TimelineValue + 1; }
+        uint64_t GetCompletedTimelineValue() const;
+        void WaitForTimelineValue(uint64_t value);
+        // Without timeline semaphores completion is inferred from the in-flight fences: the renderer records the value each
+        // frame slot submitted and reports when it has waited on that slot's fence.
+        void TrackFrameSubmission(size_t frameIndex, uint64_t value);
+        void MarkFrameFenceSignaled(size_t frameIndex);
 
         size_t GetFrameCount() const { return m_ImageAvailableSemaphoresPerImage.size(); }
         size_t& CurrentFrame() { return m_CurrentFrame; }
@@ -38,7 +51,13 @@ namespace Trident
         const CommandBufferPool& GetOneTimePool() const { return m_OneTimePool; }
 
         VkCommandBuffer BeginSingleTimeCommands();
+        // Submits and blocks until this submission (and therefore everything before it) has finished.
         void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
+        // Submits without blocking and returns the timeline value that marks completion; the command buffer goes back to
+        // the pool once that value is reached.
+        uint64_t SubmitSingleTimeCommands(VkCommandBuffer commandBuffer);
+        // Recycles one-time command buffers whose submissions have completed.
+        void CollectCompletedCommands();
 
     private:
         void CreateCommandPool();
@@ -60,5 +79,9 @@ namespace Trident
         bool m_TimelineSemaphoreSupported = false;
         VkSemaphore m_FrameTimelineSemaphore = VK_NULL_HANDLE;
         uint64_t m_TimelineValue = 0;
+        uint64_t m_FenceCompletedValue = 0;               // Fallback completion inferred from in-flight fences.
+        std::vector<uint64_t> m_FrameSubmissionValues;    // Fallback: timeline value last submitted by each frame slot.
+        VkFence m_OneTimeFence = VK_NULL_HANDLE;          // Fallback: one-time submissions wait on this instead of the queue.
+        ResourceRetirement m_OneTimeRetirement;           // One-time command buffers waiting for their submission to finish.
     };
 }
\ No newline at end of file
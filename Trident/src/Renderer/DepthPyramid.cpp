@@ -0,0 +1,301 @@
+#include "Renderer/DepthPyramid.h"
+
+#include "Renderer/Buffers.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace Trident
+{
+    namespace
+    {
+        struct PyramidPushConstants
+        {
+            uint32_t m_SourceWidth = 0;
+            uint32_t m_SourceHeight = 0;
+            uint32_t m_TargetWidth = 0;
+            uint32_t m_TargetHeight = 0;
+        };
+    }
+
+    bool DepthPyramid::Create(Buffers& buffers, VkImageView depthView, VkExtent2D depthExtent, VkDescriptorSetLayout setLayout, VkSampler sampler)
+    {
+        Retire(buffers);
+
+        if (depthView == VK_NULL_HANDLE || depthExtent.width == 0 || depthExtent.height == 0)
+        {
+            return false;
+        }
+
+        VkDevice l_Device = Startup::GetDevice();
+        m_DepthExtent = depthExtent;
+
+        // Ceil-halving keeps texel i of level L aligned with depth pixels [i * 2^(L+1), (i + 1) * 2^(L+1)).
+        VkExtent2D l_Extent{ (depthExtent.width + 1) / 2, (depthExtent.height + 1) / 2 };
+        while (true)
+        {
+            m_LevelExtents.push_back(l_Extent);
+            if (l_Extent.width == 1 && l_Extent.height == 1)
+            {
+                break;
+            }
+
+            l_Extent = { std::max(1u, (l_Extent.width + 1) / 2), std::max(1u, (l_Extent.height + 1) / 2) };
+        }
+
+        const uint32_t l_LevelCount = GetLevelCount();
+
+        VkImageCreateInfo l_ImageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        l_ImageInfo.imageType = VK_IMAGE_TYPE_2D;
+        l_ImageInfo.format = VK_FORMAT_R32_SFLOAT;
+        l_ImageInfo.extent = { m_LevelExtents[0].width, m_LevelExtents[0].height, 1 };
+        l_ImageInfo.mipLevels = l_LevelCount;
+        l_ImageInfo.arrayLayers = 1;
+        l_ImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        l_ImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        l_ImageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        l_ImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        l_ImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        if (vkCreateImage(l_Device, &l_ImageInfo, nullptr, &m_Image) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create depth pyramid image ({}x{})", l_ImageInfo.extent.width, l_ImageInfo.extent.height);
+            Destroy();
+
+            return false;
+        }
+
+        VkMemoryRequirements l_Requirements{};
+        vkGetImageMemoryRequirements(l_Device, m_Image, &l_Requirements);
+
+        VkMemoryAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        l_AllocateInfo.allocationSize = l_Requirements.size;
+        l_AllocateInfo.memoryTypeIndex = buffers.FindMemoryType(l_Requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (vkAllocateMemory(l_Device, &l_AllocateInfo, nullptr, &m_Memory) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to allocate depth pyramid memory");
+            Destroy();
+
+            return false;
+        }
+
+        vkBindImageMemory(l_Device, m_Image, m_Memory, 0);
+
+        VkImageViewCreateInfo l_ViewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+        l_ViewInfo.image = m_Image;
+        l_ViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        l_ViewInfo.format = VK_FORMAT_R32_SFLOAT;
+        l_ViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        l_ViewInfo.subresourceRange.baseMipLevel = 0;
+        l_ViewInfo.subresourceRange.levelCount = l_LevelCount;
+        l_ViewInfo.subresourceRange.baseArrayLayer = 0;
+        l_ViewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(l_Device, &l_ViewInfo, nullptr, &m_View) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create depth pyramid view");
+            Destroy();
+
+            return false;
+        }
+
+        m_LevelViews.resize(l_LevelCount, VK_NULL_HANDLE);
+        for (uint32_t it_Level = 0; it_Level < l_LevelCount; ++it_Level)
+        {
+            l_ViewInfo.subresourceRange.baseMipLevel = it_Level;
+            l_ViewInfo.subresourceRange.levelCount = 1;
+            if (vkCreateImageView(l_Device, &l_ViewInfo, nullptr, &m_LevelViews[it_Level]) != VK_SUCCESS)
+            {
+                TR_CORE_ERROR("Failed to create depth pyramid view for level {}", it_Level);
+                Destroy();
+
+                return false;
+            }
+        }
+
+        std::array<VkDescriptorPoolSize, 2> l_PoolSizes{};
+        l_PoolSizes[0] = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, l_LevelCount };
+        l_PoolSizes[1] = { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, l_LevelCount };
+
+        VkDescriptorPoolCreateInfo l_PoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        l_PoolInfo.maxSets = l_LevelCount;
+        l_PoolInfo.poolSizeCount = static_cast<uint32_t>(l_PoolSizes.size());
+        l_PoolInfo.pPoolSizes = l_PoolSizes.data();
+
+        if (vkCreateDescriptorPool(l_Device, &l_PoolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create depth pyramid descriptor pool");
+            Destroy();
+
+            return false;
+        }
+
+        std::vector<VkDescriptorSetLayout> l_Layouts(l_LevelCount, setLayout);
+        VkDescriptorSetAllocateInfo l_SetInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+        l_SetInfo.descriptorPool = m_DescriptorPool;
+        l_SetInfo.descriptorSetCount = l_LevelCount;
+        l_SetInfo.pSetLayouts = l_Layouts.data();
+
+        m_LevelSets.resize(l_LevelCount, VK_NULL_HANDLE);
+        if (vkAllocateDescriptorSets(l_Device, &l_SetInfo, m_LevelSets.data()) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to allocate depth pyramid descriptor sets");
+            Destroy();
+
+            return false;
+        }
+
+        for (uint32_t it_Level = 0; it_Level < l_LevelCount; ++it_Level)
+        {
+            VkDescriptorImageInfo l_SourceInfo{};
+            l_SourceInfo.sampler = sampler;
+            l_SourceInfo.imageView = it_Level == 0 ? depthView : m_LevelViews[it_Level - 1];
+            l_SourceInfo.imageLayout = it_Level == 0 ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+
+            VkDescriptorImageInfo l_TargetInfo{};
+            l_TargetInfo.imageView = m_LevelViews[it_Level];
+            l_TargetInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+            std::array<VkWriteDescriptorSet, 2> l_Writes{};
+            l_Writes[0] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            l_Writes[0].dstSet = m_LevelSets[it_Level];
+            l_Writes[0].dstBinding = 0;
+            l_Writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            l_Writes[0].descriptorCount = 1;
+            l_Writes[0].pImageInfo = &l_SourceInfo;
+            l_Writes[1] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            l_Writes[1].dstSet = m_LevelSets[it_Level];
+            l_Writes[1].dstBinding = 1;
+            l_Writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            l_Writes[1].descriptorCount = 1;
+            l_Writes[1].pImageInfo = &l_TargetInfo;
+
+            vkUpdateDescriptorSets(l_Device, static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+        }
+
+        TR_CORE_TRACE("Depth pyramid created for {}x{} depth ({} levels)", depthExtent.width, depthExtent.height, l_LevelCount);
+
+        return true;
+    }
+
+    void DepthPyramid::Destroy()
+    {
+        VkDevice l_Device = Startup::GetDevice();
+
+        if (m_DescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(l_Device, m_DescriptorPool, nullptr);
+            m_DescriptorPool = VK_NULL_HANDLE;
+        }
+        m_LevelSets.clear();
+
+        for (VkImageView it_View : m_LevelViews)
+        {
+            if (it_View != VK_NULL_HANDLE)
+            {
+                vkDestroyImageView(l_Device, it_View, nullptr);
+            }
+        }
+        m_LevelViews.clear();
+
+        if (m_View != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(l_Device, m_View, nullptr);
+            m_View = VK_NULL_HANDLE;
+        }
+
+        if (m_Image != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(l_Device, m_Image, nullptr);
+            m_Image = VK_NULL_HANDLE;
+        }
+
+        if (m_Memory != VK_NULL_HANDLE)
+        {
+            vkFreeMemory(l_Device, m_Memory, nullptr);
+            m_Memory = VK_NULL_HANDLE;
+        }
+
+        m_LevelExtents.clear();
+        m_DepthExtent = { 0, 0 };
+    }
+
+    void DepthPyramid::Retire(Buffers& buffers)
+    {
+        if (m_Image == VK_NULL_HANDLE && m_DescriptorPool == VK_NULL_HANDLE && m_LevelViews.empty())
+        {
+            Destroy();
+
+            return;
+        }
+
+        DepthPyramid l_Retired{};
+        std::swap(l_Retired.m_Image, m_Image);
+        std::swap(l_Retired.m_Memory, m_Memory);
+        std::swap(l_Retired.m_View, m_View);
+        std::swap(l_Retired.m_LevelViews, m_LevelViews);
+        std::swap(l_Retired.m_DescriptorPool, m_DescriptorPool);
+        m_LevelSets.clear();
+        m_LevelExtents.clear();
+        m_DepthExtent = { 0, 0 };
+
+        buffers.Retire([l_Retired]() mutable
+            {
+                l_Retired.Destroy();
+            });
+    }
+
+    void DepthPyramid::Record(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout) const
+    {
+        if (!IsValid() || pipeline == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        // Previous contents are irrelevant; the barrier only orders against last frame's culling reads.
+        VkImageMemoryBarrier l_ToGeneral{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        l_ToGeneral.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_ToGeneral.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_ToGeneral.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        l_ToGeneral.subresourceRange.baseMipLevel = 0;
+        l_ToGeneral.subresourceRange.levelCount = GetLevelCount();
+        l_ToGeneral.subresourceRange.baseArrayLayer = 0;
+        l_ToGeneral.subresourceRange.layerCount = 1;
+        l_ToGeneral.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        l_ToGeneral.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        l_ToGeneral.srcAccessMask = 0;
+        l_ToGeneral.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        l_ToGeneral.image = m_Image;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_ToGeneral);
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+
+        VkExtent2D l_SourceExtent = m_DepthExtent;
+        for (uint32_t it_Level = 0; it_Level < GetLevelCount(); ++it_Level)
+        {
+            const VkExtent2D& l_TargetExtent = m_LevelExtents[it_Level];
+
+            PyramidPushConstants l_Constants{};
+            l_Constants.m_SourceWidth = l_SourceExtent.width;
+            l_Constants.m_SourceHeight = l_SourceExtent.height;
+            l_Constants.m_TargetWidth = l_TargetExtent.width;
+            l_Constants.m_TargetHeight = l_TargetExtent.height;
+
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &m_LevelSets[it_Level], 0, nullptr);
+            vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PyramidPushConstants), &l_Constants);
+            vkCmdDispatch(commandBuffer, (l_TargetExtent.width + s_WorkGroupSize - 1) / s_WorkGroupSize, (l_TargetExtent.height + s_WorkGroupSize - 1) / s_WorkGroupSize, 1);
+
+            // Each level reads the one written just before it; the final barrier also covers the culling pass.
+            VkMemoryBarrier l_LevelBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+            l_LevelBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            l_LevelBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &l_LevelBarrier, 0, nullptr, 0, nullptr);
+
+            l_SourceExtent = l_TargetExtent;
+        }
+    }
+}
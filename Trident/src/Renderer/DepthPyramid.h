@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Trident
+{
+    class Buffers;
+
+    /**
+     * @brief Hierarchical-Z pyramid built from a viewport's depth attachment.
+     *
+     * Mip 0 is half the depth resolution and every texel stores the farthest depth of the 2x2 block beneath it, so a
+     * bounds test only needs four fetches at the level whose texels cover the projected rectangle. The downsample
+     * pipeline is shared and owned by the caller; each pyramid only owns its image, views and per-level descriptor sets.
+     */
+    class DepthPyramid
+    {
+    public:
+        static constexpr uint32_t s_WorkGroupSize = 8; // Must match local_size_x/y in DepthPyramid.comp.
+
+        bool Create(Buffers& buffers, VkImageView depthView, VkExtent2D depthExtent, VkDescriptorSetLayout setLayout, VkSampler sampler);
+        void Destroy();
+        // Hands the current image, views and descriptor pool to the buffer allocator's retirement queue and resets the pyramid,
+        // for when in-flight frames may still sample it.
+        void Retire(Buffers& buffers);
+
+        // Expects the depth attachment in VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL; leaves the pyramid readable by compute.
+        void Record(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout) const;
+
+        bool IsValid() const { return m_Image != VK_NULL_HANDLE; }
+        VkImageView GetView() const { return m_View; }
+        uint32_t GetLevelCount() const { return static_cast<uint32_t>(m_LevelExtents.size()); }
+        VkExtent2D GetDepthExtent() const { return m_DepthExtent; }
+
+    private:
+        VkImage m_Image = VK_NULL_HANDLE;
+        VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+        VkImageView m_View = VK_NULL_HANDLE;                // All mips, sampled by the culling pass.
+        std::vector<VkImageView> m_LevelViews;              // Single-mip views written by the downsample.
+        std::vector<VkExtent2D> m_LevelExtents;
+        VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+        std::vector<VkDescriptorSet> m_LevelSets;           // Level N reads level N - 1 (or depth for level 0).
+        VkExtent2D m_DepthExtent{ 0, 0 };
+    };
+}
@@ -1,5 +1,6 @@
 #include "Renderer/Pipeline.h"
 #include "Renderer/Swapchain.h"
+#include "Renderer/Buffers.h"
 #include "Renderer/Vertex.h"
 #include "Renderer/RenderData.h"
 
@@ -9,26 +10,92 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <sstream>
 #include <system_error>
+#include <utility>
 
 namespace Trident
 {
+    namespace
+    {
+        const std::filesystem::path s_PipelineCachePath = std::filesystem::path("Cache") / "PipelineCache.bin";
+        constexpr uint32_t s_PipelineCacheMagic = 0x43505254; // "TRPC"
+
+        // Written ahead of the driver blob. Vulkan's own header is only checked by the driver, which may reject or,
+        // on some implementations, misbehave on foreign data, so the identity is validated before the blob is handed over.
+        struct PipelineCacheFileHeader
+        {
+            uint32_t m_Magic = s_PipelineCacheMagic;
+            uint32_t m_VendorId = 0;
+            uint32_t m_DeviceId = 0;
+            uint32_t m_DriverVersion = 0;
+            uint8_t m_PipelineCacheUuid[VK_UUID_SIZE]{};
+            uint64_t m_DataSize = 0;
+        };
+
+        PipelineCacheFileHeader BuildPipelineCacheHeader()
+        {
+            VkPhysicalDeviceProperties l_Properties{};
+            vkGetPhysicalDeviceProperties(Startup::GetPhysicalDevice(), &l_Properties);
+
+            PipelineCacheFileHeader l_Header{};
+            l_Header.m_VendorId = l_Properties.vendorID;
+            l_Header.m_DeviceId = l_Properties.deviceID;
+            l_Header.m_DriverVersion = l_Properties.driverVersion;
+            std::memcpy(l_Header.m_PipelineCacheUuid, l_Properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+            return l_Header;
+        }
+
+        // FNV-1a over the file contents; 0 means the file could not be read (missing, or mid-save on some editors).
+        uint64_t HashShaderSource(const std::string& sourcePath)
+        {
+            std::ifstream l_Stream(sourcePath, std::ios::binary);
+            if (!l_Stream)
+            {
+                return 0;
+            }
+
+            uint64_t l_Hash = 14695981039346656037ull;
+            std::array<char, 4096> l_Chunk{};
+            while (l_Stream.read(l_Chunk.data(), l_Chunk.size()) || l_Stream.gcount() > 0)
+            {
+                const std::streamsize l_Count = l_Stream.gcount();
+                for (std::streamsize it_Byte = 0; it_Byte < l_Count; ++it_Byte)
+                {
+                    l_Hash ^= static_cast<uint8_t>(l_Chunk[static_cast<size_t>(it_Byte)]);
+                    l_Hash *= 1099511628211ull;
+                }
+            }
+
+            return l_Hash;
+        }
+    }
+
     void Pipeline::Init(Swapchain& swapchain)
     {
+        CreatePipelineCache();
         InitializeShaderStages();
         CreateRenderPass(swapchain);
-        CreateDescriptorSetLayout();
+        CreateDescriptorSetLayout(swapchain.GetImageCount());
         CreateSkyboxDescriptorSetLayout();
-        CreateGraphicsPipeline(swapchain);
-        CreateSkyboxPipeline(swapchain);
+        CreateGraphicsPipeline();
+        CreateSkyboxPipeline();
         CreateFramebuffers(swapchain);
+
+        StartReloadWorker();
     }
 
     void Pipeline::Cleanup()
     {
+        StopReloadWorker();
+
         CleanupFramebuffers();
         DestroyGraphicsPipeline();
         DestroySkyboxPipeline();
@@ -40,6 +107,13 @@ namespace Trident
             m_RenderPass = VK_NULL_HANDLE;
         }
 
+        if (m_ContinuationRenderPass != VK_NULL_HANDLE)
+        {
+            vkDestroyRenderPass(Startup::GetDevice(), m_ContinuationRenderPass, nullptr);
+
+            m_ContinuationRenderPass = VK_NULL_HANDLE;
+        }
+
         if (m_DescriptorSetLayout != VK_NULL_HANDLE)
         {
             vkDestroyDescriptorSetLayout(Startup::GetDevice(), m_DescriptorSetLayout, nullptr);
@@ -56,6 +130,14 @@ namespace Trident
 
         m_ShaderStages.clear();
         m_SkyboxShaderStages.clear();
+
+        SavePipelineCache();
+        DestroyPipelineCache();
+    }
+
+    bool Pipeline::IsGraphicsPipelineReady() const
+    {
+        return std::all_of(m_GraphicsPipelines.begin(), m_GraphicsPipelines.end(), [](VkPipeline a_Pipeline) { return a_Pipeline != VK_NULL_HANDLE; });
     }
 
     void Pipeline::RecreateFramebuffers(Swapchain& swapchain)
@@ -108,10 +190,13 @@ namespace Trident
 
     void Pipeline::DestroyGraphicsPipeline()
     {
-        if (m_GraphicsPipeline != VK_NULL_HANDLE)
+        for (VkPipeline& it_Pipeline : m_GraphicsPipelines)
         {
-            vkDestroyPipeline(Startup::GetDevice(), m_GraphicsPipeline, nullptr);
-            m_GraphicsPipeline = VK_NULL_HANDLE;
+            if (it_Pipeline != VK_NULL_HANDLE)
+            {
+                vkDestroyPipeline(Startup::GetDevice(), it_Pipeline, nullptr);
+                it_Pipeline = VK_NULL_HANDLE;
+            }
         }
 
         if (m_PipelineLayout != VK_NULL_HANDLE)
@@ -136,6 +221,117 @@ namespace Trident
         }
     }
 
+    void Pipeline::CreatePipelineCache()
+    {
+        DestroyPipelineCache();
+
+        const PipelineCacheFileHeader l_Expected = BuildPipelineCacheHeader();
+        std::vector<char> l_InitialData{};
+
+        std::error_code l_Error{};
+        if (std::filesystem::exists(s_PipelineCachePath, l_Error))
+        {
+            std::vector<char> l_File = Utilities::FileManagement::ReadBinaryFile(s_PipelineCachePath.string());
+
+            PipelineCacheFileHeader l_Header{};
+            if (l_File.size() >= sizeof(l_Header))
+            {
+                std::memcpy(&l_Header, l_File.data(), sizeof(l_Header));
+            }
+
+            const bool l_Matches = l_File.size() >= sizeof(l_Header) && l_Header.m_Magic == l_Expected.m_Magic && l_Header.m_VendorId == l_Expected.m_VendorId
+                && l_Header.m_DeviceId == l_Expected.m_DeviceId && l_Header.m_DriverVersion == l_Expected.m_DriverVersion
+                && std::memcmp(l_Header.m_PipelineCacheUuid, l_Expected.m_PipelineCacheUuid, VK_UUID_SIZE) == 0
+                && l_Header.m_DataSize == l_File.size() - sizeof(l_Header);
+
+            if (l_Matches)
+            {
+                l_InitialData.assign(l_File.begin() + sizeof(l_Header), l_File.end());
+            }
+            else
+            {
+                TR_CORE_WARN("Discarding pipeline cache '{}' written by a different device or driver", s_PipelineCachePath.string());
+            }
+        }
+
+        VkPipelineCacheCreateInfo l_CacheInfo{ VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+        l_CacheInfo.initialDataSize = l_InitialData.size();
+        l_CacheInfo.pInitialData = l_InitialData.empty() ? nullptr : l_InitialData.data();
+
+        if (vkCreatePipelineCache(Startup::GetDevice(), &l_CacheInfo, nullptr, &m_PipelineCache) != VK_SUCCESS)
+        {
+            // Pipelines still build without a cache, just without reuse across runs.
+            TR_CORE_WARN("Failed to create pipeline cache; pipelines will compile from scratch");
+            m_PipelineCache = VK_NULL_HANDLE;
+
+            return;
+        }
+
+        TR_CORE_TRACE("Pipeline cache {} ({} bytes)", l_InitialData.empty() ? "created empty" : "loaded from disk", l_InitialData.size());
+    }
+
+    void Pipeline::SavePipelineCache() const
+    {
+        if (m_PipelineCache == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        size_t l_DataSize = 0;
+        if (vkGetPipelineCacheData(Startup::GetDevice(), m_PipelineCache, &l_DataSize, nullptr) != VK_SUCCESS || l_DataSize == 0)
+        {
+            return;
+        }
+
+        std::vector<char> l_Data(l_DataSize);
+        if (vkGetPipelineCacheData(Startup::GetDevice(), m_PipelineCache, &l_DataSize, l_Data.data()) != VK_SUCCESS)
+        {
+            TR_CORE_WARN("Failed to read back pipeline cache data");
+
+            return;
+        }
+
+        PipelineCacheFileHeader l_Header = BuildPipelineCacheHeader();
+        l_Header.m_DataSize = l_DataSize;
+
+        std::error_code l_Error{};
+        std::filesystem::create_directories(s_PipelineCachePath.parent_path(), l_Error);
+
+        // Write beside the real file and swap it in so an interrupted save never leaves a truncated cache behind.
+        const std::filesystem::path l_TempPath = s_PipelineCachePath.string() + ".tmp";
+        {
+            std::ofstream l_Stream(l_TempPath, std::ios::binary | std::ios::trunc);
+            if (!l_Stream)
+            {
+                TR_CORE_WARN("Unable to write pipeline cache '{}'", l_TempPath.string());
+
+                return;
+            }
+
+            l_Stream.write(reinterpret_cast<const char*>(&l_Header), sizeof(l_Header));
+            l_Stream.write(l_Data.data(), static_cast<std::streamsize>(l_DataSize));
+        }
+
+        std::filesystem::rename(l_TempPath, s_PipelineCachePath, l_Error);
+        if (l_Error)
+        {
+            TR_CORE_WARN("Failed to replace pipeline cache '{}': {}", s_PipelineCachePath.string(), l_Error.message());
+
+            return;
+        }
+
+        TR_CORE_TRACE("Pipeline cache saved ({} bytes)", l_DataSize);
+    }
+
+    void Pipeline::DestroyPipelineCache()
+    {
+        if (m_PipelineCache != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineCache(Startup::GetDevice(), m_PipelineCache, nullptr);
+            m_PipelineCache = VK_NULL_HANDLE;
+        }
+    }
+
     void Pipeline::InitializeShaderStages()
     {
         m_ShaderStages.clear();
@@ -166,26 +362,6 @@ namespace Trident
         l_SkyboxFragment.SourcePath = (l_ShaderRoot / "Skybox.frag").generic_string();
         l_SkyboxFragment.SpirvPath = l_SkyboxFragment.SourcePath + ".spv";
         m_SkyboxShaderStages.push_back(l_SkyboxFragment);
-
-        // Cache initial timestamps so the first frame hot-reload check does not trigger unnecessarily.
-        std::error_code l_Error{};
-        auto l_CacheTimestamps = [&l_Error](std::vector<ShaderStage>& a_Stages)
-            {
-                for (auto& l_Shader : a_Stages)
-                {
-                    if (std::filesystem::exists(l_Shader.SourcePath, l_Error))
-                    {
-                        l_Shader.SourceTimestamp = std::filesystem::last_write_time(l_Shader.SourcePath, l_Error);
-                    }
-                    if (std::filesystem::exists(l_Shader.SpirvPath, l_Error))
-                    {
-                        l_Shader.SpirvTimestamp = std::filesystem::last_write_time(l_Shader.SpirvPath, l_Error);
-                    }
-                }
-            };
-
-        l_CacheTimestamps(m_ShaderStages);
-        l_CacheTimestamps(m_SkyboxShaderStages);
     }
 
     bool Pipeline::EnsureShaderBinaries(std::vector<ShaderStage>& shaderStages)
@@ -258,9 +434,6 @@ namespace Trident
             int l_Result = std::system(l_Command.c_str());
             if (l_Result == 0)
             {
-                std::error_code l_Error{};
-                shaderStage.SourceTimestamp = std::filesystem::last_write_time(shaderStage.SourcePath, l_Error);
-                shaderStage.SpirvTimestamp = std::filesystem::last_write_time(shaderStage.SpirvPath, l_Error);
                 TR_CORE_INFO("Compiled shader {}", shaderStage.SourcePath);
 
                 return true;
@@ -392,7 +565,8 @@ namespace Trident
         l_DepthAttachment.format = m_DepthFormat;
         l_DepthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
         l_DepthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-        l_DepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        // Depth is kept so occlusion culling can build its depth pyramid from the finished first pass.
+        l_DepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
         l_DepthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         l_DepthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         l_DepthAttachment.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
@@ -434,13 +608,26 @@ namespace Trident
             TR_CORE_CRITICAL("Failed to create render pass");
         }
 
+        // Only the depth load op differs, which keeps framebuffers and pipelines compatible between the two passes.
+        l_Attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+        if (vkCreateRenderPass(Startup::GetDevice(), &l_RenderPassInfo, nullptr, &m_ContinuationRenderPass) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create continuation render pass");
+        }
+
         TR_CORE_TRACE("Render Pass Created");
     }
 
-    void Pipeline::CreateDescriptorSetLayout()
+    void Pipeline::CreateDescriptorSetLayout(uint32_t imageCount)
     {
         TR_CORE_TRACE("Creating Descriptor Set Layout");
 
+        // Every swapchain image allocates its own set, so the update-after-bind pool budget is shared between them.
+        const uint32_t l_LayoutTextureCount = Startup::GetBindlessTextureLimit();
+        const uint32_t l_PoolTextureCount = Startup::GetUpdateAfterBindDescriptorLimit() / std::max(imageCount, 1u);
+        m_BindlessTextures = l_LayoutTextureCount > s_MaxMaterialTextures && l_PoolTextureCount > s_MaxMaterialTextures;
+        m_MaterialTextureCapacity = m_BindlessTextures ? std::min({ l_LayoutTextureCount, l_PoolTextureCount, s_MaxBindlessTextures }) : s_MaxMaterialTextures;
+
         VkDescriptorSetLayoutBinding l_GlobalLayoutBinding{};
         l_GlobalLayoutBinding.binding = 0;
         l_GlobalLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
@@ -450,23 +637,21 @@ namespace Trident
 
         VkDescriptorSetLayoutBinding l_MaterialLayoutBinding{};
         l_MaterialLayoutBinding.binding = 1;
-        // The fragment shader currently reads a single material record via a uniform buffer binding.
-        // Switching to a storage buffer would enable bindless style indexing in the future once the shader is ready.
-        l_MaterialLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        // Storage buffer holding every material record; the fragment shader indexes it with the draw's material index.
+        l_MaterialLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         l_MaterialLayoutBinding.descriptorCount = 1;
         l_MaterialLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
         l_MaterialLayoutBinding.pImmutableSamplers = nullptr;
 
-        VkDescriptorSetLayoutBinding l_SamplerLayoutBinding{};
-        l_SamplerLayoutBinding.binding = 2;
-        l_SamplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        l_SamplerLayoutBinding.descriptorCount = s_MaxMaterialTextures;
-        l_SamplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-        l_SamplerLayoutBinding.pImmutableSamplers = nullptr;
+        VkDescriptorSetLayoutBinding l_AiBlendBinding{};
+        l_AiBlendBinding.binding = 2;
+        l_AiBlendBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_AiBlendBinding.descriptorCount = 1;
+        l_AiBlendBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        l_AiBlendBinding.pImmutableSamplers = nullptr;
 
         VkDescriptorSetLayoutBinding l_SkyboxSamplerBinding{};
-        // Binding 3 is reserved for the environment cubemap. Keeping it adjacent to the material sampler makes it
-        // trivial to pivot toward bindless descriptors or texture arrays in a future renderer upgrade.
+        // Binding 3 is reserved for the environment cubemap.
         l_SkyboxSamplerBinding.binding = 3;
         l_SkyboxSamplerBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
         l_SkyboxSamplerBinding.descriptorCount = 1;
@@ -480,38 +665,60 @@ namespace Trident
         l_BonePaletteBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         l_BonePaletteBinding.pImmutableSamplers = nullptr;
 
-        VkDescriptorSetLayoutBinding l_AiBlendBinding{};
-        l_AiBlendBinding.binding = 5;
-        l_AiBlendBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        l_AiBlendBinding.descriptorCount = 1;
-        l_AiBlendBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-        l_AiBlendBinding.pImmutableSamplers = nullptr;
+        VkDescriptorSetLayoutBinding l_SceneBufferBinding{};
+        l_SceneBufferBinding.binding = 5;
+        l_SceneBufferBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_SceneBufferBinding.descriptorCount = 1;
+        l_SceneBufferBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        l_SceneBufferBinding.pImmutableSamplers = nullptr;
+
+        // A variable-count array must use the highest binding number, so the material textures sit last.
+        VkDescriptorSetLayoutBinding l_SamplerLayoutBinding{};
+        l_SamplerLayoutBinding.binding = 6;
+        l_SamplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_SamplerLayoutBinding.descriptorCount = m_BindlessTextures ? l_LayoutTextureCount : s_MaxMaterialTextures;
+        l_SamplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        l_SamplerLayoutBinding.pImmutableSamplers = nullptr;
 
         // Descriptor layout summary (set = 0):
-        // 0 -> Global scene uniform buffer, 1 -> Material table, 2 -> Material textures, 3 -> Skybox cubemap,
-        // 4 -> Bone palette storage buffer, 5 -> AI frame blend texture sampled during shading.
-        // Future optimisation passes can extend this without reshuffling existing slots.
-        std::array<VkDescriptorSetLayoutBinding, 6> l_Bindings
+        // 0 -> Global scene uniform buffer, 1 -> Material table, 2 -> AI frame blend texture sampled during shading,
+        // 3 -> Skybox cubemap, 4 -> Bone palette (skinning itself runs in SkinningPass), 5 -> Scene instance records,
+        // 6 -> Material textures (bindless when supported).
+        std::array<VkDescriptorSetLayoutBinding, 7> l_Bindings
         {
             l_GlobalLayoutBinding,
             l_MaterialLayoutBinding,
-            l_SamplerLayoutBinding,
+            l_AiBlendBinding,
             l_SkyboxSamplerBinding,
             l_BonePaletteBinding,
-            l_AiBlendBinding
+            l_SceneBufferBinding,
+            l_SamplerLayoutBinding
         };
 
+        // Only the texture array is partially bound and update-after-bind; the other bindings keep their usual rules.
+        std::array<VkDescriptorBindingFlags, 7> l_BindingFlags{};
+        l_BindingFlags[6] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+            | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo l_BindingFlagsInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO };
+        l_BindingFlagsInfo.bindingCount = static_cast<uint32_t>(l_BindingFlags.size());
+        l_BindingFlagsInfo.pBindingFlags = l_BindingFlags.data();
 
         VkDescriptorSetLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
         l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_Bindings.size());
         l_LayoutInfo.pBindings = l_Bindings.data();
+        if (m_BindlessTextures)
+        {
+            l_LayoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+            l_LayoutInfo.pNext = &l_BindingFlagsInfo;
+        }
 
         if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS)
         {
             TR_CORE_CRITICAL("Failed to create descriptor set layout");
         }
 
-        TR_CORE_TRACE("Descriptor Set Layout Created");
+        TR_CORE_TRACE("Descriptor Set Layout Created (Material textures = {}, Bindless = {})", m_MaterialTextureCapacity, m_BindlessTextures);
     }
 
     void Pipeline::CreateSkyboxDescriptorSetLayout()
@@ -546,7 +753,7 @@ namespace Trident
         TR_CORE_TRACE("Skybox Descriptor Set Layout Created");
     }
 
-    void Pipeline::CreateGraphicsPipeline(Swapchain& swapchain)
+    void Pipeline::CreateGraphicsPipeline()
     {
         TR_CORE_TRACE("Creating Graphics Pipeline");
 
@@ -557,12 +764,37 @@ namespace Trident
             TR_CORE_WARN("Shader compilation reported issues; attempting to reuse existing SPIR-V artifacts");
         }
 
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(RenderablePushConstant);
+
+        VkPipelineLayoutCreateInfo l_PipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_PipelineLayoutInfo.setLayoutCount = 1;
+        l_PipelineLayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        l_PipelineLayoutInfo.pushConstantRangeCount = 1;
+        l_PipelineLayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (vkCreatePipelineLayout(Startup::GetDevice(), &l_PipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create pipeline layout");
+        }
+
+        BuildGraphicsPipelines(m_GraphicsPipelines);
+        RecordSourceHashes(m_ShaderStages);
+
+        TR_CORE_TRACE("Graphics Pipeline Created");
+    }
+
+    // Touches nothing the render thread writes (the pipeline cache synchronises itself), so the reload worker can call it while frames render.
+    bool Pipeline::BuildGraphicsPipelines(std::array<VkPipeline, s_PermutationCount>& pipelines) const
+    {
         std::vector<VkPipelineShaderStageCreateInfo> l_ShaderStages;
         std::vector<VkShaderModule> l_ShaderModules;
         l_ShaderStages.reserve(m_ShaderStages.size());
         l_ShaderModules.reserve(m_ShaderStages.size());
 
-        for (auto& l_Shader : m_ShaderStages)
+        for (const auto& l_Shader : m_ShaderStages)
         {
             auto a_Code = Utilities::FileManagement::ReadBinaryFile(l_Shader.SpirvPath);
             if (a_Code.empty())
@@ -595,7 +827,7 @@ namespace Trident
 
             TR_CORE_CRITICAL("Aborting pipeline creation because a shader stage failed to load");
 
-            return;
+            return false;
         }
 
         auto a_BindingDescription = Vertex::GetBindingDescription();
@@ -611,23 +843,11 @@ namespace Trident
         l_InputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
         l_InputAssembly.primitiveRestartEnable = VK_FALSE;
 
-        VkViewport l_Viewport{};
-        l_Viewport.x = 0.0f;
-        l_Viewport.y = 0.0f;
-        l_Viewport.width = static_cast<float>(swapchain.GetExtent().width);
-        l_Viewport.height = static_cast<float>(swapchain.GetExtent().height);
-        l_Viewport.minDepth = 0.0f;
-        l_Viewport.maxDepth = 1.0f;
-
-        VkRect2D l_Scissor{};
-        l_Scissor.offset = { 0,0 };
-        l_Scissor.extent = swapchain.GetExtent();
-
+        // Viewport and scissor are dynamic state, so the pipeline does not depend on the swapchain extent and can be
+        // rebuilt off the render thread.
         VkPipelineViewportStateCreateInfo l_ViewportState{ VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
         l_ViewportState.viewportCount = 1;
-        l_ViewportState.pViewports = &l_Viewport;
         l_ViewportState.scissorCount = 1;
-        l_ViewportState.pScissors = &l_Scissor;
 
         VkPipelineRasterizationStateCreateInfo l_Rasterizer{ VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
         l_Rasterizer.depthClampEnable = VK_FALSE;
@@ -665,25 +885,22 @@ namespace Trident
         l_DynamicState.dynamicStateCount = 2;
         l_DynamicState.pDynamicStates = l_DynamicStates;
 
-        VkPushConstantRange l_PushConstant{};
-        l_PushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-        l_PushConstant.offset = 0;
-        l_PushConstant.size = sizeof(RenderablePushConstant);
-
-        VkPipelineLayoutCreateInfo l_PipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
-        l_PipelineLayoutInfo.setLayoutCount = 1;
-        l_PipelineLayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
-        l_PipelineLayoutInfo.pushConstantRangeCount = 1;
-        l_PipelineLayoutInfo.pPushConstantRanges = &l_PushConstant;
-
-        if (vkCreatePipelineLayout(Startup::GetDevice(), &l_PipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        // Every permutation shares the same modules and fixed-function state; only the specialization data differs.
+        std::array<VkSpecializationMapEntry, s_FeatureCount> l_SpecializationEntries{};
+        for (uint32_t it_Feature = 0; it_Feature < s_FeatureCount; ++it_Feature)
         {
-            TR_CORE_CRITICAL("Failed to create pipeline layout");
+            l_SpecializationEntries[it_Feature].constantID = it_Feature;
+            l_SpecializationEntries[it_Feature].offset = it_Feature * sizeof(VkBool32);
+            l_SpecializationEntries[it_Feature].size = sizeof(VkBool32);
         }
 
+        std::array<std::array<VkBool32, s_FeatureCount>, s_PermutationCount> l_SpecializationData{};
+        std::array<VkSpecializationInfo, s_PermutationCount> l_SpecializationInfos{};
+        std::vector<VkPipelineShaderStageCreateInfo> l_PermutationStages(s_PermutationCount * l_ShaderStages.size());
+        std::array<VkGraphicsPipelineCreateInfo, s_PermutationCount> l_PipelineInfos{};
+
         VkGraphicsPipelineCreateInfo l_PipelineInfo{ VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
         l_PipelineInfo.stageCount = static_cast<uint32_t>(l_ShaderStages.size());
-        l_PipelineInfo.pStages = l_ShaderStages.data();
         l_PipelineInfo.pVertexInputState = &l_VertexInputInfo;
         l_PipelineInfo.pInputAssemblyState = &l_InputAssembly;
         l_PipelineInfo.pViewportState = &l_ViewportState;
@@ -698,9 +915,53 @@ namespace Trident
         l_PipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
         l_PipelineInfo.basePipelineIndex = -1;
 
-        if (vkCreateGraphicsPipelines(Startup::GetDevice(), VK_NULL_HANDLE, 1, &l_PipelineInfo, nullptr, &m_GraphicsPipeline) != VK_SUCCESS)
+        for (uint32_t it_Permutation = 0; it_Permutation < s_PermutationCount; ++it_Permutation)
+        {
+            for (uint32_t it_Feature = 0; it_Feature < s_FeatureCount; ++it_Feature)
+            {
+                l_SpecializationData[it_Permutation][it_Feature] = (it_Permutation & (1u << it_Feature)) != 0 ? VK_TRUE : VK_FALSE;
+            }
+
+            VkSpecializationInfo& l_Specialization = l_SpecializationInfos[it_Permutation];
+            l_Specialization.mapEntryCount = static_cast<uint32_t>(l_SpecializationEntries.size());
+            l_Specialization.pMapEntries = l_SpecializationEntries.data();
+            l_Specialization.dataSize = sizeof(VkBool32) * s_FeatureCount;
+            l_Specialization.pData = l_SpecializationData[it_Permutation].data();
+
+            // Constants a stage does not declare are ignored, so both stages can share one specialization block.
+            VkPipelineShaderStageCreateInfo* l_Stages = l_PermutationStages.data() + it_Permutation * l_ShaderStages.size();
+            for (size_t it_Stage = 0; it_Stage < l_ShaderStages.size(); ++it_Stage)
+            {
+                l_Stages[it_Stage] = l_ShaderStages[it_Stage];
+                l_Stages[it_Stage].pSpecializationInfo = &l_Specialization;
+            }
+
+            l_PipelineInfos[it_Permutation] = l_PipelineInfo;
+            l_PipelineInfos[it_Permutation].pStages = l_Stages;
+        }
+
+        const auto a_BuildStart = std::chrono::steady_clock::now();
+        const VkResult l_Result = vkCreateGraphicsPipelines(Startup::GetDevice(), m_PipelineCache, static_cast<uint32_t>(l_PipelineInfos.size()), l_PipelineInfos.data(), nullptr,
+            pipelines.data());
+        const double l_BuildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - a_BuildStart).count();
+
+        if (l_Result != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create graphics pipeline permutations (VkResult {})", static_cast<int>(l_Result));
+
+            // Callers check IsGraphicsPipelineReady(), so a partial set is dropped rather than served.
+            for (VkPipeline& it_Pipeline : pipelines)
+            {
+                if (it_Pipeline != VK_NULL_HANDLE)
+                {
+                    vkDestroyPipeline(Startup::GetDevice(), it_Pipeline, nullptr);
+                    it_Pipeline = VK_NULL_HANDLE;
+                }
+            }
+        }
+        else
         {
-            TR_CORE_CRITICAL("Failed to create graphics pipeline");
+            TR_CORE_TRACE("Built {} graphics pipeline permutations in {:.2f} ms", s_PermutationCount, l_BuildMilliseconds);
         }
 
         for (VkShaderModule it_Module : l_ShaderModules)
@@ -708,39 +969,51 @@ namespace Trident
             vkDestroyShaderModule(Startup::GetDevice(), it_Module, nullptr);
         }
 
-        std::error_code l_Error{};
-        for (auto& l_Shader : m_ShaderStages)
+        return l_Result == VK_SUCCESS;
+    }
+
+
+    void Pipeline::CreateSkyboxPipeline()
+    {
+        TR_CORE_TRACE("Creating Skybox Pipeline");
+
+        DestroySkyboxPipeline();
+
+        if (!EnsureShaderBinaries(m_SkyboxShaderStages))
         {
-            if (std::filesystem::exists(l_Shader.SourcePath, l_Error))
-            {
-                l_Shader.SourceTimestamp = std::filesystem::last_write_time(l_Shader.SourcePath, l_Error);
-            }
-            if (std::filesystem::exists(l_Shader.SpirvPath, l_Error))
-            {
-                l_Shader.SpirvTimestamp = std::filesystem::last_write_time(l_Shader.SpirvPath, l_Error);
-            }
+            TR_CORE_WARN("Skybox shader compilation reported issues; attempting to reuse existing SPIR-V artifacts");
         }
 
-        TR_CORE_TRACE("Graphics Pipeline Created");
-}
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(glm::mat4);
 
-void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
-{
-    TR_CORE_TRACE("Creating Skybox Pipeline");
+        VkPipelineLayoutCreateInfo l_PipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_PipelineLayoutInfo.setLayoutCount = 1;
+        l_PipelineLayoutInfo.pSetLayouts = &m_SkyboxDescriptorSetLayout;
+        l_PipelineLayoutInfo.pushConstantRangeCount = 1;
+        l_PipelineLayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (vkCreatePipelineLayout(Startup::GetDevice(), &l_PipelineLayoutInfo, nullptr, &m_SkyboxPipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create skybox pipeline layout");
+        }
 
-    DestroySkyboxPipeline();
+        BuildSkyboxPipeline(m_SkyboxPipeline);
+        RecordSourceHashes(m_SkyboxShaderStages);
 
-    if (!EnsureShaderBinaries(m_SkyboxShaderStages))
-    {
-        TR_CORE_WARN("Skybox shader compilation reported issues; attempting to reuse existing SPIR-V artifacts");
+        TR_CORE_TRACE("Skybox Pipeline Created");
     }
 
+bool Pipeline::BuildSkyboxPipeline(VkPipeline& pipeline) const
+{
     std::vector<VkPipelineShaderStageCreateInfo> l_ShaderStages;
     std::vector<VkShaderModule> l_ShaderModules;
     l_ShaderStages.reserve(m_SkyboxShaderStages.size());
     l_ShaderModules.reserve(m_SkyboxShaderStages.size());
 
-    for (auto& l_Shader : m_SkyboxShaderStages)
+    for (const auto& l_Shader : m_SkyboxShaderStages)
     {
         auto a_Code = Utilities::FileManagement::ReadBinaryFile(l_Shader.SpirvPath);
         if (a_Code.empty())
@@ -773,7 +1046,7 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
 
         TR_CORE_CRITICAL("Aborting skybox pipeline creation because a shader stage failed to load");
 
-        return;
+        return false;
     }
 
     VkVertexInputBindingDescription l_Binding{};
@@ -797,23 +1070,10 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
     l_InputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
     l_InputAssembly.primitiveRestartEnable = VK_FALSE;
 
-    VkViewport l_Viewport{};
-    l_Viewport.x = 0.0f;
-    l_Viewport.y = 0.0f;
-    l_Viewport.width = static_cast<float>(swapchain.GetExtent().width);
-    l_Viewport.height = static_cast<float>(swapchain.GetExtent().height);
-    l_Viewport.minDepth = 0.0f;
-    l_Viewport.maxDepth = 1.0f;
-
-    VkRect2D l_Scissor{};
-    l_Scissor.offset = { 0,0 };
-    l_Scissor.extent = swapchain.GetExtent();
-
+    // Dynamic viewport and scissor, as in the main pipeline.
     VkPipelineViewportStateCreateInfo l_ViewportState{ VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
     l_ViewportState.viewportCount = 1;
-    l_ViewportState.pViewports = &l_Viewport;
     l_ViewportState.scissorCount = 1;
-    l_ViewportState.pScissors = &l_Scissor;
 
     VkPipelineRasterizationStateCreateInfo l_Rasterizer{ VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
     l_Rasterizer.depthClampEnable = VK_FALSE;
@@ -849,22 +1109,6 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
     l_DynamicState.dynamicStateCount = 2;
     l_DynamicState.pDynamicStates = l_DynamicStates;
 
-    VkPushConstantRange l_PushConstant{};
-    l_PushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    l_PushConstant.offset = 0;
-    l_PushConstant.size = sizeof(glm::mat4);
-
-    VkPipelineLayoutCreateInfo l_PipelineLayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
-    l_PipelineLayoutInfo.setLayoutCount = 1;
-    l_PipelineLayoutInfo.pSetLayouts = &m_SkyboxDescriptorSetLayout;
-    l_PipelineLayoutInfo.pushConstantRangeCount = 1;
-    l_PipelineLayoutInfo.pPushConstantRanges = &l_PushConstant;
-
-    if (vkCreatePipelineLayout(Startup::GetDevice(), &l_PipelineLayoutInfo, nullptr, &m_SkyboxPipelineLayout) != VK_SUCCESS)
-    {
-        TR_CORE_CRITICAL("Failed to create skybox pipeline layout");
-    }
-
     VkGraphicsPipelineCreateInfo l_PipelineInfo{ VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
     l_PipelineInfo.stageCount = static_cast<uint32_t>(l_ShaderStages.size());
     l_PipelineInfo.pStages = l_ShaderStages.data();
@@ -882,9 +1126,11 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
     l_PipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
     l_PipelineInfo.basePipelineIndex = -1;
 
-    if (vkCreateGraphicsPipelines(Startup::GetDevice(), VK_NULL_HANDLE, 1, &l_PipelineInfo, nullptr, &m_SkyboxPipeline) != VK_SUCCESS)
+    const VkResult l_Result = vkCreateGraphicsPipelines(Startup::GetDevice(), m_PipelineCache, 1, &l_PipelineInfo, nullptr, &pipeline);
+    if (l_Result != VK_SUCCESS)
     {
         TR_CORE_CRITICAL("Failed to create skybox graphics pipeline");
+        pipeline = VK_NULL_HANDLE;
     }
 
     for (VkShaderModule it_Module : l_ShaderModules)
@@ -892,20 +1138,7 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
         vkDestroyShaderModule(Startup::GetDevice(), it_Module, nullptr);
     }
 
-    std::error_code l_Error{};
-    for (auto& l_Shader : m_SkyboxShaderStages)
-    {
-        if (std::filesystem::exists(l_Shader.SourcePath, l_Error))
-        {
-            l_Shader.SourceTimestamp = std::filesystem::last_write_time(l_Shader.SourcePath, l_Error);
-        }
-        if (std::filesystem::exists(l_Shader.SpirvPath, l_Error))
-        {
-            l_Shader.SpirvTimestamp = std::filesystem::last_write_time(l_Shader.SpirvPath, l_Error);
-        }
-    }
-
-    TR_CORE_TRACE("Skybox Pipeline Created");
+    return l_Result == VK_SUCCESS;
 }
 
     void Pipeline::CreateFramebuffers(Swapchain& swapchain)
@@ -994,79 +1227,279 @@ void Pipeline::CreateSkyboxPipeline(Swapchain& swapchain)
         TR_CORE_TRACE("Framebuffers Created ({} Total)", m_SwapchainFramebuffers.size());
     }
 
-    bool Pipeline::ReloadIfNeeded(Swapchain& swapchain, bool waitForDevice)
+    void Pipeline::RequestReload()
     {
-        std::error_code l_Error{};
-        bool l_ShouldReloadDefault = false;
-        bool l_ShouldReloadSkybox = false;
+        {
+            std::scoped_lock l_Lock(m_ReloadMutex);
+            m_ReloadRequested = true;
+        }
+        m_ReloadCondition.notify_one();
+    }
+
+    Pipeline::ReloadResult Pipeline::ApplyPendingReload(Buffers& buffers)
+    {
+        ReloadBuild l_Build{};
+        {
+            std::scoped_lock l_Lock(m_ReloadMutex);
+            if (m_PendingBuild.m_Result == ReloadResult::None)
+            {
+                return ReloadResult::None;
+            }
+
+            l_Build = std::exchange(m_PendingBuild, ReloadBuild{});
+        }
+
+        if (l_Build.m_GraphicsPipelines[0] != VK_NULL_HANDLE)
+        {
+            for (size_t it_Permutation = 0; it_Permutation < m_GraphicsPipelines.size(); ++it_Permutation)
+            {
+                RetirePipeline(buffers, m_GraphicsPipelines[it_Permutation]);
+                m_GraphicsPipelines[it_Permutation] = l_Build.m_GraphicsPipelines[it_Permutation];
+            }
+        }
+
+        if (l_Build.m_SkyboxPipeline != VK_NULL_HANDLE)
+        {
+            RetirePipeline(buffers, m_SkyboxPipeline);
+            m_SkyboxPipeline = l_Build.m_SkyboxPipeline;
+        }
+
+        return l_Build.m_Result;
+    }
+
+    void Pipeline::StartReloadWorker()
+    {
+        m_ReloadWorkerShouldStop = false;
+        m_ReloadRequested = false;
+        m_ReloadThread = std::thread(&Pipeline::ReloadWorkerLoop, this);
+    }
+
+    void Pipeline::StopReloadWorker()
+    {
+        {
+            std::scoped_lock l_Lock(m_ReloadMutex);
+            m_ReloadWorkerShouldStop = true;
+        }
+        m_ReloadCondition.notify_all();
 
-        auto l_CheckStages = [&l_Error](std::vector<ShaderStage>& a_Stages)
+        if (m_ReloadThread.joinable())
+        {
+            m_ReloadThread.join();
+        }
+
+        // A finished rebuild that was never swapped in was never bound either.
+        for (VkPipeline it_Pipeline : m_PendingBuild.m_GraphicsPipelines)
+        {
+            if (it_Pipeline != VK_NULL_HANDLE)
             {
-                bool l_ShouldReload = false;
-                for (auto& l_Shader : a_Stages)
+                vkDestroyPipeline(Startup::GetDevice(), it_Pipeline, nullptr);
+            }
+        }
+
+        if (m_PendingBuild.m_SkyboxPipeline != VK_NULL_HANDLE)
+        {
+            vkDestroyPipeline(Startup::GetDevice(), m_PendingBuild.m_SkyboxPipeline, nullptr);
+        }
+
+        m_PendingBuild = ReloadBuild{};
+    }
+
+    void Pipeline::ReloadWorkerLoop()
+    {
+        std::unique_lock<std::mutex> l_Lock(m_ReloadMutex);
+        while (!m_ReloadWorkerShouldStop)
+        {
+            // Poll on a timer so edits are noticed without the file watcher; a request just cuts the wait short.
+            m_ReloadCondition.wait_for(l_Lock, s_ReloadPollInterval, [this]()
                 {
-                    if (!std::filesystem::exists(l_Shader.SourcePath, l_Error))
-                    {
-                        continue;
-                    }
-
-                    auto l_WriteTime = std::filesystem::last_write_time(l_Shader.SourcePath, l_Error);
-                    if (l_Shader.SourceTimestamp != l_WriteTime)
-                    {
-                        l_ShouldReload = true;
-                    }
-                }
-                return l_ShouldReload;
-            };
+                    return m_ReloadWorkerShouldStop || m_ReloadRequested;
+                });
 
-        l_ShouldReloadDefault = l_CheckStages(m_ShaderStages);
-        l_ShouldReloadSkybox = l_CheckStages(m_SkyboxShaderStages);
+            if (m_ReloadWorkerShouldStop)
+            {
+                break;
+            }
+
+            const bool l_Requested = m_ReloadRequested;
+            m_ReloadRequested = false;
+
+            l_Lock.unlock();
+            ReloadBuild l_Build = RebuildChangedPipelines();
+            l_Lock.lock();
 
-        if (!l_ShouldReloadDefault && !l_ShouldReloadSkybox)
+            // Timer polls that found nothing stay silent; a request always gets an answer.
+            if (l_Build.m_Result != ReloadResult::Unchanged || l_Requested)
+            {
+                PublishReloadBuild(l_Build);
+            }
+        }
+    }
+
+    Pipeline::ReloadBuild Pipeline::RebuildChangedPipelines()
+    {
+        ReloadBuild l_Build{};
+
+        const ReloadResult l_DefaultResult = CompileChangedStages(m_ShaderStages);
+        bool l_Failed = l_DefaultResult == ReloadResult::Failed;
+        bool l_Applied = false;
+        if (l_DefaultResult == ReloadResult::Applied)
         {
-            return false;
+            l_Applied = BuildGraphicsPipelines(l_Build.m_GraphicsPipelines);
+            l_Failed = l_Failed || !l_Applied;
         }
 
-        if (waitForDevice)
+        const ReloadResult l_SkyboxResult = CompileChangedStages(m_SkyboxShaderStages);
+        l_Failed = l_Failed || l_SkyboxResult == ReloadResult::Failed;
+        if (l_SkyboxResult == ReloadResult::Applied)
         {
-            vkDeviceWaitIdle(Startup::GetDevice());
+            const bool l_Built = BuildSkyboxPipeline(l_Build.m_SkyboxPipeline);
+            l_Applied = l_Applied || l_Built;
+            l_Failed = l_Failed || !l_Built;
         }
 
-        if (l_ShouldReloadDefault)
+        l_Build.m_Result = l_Failed ? ReloadResult::Failed : (l_Applied ? ReloadResult::Applied : ReloadResult::Unchanged);
+
+        return l_Build;
+    }
+
+    Pipeline::ReloadResult Pipeline::CompileChangedStages(std::vector<ShaderStage>& shaderStages)
+    {
+        ReloadResult l_Result = ReloadResult::Unchanged;
+        for (ShaderStage& it_Stage : shaderStages)
         {
-            CreateGraphicsPipeline(swapchain);
+            // Content rather than timestamps, so saving an unchanged file or touching it from a tool costs nothing.
+            const uint64_t l_Hash = HashShaderSource(it_Stage.SourcePath);
+            if (l_Hash == 0 || l_Hash == it_Stage.SourceHash)
+            {
+                continue;
+            }
 
-            if (m_GraphicsPipeline == VK_NULL_HANDLE)
+            // Recorded even when compilation fails so a broken edit is reported once instead of on every poll.
+            it_Stage.SourceHash = l_Hash;
+            if (!CompileShaderStage(it_Stage))
             {
-                TR_CORE_ERROR("Graphics pipeline handle is null after reload attempt");
-                return false;
+                l_Result = ReloadResult::Failed;
+            }
+            else if (l_Result == ReloadResult::Unchanged)
+            {
+                l_Result = ReloadResult::Applied;
             }
         }
 
-        if (l_ShouldReloadSkybox)
+        return l_Result;
+    }
+
+    void Pipeline::PublishReloadBuild(ReloadBuild& build)
+    {
+        // Superseded rebuilds were never handed to the render thread, so they are destroyed directly.
+        if (build.m_GraphicsPipelines[0] != VK_NULL_HANDLE)
         {
-            CreateSkyboxPipeline(swapchain);
+            for (size_t it_Permutation = 0; it_Permutation < build.m_GraphicsPipelines.size(); ++it_Permutation)
+            {
+                if (m_PendingBuild.m_GraphicsPipelines[it_Permutation] != VK_NULL_HANDLE)
+                {
+                    vkDestroyPipeline(Startup::GetDevice(), m_PendingBuild.m_GraphicsPipelines[it_Permutation], nullptr);
+                }
+                m_PendingBuild.m_GraphicsPipelines[it_Permutation] = build.m_GraphicsPipelines[it_Permutation];
+            }
+        }
 
-            if (m_SkyboxPipeline == VK_NULL_HANDLE)
+        if (build.m_SkyboxPipeline != VK_NULL_HANDLE)
+        {
+            if (m_PendingBuild.m_SkyboxPipeline != VK_NULL_HANDLE)
             {
-                TR_CORE_ERROR("Skybox pipeline handle is null after reload attempt");
-                return false;
+                vkDestroyPipeline(Startup::GetDevice(), m_PendingBuild.m_SkyboxPipeline, nullptr);
             }
+            m_PendingBuild.m_SkyboxPipeline = build.m_SkyboxPipeline;
+        }
+
+        if (build.m_Result != ReloadResult::Unchanged || m_PendingBuild.m_Result == ReloadResult::None)
+        {
+            m_PendingBuild.m_Result = build.m_Result;
+        }
+    }
+
+    void Pipeline::RetirePipeline(Buffers& buffers, VkPipeline pipeline)
+    {
+        if (pipeline == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        // Frames already submitted may still bind the handle; every later frame is recorded with its replacement.
+        buffers.Retire([pipeline]()
+            {
+                vkDestroyPipeline(Startup::GetDevice(), pipeline, nullptr);
+            });
+    }
+
+    void Pipeline::RecordSourceHashes(std::vector<ShaderStage>& shaderStages)
+    {
+        for (ShaderStage& it_Stage : shaderStages)
+        {
+            it_Stage.SourceHash = HashShaderSource(it_Stage.SourcePath);
+        }
+    }
+
+    VkPipeline Pipeline::CreateComputePipeline(const std::string& shaderFile, VkPipelineLayout pipelineLayout)
+    {
+        if (pipelineLayout == VK_NULL_HANDLE)
+        {
+            return VK_NULL_HANDLE;
+        }
+
+        std::vector<ShaderStage> l_Stages(1);
+        l_Stages[0].Stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_Stages[0].SourcePath = (std::filesystem::path("Assets") / "Shaders" / shaderFile).generic_string();
+        l_Stages[0].SpirvPath = l_Stages[0].SourcePath + ".spv";
+
+        if (!EnsureShaderBinaries(l_Stages))
+        {
+            TR_CORE_WARN("Compute shader compilation reported issues; attempting to reuse existing SPIR-V for {}", shaderFile);
+        }
+
+        auto a_Code = Utilities::FileManagement::ReadBinaryFile(l_Stages[0].SpirvPath);
+        if (a_Code.empty())
+        {
+            TR_CORE_CRITICAL("Failed to read compute shader binary: {}", l_Stages[0].SpirvPath);
+            return VK_NULL_HANDLE;
         }
 
-        return true;
+        VkShaderModule l_Module = CreateShaderModule(a_Code);
+        if (l_Module == VK_NULL_HANDLE)
+        {
+            return VK_NULL_HANDLE;
+        }
+
+        VkComputePipelineCreateInfo l_PipelineInfo{ VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+        l_PipelineInfo.stage = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+        l_PipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_PipelineInfo.stage.module = l_Module;
+        l_PipelineInfo.stage.pName = "main";
+        l_PipelineInfo.layout = pipelineLayout;
+
+        VkPipeline l_Pipeline = VK_NULL_HANDLE;
+        if (vkCreateComputePipelines(Startup::GetDevice(), m_PipelineCache, 1, &l_PipelineInfo, nullptr, &l_Pipeline) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create compute pipeline for {}", shaderFile);
+            l_Pipeline = VK_NULL_HANDLE;
+        }
+
+        vkDestroyShaderModule(Startup::GetDevice(), l_Module, nullptr);
+
+        return l_Pipeline;
     }
 
     //------------------------------------------------------------------------------------------------------------------------------------------------------//
 
-    VkShaderModule Pipeline::CreateShaderModule(const std::vector<char>& code)
+    VkShaderModule Pipeline::CreateShaderModule(const std::vector<char>& code) const
     {
         VkShaderModuleCreateInfo l_CreateInfo{};
         l_CreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
         l_CreateInfo.codeSize = code.size();
         l_CreateInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
 
-        VkShaderModule l_Module;
+        VkShaderModule l_Module = VK_NULL_HANDLE;
         if (vkCreateShaderModule(Startup::GetDevice(), &l_CreateInfo, nullptr, &l_Module) != VK_SUCCESS)
         {
             TR_CORE_CRITICAL("Failed to create shader l_Module");
@@ -1,31 +1,63 @@
 #pragma once
 
 #include <vulkan/vulkan.h>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace Trident
 {
     class Swapchain;
+    class Buffers;
 
     class Pipeline
     {
     public:
-        // Hard limit for the number of material textures bound at once. The renderer keeps slot 0 reserved
-        // for the default white texture so real assets start at index 1. This value mirrors the size of the
-        // combined image sampler array exposed to shaders and descriptor sets.
+        // Material texture slots on devices without update-after-bind descriptor indexing. The renderer keeps slot 0
+        // reserved for the default white texture so real assets start at index 1.
         static constexpr uint32_t s_MaxMaterialTextures = 256;
+        // Slots each descriptor set allocates on bindless devices; the layout itself declares the full device limit.
+        static constexpr uint32_t s_MaxBindlessTextures = 65536;
+
+        // Feature bits selecting a main pipeline permutation. Each bit maps onto a specialization constant in
+        // Default.vert/.frag so disabled paths are compiled out by the driver instead of branched around per fragment.
+        static constexpr uint32_t s_FeatureSceneInstance = 1u << 0;  // Model matrix from the scene buffer (meshes) instead of push constants (sprites).
+        static constexpr uint32_t s_FeatureAiBlend = 1u << 1;        // Blend the AI output texture over the shaded colour.
+        static constexpr uint32_t s_FeatureAlphaTest = 1u << 2;      // Discard fragments below the material's alpha cutoff.
+        static constexpr uint32_t s_FeatureCount = 3;
+        static constexpr uint32_t s_PermutationCount = 1u << s_FeatureCount;
+
+        enum class ReloadResult
+        {
+            None,           // Nothing finished since the last frame.
+            Unchanged,      // A requested check found every source identical to what is already built.
+            Applied,        // Rebuilt pipelines were swapped in.
+            Failed          // A changed shader failed to compile or link; the previous pipelines stay bound.
+        };
 
         void Init(Swapchain& swapchain);
         void Cleanup();
         void RecreateFramebuffers(Swapchain& swapchain);
         void CleanupFramebuffers();
         void CreateFramebuffers(Swapchain& swapchain);
-        bool ReloadIfNeeded(Swapchain& swapchain, bool waitForDevice = true);
+        // Wakes the reload worker so an edit reported by the file watcher is picked up before the next poll.
+        void RequestReload();
+        // Call once per frame before recording. Swaps in pipelines the worker finished and retires the replaced ones
+        // against the frame timeline, so shader edits never idle the device.
+        ReloadResult ApplyPendingReload(Buffers& buffers);
+        // Compiles Assets/Shaders/<shaderFile> on demand and builds a compute pipeline against the caller's layout.
+        VkPipeline CreateComputePipeline(const std::string& shaderFile, VkPipelineLayout pipelineLayout);
 
         VkRenderPass GetRenderPass() const { return m_RenderPass; }
-        VkPipeline GetPipeline() const { return m_GraphicsPipeline; }
+        // Compatible with GetRenderPass() but loads depth so a pass can resume after occlusion culling ran mid-frame.
+        VkRenderPass GetContinuationRenderPass() const { return m_ContinuationRenderPass; }
+        VkPipeline GetPipeline(uint32_t features) const { return m_GraphicsPipelines[features & (s_PermutationCount - 1)]; }
+        bool IsGraphicsPipelineReady() const;
         VkPipelineLayout GetPipelineLayout() const { return m_PipelineLayout; }
         VkPipeline GetSkyboxPipeline() const { return m_SkyboxPipeline; }
         VkPipelineLayout GetSkyboxPipelineLayout() const { return m_SkyboxPipelineLayout; }
@@ -34,6 +66,9 @@ namespace Trident
         const std::vector<VkFramebuffer>& GetFramebuffers() const { return m_SwapchainFramebuffers; }
         const std::vector<VkImage>& GetDepthImages() const { return m_SwapchainDepthImages; }
         VkFormat GetDepthFormat() const { return m_DepthFormat; }
+        // Bindless sets are allocated from an update-after-bind pool with GetMaterialTextureCapacity() variable-count slots.
+        bool UsesBindlessTextures() const { return m_BindlessTextures; }
+        uint32_t GetMaterialTextureCapacity() const { return m_MaterialTextureCapacity; }
 
     private:
         struct ShaderStage
@@ -41,17 +76,39 @@ namespace Trident
             VkShaderStageFlagBits Stage = VK_SHADER_STAGE_VERTEX_BIT;
             std::string SourcePath;                                   // Path to the GLSL file
             std::string SpirvPath;                                    // Path to the generated SPIR-V binary
-            std::filesystem::file_time_type SourceTimestamp{};        // Last edit time cached for hot reload
-            std::filesystem::file_time_type SpirvTimestamp{};         // Timestamp of the SPIR-V output
+            uint64_t SourceHash = 0;                                  // Content hash of the source the SPIR-V was last built from
+        };
+
+        // Pipelines the worker built but the render thread has not swapped in yet.
+        struct ReloadBuild
+        {
+            std::array<VkPipeline, s_PermutationCount> m_GraphicsPipelines{};
+            VkPipeline m_SkyboxPipeline = VK_NULL_HANDLE;
+            ReloadResult m_Result = ReloadResult::None;
         };
 
         void CreateRenderPass(Swapchain& swapchain);
-        void CreateDescriptorSetLayout();
+        void CreateDescriptorSetLayout(uint32_t imageCount);
         void CreateSkyboxDescriptorSetLayout();
-        void CreateGraphicsPipeline(Swapchain& swapchain);
-        void CreateSkyboxPipeline(Swapchain& swapchain);
+        void CreateGraphicsPipeline();
+        void CreateSkyboxPipeline();
+        bool BuildGraphicsPipelines(std::array<VkPipeline, s_PermutationCount>& pipelines) const;
+        bool BuildSkyboxPipeline(VkPipeline& pipeline) const;
         void DestroyGraphicsPipeline();
         void DestroySkyboxPipeline();
+        // Loads the on-disk cache when it was written by this exact device and driver; otherwise starts empty.
+        void CreatePipelineCache();
+        void SavePipelineCache() const;
+        void DestroyPipelineCache();
+        void StartReloadWorker();
+        void StopReloadWorker();
+        void ReloadWorkerLoop();
+        // Worker-side: recompiles stages whose source hash moved and builds replacement pipelines from them.
+        ReloadBuild RebuildChangedPipelines();
+        ReloadResult CompileChangedStages(std::vector<ShaderStage>& shaderStages);
+        void PublishReloadBuild(ReloadBuild& build);
+        static void RetirePipeline(Buffers& buffers, VkPipeline pipeline);
+        static void RecordSourceHashes(std::vector<ShaderStage>& shaderStages);
         void InitializeShaderStages();
         bool EnsureShaderBinaries(std::vector<ShaderStage>& shaderStages);
         bool CompileShaderStage(ShaderStage& shaderStage);
@@ -59,22 +116,34 @@ namespace Trident
         VkFormat SelectDepthFormat() const;
         uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
 
-        VkShaderModule CreateShaderModule(const std::vector<char>& code);
+        VkShaderModule CreateShaderModule(const std::vector<char>& code) const;
 
     private:
         VkRenderPass m_RenderPass = VK_NULL_HANDLE;
+        VkRenderPass m_ContinuationRenderPass = VK_NULL_HANDLE;
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
-        VkPipeline m_GraphicsPipeline = VK_NULL_HANDLE;
+        std::array<VkPipeline, s_PermutationCount> m_GraphicsPipelines{};   // Indexed by feature bits.
+        VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;                   // Shared by every graphics and compute pipeline.
         VkPipelineLayout m_SkyboxPipelineLayout = VK_NULL_HANDLE;
         VkPipeline m_SkyboxPipeline = VK_NULL_HANDLE;
         VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
         VkDescriptorSetLayout m_SkyboxDescriptorSetLayout = VK_NULL_HANDLE;
+        bool m_BindlessTextures = false;
+        uint32_t m_MaterialTextureCapacity = s_MaxMaterialTextures;
         std::vector<VkFramebuffer> m_SwapchainFramebuffers;
         std::vector<VkImage> m_SwapchainDepthImages;
         std::vector<VkDeviceMemory> m_SwapchainDepthMemory;
         std::vector<VkImageView> m_SwapchainDepthImageViews;
         VkFormat m_DepthFormat = VK_FORMAT_UNDEFINED;
-        std::vector<ShaderStage> m_ShaderStages;
+        std::vector<ShaderStage> m_ShaderStages;                           // Owned by the reload worker once Init returns.
         std::vector<ShaderStage> m_SkyboxShaderStages;
+
+        static constexpr std::chrono::milliseconds s_ReloadPollInterval{ 250 };
+        std::thread m_ReloadThread;
+        std::mutex m_ReloadMutex;                                          // Guards m_PendingBuild and the request/stop flags.
+        std::condition_variable m_ReloadCondition;
+        ReloadBuild m_PendingBuild{};
+        bool m_ReloadRequested = false;
+        bool m_ReloadWorkerShouldStop = false;
     };
 }
\ No newline at end of file
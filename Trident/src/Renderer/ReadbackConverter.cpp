@@ -0,0 +1,370 @@
+#include "Renderer/ReadbackConverter.h"
+
+#include "Core/Utilities.h"
+#include "Renderer/SimdSupport.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    constexpr float s_Normalise = 1.0f / 255.0f;
+    constexpr uint32_t s_ChunkPixels = 256;     // Float-only conversions swizzle through a stack buffer of this many pixels.
+
+    struct SwizzlePlan
+    {
+        std::array<uint32_t, 4> m_Mapping{ { 0, 1, 2, 3 } };
+        uint32_t m_ChannelCount = 4;
+        bool m_Identity = false;                        // Four channels already in source order, so a plain copy suffices.
+        alignas(16) std::array<uint8_t, 16> m_Mask{};   // Byte shuffle for four source pixels; 0x80 lanes are zeroed.
+    };
+
+    using SwizzleFunction = void(*)(const uint8_t* source, uint8_t* destination, size_t pixelCount, const SwizzlePlan& plan);
+    using NormaliseFunction = void(*)(const uint8_t* source, float* destination, size_t count);
+
+    struct ConversionKernels
+    {
+        const char* m_Name = "Scalar";
+        SwizzleFunction m_Swizzle = nullptr;
+        NormaliseFunction m_Normalise = nullptr;
+    };
+
+    // Mirrors the original per-channel fallback: a mapping entry outside the source pixel keeps the channel in place.
+    std::array<uint32_t, 4> SanitiseMapping(const Trident::ReadbackConversionDesc& desc)
+    {
+        std::array<uint32_t, 4> l_Mapping = desc.m_ChannelMapping;
+        for (uint32_t it_Channel = 0; it_Channel < 4; ++it_Channel)
+        {
+            if (l_Mapping[it_Channel] >= desc.m_SourceBytesPerPixel)
+            {
+                l_Mapping[it_Channel] = it_Channel;
+            }
+        }
+
+        return l_Mapping;
+    }
+
+    SwizzlePlan BuildSwizzlePlan(const Trident::ReadbackConversionDesc& desc)
+    {
+        SwizzlePlan l_Plan{};
+        l_Plan.m_Mapping = SanitiseMapping(desc);
+        l_Plan.m_ChannelCount = desc.m_ChannelCount;
+        l_Plan.m_Identity = desc.m_ChannelCount == 4 && l_Plan.m_Mapping == std::array<uint32_t, 4>{ { 0, 1, 2, 3 } };
+
+        l_Plan.m_Mask.fill(0x80);
+        for (uint32_t it_Pixel = 0; it_Pixel < 4; ++it_Pixel)
+        {
+            for (uint32_t it_Channel = 0; it_Channel < l_Plan.m_ChannelCount; ++it_Channel)
+            {
+                l_Plan.m_Mask[it_Pixel * l_Plan.m_ChannelCount + it_Channel] = static_cast<uint8_t>(it_Pixel * 4 + l_Plan.m_Mapping[it_Channel]);
+            }
+        }
+
+        return l_Plan;
+    }
+
+    void SwizzleScalar(const uint8_t* source, uint8_t* destination, size_t pixelCount, const SwizzlePlan& plan)
+    {
+        const uint32_t l_ChannelCount = plan.m_ChannelCount;
+        for (size_t it_Pixel = 0; it_Pixel < pixelCount; ++it_Pixel)
+        {
+            for (uint32_t it_Channel = 0; it_Channel < l_ChannelCount; ++it_Channel)
+            {
+                destination[it_Pixel * l_ChannelCount + it_Channel] = source[it_Pixel * 4 + plan.m_Mapping[it_Channel]];
+            }
+        }
+    }
+
+    void NormaliseScalar(const uint8_t* source, float* destination, size_t count)
+    {
+        for (size_t it_Index = 0; it_Index < count; ++it_Index)
+        {
+            destination[it_Index] = static_cast<float>(source[it_Index]) * s_Normalise;
+        }
+    }
+
+#if defined(TRIDENT_SIMD_X64)
+    // SSE2 is part of x64 itself, so this kernel needs no runtime check.
+    void NormaliseSse2(const uint8_t* source, float* destination, size_t count)
+    {
+        const __m128 l_Scale = _mm_set1_ps(s_Normalise);
+        const __m128i l_Zero = _mm_setzero_si128();
+
+        size_t it_Index = 0;
+        for (; it_Index + 16 <= count; it_Index += 16)
+        {
+            const __m128i l_Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + it_Index));
+            const __m128i l_Low = _mm_unpacklo_epi8(l_Bytes, l_Zero);
+            const __m128i l_High = _mm_unpackhi_epi8(l_Bytes, l_Zero);
+
+            _mm_storeu_ps(destination + it_Index, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(l_Low, l_Zero)), l_Scale));
+            _mm_storeu_ps(destination + it_Index + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(l_Low, l_Zero)), l_Scale));
+            _mm_storeu_ps(destination + it_Index + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(l_High, l_Zero)), l_Scale));
+            _mm_storeu_ps(destination + it_Index + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(l_High, l_Zero)), l_Scale));
+        }
+
+        NormaliseScalar(source + it_Index, destination + it_Index, count - it_Index);
+    }
+
+    TRIDENT_SIMD_TARGET("ssse3")
+    void SwizzleSsse3(const uint8_t* source, uint8_t* destination, size_t pixelCount, const SwizzlePlan& plan)
+    {
+        const __m128i l_Mask = _mm_load_si128(reinterpret_cast<const __m128i*>(plan.m_Mask.data()));
+        const size_t l_ChannelCount = plan.m_ChannelCount;
+        // Dropping alpha stores 16 bytes for 12 useful ones; stop while the spare 4 would land past the last pixel. The
+        // overlap is rewritten by the next store or by the scalar tail.
+        const size_t l_Headroom = (l_ChannelCount == 4) ? 4 : 6;
+
+        size_t it_Pixel = 0;
+        for (; it_Pixel + l_Headroom <= pixelCount; it_Pixel += 4)
+        {
+            const __m128i l_Pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + it_Pixel * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + it_Pixel * l_ChannelCount), _mm_shuffle_epi8(l_Pixels, l_Mask));
+        }
+
+        SwizzleScalar(source + it_Pixel * 4, destination + it_Pixel * l_ChannelCount, pixelCount - it_Pixel, plan);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    void SwizzleAvx2(const uint8_t* source, uint8_t* destination, size_t pixelCount, const SwizzlePlan& plan)
+    {
+        // vpshufb works per 128-bit lane, so both lanes use the four-pixel mask.
+        const __m256i l_Mask = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(plan.m_Mask.data())));
+        // Without alpha each lane leaves 12 bytes; moving the lanes' dwords together packs them into the low 24 bytes.
+        const __m256i l_Pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+        const size_t l_ChannelCount = plan.m_ChannelCount;
+        const size_t l_Headroom = (l_ChannelCount == 4) ? 8 : 11;
+
+        size_t it_Pixel = 0;
+        for (; it_Pixel + l_Headroom <= pixelCount; it_Pixel += 8)
+        {
+            __m256i l_Pixels = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + it_Pixel * 4)), l_Mask);
+            if (l_ChannelCount == 3)
+            {
+                l_Pixels = _mm256_permutevar8x32_epi32(l_Pixels, l_Pack);
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + it_Pixel * l_ChannelCount), l_Pixels);
+        }
+
+        SwizzleScalar(source + it_Pixel * 4, destination + it_Pixel * l_ChannelCount, pixelCount - it_Pixel, plan);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    void NormaliseAvx2(const uint8_t* source, float* destination, size_t count)
+    {
+        const __m256 l_Scale = _mm256_set1_ps(s_Normalise);
+
+        size_t it_Index = 0;
+        for (; it_Index + 8 <= count; it_Index += 8)
+        {
+            const __m128i l_Bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + it_Index));
+            const __m256 l_Values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(l_Bytes));
+            _mm256_storeu_ps(destination + it_Index, _mm256_mul_ps(l_Values, l_Scale));
+        }
+
+        NormaliseScalar(source + it_Index, destination + it_Index, count - it_Index);
+    }
+#elif defined(TRIDENT_SIMD_NEON)
+    void SwizzleNeon(const uint8_t* source, uint8_t* destination, size_t pixelCount, const SwizzlePlan& plan)
+    {
+        // Table lookups with an out-of-range index (0x80) write zero, matching the x64 shuffle mask.
+        const uint8x16_t l_Mask = vld1q_u8(plan.m_Mask.data());
+        const size_t l_ChannelCount = plan.m_ChannelCount;
+        const size_t l_Headroom = (l_ChannelCount == 4) ? 4 : 6;
+
+        size_t it_Pixel = 0;
+        for (; it_Pixel + l_Headroom <= pixelCount; it_Pixel += 4)
+        {
+            vst1q_u8(destination + it_Pixel * l_ChannelCount, vqtbl1q_u8(vld1q_u8(source + it_Pixel * 4), l_Mask));
+        }
+
+        SwizzleScalar(source + it_Pixel * 4, destination + it_Pixel * l_ChannelCount, pixelCount - it_Pixel, plan);
+    }
+
+    void NormaliseNeon(const uint8_t* source, float* destination, size_t count)
+    {
+        size_t it_Index = 0;
+        for (; it_Index + 16 <= count; it_Index += 16)
+        {
+            const uint8x16_t l_Bytes = vld1q_u8(source + it_Index);
+            const uint16x8_t l_Low = vmovl_u8(vget_low_u8(l_Bytes));
+            const uint16x8_t l_High = vmovl_u8(vget_high_u8(l_Bytes));
+
+            vst1q_f32(destination + it_Index, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(l_Low))), s_Normalise));
+            vst1q_f32(destination + it_Index + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(l_Low))), s_Normalise));
+            vst1q_f32(destination + it_Index + 8, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(l_High))), s_Normalise));
+            vst1q_f32(destination + it_Index + 12, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(l_High))), s_Normalise));
+        }
+
+        NormaliseScalar(source + it_Index, destination + it_Index, count - it_Index);
+    }
+#endif
+
+    ConversionKernels SelectKernels()
+    {
+#if defined(TRIDENT_SIMD_X64)
+        if (Trident::Simd::SupportsAvx2())
+        {
+            return { "AVX2", &SwizzleAvx2, &NormaliseAvx2 };
+        }
+
+        if (Trident::Simd::SupportsSsse3())
+        {
+            return { "SSSE3", &SwizzleSsse3, &NormaliseSse2 };
+        }
+
+        return { "SSE2", &SwizzleScalar, &NormaliseSse2 };
+#elif defined(TRIDENT_SIMD_NEON)
+        return { "NEON", &SwizzleNeon, &NormaliseNeon };
+#else
+        return { "Scalar", &SwizzleScalar, &NormaliseScalar };
+#endif
+    }
+
+    const ConversionKernels& GetKernels()
+    {
+        static const ConversionKernels s_Kernels = SelectKernels();
+
+        return s_Kernels;
+    }
+
+    void ConvertRow(const ConversionKernels& kernels, const SwizzlePlan& plan, const uint8_t* source, uint32_t width, float* floats, uint8_t* bytes)
+    {
+        const size_t l_ElementCount = static_cast<size_t>(width) * plan.m_ChannelCount;
+
+        if (bytes != nullptr)
+        {
+            if (plan.m_Identity)
+            {
+                std::memcpy(bytes, source, l_ElementCount);
+            }
+            else
+            {
+                kernels.m_Swizzle(source, bytes, width, plan);
+            }
+
+            // The byte row is already in destination order, so the float pass reads it instead of swizzling twice.
+            if (floats != nullptr)
+            {
+                kernels.m_Normalise(bytes, floats, l_ElementCount);
+            }
+
+            return;
+        }
+
+        if (floats == nullptr)
+        {
+            return;
+        }
+
+        if (plan.m_Identity)
+        {
+            kernels.m_Normalise(source, floats, l_ElementCount);
+
+            return;
+        }
+
+        alignas(32) uint8_t l_Chunk[s_ChunkPixels * 4];
+        for (uint32_t it_Pixel = 0; it_Pixel < width; it_Pixel += s_ChunkPixels)
+        {
+            const uint32_t l_PixelCount = std::min(s_ChunkPixels, width - it_Pixel);
+            kernels.m_Swizzle(source + static_cast<size_t>(it_Pixel) * 4, l_Chunk, l_PixelCount, plan);
+            kernels.m_Normalise(l_Chunk, floats + static_cast<size_t>(it_Pixel) * plan.m_ChannelCount, static_cast<size_t>(l_PixelCount) * plan.m_ChannelCount);
+        }
+    }
+}
+
+namespace Trident
+{
+    void ReadbackConverter::Init(uint32_t workerCount)
+    {
+        m_Bands.Init(workerCount);
+
+        TR_CORE_TRACE("ReadbackConverter initialised (Workers = {}, Kernels = {})", workerCount, GetKernelName());
+    }
+
+    void ReadbackConverter::Shutdown()
+    {
+        m_Bands.Shutdown();
+    }
+
+    void ReadbackConverter::Convert(const ReadbackConversionDesc& desc)
+    {
+        if (desc.m_Source == nullptr || desc.m_Width == 0 || desc.m_Height == 0 || (desc.m_Floats == nullptr && desc.m_Bytes == nullptr))
+        {
+            return;
+        }
+
+        const uint64_t l_PixelCount = static_cast<uint64_t>(desc.m_Width) * desc.m_Height;
+        if (l_PixelCount < s_MinParallelPixels)
+        {
+            ConvertRows(desc, 0, desc.m_Height);
+
+            return;
+        }
+
+        m_Bands.Dispatch(desc.m_Height, 1, [](const void* context, uint32_t firstRow, uint32_t rowCount)
+            {
+                ConvertRows(*static_cast<const ReadbackConversionDesc*>(context), firstRow, rowCount);
+            }, &desc);
+    }
+
+    void ReadbackConverter::ConvertRows(const ReadbackConversionDesc& desc, uint32_t firstRow, uint32_t rowCount)
+    {
+        // The kernels assume four-byte source pixels; anything else keeps the generic per-channel loop.
+        if (desc.m_SourceBytesPerPixel != 4 || (desc.m_ChannelCount != 3 && desc.m_ChannelCount != 4))
+        {
+            ConvertRowsScalar(desc, firstRow, rowCount);
+
+            return;
+        }
+
+        const ConversionKernels& l_Kernels = GetKernels();
+        const SwizzlePlan l_Plan = BuildSwizzlePlan(desc);
+        const size_t l_SourceRowBytes = static_cast<size_t>(desc.m_Width) * 4;
+        const size_t l_DestinationRowElements = static_cast<size_t>(desc.m_Width) * desc.m_ChannelCount;
+
+        for (uint32_t it_Row = firstRow; it_Row < firstRow + rowCount; ++it_Row)
+        {
+            float* l_Floats = desc.m_Floats ? desc.m_Floats + it_Row * l_DestinationRowElements : nullptr;
+            uint8_t* l_Bytes = desc.m_Bytes ? desc.m_Bytes + it_Row * l_DestinationRowElements : nullptr;
+            ConvertRow(l_Kernels, l_Plan, desc.m_Source + it_Row * l_SourceRowBytes, desc.m_Width, l_Floats, l_Bytes);
+        }
+    }
+
+    void ReadbackConverter::ConvertRowsScalar(const ReadbackConversionDesc& desc, uint32_t firstRow, uint32_t rowCount)
+    {
+        const std::array<uint32_t, 4> l_Mapping = SanitiseMapping(desc);
+        const uint32_t l_ChannelCount = desc.m_ChannelCount;
+        const size_t l_FirstPixel = static_cast<size_t>(firstRow) * desc.m_Width;
+        const size_t l_EndPixel = l_FirstPixel + static_cast<size_t>(rowCount) * desc.m_Width;
+
+        for (size_t it_Pixel = l_FirstPixel; it_Pixel < l_EndPixel; ++it_Pixel)
+        {
+            const size_t l_SourceOffset = it_Pixel * desc.m_SourceBytesPerPixel;
+            const size_t l_DestinationOffset = it_Pixel * l_ChannelCount;
+
+            for (uint32_t it_Channel = 0; it_Channel < l_ChannelCount; ++it_Channel)
+            {
+                const uint32_t l_SourceChannel = (it_Channel < 4) ? l_Mapping[it_Channel] : it_Channel;
+                const uint8_t l_Value = desc.m_Source[l_SourceOffset + l_SourceChannel];
+
+                if (desc.m_Floats != nullptr)
+                {
+                    desc.m_Floats[l_DestinationOffset + it_Channel] = static_cast<float>(l_Value) * s_Normalise;
+                }
+
+                if (desc.m_Bytes != nullptr)
+                {
+                    desc.m_Bytes[l_DestinationOffset + it_Channel] = l_Value;
+                }
+            }
+        }
+    }
+
+    const char* ReadbackConverter::GetKernelName()
+    {
+        return GetKernels().m_Name;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Renderer/RowBandDispatcher.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Trident
+{
+    /**
+     * @brief Describes one mapped readback buffer and the representations a frame's consumers asked for.
+     *
+     * Either output may be null; a conversion only writes the ones that are set. Both use the same tightly packed
+     * layout of m_Width * m_Height * m_ChannelCount elements.
+     */
+    struct ReadbackConversionDesc
+    {
+        const uint8_t* m_Source = nullptr;
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+        uint32_t m_SourceBytesPerPixel = 4;
+        uint32_t m_ChannelCount = 4;                                // 4 keeps alpha, 3 drops it.
+        std::array<uint32_t, 4> m_ChannelMapping{ { 0, 1, 2, 3 } }; // Source byte feeding each destination channel.
+        float* m_Floats = nullptr;                                  // Normalised [0, 1] output for AI consumers.
+        uint8_t* m_Bytes = nullptr;                                 // Raw byte output for the video encoder.
+    };
+
+    /**
+     * @brief Swizzles, normalises and drops channels of readback frames with SIMD kernels spread across row bands.
+     *
+     * Kernels are picked once per process: AVX2 or SSSE3 when the CPU reports them, SSE2 on any other x64 CPU, NEON on
+     * ARM64 and a scalar loop elsewhere. Convert runs one band on the calling thread and hands the rest to the workers,
+     * returning only when the whole frame is written, so callers can unmap the source right after it.
+     */
+    class ReadbackConverter
+    {
+    public:
+        void Init(uint32_t workerCount);
+        void Shutdown();
+
+        void Convert(const ReadbackConversionDesc& desc);
+
+        // Single-threaded entry points, also used by the benchmark to compare kernels against the scalar reference.
+        static void ConvertRows(const ReadbackConversionDesc& desc, uint32_t firstRow, uint32_t rowCount);
+        static void ConvertRowsScalar(const ReadbackConversionDesc& desc, uint32_t firstRow, uint32_t rowCount);
+        static const char* GetKernelName();
+
+        uint32_t GetWorkerCount() const { return m_Bands.GetWorkerCount(); }
+
+    private:
+        static constexpr uint32_t s_MinParallelPixels = 256 * 256; // Smaller frames finish faster than a worker wakes up.
+
+        RowBandDispatcher m_Bands;
+    };
+}
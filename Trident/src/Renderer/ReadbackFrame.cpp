@@ -0,0 +1,63 @@
+#include "Renderer/ReadbackFrame.h"
+
+#include <algorithm>
+
+namespace Trident
+{
+    void ReadbackConsumerQueue::SetPolicy(ReadbackConsumerPolicy policy, uint32_t interval)
+    {
+        m_Policy = policy;
+        m_Interval = std::max<uint32_t>(interval, 1);
+        m_FrameCounter = 0;
+
+        if (m_Policy == ReadbackConsumerPolicy::LatestOnly)
+        {
+            while (m_Frames.size() > 1)
+            {
+                m_Frames.pop_front();
+                ++m_DroppedFrames;
+            }
+        }
+    }
+
+    bool ReadbackConsumerQueue::ShouldTake()
+    {
+        const uint64_t l_Frame = m_FrameCounter++;
+        if (m_Policy == ReadbackConsumerPolicy::EveryNth)
+        {
+            return (l_Frame % m_Interval) == 0;
+        }
+
+        return true;
+    }
+
+    void ReadbackConsumerQueue::Push(ReadbackFrame frame)
+    {
+        if (m_Policy == ReadbackConsumerPolicy::LatestOnly && !m_Frames.empty())
+        {
+            // Dropping the stale handle releases its lease, so its staging buffer can go straight back to the ring.
+            m_DroppedFrames += m_Frames.size();
+            m_Frames.clear();
+        }
+
+        m_Frames.push_back(std::move(frame));
+    }
+
+    bool ReadbackConsumerQueue::TryPop(ReadbackFrame& outFrame)
+    {
+        if (m_Frames.empty())
+        {
+            return false;
+        }
+
+        outFrame = std::move(m_Frames.front());
+        m_Frames.pop_front();
+
+        return true;
+    }
+
+    void ReadbackConsumerQueue::Clear()
+    {
+        m_Frames.clear();
+    }
+}
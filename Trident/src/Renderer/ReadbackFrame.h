@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Renderer/VideoEncoder.h"
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace Trident
+{
+    /**
+     * @brief Marks a persistently mapped readback buffer as read by CPU consumers.
+     *
+     * Every frame resolved from the buffer shares one lease. Whichever thread drops the last copy clears the flag, and
+     * the renderer recycles the buffer on its next frame; until then it is never handed back to the GPU.
+     */
+    class ReadbackLease
+    {
+    public:
+        explicit ReadbackLease(std::shared_ptr<std::atomic<bool>> inUse) : m_InUse(std::move(inUse))
+        {
+            m_InUse->store(true, std::memory_order_relaxed);
+        }
+
+        ~ReadbackLease()
+        {
+            // Release pairs with the renderer's acquire load, so every read through the lease happens before the GPU reuses it.
+            m_InUse->store(false, std::memory_order_release);
+        }
+
+        ReadbackLease(const ReadbackLease&) = delete;
+        ReadbackLease& operator=(const ReadbackLease&) = delete;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> m_InUse;
+    };
+
+    /**
+     * @brief Zero-copy view of one resolved frame readback.
+     *
+     * Copies are cheap and all point at the same memory: the mapped staging buffer, or a heap allocation on the CPU
+     * conversion fallback. Consumers that read the spans after the call returns keep m_Owner alongside them.
+     */
+    struct ReadbackFrame
+    {
+        std::shared_ptr<const void> m_Owner;        // Keeps the memory behind both spans alive and out of GPU reuse.
+        std::span<const float> m_Tensor;            // NHWC tensor normalised to [0, 1]; empty when not produced.
+        VkExtent2D m_TensorExtent{ 0, 0 };
+        uint32_t m_TensorChannels = 0;
+        std::span<const uint8_t> m_Pixels;          // Encoder payload in m_PixelLayout; empty when not produced.
+        VkExtent2D m_PixelExtent{ 0, 0 };
+        VideoEncoder::PixelLayout m_PixelLayout = VideoEncoder::PixelLayout::Rgba8;
+        uint32_t m_LumaStride = 0;                  // I420 row pitches; unused for RGBA.
+        uint32_t m_ChromaStride = 0;
+        std::chrono::system_clock::time_point m_Timestamp{}; // Wall clock of the frame the copy was recorded in.
+        uint32_t m_FrameIndex = 0;                  // Swapchain image the copy was taken from.
+
+        bool HasTensor() const { return !m_Tensor.empty(); }
+        bool HasPixels() const { return !m_Pixels.empty(); }
+    };
+
+    /**
+     * @brief How a consumer samples the stream of completed readbacks, one frame per rendered frame.
+     */
+    enum class ReadbackConsumerPolicy
+    {
+        LatestOnly,   // Keep only the newest unconsumed frame; older ones are dropped when a newer one lands.
+        EveryNth,     // Take one frame out of every interval frames and queue it.
+        AllFrames     // Queue every frame; slow consumers apply back-pressure through their leases instead.
+    };
+
+    /**
+     * @brief Frames resolved for one consumer, filtered by its policy.
+     *
+     * The renderer asks ShouldTake before producing a consumer's data, so frames a policy skips are never converted.
+     */
+    class ReadbackConsumerQueue
+    {
+    public:
+        void SetPolicy(ReadbackConsumerPolicy policy, uint32_t interval);
+        ReadbackConsumerPolicy GetPolicy() const { return m_Policy; }
+        uint32_t GetInterval() const { return m_Interval; }
+
+        // Advances the frame counter; call once per completed readback.
+        bool ShouldTake();
+        void Push(ReadbackFrame frame);
+        bool TryPop(ReadbackFrame& outFrame);
+        void Clear();
+
+        size_t GetQueuedCount() const { return m_Frames.size(); }
+        uint64_t GetDroppedCount() const { return m_DroppedFrames; }
+
+    private:
+        ReadbackConsumerPolicy m_Policy = ReadbackConsumerPolicy::LatestOnly;
+        uint32_t m_Interval = 1;              // Used by EveryNth only.
+        uint64_t m_FrameCounter = 0;
+        uint64_t m_DroppedFrames = 0;         // Frames replaced before the consumer picked them up (LatestOnly).
+        std::deque<ReadbackFrame> m_Frames;
+    };
+}
@@ -0,0 +1,327 @@
+#include "Renderer/ReadbackPreprocessor.h"
+
+#include "Renderer/Pipeline.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <array>
+
+namespace Trident
+{
+    namespace
+    {
+        constexpr VkDeviceSize s_SectionAlignment = 256;   // Keeps the planes on their own cache lines behind the tensor.
+
+        // Flag bits shared with ReadbackPreprocess.comp.
+        constexpr uint32_t s_FlagTensor = 1u << 0;
+        constexpr uint32_t s_FlagTensorHalf = 1u << 1;
+        constexpr uint32_t s_FlagYuv = 1u << 2;
+        constexpr uint32_t s_FlagYuvFullRange = 1u << 3;
+        constexpr uint32_t s_FlagSourceSrgb = 1u << 4;
+
+        VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        uint32_t GetTensorUnitCount(const ReadbackPreprocessLayout& layout)
+        {
+            const uint32_t l_PixelCount = layout.m_TensorExtent.width * layout.m_TensorExtent.height;
+
+            return layout.m_TensorHalf ? (l_PixelCount + 1) / 2 : l_PixelCount;
+        }
+    }
+
+    ReadbackPreprocessLayout ReadbackPreprocessLayout::Build(VkExtent2D tensorExtent, uint32_t tensorChannels, bool tensorHalf, VkExtent2D yuvExtent, bool yuvFullRange)
+    {
+        ReadbackPreprocessLayout l_Layout{};
+
+        if (tensorExtent.width > 0 && tensorExtent.height > 0 && tensorChannels > 0 && tensorChannels <= 4)
+        {
+            l_Layout.m_TensorExtent = tensorExtent;
+            l_Layout.m_TensorChannels = tensorChannels;
+            l_Layout.m_TensorHalf = tensorHalf;
+            l_Layout.m_TensorOffset = 0;
+            // Every tensor unit owns one word per channel: a float, or a pair of halves covering two pixels.
+            l_Layout.m_TensorSize = static_cast<VkDeviceSize>(GetTensorUnitCount(l_Layout)) * tensorChannels * sizeof(uint32_t);
+        }
+
+        if (yuvExtent.width > 0 && yuvExtent.height > 0)
+        {
+            const uint32_t l_BlocksPerRow = (yuvExtent.width + 7) / 8;
+            const VkDeviceSize l_ChromaRows = (yuvExtent.height + 1) / 2;
+
+            l_Layout.m_YuvExtent = yuvExtent;
+            l_Layout.m_YuvFullRange = yuvFullRange;
+            l_Layout.m_LumaStride = l_BlocksPerRow * 8;
+            l_Layout.m_ChromaStride = l_BlocksPerRow * 4;
+            l_Layout.m_YuvOffset = AlignUp(l_Layout.m_TensorOffset + l_Layout.m_TensorSize, s_SectionAlignment);
+            l_Layout.m_YuvSize = static_cast<VkDeviceSize>(l_Layout.m_LumaStride) * yuvExtent.height + 2 * static_cast<VkDeviceSize>(l_Layout.m_ChromaStride) * l_ChromaRows;
+        }
+
+        if (l_Layout.HasYuv())
+        {
+            l_Layout.m_TotalSize = l_Layout.m_YuvOffset + l_Layout.m_YuvSize;
+        }
+        else
+        {
+            l_Layout.m_TotalSize = l_Layout.m_TensorOffset + l_Layout.m_TensorSize;
+        }
+
+        return l_Layout;
+    }
+
+    void ReadbackPreprocessor::Init(Pipeline& pipeline)
+    {
+        static_assert(sizeof(PreprocessPushConstants) == 64, "PreprocessPushConstants must match ReadbackPreprocess.comp");
+
+        CreateDescriptorResources();
+
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(PreprocessPushConstants);
+
+        VkPipelineLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.setLayoutCount = 1;
+        l_LayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        l_LayoutInfo.pushConstantRangeCount = 1;
+        l_LayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (m_DescriptorSetLayout == VK_NULL_HANDLE || vkCreatePipelineLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create readback pre-processing pipeline layout");
+            return;
+        }
+
+        // Bilinear resampling covers the optional resize; at 1:1 every sample lands on a texel centre and reads it exactly.
+        VkSamplerCreateInfo l_SamplerInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+        l_SamplerInfo.magFilter = VK_FILTER_LINEAR;
+        l_SamplerInfo.minFilter = VK_FILTER_LINEAR;
+        l_SamplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        l_SamplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        l_SamplerInfo.minLod = 0.0f;
+        l_SamplerInfo.maxLod = 0.0f;
+
+        if (vkCreateSampler(Startup::GetDevice(), &l_SamplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create readback pre-processing sampler");
+            return;
+        }
+
+        m_ComputePipeline = pipeline.CreateComputePipeline("ReadbackPreprocess.comp", m_PipelineLayout);
+        if (m_ComputePipeline == VK_NULL_HANDLE)
+        {
+            TR_CORE_WARN("GPU readback pre-processing disabled; frames will be converted on the CPU");
+        }
+
+        TR_CORE_TRACE("ReadbackPreprocessor initialised (Ready = {})", IsReady());
+    }
+
+    void ReadbackPreprocessor::Shutdown()
+    {
+        VkDevice l_Device = Startup::GetDevice();
+
+        m_FrameDescriptorSets.clear();
+
+        if (m_ComputePipeline != VK_NULL_HANDLE)
+        {
+            vkDestroyPipeline(l_Device, m_ComputePipeline, nullptr);
+            m_ComputePipeline = VK_NULL_HANDLE;
+        }
+
+        if (m_Sampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(l_Device, m_Sampler, nullptr);
+            m_Sampler = VK_NULL_HANDLE;
+        }
+
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(l_Device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(l_Device, m_DescriptorPool, nullptr);
+            m_DescriptorPool = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(l_Device, m_DescriptorSetLayout, nullptr);
+            m_DescriptorSetLayout = VK_NULL_HANDLE;
+        }
+    }
+
+    bool ReadbackPreprocessor::Record(VkCommandBuffer commandBuffer, uint32_t frameIndex, VkImageView sourceView, VkExtent2D sourceExtent,
+        VkExtent2D allocatedExtent, bool sourceIsSrgb, const ReadbackPreprocessLayout& layout, VkBuffer output)
+    {
+        if (!IsReady() || commandBuffer == VK_NULL_HANDLE || sourceView == VK_NULL_HANDLE || output == VK_NULL_HANDLE || layout.IsEmpty())
+        {
+            return false;
+        }
+
+        if (sourceExtent.width == 0 || sourceExtent.height == 0 || allocatedExtent.width == 0 || allocatedExtent.height == 0)
+        {
+            return false;
+        }
+
+        const VkDescriptorSet l_DescriptorSet = EnsureFrame(frameIndex);
+        if (l_DescriptorSet == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        // The caller has waited on this image, so its set is idle; the source view and output follow target and readback resizes.
+        VkDescriptorImageInfo l_ImageInfo{};
+        l_ImageInfo.sampler = m_Sampler;
+        l_ImageInfo.imageView = sourceView;
+        l_ImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        VkDescriptorBufferInfo l_BufferInfo{ output, 0, layout.m_TotalSize };
+
+        std::array<VkWriteDescriptorSet, 2> l_Writes{};
+        l_Writes[0] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        l_Writes[0].dstSet = l_DescriptorSet;
+        l_Writes[0].dstBinding = 0;
+        l_Writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_Writes[0].descriptorCount = 1;
+        l_Writes[0].pImageInfo = &l_ImageInfo;
+        l_Writes[1] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        l_Writes[1].dstSet = l_DescriptorSet;
+        l_Writes[1].dstBinding = 1;
+        l_Writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_Writes[1].descriptorCount = 1;
+        l_Writes[1].pBufferInfo = &l_BufferInfo;
+        vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+
+        PreprocessPushConstants l_Constants{};
+        l_Constants.m_SourceUvScale[0] = static_cast<float>(sourceExtent.width) / static_cast<float>(allocatedExtent.width);
+        l_Constants.m_SourceUvScale[1] = static_cast<float>(sourceExtent.height) / static_cast<float>(allocatedExtent.height);
+        l_Constants.m_Flags = sourceIsSrgb ? s_FlagSourceSrgb : 0u;
+
+        if (layout.HasTensor())
+        {
+            l_Constants.m_Flags |= s_FlagTensor | (layout.m_TensorHalf ? s_FlagTensorHalf : 0u);
+            l_Constants.m_TensorWidth = layout.m_TensorExtent.width;
+            l_Constants.m_TensorHeight = layout.m_TensorExtent.height;
+            l_Constants.m_TensorChannels = layout.m_TensorChannels;
+            l_Constants.m_TensorOffset = static_cast<uint32_t>(layout.m_TensorOffset / sizeof(uint32_t));
+            l_Constants.m_TensorUnits = GetTensorUnitCount(layout);
+        }
+
+        if (layout.HasYuv())
+        {
+            const uint32_t l_LumaWords = layout.m_LumaStride / sizeof(uint32_t);
+            const uint32_t l_ChromaWords = layout.m_ChromaStride / sizeof(uint32_t);
+            const uint32_t l_ChromaRows = (layout.m_YuvExtent.height + 1) / 2;
+
+            l_Constants.m_Flags |= s_FlagYuv | (layout.m_YuvFullRange ? s_FlagYuvFullRange : 0u);
+            l_Constants.m_YuvWidth = layout.m_YuvExtent.width;
+            l_Constants.m_YuvHeight = layout.m_YuvExtent.height;
+            l_Constants.m_LumaStride = l_LumaWords;
+            l_Constants.m_ChromaStride = l_ChromaWords;
+            l_Constants.m_LumaOffset = static_cast<uint32_t>(layout.m_YuvOffset / sizeof(uint32_t));
+            l_Constants.m_UOffset = l_Constants.m_LumaOffset + l_LumaWords * layout.m_YuvExtent.height;
+            l_Constants.m_VOffset = l_Constants.m_UOffset + l_ChromaWords * l_ChromaRows;
+            // One unit per 8x2 luma block, which is also one word of U and one of V.
+            l_Constants.m_YuvUnits = l_ChromaWords * l_ChromaRows;
+        }
+
+        const uint32_t l_UnitCount = std::max(l_Constants.m_TensorUnits, l_Constants.m_YuvUnits);
+        const uint32_t l_GroupCount = (l_UnitCount + s_WorkGroupSize - 1) / s_WorkGroupSize;
+        const uint32_t l_GroupsX = std::min(l_GroupCount, s_MaxGroupsPerRow);
+        const uint32_t l_GroupsY = (l_GroupCount + l_GroupsX - 1) / l_GroupsX;
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_ComputePipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, 1, &l_DescriptorSet, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PreprocessPushConstants), &l_Constants);
+        vkCmdDispatch(commandBuffer, l_GroupsX, l_GroupsY, 1);
+
+        VkBufferMemoryBarrier l_Barrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+        l_Barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        l_Barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        l_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.buffer = output;
+        l_Barrier.offset = 0;
+        l_Barrier.size = layout.m_TotalSize;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &l_Barrier, 0, nullptr);
+
+        return true;
+    }
+
+    void ReadbackPreprocessor::CreateDescriptorResources()
+    {
+        // 0 -> Primary viewport colour target, 1 -> Host-visible readback buffer.
+        std::array<VkDescriptorSetLayoutBinding, 2> l_Bindings{};
+        l_Bindings[0].binding = 0;
+        l_Bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_Bindings[0].descriptorCount = 1;
+        l_Bindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_Bindings[1].binding = 1;
+        l_Bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_Bindings[1].descriptorCount = 1;
+        l_Bindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        VkDescriptorSetLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_Bindings.size());
+        l_LayoutInfo.pBindings = l_Bindings.data();
+
+        if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create readback pre-processing descriptor set layout");
+            return;
+        }
+
+        std::array<VkDescriptorPoolSize, 2> l_PoolSizes{};
+        l_PoolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        l_PoolSizes[0].descriptorCount = s_MaxFrames;
+        l_PoolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_PoolSizes[1].descriptorCount = s_MaxFrames;
+
+        VkDescriptorPoolCreateInfo l_PoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        l_PoolInfo.maxSets = s_MaxFrames;
+        l_PoolInfo.poolSizeCount = static_cast<uint32_t>(l_PoolSizes.size());
+        l_PoolInfo.pPoolSizes = l_PoolSizes.data();
+
+        if (vkCreateDescriptorPool(Startup::GetDevice(), &l_PoolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create readback pre-processing descriptor pool");
+        }
+    }
+
+    VkDescriptorSet ReadbackPreprocessor::EnsureFrame(uint32_t frameIndex)
+    {
+        if (frameIndex >= s_MaxFrames || m_DescriptorPool == VK_NULL_HANDLE)
+        {
+            TR_CORE_ERROR("GPU readback pre-processing supports at most {} frames; frame {} is converted on the CPU", s_MaxFrames, frameIndex);
+            return VK_NULL_HANDLE;
+        }
+
+        if (frameIndex >= m_FrameDescriptorSets.size())
+        {
+            const size_t l_FirstNew = m_FrameDescriptorSets.size();
+            m_FrameDescriptorSets.resize(static_cast<size_t>(frameIndex) + 1, VK_NULL_HANDLE);
+
+            for (size_t it_Index = l_FirstNew; it_Index < m_FrameDescriptorSets.size(); ++it_Index)
+            {
+                VkDescriptorSetAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+                l_AllocateInfo.descriptorPool = m_DescriptorPool;
+                l_AllocateInfo.descriptorSetCount = 1;
+                l_AllocateInfo.pSetLayouts = &m_DescriptorSetLayout;
+                if (vkAllocateDescriptorSets(Startup::GetDevice(), &l_AllocateInfo, &m_FrameDescriptorSets[it_Index]) != VK_SUCCESS)
+                {
+                    TR_CORE_ERROR("Failed to allocate readback pre-processing descriptor set for frame {}", it_Index);
+                }
+            }
+        }
+
+        return m_FrameDescriptorSets[frameIndex];
+    }
+}
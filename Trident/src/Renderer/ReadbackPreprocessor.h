@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Trident
+{
+    class Pipeline;
+
+    /**
+     * @brief Byte layout of a pre-processed readback buffer: an optional NHWC tensor followed by optional I420 planes.
+     *
+     * The tensor is tightly packed FP32, or FP16 with the element count rounded up to whole words. The planes are Y, U
+     * then V; rows are padded to the strides below so the shader only ever stores whole words.
+     */
+    struct ReadbackPreprocessLayout
+    {
+        VkExtent2D m_TensorExtent{ 0, 0 };   // Zero when no tensor is requested.
+        uint32_t m_TensorChannels = 0;
+        bool m_TensorHalf = false;
+        VkDeviceSize m_TensorOffset = 0;
+        VkDeviceSize m_TensorSize = 0;
+
+        VkExtent2D m_YuvExtent{ 0, 0 };      // Zero when no planes are requested.
+        bool m_YuvFullRange = false;
+        uint32_t m_LumaStride = 0;           // Bytes per Y row; always a multiple of 8.
+        uint32_t m_ChromaStride = 0;         // Bytes per U or V row; half the luma stride.
+        VkDeviceSize m_YuvOffset = 0;        // Start of the Y plane; U and V follow it directly.
+        VkDeviceSize m_YuvSize = 0;
+
+        VkDeviceSize m_TotalSize = 0;
+
+        bool HasTensor() const { return m_TensorSize > 0; }
+        bool HasYuv() const { return m_YuvSize > 0; }
+        bool IsEmpty() const { return m_TotalSize == 0; }
+
+        static ReadbackPreprocessLayout Build(VkExtent2D tensorExtent, uint32_t tensorChannels, bool tensorHalf, VkExtent2D yuvExtent, bool yuvFullRange);
+    };
+
+    /**
+     * @brief Converts the primary viewport's colour target into the exact bytes the CPU consumers read, in one dispatch.
+     *
+     * Writing straight into the host-visible readback buffer replaces the raw image copy, so the CPU only memcpys the
+     * tensor and the planes instead of swizzling, normalising and colour converting every pixel itself.
+     */
+    class ReadbackPreprocessor
+    {
+    public:
+        void Init(Pipeline& pipeline);
+        void Shutdown();
+
+        // Recorded outside any render pass with the source in SHADER_READ_ONLY_OPTIMAL; the output is ready for host reads.
+        bool Record(VkCommandBuffer commandBuffer, uint32_t frameIndex, VkImageView sourceView, VkExtent2D sourceExtent, VkExtent2D allocatedExtent,
+            bool sourceIsSrgb, const ReadbackPreprocessLayout& layout, VkBuffer output);
+
+        bool IsReady() const { return m_ComputePipeline != VK_NULL_HANDLE && m_Sampler != VK_NULL_HANDLE; }
+
+    private:
+        // Mirrors the push constant block in ReadbackPreprocess.comp.
+        struct PreprocessPushConstants
+        {
+            float m_SourceUvScale[2] = { 1.0f, 1.0f };
+            uint32_t m_Flags = 0;
+            uint32_t m_TensorWidth = 0;
+            uint32_t m_TensorHeight = 0;
+            uint32_t m_TensorChannels = 0;
+            uint32_t m_TensorOffset = 0;
+            uint32_t m_TensorUnits = 0;
+            uint32_t m_YuvWidth = 0;
+            uint32_t m_YuvHeight = 0;
+            uint32_t m_LumaStride = 0;
+            uint32_t m_ChromaStride = 0;
+            uint32_t m_LumaOffset = 0;
+            uint32_t m_UOffset = 0;
+            uint32_t m_VOffset = 0;
+            uint32_t m_YuvUnits = 0;
+        };
+
+        void CreateDescriptorResources();
+        VkDescriptorSet EnsureFrame(uint32_t frameIndex);
+
+    private:
+        static constexpr uint32_t s_MaxFrames = 8;            // Upper bound on swapchain images served by the descriptor pool.
+        static constexpr uint32_t s_WorkGroupSize = 64;       // Must match local_size_x in ReadbackPreprocess.comp.
+        static constexpr uint32_t s_MaxGroupsPerRow = 4096;   // Keeps large frames under the per-axis dispatch limit.
+
+        VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
+        VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        VkPipeline m_ComputePipeline = VK_NULL_HANDLE;
+        VkSampler m_Sampler = VK_NULL_HANDLE;
+
+        std::vector<VkDescriptorSet> m_FrameDescriptorSets;
+    };
+}
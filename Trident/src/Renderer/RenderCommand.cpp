@@ -55,6 +55,16 @@ namespace Trident
         Startup::GetRenderer().AppendMeshes(std::move(meshes), std::move(materials), std::move(textures));
     }
 
+    const std::vector<Geometry::Material>& RenderCommand::GetMaterials()
+    {
+        return Startup::GetRenderer().GetMaterials();
+    }
+
+    void RenderCommand::SetMaterial(size_t materialIndex, const Geometry::Material& material)
+    {
+        Startup::GetRenderer().SetMaterial(materialIndex, material);
+    }
+
     void RenderCommand::SetEditorCamera(Camera* camera)
     {
         Startup::GetRenderer().SetEditorCamera(camera);
@@ -141,6 +151,11 @@ namespace Trident
         return Startup::GetRenderer().GetViewportTexture(viewportId);
     }
 
+    glm::vec2 RenderCommand::GetViewportTextureUV(uint32_t viewportId)
+    {
+        return Startup::GetRenderer().GetViewportTextureUV(viewportId);
+    }
+
     glm::mat4 RenderCommand::GetViewportViewMatrix(uint32_t viewportId)
     {
         // Renderer chooses the appropriate camera based on viewport ID; editor (1U) and runtime (2U) remain isolated.
@@ -193,6 +208,91 @@ namespace Trident
         return Startup::GetRenderer().GetModelCount();
     }
 
+    size_t RenderCommand::GetTriangleCount()
+    {
+        return Startup::GetRenderer().GetTriangleCount();
+    }
+
+    size_t RenderCommand::GetLodTrianglesSaved()
+    {
+        return Startup::GetRenderer().GetLodTrianglesSaved();
+    }
+
+    void RenderCommand::SetLodBias(float bias)
+    {
+        Startup::GetRenderer().SetLodBias(bias);
+    }
+
+    float RenderCommand::GetLodBias()
+    {
+        return Startup::GetRenderer().GetLodBias();
+    }
+
+    void RenderCommand::SetClusterCullingEnabled(bool enabled)
+    {
+        Startup::GetRenderer().SetClusterCullingEnabled(enabled);
+    }
+
+    bool RenderCommand::IsClusterCullingEnabled()
+    {
+        return Startup::GetRenderer().IsClusterCullingEnabled();
+    }
+
+    void RenderCommand::SetOcclusionCullingEnabled(bool enabled)
+    {
+        Startup::GetRenderer().SetOcclusionCullingEnabled(enabled);
+    }
+
+    bool RenderCommand::IsOcclusionCullingEnabled()
+    {
+        return Startup::GetRenderer().IsOcclusionCullingEnabled();
+    }
+
+    ClusterCuller::CullingStats RenderCommand::GetClusterCullingStats()
+    {
+        return Startup::GetRenderer().GetClusterCullingStats();
+    }
+
+    SceneBuffer::UploadStats RenderCommand::GetSceneBufferStats()
+    {
+        return Startup::GetRenderer().GetSceneBufferStats();
+    }
+
+    void RenderCommand::SetTextureAnisotropy(float anisotropy)
+    {
+        Startup::GetRenderer().SetTextureAnisotropy(anisotropy);
+    }
+
+    float RenderCommand::GetTextureAnisotropy()
+    {
+        return Startup::GetRenderer().GetTextureAnisotropy();
+    }
+
+    void RenderCommand::SetTextureMipDropCount(uint32_t count)
+    {
+        Startup::GetRenderer().SetTextureMipDropCount(count);
+    }
+
+    uint32_t RenderCommand::GetTextureMipDropCount()
+    {
+        return Startup::GetRenderer().GetTextureMipDropCount();
+    }
+
+    void RenderCommand::SetTextureMemoryBudget(uint64_t bytes)
+    {
+        Startup::GetRenderer().SetTextureMemoryBudget(bytes);
+    }
+
+    uint64_t RenderCommand::GetTextureMemoryBudget()
+    {
+        return Startup::GetRenderer().GetTextureMemoryBudget();
+    }
+
+    Renderer::TextureResidencyStats RenderCommand::GetTextureResidencyStats()
+    {
+        return Startup::GetRenderer().GetTextureResidencyStats();
+    }
+
     int32_t RenderCommand::ResolveTextureSlot(const std::string& texturePath)
     {
         // Forward the request to the renderer so tooling can trigger reloads after editing component properties.
@@ -223,6 +323,16 @@ namespace Trident
         return Startup::GetRenderer().GetAiBlendStrength();
     }
 
+    void RenderCommand::SetAiBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait)
+    {
+        Startup::GetRenderer().SetAiBatching(maxBatchSize, maxWait);
+    }
+
+    uint32_t RenderCommand::GetAiMaxBatchSize()
+    {
+        return Startup::GetRenderer().GetAiMaxBatchSize();
+    }
+
     ImTextureID RenderCommand::GetAiTextureDescriptor()
     {
         // Placeholder that will eventually return the ImGui descriptor once the renderer exposes the AI texture to tooling.
@@ -260,16 +370,26 @@ namespace Trident
         return Startup::GetRenderer().GetFrameDatasetCaptureInterval();
     }
 
+    void RenderCommand::SetReadbackConsumerPolicy(Renderer::ReadbackConsumer consumer, ReadbackConsumerPolicy policy, uint32_t interval)
+    {
+        Startup::GetRenderer().SetReadbackConsumerPolicy(consumer, policy, interval);
+    }
+
+    ReadbackConsumerPolicy RenderCommand::GetReadbackConsumerPolicy(Renderer::ReadbackConsumer consumer)
+    {
+        return Startup::GetRenderer().GetReadbackConsumerPolicy(consumer);
+    }
+
     bool RenderCommand::SetViewportRecordingEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent, const std::filesystem::path& outputPath)
     {
         // Forward the recording toggle so UI panels can trigger capture sessions.
         return Startup::GetRenderer().SetViewportRecordingEnabled(enabled, viewportId, extent, outputPath);
     }
 
-    void RenderCommand::SubmitViewportFrame(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp)
+    void RenderCommand::SubmitViewportFrame()
     {
         // Allow panels to push the latest readback into the recording buffer when needed.
-        Startup::GetRenderer().SubmitViewportFrame(imageIndex, captureTimestamp);
+        Startup::GetRenderer().SubmitViewportFrame();
     }
 
     bool RenderCommand::IsViewportRecording()
@@ -277,6 +397,66 @@ namespace Trident
         return Startup::GetRenderer().IsViewportRecording();
     }
 
+    bool RenderCommand::SetViewportReplayEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent)
+    {
+        return Startup::GetRenderer().SetViewportReplayEnabled(enabled, viewportId, extent);
+    }
+
+    bool RenderCommand::IsViewportReplayActive()
+    {
+        return Startup::GetRenderer().IsViewportReplayActive();
+    }
+
+    bool RenderCommand::SaveViewportReplay(const std::filesystem::path& outputPath)
+    {
+        return Startup::GetRenderer().SaveViewportReplay(outputPath);
+    }
+
+    void RenderCommand::SetReplayBudget(size_t budgetBytes)
+    {
+        Startup::GetRenderer().SetReplayBudget(budgetBytes);
+    }
+
+    size_t RenderCommand::GetReplayBudget()
+    {
+        return Startup::GetRenderer().GetReplayBudget();
+    }
+
+    ReplayBuffer::Stats RenderCommand::GetReplayStats()
+    {
+        return Startup::GetRenderer().GetReplayStats();
+    }
+
+    void RenderCommand::SetRecordingQueuePolicy(VideoEncoder::QueueOverflowPolicy policy, size_t budgetBytes)
+    {
+        Startup::GetRenderer().SetRecordingQueuePolicy(policy, budgetBytes);
+    }
+
+    VideoEncoder::QueueOverflowPolicy RenderCommand::GetRecordingQueuePolicy()
+    {
+        return Startup::GetRenderer().GetRecordingQueuePolicy();
+    }
+
+    size_t RenderCommand::GetRecordingQueueBudget()
+    {
+        return Startup::GetRenderer().GetRecordingQueueBudget();
+    }
+
+    void RenderCommand::SetRecordingSegmentEncoders(uint32_t encoderCount)
+    {
+        Startup::GetRenderer().SetRecordingSegmentEncoders(encoderCount);
+    }
+
+    uint32_t RenderCommand::GetRecordingSegmentEncoders()
+    {
+        return Startup::GetRenderer().GetRecordingSegmentEncoders();
+    }
+
+    VideoEncoder::QueueStats RenderCommand::GetRecordingQueueStats()
+    {
+        return Startup::GetRenderer().GetRecordingQueueStats();
+    }
+
     const std::vector<VideoEncoder::RecordedFrame>& RenderCommand::GetViewportFrameBuffer()
     {
         return Startup::GetRenderer().GetViewportFrameBuffer();
@@ -23,6 +23,9 @@ namespace Trident
         // Mirror Renderer::SetClearColor so editor widgets can adjust the background tone live.
         static void SetClearColor(const glm::vec4& color);
         static void AppendMeshes(std::vector<Geometry::Mesh> meshes, std::vector<Geometry::Material> materials, std::vector<std::string> textures);
+        // Material edits from the inspector; only the edited record is re-uploaded to the GPU.
+        static const std::vector<Geometry::Material>& GetMaterials();
+        static void SetMaterial(size_t materialIndex, const Geometry::Material& material);
         static void SetEditorCamera(Camera* camera);
         static void SetRuntimeCamera(Camera* camera);
         static void SetRuntimeCameraReady(bool cameraReady);
@@ -43,6 +46,7 @@ namespace Trident
         static void SetWorldTransform(ECS::Entity entity, const glm::mat4& worldTransform);
         static ViewportInfo GetViewport();
         static VkDescriptorSet GetViewportTexture(uint32_t viewportId);
+        static glm::vec2 GetViewportTextureUV(uint32_t viewportId);
         static glm::mat4 GetViewportViewMatrix(uint32_t viewportId);
         static glm::mat4 GetViewportProjectionMatrix(uint32_t viewportId);
         static glm::mat4 GetEditorCameraViewMatrix();
@@ -54,6 +58,27 @@ namespace Trident
         // Provide averaged timing statistics so editor overlays can surface FPS without touching renderer internals.
         static Renderer::FrameTimingStats GetFrameTimingStats();
         static size_t GetModelCount();
+        // Report full-detail triangle totals alongside the per-frame savings from LOD selection.
+        static size_t GetTriangleCount();
+        static size_t GetLodTrianglesSaved();
+        // Bias the LOD error threshold in powers of two; positive values favour coarser meshes.
+        static void SetLodBias(float bias);
+        static float GetLodBias();
+        // Toggle compute cluster culling and report how many clusters and triangles survived the last completed frame.
+        static void SetClusterCullingEnabled(bool enabled);
+        static bool IsClusterCullingEnabled();
+        static void SetOcclusionCullingEnabled(bool enabled);
+        static bool IsOcclusionCullingEnabled();
+        static ClusterCuller::CullingStats GetClusterCullingStats();
+        static SceneBuffer::UploadStats GetSceneBufferStats();
+        static void SetTextureAnisotropy(float anisotropy);
+        static float GetTextureAnisotropy();
+        static void SetTextureMipDropCount(uint32_t count);
+        static uint32_t GetTextureMipDropCount();
+        // Texture memory budget in bytes (0 = automatic) and the residency manager's view of it.
+        static void SetTextureMemoryBudget(uint64_t bytes);
+        static uint64_t GetTextureMemoryBudget();
+        static Renderer::TextureResidencyStats GetTextureResidencyStats();
         // Allow editor tooling to resolve texture slots on demand when authors request explicit reloads.
         static int32_t ResolveTextureSlot(const std::string& texturePath);
         // Provide mesh indices for primitives so authoring actions can spawn immediately renderable shapes.
@@ -63,6 +88,9 @@ namespace Trident
         // Allow tooling to adjust the AI blend strength without reaching into the renderer singleton directly.
         static void SetAiBlendStrength(float blendStrength);
         static float GetAiBlendStrength();
+        // Trade AI latency for throughput by packing queued frames into batched inference runs.
+        static void SetAiBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait);
+        static uint32_t GetAiMaxBatchSize();
         // Placeholder hook for future UI that will surface the AI texture preview.
         static ImTextureID GetAiTextureDescriptor();
         // Toggle dataset capture at runtime without relying on environment variables.
@@ -75,11 +103,28 @@ namespace Trident
         // Adjust how frequently frames are captured to reduce I/O pressure.
         static void SetFrameDatasetCaptureInterval(uint32_t interval);
         static uint32_t GetFrameDatasetCaptureInterval();
+        // Pick which per-frame readbacks the AI helper or the recorder consume (latest only, every Nth, or all).
+        static void SetReadbackConsumerPolicy(Renderer::ReadbackConsumer consumer, ReadbackConsumerPolicy policy, uint32_t interval = 1);
+        static ReadbackConsumerPolicy GetReadbackConsumerPolicy(Renderer::ReadbackConsumer consumer);
         // Toggle viewport recording so UI panels can export animation clips.
         static bool SetViewportRecordingEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent, const std::filesystem::path& outputPath);
         // Submit the latest frame to the recording path when readback completes.
-        static void SubmitViewportFrame(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp);
+        static void SubmitViewportFrame();
         static bool IsViewportRecording();
+        // Keep an in-memory replay of the viewport and save the buffered stretch to disk without stalling the frame.
+        static bool SetViewportReplayEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent);
+        static bool IsViewportReplayActive();
+        static bool SaveViewportReplay(const std::filesystem::path& outputPath);
+        static void SetReplayBudget(size_t budgetBytes);
+        static size_t GetReplayBudget();
+        static ReplayBuffer::Stats GetReplayStats();
+        // Bound the encoder queue by bytes and choose how recording sheds load once the budget is reached.
+        static void SetRecordingQueuePolicy(VideoEncoder::QueueOverflowPolicy policy, size_t budgetBytes);
+        static VideoEncoder::QueueOverflowPolicy GetRecordingQueuePolicy();
+        static size_t GetRecordingQueueBudget();
+        static void SetRecordingSegmentEncoders(uint32_t encoderCount);
+        static uint32_t GetRecordingSegmentEncoders();
+        static VideoEncoder::QueueStats GetRecordingQueueStats();
         static const std::vector<VideoEncoder::RecordedFrame>& GetViewportFrameBuffer();
     };
 }
\ No newline at end of file
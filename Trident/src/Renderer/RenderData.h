@@ -22,7 +22,7 @@ namespace Trident
         int32_t m_UseMaterialOverride{ 0 };// Non-zero when material overrides should be used.
         float m_SortBias{ 0.0f };          // Depth bias reserved for transparent layering.
         int32_t m_MaterialIndex{ -1 };     // Material lookup written per draw so the fragment shader can fetch shading data.
-        int32_t m_Padding0{ 0 };           // Reserved for feature flags that still need to land.
+        int32_t m_InstanceIndex{ -1 };     // Scene buffer record; -1 keeps the push-constant matrix and bone range.
         int32_t m_BoneOffset{ 0 };         // Offset into the bone palette buffer. Zero when skinning is not used.
         int32_t m_BoneCount{ 0 };          // Number of matrices contributing to this draw's palette.
     };
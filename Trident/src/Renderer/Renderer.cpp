@@ -36,6 +36,8 @@
 #include <iterator>
 #include <utility>
 #include <span>
+#include <bit>
+#include <thread>
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
@@ -48,6 +50,12 @@ namespace
 {
     constexpr const char* kDefaultTextureKey = "renderer://default-white";
 
+    // Data maps get their own UNORM slot, so a file used both as colour and as data is uploaded once per colour space.
+    std::string GetTextureSlotKey(const std::string& normalizedPath, bool linear)
+    {
+        return linear ? "linear://" + normalizedPath : normalizedPath;
+    }
+
     struct SwapchainFormatInfo
     {
         uint32_t m_BytesPerPixel = 0; // Total bytes consumed by a single pixel in the swapchain format.
@@ -263,6 +271,14 @@ namespace
         }
     }
 
+    /**
+     * @brief Sampling these formats decodes to linear, so consumers of the stored bytes need the value re-encoded.
+     */
+    bool IsSrgbFormat(VkFormat format)
+    {
+        return format == VK_FORMAT_B8G8R8A8_SRGB || format == VK_FORMAT_R8G8B8A8_SRGB;
+    }
+
     /**
      * @brief Extract the NHWC layout information from the model supplied tensor shape.
      */
@@ -536,6 +552,48 @@ namespace
 #endif
         return l_LocalTime;
     }
+
+    VkExtent2D RoundUpToBucket(VkExtent2D extent, uint32_t bucketSize)
+    {
+        return { ((extent.width + bucketSize - 1) / bucketSize) * bucketSize, ((extent.height + bucketSize - 1) / bucketSize) * bucketSize };
+    }
+
+    // An allocation serves an extent when it holds it with at most one spare bucket per axis. The spare bucket is the
+    // hysteresis that keeps a size jittering around a bucket edge from reallocating back and forth.
+    bool IsAllocationSuitable(VkExtent2D allocated, VkExtent2D extent, uint32_t bucketSize)
+    {
+        const VkExtent2D l_Bucket = RoundUpToBucket(extent, bucketSize);
+
+        return allocated.width >= extent.width && allocated.height >= extent.height
+            && allocated.width <= l_Bucket.width + bucketSize && allocated.height <= l_Bucket.height + bucketSize;
+    }
+
+    // CPU-converted readback for frames the GPU pre-process did not write; shared with consumers like a staging buffer.
+    struct ReadbackHostCopy
+    {
+        std::vector<float> m_Floats;
+        std::shared_ptr<std::vector<uint8_t>> m_Bytes;  // Drawn from the encoder's pixel pool, so recording reuses the same few buffers.
+    };
+
+    /**
+     * @brief Readback is read in place by the CPU, where cached memory is far faster than the write-combined default.
+     */
+    bool SupportsHostCachedReadback()
+    {
+        VkPhysicalDeviceMemoryProperties l_Properties{};
+        vkGetPhysicalDeviceMemoryProperties(Trident::Startup::GetPhysicalDevice(), &l_Properties);
+
+        const VkMemoryPropertyFlags l_Required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        for (uint32_t it_Type = 0; it_Type < l_Properties.memoryTypeCount; ++it_Type)
+        {
+            if ((l_Properties.memoryTypes[it_Type].propertyFlags & l_Required) == l_Required)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
 }
 
 namespace Trident
@@ -547,6 +605,10 @@ namespace Trident
         m_AiDebugStats.m_TextureReady = m_AiTextureReady;
         m_AiDebugStats.m_ModelInitialised = m_FrameGenerator.IsInitialised();
 
+        // Inference only ever needs the newest frame, while a recording should keep every frame it can get.
+        m_AiReadbackQueue.SetPolicy(ReadbackConsumerPolicy::LatestOnly, 1);
+        m_EncoderReadbackQueue.SetPolicy(ReadbackConsumerPolicy::AllFrames, 1);
+
         // Default dataset capture settings point at a local directory and remain disabled until requested.
         m_FrameDatasetCaptureDirectory = std::filesystem::current_path() / "DatasetCapture";
         m_FrameDatasetCaptureInterval = 1;
@@ -596,6 +658,7 @@ namespace Trident
         m_SwapchainDepthLayouts.assign(m_Swapchain.GetImageCount(), VK_IMAGE_LAYOUT_UNDEFINED);
         m_Pipeline.Init(m_Swapchain);
         m_Commands.Init(m_Swapchain.GetImageCount());
+        m_Buffers.Init(m_Commands);
 
         // Pre-size the performance history buffer so we can efficiently track frame timings.
         m_PerformanceHistory.clear();
@@ -609,9 +672,20 @@ namespace Trident
         m_Buffers.CreateUniformBuffers(m_Swapchain.GetImageCount(), l_GlobalSize, m_GlobalUniformBuffers, m_GlobalUniformBuffersMemory);
         EnsureMaterialBufferCapacity(m_Materials.size());
         EnsureSkinningBufferCapacity(std::max<size_t>(m_BonePaletteMatrixCapacity, static_cast<size_t>(s_MaxBonesPerSkeleton)));
+        m_SceneBuffer.Init(m_Buffers);
 
         CreateDescriptorPool();
+        Loader::TextureLoader::SetBlockCompressionSupported(Startup::SupportsTextureCompressionBC());
+        m_ClusterCuller.Init(m_Pipeline, m_Buffers);
+        m_SkinningPass.Init(m_Pipeline, m_Buffers);
+        m_ReadbackPreprocessor.Init(m_Pipeline);
         CreateDefaultTexture();
+        // Half the cores decode textures; the rest stay free for the frame and the AI worker.
+        m_TextureStreamer.Init(m_Buffers, std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u));
+        // Slots acquired before the first frame count as used now rather than idle since the epoch.
+        m_TextureResidencyTime = std::chrono::steady_clock::now();
+        // The render thread converts one band itself, so it counts towards the readback conversion threads.
+        m_ReadbackConverter.Init(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u) - 1);
         CreateDefaultSkybox();
         CreateDescriptorSets();
 
@@ -637,13 +711,6 @@ namespace Trident
             ApplyPendingReadbackResize();
         }
 
-        VkFenceCreateInfo l_FenceInfo{ VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
-        l_FenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-        if (vkCreateFence(Startup::GetDevice(), &l_FenceInfo, nullptr, &m_ResourceFence) != VK_SUCCESS)
-        {
-            TR_CORE_CRITICAL("Failed to create resource fence");
-        }
-
         TR_CORE_INFO("-------RENDERER INITIALIZED-------");
     }
 
@@ -653,7 +720,7 @@ namespace Trident
 
         // Block until all GPU work completes so that pipelines, descriptor pools and swapchain-backed
         // images are no longer referenced by in-flight command buffers before teardown begins.
-        vkDeviceWaitIdle(Startup::GetDevice());
+        Startup::WaitForDeviceIdle("renderer shutdown");
 
         m_Commands.Cleanup();
         m_TextRenderer.Shutdown();
@@ -687,14 +754,22 @@ namespace Trident
         m_Pipeline.Cleanup();
         m_Swapchain.Cleanup();
         m_Skybox.Cleanup(m_Buffers);
+        m_ClusterCuller.Shutdown();
+        m_SkinningPass.Shutdown();
+        m_ReadbackPreprocessor.Shutdown();
+        m_SceneBuffer.Shutdown();
         m_Buffers.Cleanup();
         m_GlobalUniformBuffers.clear();
         m_GlobalUniformBuffersMemory.clear();
         m_MaterialBuffers.clear();
         m_MaterialBuffersMemory.clear();
-        m_MaterialBufferDirty.clear();
+        m_MaterialBuffersMapped.clear();
+        m_MaterialDirtyRanges.clear();
         m_MaterialBufferElementCount = 0;
 
+        m_TextureStreamer.Shutdown();
+        m_ReadbackConverter.Shutdown();
+        m_StreamingTextureSlots.clear();
         for (TextureSlot& it_Slot : m_TextureSlots)
         {
             DestroyTextureSlot(it_Slot);
@@ -702,11 +777,29 @@ namespace Trident
         m_TextureSlots.clear();
         m_TextureSlotLookup.clear();
         m_TextureDescriptorCache.clear();
+        m_TextureDescriptorWrites.clear();
+        m_TextureDescriptorDirty.clear();
+        m_TextureDescriptorUpdates.clear();
+        m_TextureResidencyChanges.clear();
+        m_TextureResidencyStats = {};
 
         DestroySkyboxCubemap();
 
+        // Consumers read the staging buffers in place, so their workers drain before the mappings go away.
+        if (m_VideoEncoder && m_VideoEncoder->IsSessionActive())
+        {
+            m_VideoEncoder->EndSession();
+        }
+        m_FrameDatasetRecorder.EnableCapture(false);
+        m_FrameGenerator.Shutdown();
+
         // Release the CPU-visible staging buffers used for AI readback before the buffer allocator is reset.
         DestroyReadbackResources();
+        for (ReadbackStagingBuffer& it_Staging : m_HeldReadbackStaging)
+        {
+            DestroyReadbackStaging(it_Staging);
+        }
+        m_HeldReadbackStaging.clear();
         DestroyAiResources();
 
         for (auto& it_Texture : m_ImGuiTexturePool)
@@ -718,13 +811,6 @@ namespace Trident
         }
         m_ImGuiTexturePool.clear();
 
-        if (m_ResourceFence != VK_NULL_HANDLE)
-        {
-            vkDestroyFence(Startup::GetDevice(), m_ResourceFence, nullptr);
-
-            m_ResourceFence = VK_NULL_HANDLE;
-        }
-
         m_Shutdown = true;
 
         TR_CORE_TRACE("Renderer Shutdown Complete");
@@ -737,16 +823,23 @@ namespace Trident
         VkExtent2D l_FrameExtent{ 0, 0 };
 
         Utilities::Allocation::ResetFrame();
+        CheckSteadyStateDeviceIdle();
         ProcessReloadEvents();
 
-        // Apply any pending readback resizes once the GPU is idle so resource churn stays out of the hot path.
+        // Rebuild readback staging between frames; the replaced buffers are retired against the frame timeline.
         ApplyPendingReadbackResize();
+        UpdateOffscreenTargets();
 
-        // Allow developers to tweak GLSL and get instant feedback without restarting the app.
-        if (m_Pipeline.ReloadIfNeeded(m_Swapchain))
+        // Shader edits compile and link on the pipeline's worker thread; a finished rebuild is swapped in here, between
+        // frames, and the replaced pipelines are retired once no in-flight frame can still use them.
+        const Pipeline::ReloadResult l_ShaderReload = m_Pipeline.ApplyPendingReload(m_Buffers);
+        if (l_ShaderReload == Pipeline::ReloadResult::Applied)
         {
             TR_CORE_INFO("Graphics pipeline reloaded after shader edit");
-            m_TextRenderer.RecreatePipeline(m_Pipeline.GetRenderPass());
+        }
+        if (l_ShaderReload != Pipeline::ReloadResult::None)
+        {
+            CompleteShaderReloadEvents(l_ShaderReload);
         }
 
         VkFence l_InFlightFence = m_Commands.GetInFlightFence(m_Commands.CurrentFrame());
@@ -771,9 +864,11 @@ namespace Trident
             vkWaitForFences(Startup::GetDevice(), 1, &l_InFlightFence, VK_TRUE, UINT64_MAX);
         }
 
-        // Set the frame index for deferred destruction so buffer recycling tracks the correct fence slot.
-        m_Buffers.SetCurrentFrame(m_Commands.CurrentFrame());
-        m_Buffers.ProcessPendingDestroys(l_InFlightFence, m_Commands.CurrentFrame());
+        // Everything retired against a timeline value the GPU has now reached can be released. Without timeline semaphores
+        // the fence just waited on is what advances the completed value.
+        m_Commands.MarkFrameFenceSignaled(m_Commands.CurrentFrame());
+        m_Commands.CollectCompletedCommands();
+        m_Buffers.CollectRetired();
 
         uint32_t l_ImageIndex = 0;
         if (!AcquireNextImage(l_ImageIndex, l_InFlightFence))
@@ -783,15 +878,21 @@ namespace Trident
             return;
         }
 
+        // The acquired image's previous submission has retired, so its descriptor set can take newly streamed textures.
+        ApplyStreamedTextures();
+        UpdateTextureResidency();
+        FlushTextureDescriptorSet(l_ImageIndex);
+        // Same reasoning for the image's material buffer: only records edited since it was last drawn are copied.
+        MarkMaterialsForTextureResidency();
+        FlushMaterialBuffer(l_ImageIndex);
+
         // Enable readback only when AI processing or viewport recording explicitly requests it.
         const bool l_ReadbackRequired = m_FrameGenerator.IsInitialised() || m_ViewportRecordingEnabled;
         SetReadbackEnabled(l_ReadbackRequired, m_Swapchain.GetExtent());
 
-        // Resolve any completed GPU readback before new commands reuse the staging buffers for this swapchain image.
-        if (m_ReadbackEnabled)
-        {
-            ResolvePendingReadback(l_ImageIndex, l_FrameWallClock);
-        }
+        // Recycle staging buffers whose consumers have finished, then hand every readback the GPU has finished to its consumers.
+        CollectReleasedReadbackStaging();
+        ResolveCompletedReadbacks();
 
         UpdateUniformBuffer(l_ImageIndex);
 
@@ -807,16 +908,25 @@ namespace Trident
             return;
         }
 
+        // Slots resolved while recording reach this image's set before submission; update-after-bind makes that legal.
+        if (m_Pipeline.UsesBindlessTextures())
+        {
+            FlushTextureDescriptorSet(l_ImageIndex);
+        }
+
         // Once the main color pass is ready we can offer the frame to the AI helper.
         ProcessAiFrame();
 
         // Offer the newly resolved readback to the recording path if a viewport capture is active.
-        SubmitViewportFrame(l_ImageIndex, l_FrameWallClock);
+        SubmitViewportFrame();
 
         // Capture the extent actually used when recording commands so our metrics reflect the final render target dimensions.
         l_FrameExtent = m_Swapchain.GetExtent();
 
-        if (!SubmitFrame(l_ImageIndex, l_InFlightFence))
+        const bool l_Submitted = SubmitFrame(l_ImageIndex, l_InFlightFence);
+        // Tag this frame's readback slot with its timeline value, or return it to the ring if nothing was submitted.
+        CompleteReadbackSubmission(l_Submitted, l_ImageIndex, l_FrameWallClock);
+        if (!l_Submitted)
         {
             TR_CORE_CRITICAL("Failed to submit frame");
 
@@ -863,6 +973,11 @@ namespace Trident
                 m_AiDebugStats.m_CompletedInferenceCount = 0;
                 m_AiDebugStats.m_LastInferenceMilliseconds = 0.0;
                 m_AiDebugStats.m_AverageInferenceMilliseconds = 0.0;
+                m_AiDebugStats.m_LastBatchSize = 0;
+                m_AiDebugStats.m_AverageBatchSize = 0.0;
+                m_AiDebugStats.m_LatencyP50Milliseconds = 0.0;
+                m_AiDebugStats.m_LatencyP95Milliseconds = 0.0;
+                m_AiDebugStats.m_LatencyP99Milliseconds = 0.0;
             }
 
             return;
@@ -875,6 +990,14 @@ namespace Trident
                 m_AiDebugStats.m_CompletedInferenceCount = m_FrameGenerator.GetCompletedInferenceCount();
                 m_AiDebugStats.m_LastInferenceMilliseconds = m_FrameGenerator.GetLastInferenceMilliseconds();
                 m_AiDebugStats.m_AverageInferenceMilliseconds = m_FrameGenerator.GetAverageInferenceMilliseconds();
+                const AI::FrameGenerator::InferenceStats l_InferenceStats = m_FrameGenerator.GetInferenceStats();
+                m_AiDebugStats.m_LastBatchSize = l_InferenceStats.m_LastBatchSize;
+                m_AiDebugStats.m_AverageBatchSize = l_InferenceStats.m_AverageBatchSize;
+                m_AiDebugStats.m_LatencyP50Milliseconds = l_InferenceStats.m_LatencyP50Milliseconds;
+                m_AiDebugStats.m_LatencyP95Milliseconds = l_InferenceStats.m_LatencyP95Milliseconds;
+                m_AiDebugStats.m_LatencyP99Milliseconds = l_InferenceStats.m_LatencyP99Milliseconds;
+                m_AiDebugStats.m_DroppedReadbackFrames = m_AiReadbackQueue.GetDroppedCount();
+                m_AiDebugStats.m_SkippedReadbackFrames = m_SkippedReadbackFrames;
             };
 
         a_RefreshStats();
@@ -891,7 +1014,9 @@ namespace Trident
 
             if (l_InputShapeInfo.m_HasExplicitBatch && l_InputShapeInfo.m_Batch > 1)
             {
-                TR_CORE_WARN("AI model declared a batch size of {}. The renderer currently feeds a single frame per submission.", l_InputShapeInfo.m_Batch);
+                // The frame generator stacks queued frames along the batch axis, so one frame per submission is fine.
+                TR_CORE_INFO("AI model declared a batch size of {}. Frames are packed into batches, padding any that are still short when the batch wait expires.",
+                    l_InputShapeInfo.m_Batch);
             }
 
             m_AiInputLayoutVerified = true;
@@ -930,16 +1055,8 @@ namespace Trident
 
         UploadAiInterpolationToGpu();
 
-        const auto l_Now = std::chrono::steady_clock::now();
-        if (l_Now < m_NextAiInferenceTime)
-        {
-            // Skip submission to throttle AI workload and keep the last valid output active.
-            return;
-        }
-
-        m_NextAiInferenceTime = l_Now + m_AiInferenceThrottleInterval;
-
-        std::vector<float> l_FrameReadback;
+        // The AI readback queue's policy decides how many frames reach this point; latest-only hands over at most one.
+        ReadbackFrame l_FrameReadback;
         if (!TryAcquireRenderedFrame(l_FrameReadback))
         {
             // No fresh GPU readback is available. This occurs when the viewport resolution changes or the frame has not
@@ -954,15 +1071,16 @@ namespace Trident
             l_ExpectedElements = static_cast<size_t>(l_InputCaptureShape[1]) * static_cast<size_t>(l_InputCaptureShape[2]) * static_cast<size_t>(l_InputCaptureShape[3]);
         }
 
-        if (l_ExpectedElements > 0 && l_FrameReadback.size() != l_ExpectedElements)
+        if (l_ExpectedElements > 0 && l_FrameReadback.m_Tensor.size() != l_ExpectedElements)
         {
-            TR_CORE_WARN("AI frame generator received {} elements but expected {}. Skipping inference this frame.", l_FrameReadback.size(), l_ExpectedElements);
+            TR_CORE_WARN("AI frame generator received {} elements but expected {}. Skipping inference this frame.", l_FrameReadback.m_Tensor.size(), l_ExpectedElements);
             a_RefreshStats();
 
             return;
         }
 
-        if (!m_FrameGenerator.ProcessFrame(l_FrameReadback))
+        // The worker and the dataset writer read the tensor in place; the shared owner keeps its staging buffer out of reuse.
+        if (!m_FrameGenerator.ProcessFrame(l_FrameReadback.m_Tensor, l_FrameReadback.m_Owner))
         {
             TR_CORE_WARN("AI frame generator rejected the current frame. Retaining the previous AI output for now.");
             a_RefreshStats();
@@ -973,7 +1091,8 @@ namespace Trident
         if (m_FrameDatasetCaptureEnabled)
         {
             // Cache the exact tensor submitted to the AI worker so the dataset stays perfectly synchronised.
-            m_FrameDatasetRecorder.RecordInputFrame(l_FrameReadback, m_FrameReadbackExtent, m_FrameReadbackChannelCount, l_InputCaptureShape);
+            m_FrameDatasetRecorder.RecordInputFrame(l_FrameReadback.m_Tensor, l_FrameReadback.m_TensorExtent, l_FrameReadback.m_TensorChannels, l_InputCaptureShape,
+                l_FrameReadback.m_Owner);
         }
 
         a_RefreshStats();
@@ -981,23 +1100,14 @@ namespace Trident
         // TODO: Once the async path matures, explore scheduling policies such as adaptive batching or prioritising history frames.
     }
 
-    bool Renderer::TryAcquireRenderedFrame(std::vector<float>& a_OutPixels)
+    bool Renderer::TryAcquireRenderedFrame(ReadbackFrame& a_OutFrame)
     {
-        if (m_PendingFrameReadback.empty())
-        {
-            return false;
-        }
-
-        a_OutPixels = m_PendingFrameReadback;
-        m_PendingFrameReadback.clear();
-
-        return true;
+        // Popping hands the caller the only renderer-side reference, so each resolved tensor is consumed once.
+        return m_AiReadbackQueue.TryPop(a_OutFrame);
     }
 
-    void Renderer::SubmitViewportFrame(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp)
+    void Renderer::SubmitViewportFrame()
     {
-        (void)captureTimestamp;
-
         if (!m_ViewportRecordingEnabled)
         {
             return;
@@ -1011,6 +1121,9 @@ namespace Trident
             if (!m_VideoEncoder)
             {
                 m_VideoEncoder = std::make_unique<VideoEncoder>();
+                m_VideoEncoder->SetQueuePolicy(m_RecordingQueuePolicy, m_RecordingQueueBudget);
+                m_VideoEncoder->SetReplayBudget(m_ReplayBudget);
+                m_VideoEncoder->SetSegmentEncoderCount(m_RecordingSegmentEncoders);
             }
 
             if (!m_VideoEncoder)
@@ -1023,7 +1136,8 @@ namespace Trident
                 return;
             }
 
-            const bool l_SessionRestarted = m_VideoEncoder->BeginSession(m_RecordingOutputPath, m_RecordingExtent, 30);
+            const bool l_SessionRestarted = m_RecordingToReplay ? m_VideoEncoder->BeginReplaySession(m_RecordingExtent, s_ReplayTargetFps)
+                : m_VideoEncoder->BeginSession(m_RecordingOutputPath, m_RecordingExtent, 30);
             const bool l_ReinitialisedSessionActive = l_SessionRestarted && m_VideoEncoder->IsSessionActive();
 
             if (!l_ReinitialisedSessionActive)
@@ -1045,32 +1159,52 @@ namespace Trident
             return;
         }
 
-        if (m_PendingFrameReadbackBytes.empty())
-        {
-            return;
-        }
-
         if (m_RecordingExtent.width == 0 || m_RecordingExtent.height == 0)
         {
             TR_CORE_WARN("Viewport recording rejected because the extent is invalid.");
             return;
         }
 
-        VideoEncoder::RecordedFrame l_Frame{};
-        l_Frame.m_Pixels = m_PendingFrameReadbackBytes;
-        l_Frame.m_Extent = m_RecordingExtent;
-        l_Frame.m_Timestamp = m_LastReadbackTimestamp;
-        l_Frame.m_FrameIndex = imageIndex;
-        l_Frame.m_ViewportId = m_RecordingViewportId;
+        // Each completed readback is submitted once, in capture order; the queue's policy already dropped unwanted frames.
+        ReadbackFrame l_Readback;
+        while (m_EncoderReadbackQueue.TryPop(l_Readback))
+        {
+            if (!l_Readback.HasPixels())
+            {
+                continue;
+            }
+
+            // The frame borrows the resolved readback; the encoder keeps the owner until the frame is written.
+            VideoEncoder::RecordedFrame l_Frame{};
+            l_Frame.m_PixelOwner = std::move(l_Readback.m_Owner);
+            l_Frame.m_PixelView = l_Readback.m_Pixels;
+            l_Frame.m_Extent = l_Readback.m_PixelExtent;
+            l_Frame.m_Layout = l_Readback.m_PixelLayout;
+            l_Frame.m_LumaStride = l_Readback.m_LumaStride;
+            l_Frame.m_ChromaStride = l_Readback.m_ChromaStride;
+            l_Frame.m_Timestamp = l_Readback.m_Timestamp;
+            l_Frame.m_FrameIndex = l_Readback.m_FrameIndex;
+            l_Frame.m_ViewportId = m_RecordingViewportId;
 
-        m_ViewportFrameBuffer.push_back(l_Frame);
+            // Status displays only read the metadata, so the retained copy drops the pixels instead of pinning staging buffers.
+            VideoEncoder::RecordedFrame l_Metadata = l_Frame;
+            l_Metadata.m_PixelOwner.reset();
+            l_Metadata.m_PixelView = {};
 
-        if (m_VideoEncoder)
-        {
-            if (!m_VideoEncoder->SubmitFrame(l_Frame))
+            if (m_VideoEncoder)
+            {
+                if (!m_VideoEncoder->SubmitFrame(std::move(l_Frame)))
+                {
+                    TR_CORE_WARN("Video encoder rejected frame {} for viewport {}", l_Metadata.m_FrameIndex, m_RecordingViewportId);
+                }
+            }
+
+            // Only the latest entries matter to status displays; trim in batches so long recordings stay bounded.
+            if (m_ViewportFrameBuffer.size() >= s_MaxViewportFrameHistory * 2)
             {
-                TR_CORE_WARN("Video encoder rejected frame {} for viewport {}", imageIndex, m_RecordingViewportId);
+                m_ViewportFrameBuffer.erase(m_ViewportFrameBuffer.begin(), m_ViewportFrameBuffer.end() - s_MaxViewportFrameHistory);
             }
+            m_ViewportFrameBuffer.push_back(std::move(l_Metadata));
         }
     }
 
@@ -1130,7 +1264,8 @@ namespace Trident
 
         // Clear pending resize requests and schedule staging buffers for deferred release.
         m_ReadbackResizePending = false;
-        m_FrameReadbackPending.assign(m_FrameReadbackPending.size(), false);
+        m_AiReadbackQueue.Clear();
+        m_EncoderReadbackQueue.Clear();
         m_ReadbackDestroyPending = true;
         TryCompleteReadbackDestroy();
     }
@@ -1150,9 +1285,9 @@ namespace Trident
         }
 
         const bool l_ExtentChanged = (l_TargetExtent.width != m_LastReadbackExtent.width) || (l_TargetExtent.height != m_LastReadbackExtent.height);
-        const bool l_ImageCountChanged = (m_FrameReadbackBuffers.size() != m_Swapchain.GetImageCount());
+        const bool l_SlotCountChanged = (m_ReadbackRing.size() != GetReadbackRingSize());
 
-        if (!force && !l_ExtentChanged && !l_ImageCountChanged)
+        if (!force && !l_ExtentChanged && !l_SlotCountChanged)
         {
             return;
         }
@@ -1168,8 +1303,7 @@ namespace Trident
             return;
         }
 
-        // Block until the GPU is idle before rebuilding staging buffers so in-flight frames are not disrupted.
-        vkDeviceWaitIdle(Startup::GetDevice());
+        // The previous staging buffers are retired rather than destroyed, so in-flight copies into them stay valid.
         CreateOrResizeReadbackResources(m_PendingReadbackExtent);
         m_LastReadbackExtent = m_FrameReadbackExtent;
         m_ReadbackResizePending = false;
@@ -1191,6 +1325,7 @@ namespace Trident
             l_TargetExtent = m_Swapchain.GetExtent();
         }
         const uint32_t l_ImageCount = m_Swapchain.GetImageCount();
+        const uint32_t l_SlotCount = GetReadbackRingSize();
         const SwapchainFormatInfo l_FormatInfo = QuerySwapchainFormatInfo(m_Swapchain.GetImageFormat());
 
         if (l_TargetExtent.width == 0 || l_TargetExtent.height == 0 || l_ImageCount == 0 || l_FormatInfo.m_BytesPerPixel == 0 || l_FormatInfo.m_ChannelCount == 0)
@@ -1201,7 +1336,6 @@ namespace Trident
             }
 
             // Either the swapchain is minimised or we encountered an unsupported format; clear any stale allocations.
-            vkDeviceWaitIdle(Startup::GetDevice());
             DestroyReadbackResources();
 
             m_LastReadbackExtent = { 0, 0 };
@@ -1209,11 +1343,14 @@ namespace Trident
             return;
         }
 
-        const VkDeviceSize l_BufferSize = static_cast<VkDeviceSize>(l_TargetExtent.width) * static_cast<VkDeviceSize>(l_TargetExtent.height) * l_FormatInfo.m_BytesPerPixel;
+        // Buffers hold either the raw copy or the pre-processed tensor and planes, whichever is larger; a resampled tensor can
+        // outgrow the frame itself.
+        const VkDeviceSize l_RawSize = static_cast<VkDeviceSize>(l_TargetExtent.width) * static_cast<VkDeviceSize>(l_TargetExtent.height) * l_FormatInfo.m_BytesPerPixel;
+        const VkDeviceSize l_BufferSize = std::max(l_RawSize, BuildReadbackPreprocessLayout(l_TargetExtent, l_FormatInfo.m_ChannelCount).m_TotalSize);
 
         const bool l_MatchingExtent = (m_FrameReadbackExtent.width == l_TargetExtent.width) && (m_FrameReadbackExtent.height == l_TargetExtent.height);
         const bool l_MatchingSize = (m_FrameReadbackBufferSize == l_BufferSize);
-        const bool l_MatchingCount = (m_FrameReadbackBuffers.size() == l_ImageCount);
+        const bool l_MatchingCount = (m_ReadbackRing.size() == l_SlotCount);
 
         m_LastReadbackExtent = l_TargetExtent;
         if (l_MatchingExtent && l_MatchingSize && l_MatchingCount)
@@ -1223,18 +1360,11 @@ namespace Trident
 
         DestroyReadbackResources();
 
-        m_FrameReadbackBuffers.resize(l_ImageCount, VK_NULL_HANDLE);
-        m_FrameReadbackMemory.resize(l_ImageCount, VK_NULL_HANDLE);
-        m_FrameReadbackPending.assign(l_ImageCount, false);
-
-        for (uint32_t it_Index = 0; it_Index < l_ImageCount; ++it_Index)
+        m_ReadbackRing.resize(l_SlotCount);
+        m_ReadbackRingCursor = 0;
+        for (ReadbackRingSlot& it_Slot : m_ReadbackRing)
         {
-            VkBuffer l_Buffer = VK_NULL_HANDLE;
-            VkDeviceMemory l_Memory = VK_NULL_HANDLE;
-            m_Buffers.CreateBuffer(l_BufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, l_Buffer, l_Memory);
-
-            m_FrameReadbackBuffers[it_Index] = l_Buffer;
-            m_FrameReadbackMemory[it_Index] = l_Memory;
+            it_Slot.m_Staging = CreateReadbackStaging(l_BufferSize);
         }
 
         m_FrameReadbackExtent = l_TargetExtent;
@@ -1245,24 +1375,29 @@ namespace Trident
         m_ReadbackConfigurationWarningIssued = false;
 
         //TR_CORE_TRACE("Frame readback staging resized to {}x{} ({} bytes per pixel, {} buffers)", l_TargetExtent.width, l_TargetExtent.height,
-        //    l_FormatInfo.m_BytesPerPixel, l_ImageCount);
+        //    l_FormatInfo.m_BytesPerPixel, l_SlotCount);
     }
 
     void Renderer::DestroyReadbackResources()
     {
-        for (size_t it_Index = 0; it_Index < m_FrameReadbackBuffers.size(); ++it_Index)
+        // Drop the renderer's own handles first so buffers only the queued frames were holding can be destroyed right away.
+        // Slots still in flight are retired against the timeline by the buffer allocator, like any other buffer.
+        m_AiReadbackQueue.Clear();
+        m_EncoderReadbackQueue.Clear();
+
+        for (ReadbackRingSlot& it_Slot : m_ReadbackRing)
         {
-            VkBuffer& l_Buffer = m_FrameReadbackBuffers[it_Index];
-            VkDeviceMemory l_Memory = (it_Index < m_FrameReadbackMemory.size()) ? m_FrameReadbackMemory[it_Index] : VK_NULL_HANDLE;
-            if (l_Buffer != VK_NULL_HANDLE || l_Memory != VK_NULL_HANDLE)
-            {
-                m_Buffers.DestroyBuffer(l_Buffer, l_Memory);
-            }
+            ReleaseReadbackStaging(it_Slot.m_Staging);
+        }
+        for (ReadbackStagingBuffer& it_Staging : m_SpareReadbackStaging)
+        {
+            DestroyReadbackStaging(it_Staging);
         }
 
-        m_FrameReadbackBuffers.clear();
-        m_FrameReadbackMemory.clear();
-        m_FrameReadbackPending.clear();
+        m_ReadbackRing.clear();
+        m_ReadbackRingCursor = 0;
+        m_RecordedReadbackSlot = s_InvalidReadbackSlot;
+        m_SpareReadbackStaging.clear();
         m_FrameReadbackExtent = { 0, 0 };
         m_LastReadbackExtent = { 0, 0 };
         m_FrameReadbackBufferSize = 0;
@@ -1270,53 +1405,176 @@ namespace Trident
         m_FrameReadbackChannelCount = 0;
         m_FrameReadbackChannelMapping = { 0, 1, 2, 3 };
         m_ReadbackConfigurationWarningIssued = false;
-        m_PendingFrameReadback.clear();
-        m_PendingFrameReadbackBytes.clear();
     }
 
-    void Renderer::TryCompleteReadbackDestroy()
+    Renderer::ReadbackStagingBuffer Renderer::CreateReadbackStaging(VkDeviceSize size)
     {
-        if (!m_ReadbackDestroyPending)
+        ReadbackStagingBuffer l_Staging{};
+        const VkBufferUsageFlags l_Usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        if (SupportsHostCachedReadback())
         {
-            return;
+            m_Buffers.CreateBuffer(size, l_Usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, l_Staging.m_Buffer, l_Staging.m_Memory);
+            l_Staging.m_HostCached = (l_Staging.m_Buffer != VK_NULL_HANDLE && l_Staging.m_Memory != VK_NULL_HANDLE);
         }
 
-        const uint32_t l_FrameCount = m_Commands.GetFrameCount();
-        VkDevice l_Device = Startup::GetDevice();
-        for (uint32_t it_Frame = 0; it_Frame < l_FrameCount; ++it_Frame)
+        if (!l_Staging.m_HostCached)
         {
-            VkFence l_Fence = m_Commands.GetInFlightFence(it_Frame);
-            if (vkGetFenceStatus(l_Device, l_Fence) == VK_NOT_READY)
+            if (l_Staging.m_Buffer != VK_NULL_HANDLE || l_Staging.m_Memory != VK_NULL_HANDLE)
             {
-                return;
+                m_Buffers.DestroyBuffer(l_Staging.m_Buffer, l_Staging.m_Memory);
             }
+            m_Buffers.CreateBuffer(size, l_Usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, l_Staging.m_Buffer, l_Staging.m_Memory);
         }
 
-        DestroyReadbackResources();
-        m_ReadbackDestroyPending = false;
+        if (l_Staging.m_Buffer == VK_NULL_HANDLE || l_Staging.m_Memory == VK_NULL_HANDLE)
+        {
+            DestroyReadbackStaging(l_Staging);
+
+            return l_Staging;
+        }
+
+        // Mapped for the buffer's whole life, so consumers can hold plain pointers into it.
+        void* l_Mapped = nullptr;
+        if (vkMapMemory(Startup::GetDevice(), l_Staging.m_Memory, 0, VK_WHOLE_SIZE, 0, &l_Mapped) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to map frame readback buffer");
+            DestroyReadbackStaging(l_Staging);
+
+            return l_Staging;
+        }
+
+        l_Staging.m_Mapped = static_cast<uint8_t*>(l_Mapped);
+        l_Staging.m_Size = size;
+        l_Staging.m_InUse = std::make_shared<std::atomic<bool>>(false);
+
+        return l_Staging;
     }
 
-    void Renderer::ResolvePendingReadback(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp)
+    void Renderer::DestroyReadbackStaging(ReadbackStagingBuffer& staging)
     {
-        if (!m_ReadbackEnabled)
+        if (staging.m_Mapped != nullptr)
+        {
+            vkUnmapMemory(Startup::GetDevice(), staging.m_Memory);
+        }
+
+        if (staging.m_Buffer != VK_NULL_HANDLE || staging.m_Memory != VK_NULL_HANDLE)
+        {
+            m_Buffers.DestroyBuffer(staging.m_Buffer, staging.m_Memory);
+        }
+
+        staging = {};
+    }
+
+    void Renderer::ReleaseReadbackStaging(ReadbackStagingBuffer& staging)
+    {
+        if (staging.m_Buffer == VK_NULL_HANDLE)
         {
+            staging = {};
+
             return;
         }
 
-        if (imageIndex >= m_FrameReadbackBuffers.size())
+        if (staging.IsInUse())
         {
+            // A consumer still reads it; CollectReleasedReadbackStaging destroys it once the last lease is gone.
+            m_HeldReadbackStaging.push_back(std::move(staging));
+            staging = {};
+
             return;
         }
 
-        if (!m_FrameReadbackPending[imageIndex])
+        DestroyReadbackStaging(staging);
+    }
+
+    void Renderer::CollectReleasedReadbackStaging()
+    {
+        for (size_t it_Index = 0; it_Index < m_HeldReadbackStaging.size();)
+        {
+            ReadbackStagingBuffer& l_Staging = m_HeldReadbackStaging[it_Index];
+            if (l_Staging.IsInUse())
+            {
+                ++it_Index;
+
+                continue;
+            }
+
+            // Buffers of the current size are kept for the next swap; anything left over from a resize is freed.
+            if (l_Staging.m_Size == m_FrameReadbackBufferSize && m_SpareReadbackStaging.size() < s_MaxSpareReadbackStaging)
+            {
+                m_SpareReadbackStaging.push_back(std::move(l_Staging));
+            }
+            else
+            {
+                DestroyReadbackStaging(l_Staging);
+            }
+
+            m_HeldReadbackStaging[it_Index] = std::move(m_HeldReadbackStaging.back());
+            m_HeldReadbackStaging.pop_back();
+        }
+    }
+
+    bool Renderer::EnsureWritableReadbackStaging(ReadbackStagingBuffer& staging)
+    {
+        if (staging.m_Buffer != VK_NULL_HANDLE && !staging.IsInUse())
+        {
+            return true;
+        }
+
+        // The GPU must never write under a live lease. Swap in another buffer and let the held one drain, unless consumers
+        // are already so far behind that skipping this frame's readback is the better answer.
+        if (m_HeldReadbackStaging.size() >= s_MaxHeldReadbackStaging)
+        {
+            return false;
+        }
+
+        ReadbackStagingBuffer l_Replacement{};
+        if (!m_SpareReadbackStaging.empty())
+        {
+            l_Replacement = std::move(m_SpareReadbackStaging.back());
+            m_SpareReadbackStaging.pop_back();
+        }
+        else
+        {
+            l_Replacement = CreateReadbackStaging(m_FrameReadbackBufferSize);
+        }
+
+        if (l_Replacement.m_Buffer == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        ReleaseReadbackStaging(staging);
+        staging = std::move(l_Replacement);
+
+        return true;
+    }
+
+    void Renderer::TryCompleteReadbackDestroy()
+    {
+        if (!m_ReadbackDestroyPending)
         {
             return;
         }
 
-        const auto l_Now = std::chrono::steady_clock::now();
-        if (l_Now < m_NextReadbackTime)
+        const uint32_t l_FrameCount = m_Commands.GetFrameCount();
+        VkDevice l_Device = Startup::GetDevice();
+        for (uint32_t it_Frame = 0; it_Frame < l_FrameCount; ++it_Frame)
+        {
+            VkFence l_Fence = m_Commands.GetInFlightFence(it_Frame);
+            if (vkGetFenceStatus(l_Device, l_Fence) == VK_NOT_READY)
+            {
+                return;
+            }
+        }
+
+        DestroyReadbackResources();
+        m_ReadbackDestroyPending = false;
+    }
+
+    void Renderer::ResolveCompletedReadbacks()
+    {
+        if (!m_ReadbackEnabled || m_ReadbackRing.empty())
         {
-            // Leave the pending flag set so the newest frame can be resolved later.
             return;
         }
 
@@ -1333,104 +1591,289 @@ namespace Trident
                 m_ReadbackConfigurationWarningIssued = true;
             }
 
-            // Keep the pending flag intact so the frame is not silently dropped while resources are recreated.
+            // Keep submitted slots intact so frames are not silently dropped while resources are recreated.
             return;
         }
 
-        VkDevice l_Device = Startup::GetDevice();
-        void* l_Mapped = nullptr;
-        if (vkMapMemory(l_Device, m_FrameReadbackMemory[imageIndex], 0, m_FrameReadbackBufferSize, 0, &l_Mapped) != VK_SUCCESS)
+        // Poll, never wait: only slots whose submission the timeline has already passed are picked up, oldest first so
+        // consumers see frames in order.
+        const uint64_t l_CompletedValue = m_Commands.GetCompletedTimelineValue();
+        std::array<ReadbackRingSlot*, s_MaxReadbackRingSize> l_ReadySlots{};
+        size_t l_ReadyCount = 0;
+        for (ReadbackRingSlot& it_Slot : m_ReadbackRing)
         {
-            TR_CORE_CRITICAL("Failed to map frame readback buffer {}", imageIndex);
-            m_FrameReadbackPending[imageIndex] = false;
-            return;
+            if (it_Slot.m_State == ReadbackSlotState::Submitted && it_Slot.m_TimelineValue <= l_CompletedValue && l_ReadyCount < l_ReadySlots.size())
+            {
+                l_ReadySlots[l_ReadyCount++] = &it_Slot;
+            }
         }
 
-        const uint8_t* l_SourceBytes = static_cast<const uint8_t*>(l_Mapped);
-        const size_t l_PixelCount = static_cast<size_t>(m_FrameReadbackExtent.width) * static_cast<size_t>(m_FrameReadbackExtent.height);
-        const size_t l_TotalElements = l_PixelCount * static_cast<size_t>(m_FrameReadbackChannelCount);
+        std::sort(l_ReadySlots.begin(), l_ReadySlots.begin() + l_ReadyCount, [](const ReadbackRingSlot* a_Left, const ReadbackRingSlot* a_Right)
+            {
+                return a_Left->m_TimelineValue < a_Right->m_TimelineValue;
+            });
+
+        for (size_t it_Index = 0; it_Index < l_ReadyCount; ++it_Index)
+        {
+            ResolveReadbackSlot(*l_ReadySlots[it_Index]);
+        }
+    }
 
-        m_PendingFrameReadback.resize(l_TotalElements);
-        m_PendingFrameReadbackBytes.resize(l_TotalElements);
+    void Renderer::ResolveReadbackSlot(ReadbackRingSlot& slot)
+    {
+        slot.m_State = ReadbackSlotState::Free;
 
-        const float l_Normalise = 1.0f / 255.0f;
-        const uint32_t l_ChannelCount = m_FrameReadbackChannelCount;
-        const bool l_ApplyMapping = (l_ChannelCount == 4u) && (m_FrameReadbackBytesPerPixel >= 4u);
+        const ReadbackStagingBuffer& l_Staging = slot.m_Staging;
+        if (l_Staging.m_Mapped == nullptr)
+        {
+            return;
+        }
 
-        for (size_t it_PixelIndex = 0; it_PixelIndex < l_PixelCount; ++it_PixelIndex)
+        // Each consumer's policy decides up front whether it wants this frame, so skipped frames are never converted.
+        const bool l_NeedsFloats = m_FrameGenerator.IsInitialised() && m_AiReadbackQueue.ShouldTake();
+        const bool l_NeedsBytes = m_ViewportRecordingEnabled && m_EncoderReadbackQueue.ShouldTake();
+        if (!l_NeedsFloats && !l_NeedsBytes)
         {
-            const size_t l_SourceOffset = it_PixelIndex * static_cast<size_t>(m_FrameReadbackBytesPerPixel);
-            const size_t l_DestinationOffset = it_PixelIndex * static_cast<size_t>(l_ChannelCount);
+            return;
+        }
 
-            for (uint32_t it_Channel = 0; it_Channel < l_ChannelCount; ++it_Channel)
-            {
-                uint32_t l_SourceChannel = l_ApplyMapping ? m_FrameReadbackChannelMapping[it_Channel] : it_Channel;
+        // The timeline has passed the slot's submission, so the copy has landed; cached memory still needs invalidating.
+        if (l_Staging.m_HostCached)
+        {
+            VkMappedMemoryRange l_Range{ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+            l_Range.memory = l_Staging.m_Memory;
+            l_Range.offset = 0;
+            l_Range.size = VK_WHOLE_SIZE;
+            vkInvalidateMappedMemoryRanges(Startup::GetDevice(), 1, &l_Range);
+        }
 
-                // Protect against unexpected formats by falling back to the original order.
-                if (l_SourceChannel >= m_FrameReadbackBytesPerPixel)
-                {
-                    l_SourceChannel = it_Channel;
-                }
+        const ReadbackPreprocessLayout& l_Layout = slot.m_Layout;
+        const std::chrono::system_clock::time_point l_Timestamp = slot.m_CaptureTimestamp;
+        const uint32_t l_FrameIndex = slot.m_ImageIndex;
 
-                const uint8_t l_Value = l_SourceBytes[l_SourceOffset + static_cast<size_t>(l_SourceChannel)];
+        if (!l_Layout.IsEmpty())
+        {
+            // The GPU wrote the final bytes, so consumers read them straight out of the mapping. One lease covers every
+            // handle; the buffer goes back to the GPU only after the last of them is dropped.
+            const bool l_ShareTensor = l_NeedsFloats && l_Layout.HasTensor() && !l_Layout.m_TensorHalf;
+            const bool l_ShareYuv = l_NeedsBytes && l_Layout.HasYuv();
+            if (!l_ShareTensor && !l_ShareYuv)
+            {
+                return;
+            }
 
-                // AI consumers expect normalised floats in RGBA order.
-                m_PendingFrameReadback[l_DestinationOffset + it_Channel] = static_cast<float>(l_Value) * l_Normalise;
+            const std::shared_ptr<const void> l_Owner = std::make_shared<ReadbackLease>(l_Staging.m_InUse);
+            const uint8_t* l_Source = l_Staging.m_Mapped;
+            if (l_ShareTensor)
+            {
+                ReadbackFrame l_Frame{};
+                l_Frame.m_Owner = l_Owner;
+                l_Frame.m_Tensor = std::span<const float>(reinterpret_cast<const float*>(l_Source + l_Layout.m_TensorOffset),
+                    static_cast<size_t>(l_Layout.m_TensorSize / sizeof(float)));
+                l_Frame.m_TensorExtent = l_Layout.m_TensorExtent;
+                l_Frame.m_TensorChannels = l_Layout.m_TensorChannels;
+                l_Frame.m_Timestamp = l_Timestamp;
+                l_Frame.m_FrameIndex = l_FrameIndex;
+                m_AiReadbackQueue.Push(std::move(l_Frame));
+            }
 
-                // Video encoder expects raw bytes in RGBA order so it always feeds FFmpeg the same layout.
-                m_PendingFrameReadbackBytes[l_DestinationOffset + it_Channel] = l_Value;
+            if (l_ShareYuv)
+            {
+                ReadbackFrame l_Frame{};
+                l_Frame.m_Owner = l_Owner;
+                l_Frame.m_Pixels = std::span<const uint8_t>(l_Source + l_Layout.m_YuvOffset, static_cast<size_t>(l_Layout.m_YuvSize));
+                l_Frame.m_PixelExtent = l_Layout.m_YuvExtent;
+                l_Frame.m_PixelLayout = VideoEncoder::PixelLayout::Yuv420;
+                l_Frame.m_LumaStride = l_Layout.m_LumaStride;
+                l_Frame.m_ChromaStride = l_Layout.m_ChromaStride;
+                l_Frame.m_Timestamp = l_Timestamp;
+                l_Frame.m_FrameIndex = l_FrameIndex;
+                m_EncoderReadbackQueue.Push(std::move(l_Frame));
             }
+
+            return;
         }
 
-        vkUnmapMemory(l_Device, m_FrameReadbackMemory[imageIndex]);
-        m_FrameReadbackPending[imageIndex] = false;
-        m_LastReadbackTimestamp = captureTimestamp;
-        m_NextReadbackTime = l_Now + m_ReadbackThrottleInterval;
-    }
+        // Raw pixels still need swizzling on the CPU, so the converted copy lives on the heap and is shared the same way.
+        const size_t l_PixelCount = static_cast<size_t>(m_FrameReadbackExtent.width) * static_cast<size_t>(m_FrameReadbackExtent.height);
+        const size_t l_TotalElements = l_PixelCount * static_cast<size_t>(m_FrameReadbackChannelCount);
 
-    bool Renderer::EnsureAiTextureResources(VkExtent2D extent)
-    {
-        if (extent.width == 0 || extent.height == 0)
+        const std::shared_ptr<ReadbackHostCopy> l_HostCopy = std::make_shared<ReadbackHostCopy>();
+        if (l_NeedsFloats)
         {
-            return false;
+            l_HostCopy->m_Floats.resize(l_TotalElements);
+        }
+        if (l_NeedsBytes)
+        {
+            l_HostCopy->m_Bytes = m_VideoEncoder ? m_VideoEncoder->AcquirePixelBuffer(l_TotalElements) : std::make_shared<std::vector<uint8_t>>(l_TotalElements);
         }
 
-        const VkDeviceSize l_RequiredBytes = static_cast<VkDeviceSize>(extent.width) * static_cast<VkDeviceSize>(extent.height) * 4ull;
+        ReadbackConversionDesc l_Conversion{};
+        l_Conversion.m_Source = l_Staging.m_Mapped;
+        l_Conversion.m_Width = m_FrameReadbackExtent.width;
+        l_Conversion.m_Height = m_FrameReadbackExtent.height;
+        l_Conversion.m_SourceBytesPerPixel = m_FrameReadbackBytesPerPixel;
+        l_Conversion.m_ChannelCount = m_FrameReadbackChannelCount;
+        // Formats are remapped into RGBA only when a full four-channel pixel is present, as before.
+        if (m_FrameReadbackChannelCount == 4u && m_FrameReadbackBytesPerPixel >= 4u)
+        {
+            l_Conversion.m_ChannelMapping = m_FrameReadbackChannelMapping;
+        }
+        l_Conversion.m_Floats = l_NeedsFloats ? l_HostCopy->m_Floats.data() : nullptr;
+        l_Conversion.m_Bytes = l_NeedsBytes ? l_HostCopy->m_Bytes->data() : nullptr;
+        m_ReadbackConverter.Convert(l_Conversion);
 
-        if ((m_AiTextureImage != VK_NULL_HANDLE) && (extent.width != m_AiTextureExtent.width || extent.height != m_AiTextureExtent.height))
+        if (l_NeedsFloats)
         {
-            // Resolution changed, destroy the previous GPU resources before allocating replacements.
-            DestroyAiResources();
+            ReadbackFrame l_Frame{};
+            l_Frame.m_Owner = l_HostCopy;
+            l_Frame.m_Tensor = l_HostCopy->m_Floats;
+            l_Frame.m_TensorExtent = m_FrameReadbackExtent;
+            l_Frame.m_TensorChannels = m_FrameReadbackChannelCount;
+            l_Frame.m_Timestamp = l_Timestamp;
+            l_Frame.m_FrameIndex = l_FrameIndex;
+            m_AiReadbackQueue.Push(std::move(l_Frame));
         }
 
-        if (m_AiTextureImage == VK_NULL_HANDLE)
+        if (l_NeedsBytes)
         {
-            VkImageCreateInfo l_ImageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
-            l_ImageInfo.imageType = VK_IMAGE_TYPE_2D;
-            l_ImageInfo.extent = { extent.width, extent.height, 1u };
-            l_ImageInfo.mipLevels = 1;
-            l_ImageInfo.arrayLayers = 1;
-            l_ImageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
-            l_ImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-            l_ImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            l_ImageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
-            l_ImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-            l_ImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            ReadbackFrame l_Frame{};
+            // Only the pooled bytes travel to the encoder, so a queued frame does not also pin the tensor.
+            l_Frame.m_Owner = l_HostCopy->m_Bytes;
+            l_Frame.m_Pixels = *l_HostCopy->m_Bytes;
+            l_Frame.m_PixelExtent = m_FrameReadbackExtent;
+            l_Frame.m_PixelLayout = VideoEncoder::PixelLayout::Rgba8;
+            l_Frame.m_Timestamp = l_Timestamp;
+            l_Frame.m_FrameIndex = l_FrameIndex;
+            m_EncoderReadbackQueue.Push(std::move(l_Frame));
+        }
+    }
 
-            if (vkCreateImage(Startup::GetDevice(), &l_ImageInfo, nullptr, &m_AiTextureImage) != VK_SUCCESS)
+    uint32_t Renderer::AcquireReadbackSlot()
+    {
+        const uint32_t l_SlotCount = static_cast<uint32_t>(m_ReadbackRing.size());
+        for (uint32_t it_Offset = 0; it_Offset < l_SlotCount; ++it_Offset)
+        {
+            const uint32_t l_Index = (m_ReadbackRingCursor + it_Offset) % l_SlotCount;
+            ReadbackRingSlot& l_Slot = m_ReadbackRing[l_Index];
+            if (l_Slot.m_State == ReadbackSlotState::Free && EnsureWritableReadbackStaging(l_Slot.m_Staging))
             {
-                TR_CORE_CRITICAL("Failed to create AI interpolation image");
-                DestroyAiResources();
+                m_ReadbackRingCursor = (l_Index + 1) % l_SlotCount;
 
-                return false;
+                return l_Index;
             }
+        }
 
-            VkMemoryRequirements l_Requirements{};
-            vkGetImageMemoryRequirements(Startup::GetDevice(), m_AiTextureImage, &l_Requirements);
+        // Every slot is still in flight or pinned by consumers. Skipping one frame's copy is cheaper than stalling the CPU.
+        ++m_SkippedReadbackFrames;
 
-            VkMemoryAllocateInfo l_AllocInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
-            l_AllocInfo.allocationSize = l_Requirements.size;
-            l_AllocInfo.memoryTypeIndex = m_Buffers.FindMemoryType(l_Requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        return s_InvalidReadbackSlot;
+    }
+
+    void Renderer::CompleteReadbackSubmission(bool submitted, uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp)
+    {
+        if (m_RecordedReadbackSlot >= m_ReadbackRing.size())
+        {
+            m_RecordedReadbackSlot = s_InvalidReadbackSlot;
+
+            return;
+        }
+
+        ReadbackRingSlot& l_Slot = m_ReadbackRing[m_RecordedReadbackSlot];
+        m_RecordedReadbackSlot = s_InvalidReadbackSlot;
+        if (!submitted)
+        {
+            // Nothing will ever signal for a failed submission, so the slot goes straight back to the ring.
+            l_Slot.m_State = ReadbackSlotState::Free;
+
+            return;
+        }
+
+        // SubmitFrame took the newest timeline value for this frame; the slot is ready once the GPU reaches it.
+        l_Slot.m_State = ReadbackSlotState::Submitted;
+        l_Slot.m_TimelineValue = m_Commands.GetTimelineValue();
+        l_Slot.m_CaptureTimestamp = captureTimestamp;
+        l_Slot.m_ImageIndex = imageIndex;
+    }
+
+    uint32_t Renderer::GetReadbackRingSize() const
+    {
+        // One slot per frame the GPU can have queued, plus one holding the completed frame while the next copy lands.
+        return std::min<uint32_t>(m_Swapchain.GetImageCount() + 1, s_MaxReadbackRingSize);
+    }
+
+    ReadbackPreprocessLayout Renderer::BuildReadbackPreprocessLayout(VkExtent2D readbackExtent, uint32_t readbackChannelCount) const
+    {
+        // The tensor follows the model's input shape, with dynamic dimensions falling back to the readback itself. The frame
+        // generator consumes FP32 tensors, so the FP16 variant of the pass is not requested here.
+        VkExtent2D l_TensorExtent{ 0, 0 };
+        uint32_t l_TensorChannels = 0;
+        if (m_FrameGenerator.IsInitialised())
+        {
+            const TensorShapeInfo l_ShapeInfo = ParseTensorShapeNhwc(m_FrameGenerator.GetPrimaryInputShape());
+            if (l_ShapeInfo.m_IsValid && l_ShapeInfo.m_IsChannelsLast)
+            {
+                const std::array<int64_t, 4> l_Shape = BuildCanonicalNhwcShape(l_ShapeInfo, readbackExtent, readbackChannelCount);
+                l_TensorExtent = { static_cast<uint32_t>(l_Shape[2]), static_cast<uint32_t>(l_Shape[1]) };
+                l_TensorChannels = static_cast<uint32_t>(l_Shape[3]);
+            }
+        }
+
+        // Planes are written at the encoder's extent, which is already rounded to even dimensions for FFmpeg.
+        VkExtent2D l_YuvExtent{ 0, 0 };
+        bool l_YuvFullRange = false;
+        if (m_ViewportRecordingEnabled && m_VideoEncoder && m_VideoEncoder->IsSessionActive())
+        {
+            l_YuvExtent = m_VideoEncoder->GetOutputExtent();
+            l_YuvFullRange = m_VideoEncoder->UsesFullRangeYuv();
+        }
+
+        return ReadbackPreprocessLayout::Build(l_TensorExtent, l_TensorChannels, false, l_YuvExtent, l_YuvFullRange);
+    }
+
+    bool Renderer::EnsureAiTextureResources(VkExtent2D extent)
+    {
+        if (extent.width == 0 || extent.height == 0)
+        {
+            return false;
+        }
+
+        const VkDeviceSize l_RequiredBytes = static_cast<VkDeviceSize>(extent.width) * static_cast<VkDeviceSize>(extent.height) * 4ull;
+
+        if ((m_AiTextureImage != VK_NULL_HANDLE) && (extent.width != m_AiTextureExtent.width || extent.height != m_AiTextureExtent.height))
+        {
+            // Resolution changed, destroy the previous GPU resources before allocating replacements.
+            DestroyAiResources();
+        }
+
+        if (m_AiTextureImage == VK_NULL_HANDLE)
+        {
+            VkImageCreateInfo l_ImageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+            l_ImageInfo.imageType = VK_IMAGE_TYPE_2D;
+            l_ImageInfo.extent = { extent.width, extent.height, 1u };
+            l_ImageInfo.mipLevels = 1;
+            l_ImageInfo.arrayLayers = 1;
+            l_ImageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+            l_ImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            l_ImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            l_ImageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+            l_ImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            l_ImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+            if (vkCreateImage(Startup::GetDevice(), &l_ImageInfo, nullptr, &m_AiTextureImage) != VK_SUCCESS)
+            {
+                TR_CORE_CRITICAL("Failed to create AI interpolation image");
+                DestroyAiResources();
+
+                return false;
+            }
+
+            VkMemoryRequirements l_Requirements{};
+            vkGetImageMemoryRequirements(Startup::GetDevice(), m_AiTextureImage, &l_Requirements);
+
+            VkMemoryAllocateInfo l_AllocInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+            l_AllocInfo.allocationSize = l_Requirements.size;
+            l_AllocInfo.memoryTypeIndex = m_Buffers.FindMemoryType(l_Requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
             if (vkAllocateMemory(Startup::GetDevice(), &l_AllocInfo, nullptr, &m_AiTextureMemory) != VK_SUCCESS)
             {
@@ -1729,7 +2172,7 @@ namespace Trident
         {
             VkWriteDescriptorSet l_Write{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
             l_Write.dstSet = l_Set;
-            l_Write.dstBinding = 5;
+            l_Write.dstBinding = 2;
             l_Write.dstArrayElement = 0;
             l_Write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             l_Write.descriptorCount = 1;
@@ -1978,9 +2421,8 @@ namespace Trident
         };
 
         UploadGuard l_UploadGuard(m_IsUploadingMeshes);
-        // Ensure no GPU operations are using the old buffers before reallocating resources.
-        vkWaitForFences(Startup::GetDevice(), 1, &m_ResourceFence, VK_TRUE, UINT64_MAX);
-        
+        // Replaced geometry, cluster and material buffers are retired against the frame timeline, so in-flight frames keep theirs.
+
         // Prebuild primitive meshes so this upload includes their geometry and draw metadata.
         EnsurePrimitiveMeshesInCache();
 
@@ -2007,10 +2449,16 @@ namespace Trident
 
         size_t l_VertexCount = 0;
         size_t l_IndexCount = 0;
+        size_t l_BaseIndexCount = 0;
         for (const auto& it_Mesh : l_Meshes)
         {
             l_VertexCount += it_Mesh.Vertices.size();
             l_IndexCount += it_Mesh.Indices.size();
+            l_BaseIndexCount += it_Mesh.Indices.size();
+            for (const Geometry::MeshLod& it_Lod : it_Mesh.Lods)
+            {
+                l_IndexCount += it_Lod.Indices.size();
+            }
         }
 
         if (l_VertexCount > m_MaxVertexCount)
@@ -2036,6 +2484,12 @@ namespace Trident
                 // the vertex offset and corrupt geometry once multiple meshes share the combined buffers.
                 m_StagingIndices[l_IndexOffset++] = index;
             }
+            // Simplified LODs follow their parent's LOD0 range and share its base vertex.
+            for (const Geometry::MeshLod& it_Lod : it_Mesh.Lods)
+            {
+                std::copy(it_Lod.Indices.begin(), it_Lod.Indices.end(), m_StagingIndices.get() + l_IndexOffset);
+                l_IndexOffset += it_Lod.Indices.size();
+            }
             l_VertOffset += it_Mesh.Vertices.size();
         }
 
@@ -2045,11 +2499,11 @@ namespace Trident
         // Upload the combined geometry once per load so every mesh can share the same GPU buffers.
         if (!l_AllVertices.empty())
         {
-            m_Buffers.CreateVertexBuffer(l_AllVertices, m_Commands.GetOneTimePool(), m_VertexBuffer, m_VertexBufferMemory);
+            m_Buffers.CreateVertexBuffer(l_AllVertices, m_VertexBuffer, m_VertexBufferMemory);
         }
         if (!l_AllIndices.empty())
         {
-            m_Buffers.CreateIndexBuffer(l_AllIndices, m_Commands.GetOneTimePool(), m_IndexBuffer, m_IndexBufferMemory, m_IndexCount);
+            m_Buffers.CreateIndexBuffer(l_AllIndices, m_IndexBuffer, m_IndexBufferMemory, m_IndexCount);
         }
 
         // Record the uploaded index count so the command buffer draw guard can validate pending draws.
@@ -2059,6 +2513,8 @@ namespace Trident
         m_MeshDrawInfo.clear();
         m_MeshDrawInfo.reserve(l_Meshes.size());
 
+        std::vector<ClusterCuller::ClusterData> l_Clusters;
+
         uint32_t l_FirstIndexCursor = 0;
         int32_t l_BaseVertexCursor = 0;
         for (size_t l_MeshIndex = 0; l_MeshIndex < l_Meshes.size(); ++l_MeshIndex)
@@ -2068,14 +2524,72 @@ namespace Trident
             l_DrawInfo.m_FirstIndex = l_FirstIndexCursor;
             l_DrawInfo.m_IndexCount = static_cast<uint32_t>(it_Mesh.Indices.size());
             l_DrawInfo.m_BaseVertex = l_BaseVertexCursor;
+            l_DrawInfo.m_VertexCount = static_cast<uint32_t>(it_Mesh.Vertices.size());
             l_DrawInfo.m_MaterialIndex = it_Mesh.MaterialIndex;
+            l_DrawInfo.m_Lods[0].m_FirstIndex = l_DrawInfo.m_FirstIndex;
+            l_DrawInfo.m_Lods[0].m_IndexCount = l_DrawInfo.m_IndexCount;
+            l_DrawInfo.m_Lods[0].m_Error = 0.0f;
+            l_DrawInfo.m_LodCount = 1;
 
-            m_MeshDrawInfo.push_back(l_DrawInfo);
+            // Meshlet ranges are relative to the mesh's LOD0 indices; rebase them onto the shared index buffer.
+            l_DrawInfo.m_FirstCluster = static_cast<uint32_t>(l_Clusters.size());
+            l_DrawInfo.m_ClusterCount = static_cast<uint32_t>(it_Mesh.Meshlets.size());
+            for (const Geometry::Meshlet& it_Meshlet : it_Mesh.Meshlets)
+            {
+                ClusterCuller::ClusterData l_Cluster{};
+                l_Cluster.m_BoundingSphere = glm::vec4(it_Meshlet.Center, it_Meshlet.Radius);
+                l_Cluster.m_Cone = glm::vec4(it_Meshlet.ConeAxis, it_Meshlet.ConeCutoff);
+                l_Cluster.m_FirstIndex = l_DrawInfo.m_FirstIndex + it_Meshlet.FirstIndex;
+                l_Cluster.m_IndexCount = it_Meshlet.IndexCount;
+                l_Clusters.push_back(l_Cluster);
+            }
 
             l_FirstIndexCursor += l_DrawInfo.m_IndexCount;
+            for (const Geometry::MeshLod& it_Lod : it_Mesh.Lods)
+            {
+                const uint32_t l_LodIndexCount = static_cast<uint32_t>(it_Lod.Indices.size());
+                if (l_DrawInfo.m_LodCount < l_DrawInfo.m_Lods.size())
+                {
+                    MeshLodRange& l_Range = l_DrawInfo.m_Lods[l_DrawInfo.m_LodCount++];
+                    l_Range.m_FirstIndex = l_FirstIndexCursor;
+                    l_Range.m_IndexCount = l_LodIndexCount;
+                    l_Range.m_Error = it_Lod.Error;
+                }
+                l_FirstIndexCursor += l_LodIndexCount;
+            }
+
+            if (!it_Mesh.Vertices.empty())
+            {
+                glm::vec3 l_Min{ std::numeric_limits<float>::max() };
+                glm::vec3 l_Max{ std::numeric_limits<float>::lowest() };
+                for (const Vertex& it_Vertex : it_Mesh.Vertices)
+                {
+                    l_Min = glm::min(l_Min, it_Vertex.Position);
+                    l_Max = glm::max(l_Max, it_Vertex.Position);
+                }
+
+                l_DrawInfo.m_BoundsCenter = (l_Min + l_Max) * 0.5f;
+                l_DrawInfo.m_BoundsRadius = glm::length(l_Max - l_Min) * 0.5f;
+            }
+
+            // Every LOD also gets a single cluster spanning it so unclustered meshes and coarse LODs still go through occlusion.
+            for (uint32_t it_Lod = 0; it_Lod < l_DrawInfo.m_LodCount; ++it_Lod)
+            {
+                ClusterCuller::ClusterData l_Cluster{};
+                l_Cluster.m_BoundingSphere = glm::vec4(l_DrawInfo.m_BoundsCenter, l_DrawInfo.m_BoundsRadius);
+                l_Cluster.m_FirstIndex = l_DrawInfo.m_Lods[it_Lod].m_FirstIndex;
+                l_Cluster.m_IndexCount = l_DrawInfo.m_Lods[it_Lod].m_IndexCount;
+                l_DrawInfo.m_LodClusters[it_Lod] = static_cast<uint32_t>(l_Clusters.size());
+                l_Clusters.push_back(l_Cluster);
+            }
+
+            m_MeshDrawInfo.push_back(l_DrawInfo);
+
             l_BaseVertexCursor += static_cast<int32_t>(it_Mesh.Vertices.size());
         }
 
+        m_ClusterCuller.UploadClusters(l_Clusters);
+
         // Clear any cached draw list so the next frame rebuilds commands using the fresh offsets.
         m_MeshDrawCommands.clear();
 
@@ -2110,9 +2624,9 @@ namespace Trident
         }
 
         m_ModelCount = l_Meshes.size();
-        m_TriangleCount = l_IndexCount / 3;
+        m_TriangleCount = l_BaseIndexCount / 3;
 
-        TR_CORE_INFO("Scene info - Models: {} Triangles: {} Materials: {}", m_ModelCount, m_TriangleCount, m_Materials.size());
+        TR_CORE_INFO("Scene info - Models: {} Triangles: {} Materials: {} Clusters: {}", m_ModelCount, m_TriangleCount, m_Materials.size(), l_Clusters.size());
     }
 
     void Renderer::UploadTexture(const std::string& texturePath, const Loader::TextureData& texture)
@@ -2132,15 +2646,11 @@ namespace Trident
             return;
         }
 
-        if (m_ResourceFence != VK_NULL_HANDLE)
-        {
-            vkWaitForFences(Startup::GetDevice(), 1, &m_ResourceFence, VK_TRUE, UINT64_MAX);
-        }
-
-        auto a_Existing = m_TextureSlotLookup.find(l_NormalizedPath);
-        if (a_Existing == m_TextureSlotLookup.end())
+        const bool l_HasColorSlot = m_TextureSlotLookup.contains(GetTextureSlotKey(l_NormalizedPath, false));
+        const bool l_HasDataSlot = m_TextureSlotLookup.contains(GetTextureSlotKey(l_NormalizedPath, true));
+        if (!l_HasColorSlot && !l_HasDataSlot)
         {
-            if (m_TextureSlots.size() >= Pipeline::s_MaxMaterialTextures)
+            if (m_TextureSlots.size() >= m_Pipeline.GetMaterialTextureCapacity())
             {
                 TR_CORE_WARN("Texture budget exhausted. Unable to hot-reload '{}'.", l_NormalizedPath.c_str());
                 return;
@@ -2157,34 +2667,54 @@ namespace Trident
             m_TextureSlots.push_back(std::move(l_NewSlot));
             const uint32_t l_NewIndex = static_cast<uint32_t>(m_TextureSlots.size() - 1);
             m_TextureSlotLookup.emplace(l_NormalizedPath, l_NewIndex);
+            MarkTextureSlotDirty(l_NewIndex);
+
+            return;
         }
-        else
+
+        if (l_HasColorSlot)
         {
-            const uint32_t l_SlotIndex = a_Existing->second;
-            if (l_SlotIndex >= m_TextureSlots.size())
-            {
-                TR_CORE_WARN("Texture cache entry for '{}' referenced an invalid slot. Reverting to default.", l_NormalizedPath.c_str());
-                m_TextureSlotLookup[l_NormalizedPath] = 0u;
-            }
-            else
-            {
-                DestroyTextureSlot(m_TextureSlots[l_SlotIndex]);
+            RefreshTextureSlot(l_NormalizedPath, false, texture);
+        }
 
-                TextureSlot l_Replacement{};
-                if (!PopulateTextureSlot(l_Replacement, texture))
-                {
-                    TR_CORE_WARN("Failed to refresh texture '{}'. Using the default slot instead.", l_NormalizedPath.c_str());
-                    m_TextureSlotLookup[l_NormalizedPath] = 0u;
-                }
-                else
-                {
-                    l_Replacement.m_SourcePath = l_NormalizedPath;
-                    m_TextureSlots[l_SlotIndex] = std::move(l_Replacement);
-                }
-            }
+        if (l_HasDataSlot)
+        {
+            // The watcher decoded the file for colour; data maps need the UNORM decode and chain.
+            RefreshTextureSlot(l_NormalizedPath, true, Loader::TextureLoader::Load(l_NormalizedPath, true));
         }
+    }
 
-        RefreshTextureDescriptorBindings();
+    void Renderer::RefreshTextureSlot(const std::string& normalizedPath, bool linear, const Loader::TextureData& texture)
+    {
+        const std::string l_Key = GetTextureSlotKey(normalizedPath, linear);
+        const uint32_t l_SlotIndex = m_TextureSlotLookup[l_Key];
+        if (l_SlotIndex >= m_TextureSlots.size())
+        {
+            TR_CORE_WARN("Texture cache entry for '{}' referenced an invalid slot. Reverting to default.", normalizedPath.c_str());
+            m_TextureSlotLookup[l_Key] = 0u;
+
+            return;
+        }
+
+        // A hot reload supersedes any streamed upload still in flight; its result is discarded on arrival.
+        m_StreamingTextureSlots.erase(m_TextureSlots[l_SlotIndex].m_StreamTicket);
+        // Other images' sets keep the old view until they are reacquired, so it is retired rather than destroyed.
+        RetireTextureSlot(m_TextureSlots[l_SlotIndex]);
+
+        TextureSlot l_Replacement{};
+        if (texture.Pixels.empty() || !PopulateTextureSlot(l_Replacement, texture))
+        {
+            TR_CORE_WARN("Failed to refresh texture '{}'. Using the default slot instead.", normalizedPath.c_str());
+            m_TextureSlotLookup[l_Key] = 0u;
+        }
+        else
+        {
+            l_Replacement.m_SourcePath = normalizedPath;
+            l_Replacement.m_LastUsedTime = m_TextureResidencyTime;
+            l_Replacement.m_Linear = linear;
+            m_TextureSlots[l_SlotIndex] = std::move(l_Replacement);
+        }
+        MarkTextureSlotDirty(l_SlotIndex);
     }
 
     Renderer::ImGuiTexture* Renderer::CreateImGuiTexture(const Loader::TextureData& texture)
@@ -2199,6 +2729,14 @@ namespace Trident
             return nullptr;
         }
 
+        // ImGui images are single-level RGBA8; cooked KTX2 data carries its own chain and possibly compressed blocks.
+        if (texture.IsBlockCompressed() || !texture.Mips.empty())
+        {
+            TR_CORE_WARN("ImGui texture creation skipped because cooked textures are not supported for UI images.");
+
+            return nullptr;
+        }
+
         VkDevice l_Device = Startup::GetDevice();
 
         auto l_TextureStorage = std::make_unique<ImGuiTexture>();
@@ -2488,6 +3026,8 @@ namespace Trident
     {
         // Persist the registry pointer so draw gathering always references the intended data source (editor vs runtime).
         m_Registry = registry;
+        // Scene buffer slots are keyed by entity id, which means something else in another registry.
+        m_SceneBuffer.Reset();
         if (m_ViewportCamera != std::numeric_limits<ECS::Entity>::max())
         {
             // Reset the cached viewport camera when the underlying registry changes to avoid dangling entity references.
@@ -2524,12 +3064,61 @@ namespace Trident
         m_FrameDatasetRecorder.SetSampleInterval(m_FrameDatasetCaptureInterval);
     }
 
+    void Renderer::SetReadbackConsumerPolicy(ReadbackConsumer consumer, ReadbackConsumerPolicy policy, uint32_t interval)
+    {
+        ReadbackConsumerQueue& l_Queue = (consumer == ReadbackConsumer::Ai) ? m_AiReadbackQueue : m_EncoderReadbackQueue;
+        l_Queue.SetPolicy(policy, interval);
+    }
+
+    ReadbackConsumerPolicy Renderer::GetReadbackConsumerPolicy(ReadbackConsumer consumer) const
+    {
+        return (consumer == ReadbackConsumer::Ai) ? m_AiReadbackQueue.GetPolicy() : m_EncoderReadbackQueue.GetPolicy();
+    }
+
+    void Renderer::SetRecordingQueuePolicy(VideoEncoder::QueueOverflowPolicy policy, size_t budgetBytes)
+    {
+        // Remember the choice so encoders created for later sessions start with it.
+        m_RecordingQueuePolicy = policy;
+        m_RecordingQueueBudget = budgetBytes;
+        if (m_VideoEncoder)
+        {
+            m_VideoEncoder->SetQueuePolicy(policy, budgetBytes);
+        }
+    }
+
+    void Renderer::SetRecordingSegmentEncoders(uint32_t encoderCount)
+    {
+        m_RecordingSegmentEncoders = std::max(encoderCount, 1u);
+        if (m_VideoEncoder)
+        {
+            m_VideoEncoder->SetSegmentEncoderCount(m_RecordingSegmentEncoders);
+        }
+    }
+
+    VideoEncoder::QueueStats Renderer::GetRecordingQueueStats() const
+    {
+        if (!m_VideoEncoder)
+        {
+            VideoEncoder::QueueStats l_Stats{};
+            l_Stats.m_BudgetBytes = m_RecordingQueueBudget;
+
+            return l_Stats;
+        }
+
+        return m_VideoEncoder->GetQueueStats();
+    }
+
     void Renderer::SetClearColor(const glm::vec4& color)
     {
         // Persist the preferred clear colour so both render passes remain visually consistent.
         m_ClearColor = color;
     }
 
+    void Renderer::SetAiBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait)
+    {
+        m_FrameGenerator.SetBatching(maxBatchSize, maxWait);
+    }
+
     void Renderer::SetAiBlendStrength(float blendStrength)
     {
         const float l_ClampedStrength = std::clamp(blendStrength, 0.0f, 1.0f);
@@ -2566,6 +3155,20 @@ namespace Trident
         return VK_NULL_HANDLE;
     }
 
+    glm::vec2 Renderer::GetViewportTextureUV(uint32_t viewportID) const
+    {
+        const ViewportContext* l_Context = FindViewportContext(viewportID);
+        if (!l_Context || l_Context->m_Target.m_AllocatedExtent.width == 0 || l_Context->m_Target.m_AllocatedExtent.height == 0)
+        {
+            return glm::vec2(1.0f);
+        }
+
+        const OffscreenTarget& l_Target = l_Context->m_Target;
+
+        return glm::vec2(static_cast<float>(l_Target.m_Extent.width) / static_cast<float>(l_Target.m_AllocatedExtent.width),
+            static_cast<float>(l_Target.m_Extent.height) / static_cast<float>(l_Target.m_AllocatedExtent.height));
+    }
+
     const Camera* Renderer::GetActiveCamera() const
     {
         const ViewportContext* l_Context = FindViewportContext(m_ActiveViewportId);
@@ -2808,6 +3411,10 @@ namespace Trident
         l_RequestedExtent.width = static_cast<uint32_t>(std::max(info.Size.x, 0.0f));
         l_RequestedExtent.height = static_cast<uint32_t>(std::max(info.Size.y, 0.0f));
 
+        if (l_Context.m_CachedExtent.width != l_RequestedExtent.width || l_Context.m_CachedExtent.height != l_RequestedExtent.height)
+        {
+            l_Context.m_StableFrames = 0;
+        }
         l_Context.m_CachedExtent = l_RequestedExtent;
 
         // Only allow readback resizing if we aren't recording, 
@@ -2834,9 +3441,9 @@ namespace Trident
             return;
         }
 
-        CreateOrResizeOffscreenResources(l_Target, l_RequestedExtent);
-
-        // Future: consider pooling and recycling detached targets so background viewports can warm-start when reopened.
+        // While a panel edge is being dragged the target is only cropped (or clamped) so resizing never allocates per frame;
+        // UpdateOffscreenTargets reallocates once the size has settled.
+        ApplyOffscreenExtent(l_Context, l_RequestedExtent, l_Target.m_Image == VK_NULL_HANDLE);
     }
 
     ViewportInfo Renderer::GetViewport() const
@@ -2880,8 +3487,8 @@ namespace Trident
         std::vector<Vertex> l_VertexData(l_Vertices.begin(), l_Vertices.end());
         std::vector<uint32_t> l_IndexData(l_Indices.begin(), l_Indices.end());
 
-        m_Buffers.CreateVertexBuffer(l_VertexData, m_Commands.GetOneTimePool(), m_SpriteVertexBuffer, m_SpriteVertexMemory);
-        m_Buffers.CreateIndexBuffer(l_IndexData, m_Commands.GetOneTimePool(), m_SpriteIndexBuffer, m_SpriteIndexMemory, m_SpriteIndexCount);
+        m_Buffers.CreateVertexBuffer(l_VertexData, m_SpriteVertexBuffer, m_SpriteVertexMemory);
+        m_Buffers.CreateIndexBuffer(l_IndexData, m_SpriteIndexBuffer, m_SpriteIndexMemory, m_SpriteIndexCount);
 
         if (m_SpriteIndexCount == 0)
         {
@@ -2907,9 +3514,58 @@ namespace Trident
         }
     }
 
+    void Renderer::SetLodBias(float bias)
+    {
+        m_LodBias = std::clamp(bias, -4.0f, 4.0f);
+    }
+
+    uint32_t Renderer::SelectMeshLod(const MeshDrawInfo& drawInfo, const glm::mat4& modelMatrix, uint32_t currentLod, const glm::vec3& cameraPosition,
+        float projectionScale, bool orthographic) const
+    {
+        if (drawInfo.m_LodCount <= 1 || projectionScale <= 0.0f)
+        {
+            return 0;
+        }
+
+        const float l_Scale = std::max({ glm::length(glm::vec3(modelMatrix[0])), glm::length(glm::vec3(modelMatrix[1])), glm::length(glm::vec3(modelMatrix[2])) });
+        const glm::vec3 l_WorldCenter = glm::vec3(modelMatrix * glm::vec4(drawInfo.m_BoundsCenter, 1.0f));
+        float l_Distance = 1.0f;
+        if (!orthographic)
+        {
+            // Measure to the nearest point of the bounding sphere so large meshes refine before the camera reaches their centre.
+            l_Distance = glm::length(l_WorldCenter - cameraPosition) - drawInfo.m_BoundsRadius * l_Scale;
+            if (l_Distance <= 0.0f)
+            {
+                return 0;
+            }
+        }
+
+        auto a_ScreenError = [&](uint32_t level)
+            {
+                return drawInfo.m_Lods[level].m_Error * l_Scale * projectionScale / l_Distance;
+            };
+
+        const float l_Threshold = s_LodPixelErrorThreshold * std::exp2(m_LodBias);
+        uint32_t l_Level = std::min(currentLod, drawInfo.m_LodCount - 1);
+
+        // Refine only once the error clearly exceeds the budget and coarsen only once it is clearly below it.
+        while (l_Level > 0 && a_ScreenError(l_Level) > l_Threshold * (1.0f + s_LodHysteresis))
+        {
+            --l_Level;
+        }
+
+        while (l_Level + 1 < drawInfo.m_LodCount && a_ScreenError(l_Level + 1) <= l_Threshold * (1.0f - s_LodHysteresis))
+        {
+            ++l_Level;
+        }
+
+        return l_Level;
+    }
+
     void Renderer::GatherMeshDraws()
     {
         m_MeshDrawCommands.clear();
+        m_LodTrianglesSaved = 0;
 
         if (!m_Registry)
         {
@@ -2920,6 +3576,28 @@ namespace Trident
         // Reserve upfront so dynamic scenes with many meshes avoid repeated allocations.
         m_MeshDrawCommands.reserve(l_Entities.size());
 
+        // LODs are chosen once per frame against the active viewport's camera; secondary viewports reuse the same list.
+        const Camera* l_LodCamera = GetActiveCamera();
+        glm::vec3 l_CameraPosition{ 0.0f };
+        float l_ProjectionScale = 0.0f;
+        bool l_Orthographic = false;
+        if (l_LodCamera)
+        {
+            float l_ViewportHeight = static_cast<float>(m_Swapchain.GetExtent().height);
+            if (const ViewportContext* l_Context = FindViewportContext(m_ActiveViewportId))
+            {
+                if (l_Context->m_Target.m_Extent.height > 0)
+                {
+                    l_ViewportHeight = static_cast<float>(l_Context->m_Target.m_Extent.height);
+                }
+            }
+
+            // projection[1][1] maps view-space height to NDC; half the viewport converts it to pixels per world unit at unit depth.
+            l_CameraPosition = l_LodCamera->GetPosition();
+            l_ProjectionScale = std::abs(l_LodCamera->GetProjectionMatrix()[1][1]) * 0.5f * l_ViewportHeight;
+            l_Orthographic = l_LodCamera->GetProjectionType() == Camera::ProjectionType::Orthographic;
+        }
+
         for (ECS::Entity it_Entity : l_Entities)
         {
             if (!m_Registry->HasComponent<MeshComponent>(it_Entity))
@@ -2955,11 +3633,14 @@ namespace Trident
                 continue;
             }
 
-            glm::mat4 l_ModelMatrix{ 1.0f };
-            if (m_Registry->HasComponent<Transform>(it_Entity))
+            // The scene buffer caches the transform inputs, so only entities that moved are recomposed and re-uploaded.
+            const uint32_t l_SceneIndex = m_SceneBuffer.AcquireSlot(it_Entity);
+            const Transform l_Transform = m_Registry->HasComponent<Transform>(it_Entity) ? m_Registry->GetComponent<Transform>(it_Entity) : Transform{};
+            if (m_SceneBuffer.HasTransformChanged(l_SceneIndex, l_Transform))
             {
-                l_ModelMatrix = ComposeTransform(m_Registry->GetComponent<Transform>(it_Entity));
+                m_SceneBuffer.SetTransform(l_SceneIndex, l_Transform, ComposeTransform(l_Transform));
             }
+            const glm::mat4 l_ModelMatrix = m_SceneBuffer.GetWorldMatrix(l_SceneIndex);
 
             TextureComponent* l_TextureComponent = nullptr;
             if (m_Registry->HasComponent<TextureComponent>(it_Entity))
@@ -2981,6 +3662,10 @@ namespace Trident
                 l_AnimationComponent = &m_Registry->GetComponent<AnimationComponent>(it_Entity);
             }
 
+            const uint32_t l_LodLevel = SelectMeshLod(l_DrawInfo, l_ModelMatrix, l_MeshComponent.m_LodLevel, l_CameraPosition, l_ProjectionScale, l_Orthographic);
+            l_MeshComponent.m_LodLevel = l_LodLevel;
+            m_LodTrianglesSaved += (l_DrawInfo.m_Lods[0].m_IndexCount - l_DrawInfo.m_Lods[l_LodLevel].m_IndexCount) / 3;
+
             MeshDrawCommand l_Command{};
             l_Command.m_ModelMatrix = l_ModelMatrix;
             l_Command.m_Component = &l_MeshComponent;
@@ -2988,8 +3673,40 @@ namespace Trident
             l_Command.m_AnimationComponent = l_AnimationComponent;
             l_Command.m_BoneOffset = 0;
             l_Command.m_BoneCount = 0;
+            l_Command.m_LodLevel = l_LodLevel;
+            l_Command.m_SceneIndex = l_SceneIndex;
             l_Command.m_Entity = it_Entity;
             m_MeshDrawCommands.push_back(l_Command);
+
+            // Mirror the slot selection used when recording so residency follows what is actually sampled.
+            const bool l_HasMaterial = l_DrawInfo.m_MaterialIndex >= 0 && static_cast<size_t>(l_DrawInfo.m_MaterialIndex) < m_Materials.size();
+            int32_t l_TextureSlot = 0;
+            if (l_TextureComponent != nullptr && l_TextureComponent->m_TextureSlot >= 0)
+            {
+                l_TextureSlot = l_TextureComponent->m_TextureSlot;
+            }
+            else if (l_HasMaterial)
+            {
+                l_TextureSlot = m_Materials[l_DrawInfo.m_MaterialIndex].BaseColorTextureSlot;
+            }
+            MarkTextureSlotUsed(l_TextureSlot);
+
+            // Unchanged parameters are compared away inside the scene buffer and do not dirty the record.
+            SceneBuffer::DrawParameters l_Parameters{};
+            l_Parameters.m_ObjectBounds = glm::vec4(l_DrawInfo.m_BoundsCenter, l_DrawInfo.m_BoundsRadius);
+            l_Parameters.m_MaterialIndex = l_DrawInfo.m_MaterialIndex;
+            l_Parameters.m_TextureSlot = l_TextureSlot;
+            l_Parameters.m_FirstIndex = l_DrawInfo.m_Lods[l_LodLevel].m_FirstIndex;
+            l_Parameters.m_IndexCount = l_DrawInfo.m_Lods[l_LodLevel].m_IndexCount;
+            l_Parameters.m_BaseVertex = l_DrawInfo.m_BaseVertex;
+            m_SceneBuffer.SetDrawParameters(l_SceneIndex, l_Parameters);
+
+            // The shader reads these through the material record regardless of any base-color override.
+            if (l_HasMaterial)
+            {
+                MarkTextureSlotUsed(m_Materials[l_DrawInfo.m_MaterialIndex].MetallicRoughnessTextureSlot);
+                MarkTextureSlotUsed(m_Materials[l_DrawInfo.m_MaterialIndex].NormalTextureSlot);
+            }
         }
     }
 
@@ -3038,7 +3755,29 @@ namespace Trident
             l_Command.m_Entity = it_Entity;
 
             m_SpriteDrawList.push_back(l_Command);
+
+            if (l_TextureComponent != nullptr)
+            {
+                MarkTextureSlotUsed(l_TextureComponent->m_TextureSlot);
+            }
+        }
+    }
+
+    uint32_t Renderer::GetFramePipelineFeatures() const
+    {
+        // Zero strength blends nothing, so the cheaper permutation is picked instead of compiling in a no-op mix.
+        return IsAiBlendActive() && m_AiBlendStrength > 0.0f ? Pipeline::s_FeatureAiBlend : 0u;
+    }
+
+    uint32_t Renderer::GetMeshPipelineFeatures(int32_t materialIndex) const
+    {
+        uint32_t l_Features = GetFramePipelineFeatures() | Pipeline::s_FeatureSceneInstance;
+        if (materialIndex >= 0 && static_cast<size_t>(materialIndex) < m_Materials.size() && m_Materials[materialIndex].AlphaMask)
+        {
+            l_Features |= Pipeline::s_FeatureAlphaTest;
         }
+
+        return l_Features;
     }
 
     void Renderer::DrawSprites(VkCommandBuffer commandBuffer, uint32_t imageIndex)
@@ -3050,6 +3789,9 @@ namespace Trident
             return;
         }
 
+        // Sprites carry their transform in push constants rather than a scene buffer record.
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline.GetPipeline(GetFramePipelineFeatures()));
+
         VkBuffer l_VertexBuffers[] = { m_SpriteVertexBuffer };
         VkDeviceSize l_Offsets[] = { 0 };
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, l_VertexBuffers, l_Offsets);
@@ -3108,11 +3850,7 @@ namespace Trident
             return;
         }
 
-        if (!m_BonePaletteBuffers.empty() && m_ResourceFence != VK_NULL_HANDLE)
-        {
-            vkWaitForFences(Startup::GetDevice(), 1, &m_ResourceFence, VK_TRUE, UINT64_MAX);
-        }
-
+        // Frames in flight keep the old palettes until the timeline passes them; each set is repointed when its image is next recorded.
         for (size_t it_Index = 0; it_Index < m_BonePaletteBuffers.size(); ++it_Index)
         {
             m_Buffers.DestroyBuffer(m_BonePaletteBuffers[it_Index], (it_Index < m_BonePaletteMemory.size()) ? m_BonePaletteMemory[it_Index] : VK_NULL_HANDLE);
@@ -3131,38 +3869,68 @@ namespace Trident
         m_BonePaletteMatrixCapacity = l_TargetMatrices;
         m_BonePaletteBufferSize = l_TargetSize;
         m_BonePaletteScratch.resize(m_BonePaletteMatrixCapacity);
-
-        RefreshBonePaletteDescriptors();
+        ++m_BonePaletteGeneration;
     }
 
-    void Renderer::RefreshBonePaletteDescriptors()
+    void Renderer::RefreshBonePaletteDescriptor(uint32_t imageIndex)
     {
-        if (m_DescriptorSets.empty() || m_BonePaletteBuffers.empty() || m_BonePaletteBufferSize == 0)
+        // Like the scene buffer, only the image being recorded is repointed; other sets may still be read by frames in flight.
+        if (imageIndex >= m_DescriptorSets.size() || imageIndex >= m_BonePaletteDescriptorGenerations.size() || imageIndex >= m_BonePaletteBuffers.size()
+            || m_BonePaletteBufferSize == 0)
+        {
+            return;
+        }
+
+        if (m_BonePaletteDescriptorGenerations[imageIndex] == m_BonePaletteGeneration)
         {
             return;
         }
 
-        std::vector<VkDescriptorBufferInfo> l_BufferInfos(m_DescriptorSets.size());
-        std::vector<VkWriteDescriptorSet> l_Writes(m_DescriptorSets.size());
+        VkDescriptorBufferInfo l_Info{};
+        l_Info.buffer = m_BonePaletteBuffers[imageIndex];
+        l_Info.offset = 0;
+        l_Info.range = m_BonePaletteBufferSize;
 
-        for (size_t it_Index = 0; it_Index < m_DescriptorSets.size(); ++it_Index)
+        VkWriteDescriptorSet l_Write{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        l_Write.dstSet = m_DescriptorSets[imageIndex];
+        l_Write.dstBinding = 4;
+        l_Write.dstArrayElement = 0;
+        l_Write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_Write.descriptorCount = 1;
+        l_Write.pBufferInfo = &l_Info;
+        vkUpdateDescriptorSets(Startup::GetDevice(), 1, &l_Write, 0, nullptr);
+
+        m_BonePaletteDescriptorGenerations[imageIndex] = m_BonePaletteGeneration;
+    }
+
+    void Renderer::RefreshSceneBufferDescriptor(uint32_t imageIndex)
+    {
+        // Only this image's set is rewritten; the others keep the previous table until they are recorded again.
+        if (imageIndex >= m_DescriptorSets.size() || imageIndex >= m_SceneBufferDescriptorGenerations.size() || m_SceneBuffer.GetBuffer() == VK_NULL_HANDLE)
         {
-            VkDescriptorBufferInfo& l_Info = l_BufferInfos[it_Index];
-            l_Info.buffer = (it_Index < m_BonePaletteBuffers.size()) ? m_BonePaletteBuffers[it_Index] : VK_NULL_HANDLE;
-            l_Info.offset = 0;
-            l_Info.range = m_BonePaletteBufferSize;
+            return;
+        }
 
-            VkWriteDescriptorSet& l_Write = l_Writes[it_Index];
-            l_Write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-            l_Write.dstSet = m_DescriptorSets[it_Index];
-            l_Write.dstBinding = 4;
-            l_Write.dstArrayElement = 0;
-            l_Write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            l_Write.descriptorCount = 1;
-            l_Write.pBufferInfo = &l_BufferInfos[it_Index];
+        if (m_SceneBufferDescriptorGenerations[imageIndex] == m_SceneBuffer.GetGeneration())
+        {
+            return;
         }
 
-        vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+        VkDescriptorBufferInfo l_SceneInfo{};
+        l_SceneInfo.buffer = m_SceneBuffer.GetBuffer();
+        l_SceneInfo.offset = 0;
+        l_SceneInfo.range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet l_SceneWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        l_SceneWrite.dstSet = m_DescriptorSets[imageIndex];
+        l_SceneWrite.dstBinding = 5;
+        l_SceneWrite.dstArrayElement = 0;
+        l_SceneWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_SceneWrite.descriptorCount = 1;
+        l_SceneWrite.pBufferInfo = &l_SceneInfo;
+        vkUpdateDescriptorSets(Startup::GetDevice(), 1, &l_SceneWrite, 0, nullptr);
+
+        m_SceneBufferDescriptorGenerations[imageIndex] = m_SceneBuffer.GetGeneration();
     }
 
     void Renderer::PrepareBonePaletteBuffer(uint32_t imageIndex)
@@ -3200,9 +3968,15 @@ namespace Trident
             l_TotalMatrices += l_ClampedCount;
         }
 
-        if (l_TotalMatrices == 0)
+        // Palette offsets shift whenever skinned draws come and go, so the records are synced even when nothing is skinned.
+        for (const MeshDrawCommand& it_Command : m_MeshDrawCommands)
         {
-            return;
+            m_SceneBuffer.SetBoneRange(it_Command.m_SceneIndex, it_Command.m_BoneOffset, it_Command.m_BoneCount);
+        }
+
+        if (l_TotalMatrices == 0)
+        {
+            return;
         }
 
         EnsureSkinningBufferCapacity(l_TotalMatrices);
@@ -3244,6 +4018,85 @@ namespace Trident
         vkUnmapMemory(Startup::GetDevice(), m_BonePaletteMemory[imageIndex]);
     }
 
+    void Renderer::PrepareSkinning(VkCommandBuffer commandBuffer, uint32_t imageIndex)
+    {
+        m_SkinningPass.BeginFrame();
+
+        for (MeshDrawCommand& it_Command : m_MeshDrawCommands)
+        {
+            it_Command.m_SkinnedBaseVertex = -1;
+            if (it_Command.m_BoneCount == 0 || it_Command.m_Component == nullptr || it_Command.m_Component->m_MeshIndex >= m_MeshDrawInfo.size())
+            {
+                continue;
+            }
+
+            const MeshDrawInfo& l_DrawInfo = m_MeshDrawInfo[it_Command.m_Component->m_MeshIndex];
+            it_Command.m_SkinnedBaseVertex = static_cast<int32_t>(m_SkinningPass.QueueInstance(l_DrawInfo.m_BaseVertex, l_DrawInfo.m_VertexCount,
+                it_Command.m_BoneOffset, it_Command.m_BoneCount));
+        }
+
+        const VkBuffer l_BonePalette = imageIndex < m_BonePaletteBuffers.size() ? m_BonePaletteBuffers[imageIndex] : VK_NULL_HANDLE;
+        if (!m_SkinningPass.RecordSkinning(commandBuffer, imageIndex, m_VertexBuffer, l_BonePalette))
+        {
+            // Without skinned output the instances still draw, just in their bind pose from the shared buffer.
+            for (MeshDrawCommand& it_Command : m_MeshDrawCommands)
+            {
+                it_Command.m_SkinnedBaseVertex = -1;
+            }
+        }
+    }
+
+    void Renderer::PrepareClusterInstances(uint32_t imageIndex)
+    {
+        m_ClusterCuller.BeginFrame(imageIndex);
+
+        for (MeshDrawCommand& it_Command : m_MeshDrawCommands)
+        {
+            it_Command.m_ClusterCommandOffset = 0;
+            it_Command.m_ClusterCommandCount = 0;
+        }
+
+        if (!m_ClusterCullingEnabled || !m_ClusterCuller.IsReady())
+        {
+            m_ClusterCuller.UploadInstances(imageIndex);
+
+            return;
+        }
+
+        for (MeshDrawCommand& it_Command : m_MeshDrawCommands)
+        {
+            // Cluster bounds describe the bind pose, so skinned meshes keep their single indexed draw.
+            if (it_Command.m_BoneCount > 0 || it_Command.m_Component == nullptr)
+            {
+                continue;
+            }
+
+            const size_t l_MeshIndex = it_Command.m_Component->m_MeshIndex;
+            if (l_MeshIndex >= m_MeshDrawInfo.size())
+            {
+                continue;
+            }
+
+            // LOD0 uses its meshlets when it has them; every other case is culled as one cluster covering the selected LOD.
+            const MeshDrawInfo& l_DrawInfo = m_MeshDrawInfo[l_MeshIndex];
+            const bool l_UseMeshlets = it_Command.m_LodLevel == 0 && l_DrawInfo.m_ClusterCount > 0;
+            const uint32_t l_FirstCluster = l_UseMeshlets ? l_DrawInfo.m_FirstCluster : l_DrawInfo.m_LodClusters[it_Command.m_LodLevel];
+            const uint32_t l_ClusterCount = l_UseMeshlets ? l_DrawInfo.m_ClusterCount : 1u;
+
+            it_Command.m_ClusterCommandOffset = m_ClusterCuller.QueueInstance(static_cast<uint64_t>(it_Command.m_Entity), it_Command.m_ModelMatrix,
+                l_FirstCluster, l_ClusterCount, l_DrawInfo.m_BaseVertex);
+            it_Command.m_ClusterCommandCount = l_ClusterCount;
+        }
+
+        if (!m_ClusterCuller.UploadInstances(imageIndex))
+        {
+            for (MeshDrawCommand& it_Command : m_MeshDrawCommands)
+            {
+                it_Command.m_ClusterCommandCount = 0;
+            }
+        }
+    }
+
     void Renderer::RecreateSwapchain()
     {
         TR_CORE_TRACE("Recreating Swapchain");
@@ -3260,7 +4113,9 @@ namespace Trident
             Startup::GetWindow().GetFramebufferSize(l_Width, l_Height);
         }
 
-        vkDeviceWaitIdle(Startup::GetDevice());
+        // Swapchain images cannot be retired while presentation may still hold them, so this path keeps its idle.
+        Startup::WaitForDeviceIdle("swapchain recreation");
+        m_DeviceIdleExpected = true;
 
         m_Pipeline.CleanupFramebuffers();
 
@@ -3289,10 +4144,7 @@ namespace Trident
                 m_Buffers.DestroyBuffer(m_GlobalUniformBuffers[i], m_GlobalUniformBuffersMemory[i]);
             }
 
-            for (size_t i = 0; i < m_MaterialBuffers.size(); ++i)
-            {
-                m_Buffers.DestroyBuffer(m_MaterialBuffers[i], m_MaterialBuffersMemory[i]);
-            }
+            DestroyMaterialBuffers();
 
             if (!m_DescriptorSets.empty())
             {
@@ -3312,9 +4164,7 @@ namespace Trident
 
             m_GlobalUniformBuffers.clear();
             m_GlobalUniformBuffersMemory.clear();
-            m_MaterialBuffers.clear();
-            m_MaterialBuffersMemory.clear();
-            m_MaterialBufferDirty.clear();
+            m_MaterialDirtyRanges.clear();
 
             VkDeviceSize l_GlobalSize = sizeof(GlobalUniformBuffer);
 
@@ -3343,7 +4193,10 @@ namespace Trident
             if (l_ViewportExtent.width > 0 && l_ViewportExtent.height > 0)
             {
                 ViewportContext& l_MutableContext = GetOrCreateViewportContext(m_ActiveViewportId);
-                CreateOrResizeOffscreenResources(l_MutableContext.m_Target, l_ViewportExtent);
+                // Pooled targets were created against the previous swapchain format, so they cannot be reused.
+                ClearOffscreenTargetPool();
+                RetireOffscreenTarget(l_MutableContext.m_Target, true);
+                ApplyOffscreenExtent(l_MutableContext, l_ViewportExtent, true);
 
                 l_ReadbackExtent = l_ViewportExtent;
             }
@@ -3374,20 +4227,25 @@ namespace Trident
         VkDescriptorPoolSize l_PoolSizes[4]{};
         l_PoolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
         l_PoolSizes[0].descriptorCount = l_ImageCount * 2; // Global UBO for the main pipeline plus the skybox uniform.
-        l_PoolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        l_PoolSizes[1].descriptorCount = l_ImageCount; // Material uniform buffer bound once per swapchain image.
+        l_PoolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_PoolSizes[1].descriptorCount = l_ImageCount; // Material storage buffer bound once per swapchain image.
         l_PoolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        l_PoolSizes[2].descriptorCount = l_ImageCount; // Bone palette buffer updated once per swapchain image.
+        l_PoolSizes[2].descriptorCount = l_ImageCount * 2; // Bone palette and scene buffer bound once per swapchain image.
         l_PoolSizes[3].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
         // Each swapchain image consumes an array of material textures, an AI blend texture and a cubemap sampler in the main
         // set, plus a cubemap sampler in the dedicated skybox set. The text renderer also binds a combined image sampler once
         // per frame, so reserve an additional descriptor for that path.
-        l_PoolSizes[3].descriptorCount = l_ImageCount * (Pipeline::s_MaxMaterialTextures + 4);
+        l_PoolSizes[3].descriptorCount = l_ImageCount * (m_Pipeline.GetMaterialTextureCapacity() + 4);
 
         VkDescriptorPoolCreateInfo l_PoolInfo{};
         l_PoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         // We free and recreate descriptor sets whenever the swapchain is resized, so enable free-descriptor support.
         l_PoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        if (m_Pipeline.UsesBindlessTextures())
+        {
+            // The main layout is update-after-bind, and its sets can only come from a pool created for that.
+            l_PoolInfo.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        }
         l_PoolInfo.poolSizeCount = static_cast<uint32_t>(std::size(l_PoolSizes));
         l_PoolInfo.pPoolSizes = l_PoolSizes;
         // Main render pipeline + dedicated skybox descriptors + per-frame text descriptor sets.
@@ -3411,6 +4269,7 @@ namespace Trident
         }
         m_TextureSlots.clear();
         m_TextureSlotLookup.clear();
+        m_StreamingTextureSlots.clear();
 
         Loader::TextureData l_DefaultData{};
         l_DefaultData.Width = 1;
@@ -3429,7 +4288,6 @@ namespace Trident
         m_TextureSlots.push_back(std::move(l_DefaultSlot));
         m_TextureSlotLookup.emplace(kDefaultTextureKey, 0u);
 
-        EnsureTextureDescriptorCapacity();
         RefreshTextureDescriptorBindings();
 
         TR_CORE_TRACE("Default Texture Created");
@@ -3464,6 +4322,7 @@ namespace Trident
         }
 
         slot.m_Descriptor = {};
+        slot.m_ResidentBytes = 0;
     }
 
     bool Renderer::PopulateTextureSlot(TextureSlot& slot, const Loader::TextureData& textureData)
@@ -3476,29 +4335,142 @@ namespace Trident
         }
 
         VkDevice l_Device = Startup::GetDevice();
-        const VkDeviceSize l_ImageSize = static_cast<VkDeviceSize>(textureData.Pixels.size());
+        const VkFormat l_Format = textureData.Format;
+
+        struct UploadLevel
+        {
+            const unsigned char* m_Data = nullptr;
+            size_t m_Size = 0;
+            uint32_t m_Width = 0;
+            uint32_t m_Height = 0;
+        };
+
+        std::vector<UploadLevel> l_UploadLevels;
+        std::vector<Loader::TextureData> l_Levels;
+        uint32_t l_MipLevels = 1;
+        bool l_UseBlit = false;
+
+        if (!textureData.Mips.empty())
+        {
+            // Cooked textures ship their whole chain, so dropping top mips is just skipping levels.
+            uint32_t l_FirstLevel = 0;
+            while (l_FirstLevel < m_TextureMipDropCount && l_FirstLevel + 1 < textureData.Mips.size()
+                && std::max(textureData.Mips[l_FirstLevel].m_Width, textureData.Mips[l_FirstLevel].m_Height) > s_MinDroppedTextureSize)
+            {
+                ++l_FirstLevel;
+            }
+
+            for (size_t it_Level = l_FirstLevel; it_Level < textureData.Mips.size(); ++it_Level)
+            {
+                const Loader::TextureMipRegion& l_Region = textureData.Mips[it_Level];
+                if (l_Region.m_Offset + l_Region.m_Size > textureData.Pixels.size())
+                {
+                    TR_CORE_ERROR("Cooked texture level {} lies outside its pixel data", it_Level);
+                    return false;
+                }
+
+                l_UploadLevels.push_back({ textureData.Pixels.data() + l_Region.m_Offset, l_Region.m_Size, l_Region.m_Width, l_Region.m_Height });
+            }
+
+            l_MipLevels = static_cast<uint32_t>(l_UploadLevels.size());
+        }
+        else
+        {
+            // Dropping top mips halves the footprint per level; tiny textures are left intact because they are already cheap.
+            const Loader::TextureData* l_Base = &textureData;
+            for (uint32_t it_Drop = 0; it_Drop < m_TextureMipDropCount; ++it_Drop)
+            {
+                if (std::max(l_Base->Width, l_Base->Height) <= static_cast<int>(s_MinDroppedTextureSize))
+                {
+                    break;
+                }
+
+                Loader::TextureData l_Reduced = Loader::TextureLoader::Downsample(*l_Base);
+                if (l_Reduced.Pixels.empty())
+                {
+                    break;
+                }
+
+                l_Levels.clear();
+                l_Levels.push_back(std::move(l_Reduced));
+                l_Base = &l_Levels.front();
+            }
+
+            l_MipLevels = static_cast<uint32_t>(std::bit_width(static_cast<uint32_t>(std::max(l_Base->Width, l_Base->Height))));
+
+            // Blitting needs linear filtering and blit support on the optimal tiling; otherwise the chain is built on the CPU.
+            VkFormatProperties l_FormatProperties{};
+            vkGetPhysicalDeviceFormatProperties(Startup::GetPhysicalDevice(), l_Format, &l_FormatProperties);
+            constexpr VkFormatFeatureFlags l_BlitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+            l_UseBlit = (l_FormatProperties.optimalTilingFeatures & l_BlitFeatures) == l_BlitFeatures;
+
+            const uint32_t l_CpuLevels = l_UseBlit ? 1u : l_MipLevels;
+            // Reserve up front so pointers into l_Levels stay valid while the chain grows; re-point the base after the move.
+            l_Levels.reserve(l_Levels.size() + l_CpuLevels);
+            l_Base = l_Levels.empty() ? &textureData : &l_Levels.front();
+
+            const Loader::TextureData* l_Previous = l_Base;
+            l_UploadLevels.push_back({ l_Base->Pixels.data(), l_Base->Pixels.size(), static_cast<uint32_t>(l_Base->Width), static_cast<uint32_t>(l_Base->Height) });
+            for (uint32_t it_Level = 1; it_Level < l_CpuLevels; ++it_Level)
+            {
+                l_Levels.push_back(Loader::TextureLoader::Downsample(*l_Previous));
+                l_Previous = &l_Levels.back();
+                l_UploadLevels.push_back({ l_Previous->Pixels.data(), l_Previous->Pixels.size(), static_cast<uint32_t>(l_Previous->Width),
+                    static_cast<uint32_t>(l_Previous->Height) });
+            }
+        }
+
+        const uint32_t l_Width = l_UploadLevels.front().m_Width;
+        const uint32_t l_Height = l_UploadLevels.front().m_Height;
+
+        VkDeviceSize l_ImageSize = 0;
+        for (const UploadLevel& it_Level : l_UploadLevels)
+        {
+            l_ImageSize += static_cast<VkDeviceSize>(it_Level.m_Size);
+        }
 
         VkBuffer l_StagingBuffer = VK_NULL_HANDLE;
         VkDeviceMemory l_StagingMemory = VK_NULL_HANDLE;
         m_Buffers.CreateBuffer(l_ImageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, l_StagingBuffer, l_StagingMemory);
 
+        std::vector<VkBufferImageCopy> l_CopyRegions;
+        l_CopyRegions.reserve(l_UploadLevels.size());
+
+        // Block-compressed levels are copied as-is; bufferOffset stays a multiple of the block size because every level is whole blocks.
         void* l_Data = nullptr;
         vkMapMemory(l_Device, l_StagingMemory, 0, l_ImageSize, 0, &l_Data);
-        std::memcpy(l_Data, textureData.Pixels.data(), static_cast<size_t>(l_ImageSize));
+        VkDeviceSize l_StagingOffset = 0;
+        for (size_t it_Level = 0; it_Level < l_UploadLevels.size(); ++it_Level)
+        {
+            const UploadLevel& l_Level = l_UploadLevels[it_Level];
+            std::memcpy(static_cast<uint8_t*>(l_Data) + l_StagingOffset, l_Level.m_Data, l_Level.m_Size);
+
+            VkBufferImageCopy l_CopyRegion{};
+            l_CopyRegion.bufferOffset = l_StagingOffset;
+            l_CopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            l_CopyRegion.imageSubresource.mipLevel = static_cast<uint32_t>(it_Level);
+            l_CopyRegion.imageSubresource.baseArrayLayer = 0;
+            l_CopyRegion.imageSubresource.layerCount = 1;
+            l_CopyRegion.imageOffset = { 0, 0, 0 };
+            l_CopyRegion.imageExtent = { l_Level.m_Width, l_Level.m_Height, 1 };
+            l_CopyRegions.push_back(l_CopyRegion);
+
+            l_StagingOffset += static_cast<VkDeviceSize>(l_Level.m_Size);
+        }
         vkUnmapMemory(l_Device, l_StagingMemory);
 
         VkImageCreateInfo l_ImageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
         l_ImageInfo.imageType = VK_IMAGE_TYPE_2D;
-        l_ImageInfo.extent.width = static_cast<uint32_t>(std::max(textureData.Width, 1));
-        l_ImageInfo.extent.height = static_cast<uint32_t>(std::max(textureData.Height, 1));
+        l_ImageInfo.extent.width = l_Width;
+        l_ImageInfo.extent.height = l_Height;
         l_ImageInfo.extent.depth = 1;
-        l_ImageInfo.mipLevels = 1;
+        l_ImageInfo.mipLevels = l_MipLevels;
         l_ImageInfo.arrayLayers = 1;
-        l_ImageInfo.format = VK_FORMAT_R8G8B8A8_SRGB;
+        l_ImageInfo.format = l_Format;
         l_ImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
         l_ImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        l_ImageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        l_ImageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
         l_ImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         l_ImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
 
@@ -3527,145 +4499,580 @@ namespace Trident
 
         VkCommandBuffer l_CommandBuffer = m_Commands.BeginSingleTimeCommands();
 
-        VkImageMemoryBarrier l_BarrierToTransfer{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-        l_BarrierToTransfer.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        l_BarrierToTransfer.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        l_BarrierToTransfer.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        l_BarrierToTransfer.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        l_BarrierToTransfer.image = slot.m_Image;
-        l_BarrierToTransfer.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        l_BarrierToTransfer.subresourceRange.baseMipLevel = 0;
-        l_BarrierToTransfer.subresourceRange.levelCount = 1;
-        l_BarrierToTransfer.subresourceRange.baseArrayLayer = 0;
-        l_BarrierToTransfer.subresourceRange.layerCount = 1;
-        l_BarrierToTransfer.srcAccessMask = 0;
-        l_BarrierToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-        vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_BarrierToTransfer);
-
-        VkBufferImageCopy l_CopyRegion{};
-        l_CopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        l_CopyRegion.imageSubresource.mipLevel = 0;
-        l_CopyRegion.imageSubresource.baseArrayLayer = 0;
-        l_CopyRegion.imageSubresource.layerCount = 1;
-        l_CopyRegion.imageOffset = { 0, 0, 0 };
-        l_CopyRegion.imageExtent = { l_ImageInfo.extent.width, l_ImageInfo.extent.height, 1 };
-
-        vkCmdCopyBufferToImage(l_CommandBuffer, l_StagingBuffer, slot.m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &l_CopyRegion);
-
-        VkImageMemoryBarrier l_BarrierToShader{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-        l_BarrierToShader.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        l_BarrierToShader.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        l_BarrierToShader.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        l_BarrierToShader.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        l_BarrierToShader.image = slot.m_Image;
-        l_BarrierToShader.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        l_BarrierToShader.subresourceRange.baseMipLevel = 0;
-        l_BarrierToShader.subresourceRange.levelCount = 1;
-        l_BarrierToShader.subresourceRange.baseArrayLayer = 0;
-        l_BarrierToShader.subresourceRange.layerCount = 1;
-        l_BarrierToShader.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        l_BarrierToShader.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_BarrierToShader);
-
-        m_Commands.EndSingleTimeCommands(l_CommandBuffer);
+        VkImageMemoryBarrier l_Barrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        l_Barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        l_Barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        l_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.image = slot.m_Image;
+        l_Barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        l_Barrier.subresourceRange.baseMipLevel = 0;
+        l_Barrier.subresourceRange.levelCount = l_MipLevels;
+        l_Barrier.subresourceRange.baseArrayLayer = 0;
+        l_Barrier.subresourceRange.layerCount = 1;
+        l_Barrier.srcAccessMask = 0;
+        l_Barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+        vkCmdCopyBufferToImage(l_CommandBuffer, l_StagingBuffer, slot.m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(l_CopyRegions.size()),
+            l_CopyRegions.data());
+
+        uint32_t l_ReadyLevels = 0;
+        if (l_UseBlit)
+        {
+            // Each level is read as blit source once written, then handed to the fragment shader before the next one.
+            int32_t l_MipWidth = static_cast<int32_t>(l_Width);
+            int32_t l_MipHeight = static_cast<int32_t>(l_Height);
+            l_Barrier.subresourceRange.levelCount = 1;
+            for (uint32_t it_Level = 1; it_Level < l_MipLevels; ++it_Level)
+            {
+                l_Barrier.subresourceRange.baseMipLevel = it_Level - 1;
+                l_Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                l_Barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                l_Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                l_Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+                const int32_t l_NextWidth = std::max(l_MipWidth / 2, 1);
+                const int32_t l_NextHeight = std::max(l_MipHeight / 2, 1);
+
+                VkImageBlit l_Blit{};
+                l_Blit.srcOffsets[0] = { 0, 0, 0 };
+                l_Blit.srcOffsets[1] = { l_MipWidth, l_MipHeight, 1 };
+                l_Blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                l_Blit.srcSubresource.mipLevel = it_Level - 1;
+                l_Blit.srcSubresource.baseArrayLayer = 0;
+                l_Blit.srcSubresource.layerCount = 1;
+                l_Blit.dstOffsets[0] = { 0, 0, 0 };
+                l_Blit.dstOffsets[1] = { l_NextWidth, l_NextHeight, 1 };
+                l_Blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                l_Blit.dstSubresource.mipLevel = it_Level;
+                l_Blit.dstSubresource.baseArrayLayer = 0;
+                l_Blit.dstSubresource.layerCount = 1;
+                vkCmdBlitImage(l_CommandBuffer, slot.m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &l_Blit,
+                    VK_FILTER_LINEAR);
+
+                l_Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                l_Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                l_Barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                l_Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+                l_MipWidth = l_NextWidth;
+                l_MipHeight = l_NextHeight;
+            }
+
+            l_ReadyLevels = l_MipLevels - 1;
+        }
+
+        // Whatever is still in TRANSFER_DST (the last blitted level, or every uploaded level) moves to shader read.
+        l_Barrier.subresourceRange.baseMipLevel = l_ReadyLevels;
+        l_Barrier.subresourceRange.levelCount = l_MipLevels - l_ReadyLevels;
+        l_Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        l_Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        l_Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        l_Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+        // Draws that sample the slot are submitted after the upload on the same queue, so the copy is not waited on; from
+        // here on a failure retires the image instead of destroying it underneath the pending copy.
+        m_Commands.SubmitSingleTimeCommands(l_CommandBuffer);
 
         m_Buffers.DestroyBuffer(l_StagingBuffer, l_StagingMemory);
 
         VkImageViewCreateInfo l_ViewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
         l_ViewInfo.image = slot.m_Image;
         l_ViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        l_ViewInfo.format = VK_FORMAT_R8G8B8A8_SRGB;
+        l_ViewInfo.format = l_Format;
         l_ViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         l_ViewInfo.subresourceRange.baseMipLevel = 0;
-        l_ViewInfo.subresourceRange.levelCount = 1;
+        l_ViewInfo.subresourceRange.levelCount = l_MipLevels;
         l_ViewInfo.subresourceRange.baseArrayLayer = 0;
         l_ViewInfo.subresourceRange.layerCount = 1;
 
         if (vkCreateImageView(l_Device, &l_ViewInfo, nullptr, &slot.m_View) != VK_SUCCESS)
         {
-            DestroyTextureSlot(slot);
+            RetireTextureSlot(slot);
+            return false;
+        }
+
+        slot.m_MipLevels = l_MipLevels;
+        slot.m_ResidentBytes = l_MemoryRequirements.size;
+        if (!CreateTextureSampler(l_MipLevels, slot.m_Sampler))
+        {
+            RetireTextureSlot(slot);
             return false;
         }
 
-        VkSamplerCreateInfo l_SamplerInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
-        l_SamplerInfo.magFilter = VK_FILTER_LINEAR;
-        l_SamplerInfo.minFilter = VK_FILTER_LINEAR;
-        l_SamplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        l_SamplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        l_SamplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        l_SamplerInfo.anisotropyEnable = VK_FALSE;
-        l_SamplerInfo.maxAnisotropy = 1.0f;
-        l_SamplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_WHITE;
-        l_SamplerInfo.unnormalizedCoordinates = VK_FALSE;
-        l_SamplerInfo.compareEnable = VK_FALSE;
-        l_SamplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
-        l_SamplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-        l_SamplerInfo.mipLodBias = 0.0f;
-        l_SamplerInfo.minLod = 0.0f;
-        l_SamplerInfo.maxLod = 0.0f;
+        slot.m_Descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        slot.m_Descriptor.imageView = slot.m_View;
+        slot.m_Descriptor.sampler = slot.m_Sampler;
+
+        return true;
+    }
+
+    bool Renderer::CreateTextureSampler(uint32_t mipLevels, VkSampler& sampler) const
+    {
+        VkPhysicalDeviceProperties l_Properties{};
+        vkGetPhysicalDeviceProperties(Startup::GetPhysicalDevice(), &l_Properties);
+        const float l_Anisotropy = std::min(m_TextureAnisotropy, l_Properties.limits.maxSamplerAnisotropy);
+        const bool l_UseAnisotropy = Startup::SupportsSamplerAnisotropy() && l_Anisotropy > 1.0f;
+
+        VkSamplerCreateInfo l_SamplerInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+        l_SamplerInfo.magFilter = VK_FILTER_LINEAR;
+        l_SamplerInfo.minFilter = VK_FILTER_LINEAR;
+        l_SamplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        l_SamplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        l_SamplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        l_SamplerInfo.anisotropyEnable = l_UseAnisotropy ? VK_TRUE : VK_FALSE;
+        l_SamplerInfo.maxAnisotropy = l_UseAnisotropy ? l_Anisotropy : 1.0f;
+        l_SamplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_WHITE;
+        l_SamplerInfo.unnormalizedCoordinates = VK_FALSE;
+        l_SamplerInfo.compareEnable = VK_FALSE;
+        l_SamplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+        l_SamplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        l_SamplerInfo.mipLodBias = 0.0f;
+        l_SamplerInfo.minLod = 0.0f;
+        l_SamplerInfo.maxLod = static_cast<float>(mipLevels);
+
+        return vkCreateSampler(Startup::GetDevice(), &l_SamplerInfo, nullptr, &sampler) == VK_SUCCESS;
+    }
+
+    void Renderer::SetTextureAnisotropy(float anisotropy)
+    {
+        const float l_Anisotropy = std::clamp(anisotropy, 1.0f, s_MaxTextureAnisotropy);
+        if (l_Anisotropy == m_TextureAnisotropy)
+        {
+            return;
+        }
+
+        m_TextureAnisotropy = l_Anisotropy;
+        if (m_TextureSlots.empty())
+        {
+            return;
+        }
+
+        // Samplers are immutable, so every slot gets a fresh one. In-flight frames keep the old ones until they retire, and each
+        // image's descriptor set picks up the new samplers when it is next acquired.
+        for (TextureSlot& it_Slot : m_TextureSlots)
+        {
+            if (it_Slot.m_View == VK_NULL_HANDLE)
+            {
+                continue;
+            }
+
+            VkSampler l_Sampler = VK_NULL_HANDLE;
+            if (!CreateTextureSampler(it_Slot.m_MipLevels, l_Sampler))
+            {
+                TR_CORE_WARN("Failed to rebuild sampler for texture '{}'; keeping the previous filtering", it_Slot.m_SourcePath);
+                continue;
+            }
+
+            const VkSampler l_Retired = it_Slot.m_Sampler;
+            m_Buffers.Retire([l_Retired]()
+                {
+                    vkDestroySampler(Startup::GetDevice(), l_Retired, nullptr);
+                });
+            it_Slot.m_Sampler = l_Sampler;
+            it_Slot.m_Descriptor.sampler = l_Sampler;
+        }
+
+        MarkTextureDescriptorsDirty();
+    }
+
+    void Renderer::SetTextureMipDropCount(uint32_t count)
+    {
+        m_TextureMipDropCount = std::min(count, s_MaxTextureMipDropCount);
+    }
+
+    void Renderer::SetTextureMemoryBudget(uint64_t bytes)
+    {
+        m_TextureMemoryBudget = bytes;
+        QueryTextureMemoryBudget(m_TextureResidencyStats.m_ResidentBytes);
+    }
+
+    void Renderer::RefreshTextureDescriptorBindings()
+    {
+        if (m_DescriptorSets.empty())
+        {
+            return;
+        }
+
+        if (m_TextureSlots.empty())
+        {
+            TR_CORE_WARN("Texture descriptor refresh skipped because no slots were initialised");
+            return;
+        }
+
+        MarkTextureDescriptorsDirty();
+        for (uint32_t it_Image = 0; it_Image < m_DescriptorSets.size(); ++it_Image)
+        {
+            FlushTextureDescriptorSet(it_Image);
+        }
+    }
+
+    void Renderer::MarkTextureDescriptorsDirty()
+    {
+        m_TextureDescriptorDirty.assign(m_DescriptorSets.size(), true);
+        m_TextureDescriptorUpdates.resize(m_DescriptorSets.size());
+    }
+
+    void Renderer::MarkTextureSlotDirty(uint32_t slotIndex)
+    {
+        // Sets that have not been flushed yet are rewritten in full, so only per-image lists that already exist are extended.
+        for (std::vector<uint32_t>& it_Updates : m_TextureDescriptorUpdates)
+        {
+            it_Updates.push_back(slotIndex);
+        }
+
+        // Every residency change rewrites the slot's descriptor, so this also catches uploads, evictions and reloads.
+        m_TextureResidencyChanges.push_back(slotIndex);
+    }
+
+    void Renderer::FlushTextureDescriptorSet(uint32_t imageIndex)
+    {
+        if (imageIndex >= m_DescriptorSets.size() || m_TextureSlots.empty())
+        {
+            return;
+        }
+
+        if (m_TextureDescriptorDirty.size() != m_DescriptorSets.size())
+        {
+            MarkTextureDescriptorsDirty();
+        }
+
+        const uint32_t l_Capacity = m_Pipeline.GetMaterialTextureCapacity();
+        std::vector<uint32_t>& l_Updates = m_TextureDescriptorUpdates[imageIndex];
+        if (m_TextureDescriptorDirty[imageIndex])
+        {
+            // Bindless arrays are partially bound, so only live slots need descriptors; the fixed array is filled completely.
+            const uint32_t l_Count = m_Pipeline.UsesBindlessTextures() ? std::min(static_cast<uint32_t>(m_TextureSlots.size()), l_Capacity) : l_Capacity;
+            l_Updates.resize(l_Count);
+            std::iota(l_Updates.begin(), l_Updates.end(), 0u);
+            m_TextureDescriptorDirty[imageIndex] = false;
+        }
+        else if (l_Updates.empty())
+        {
+            return;
+        }
+        else
+        {
+            std::sort(l_Updates.begin(), l_Updates.end());
+            l_Updates.erase(std::unique(l_Updates.begin(), l_Updates.end()), l_Updates.end());
+            l_Updates.erase(std::lower_bound(l_Updates.begin(), l_Updates.end(), l_Capacity), l_Updates.end());
+        }
+
+        // Every image info is gathered before the writes point into the cache, so it is never reallocated underneath them.
+        m_TextureDescriptorCache.resize(l_Updates.size());
+        m_TextureDescriptorWrites.clear();
+
+        // Slots waiting on a streamed upload or evicted under memory pressure have no view and sample the default texture.
+        const VkDescriptorImageInfo l_DefaultDescriptor = m_TextureSlots.front().m_Descriptor;
+        for (size_t it_Update = 0; it_Update < l_Updates.size(); ++it_Update)
+        {
+            const uint32_t l_SlotIndex = l_Updates[it_Update];
+            const bool l_Resident = l_SlotIndex < m_TextureSlots.size() && m_TextureSlots[l_SlotIndex].m_View != VK_NULL_HANDLE;
+            m_TextureDescriptorCache[it_Update] = l_Resident ? m_TextureSlots[l_SlotIndex].m_Descriptor : l_DefaultDescriptor;
+
+            // Consecutive slots share a single write, so a full refresh is still one write.
+            if (it_Update > 0 && l_SlotIndex == l_Updates[it_Update - 1] + 1)
+            {
+                ++m_TextureDescriptorWrites.back().descriptorCount;
+                continue;
+            }
+
+            VkWriteDescriptorSet l_TextureWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            l_TextureWrite.dstSet = m_DescriptorSets[imageIndex];
+            l_TextureWrite.dstBinding = 6;
+            l_TextureWrite.dstArrayElement = l_SlotIndex;
+            l_TextureWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            l_TextureWrite.descriptorCount = 1;
+            l_TextureWrite.pImageInfo = m_TextureDescriptorCache.data() + it_Update;
+            m_TextureDescriptorWrites.push_back(l_TextureWrite);
+        }
+
+        if (!m_TextureDescriptorWrites.empty())
+        {
+            vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(m_TextureDescriptorWrites.size()), m_TextureDescriptorWrites.data(), 0, nullptr);
+        }
+        l_Updates.clear();
+    }
+
+    void Renderer::ApplyStreamedTextures()
+    {
+        if (!m_TextureStreamer.IsEnabled())
+        {
+            return;
+        }
+
+        std::vector<TextureStreamer::StreamedTexture> l_Completed;
+        m_TextureStreamer.Update(l_Completed);
+
+        for (TextureStreamer::StreamedTexture& it_Texture : l_Completed)
+        {
+            auto a_Pending = m_StreamingTextureSlots.find(it_Texture.m_Ticket);
+            if (a_Pending == m_StreamingTextureSlots.end() || a_Pending->second >= m_TextureSlots.size()
+                || m_TextureSlots[a_Pending->second].m_StreamTicket != it_Texture.m_Ticket)
+            {
+                // The slot was reset or hot-reloaded while the upload was in flight.
+                if (a_Pending != m_StreamingTextureSlots.end())
+                {
+                    m_StreamingTextureSlots.erase(a_Pending);
+                }
+                m_TextureStreamer.Discard(it_Texture);
+                continue;
+            }
+
+            const uint32_t l_SlotIndex = a_Pending->second;
+            TextureSlot& l_Slot = m_TextureSlots[l_SlotIndex];
+            m_StreamingTextureSlots.erase(a_Pending);
+            l_Slot.m_StreamTicket = 0;
+            // A failed reload is not retried on every draw; the slot keeps whatever it showed before.
+            l_Slot.m_Evicted = false;
+
+            if (it_Texture.m_Image == VK_NULL_HANDLE)
+            {
+                TR_CORE_WARN("Failed to stream texture '{}'. Keeping its current contents.", l_Slot.m_SourcePath.c_str());
+                continue;
+            }
+
+            // Residency changes replace a texture that is still bound, so its handles outlive the frames that may sample them.
+            RetireTextureSlot(l_Slot);
+            MarkTextureSlotDirty(l_SlotIndex);
+            l_Slot.m_Image = it_Texture.m_Image;
+            l_Slot.m_Memory = it_Texture.m_Memory;
+            l_Slot.m_View = it_Texture.m_View;
+            l_Slot.m_MipLevels = it_Texture.m_MipLevels;
+            l_Slot.m_ResidentBytes = it_Texture.m_Bytes;
+            l_Slot.m_ResidencyMipDrop = l_Slot.m_RequestedMipDrop;
+            if (!CreateTextureSampler(l_Slot.m_MipLevels, l_Slot.m_Sampler))
+            {
+                TR_CORE_WARN("Failed to create a sampler for streamed texture '{}'. Using the default slot instead.", l_Slot.m_SourcePath.c_str());
+                DestroyTextureSlot(l_Slot);
+                continue;
+            }
+
+            l_Slot.m_Descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            l_Slot.m_Descriptor.imageView = l_Slot.m_View;
+            l_Slot.m_Descriptor.sampler = l_Slot.m_Sampler;
+        }
+    }
+
+    void Renderer::MarkTextureSlotUsed(int32_t slotIndex)
+    {
+        // Slot 0 is the default texture and always stays resident.
+        if (slotIndex <= 0 || static_cast<size_t>(slotIndex) >= m_TextureSlots.size())
+        {
+            return;
+        }
+
+        TextureSlot& l_Slot = m_TextureSlots[slotIndex];
+        l_Slot.m_LastUsedTime = m_TextureResidencyTime;
+        if (l_Slot.m_Evicted && l_Slot.m_StreamTicket == 0)
+        {
+            // The draw samples the default texture this frame and picks the real one up once the upload retires.
+            RestreamTextureSlot(static_cast<uint32_t>(slotIndex), 0);
+        }
+    }
+
+    void Renderer::RestreamTextureSlot(uint32_t slotIndex, uint32_t residencyMipDrop)
+    {
+        TextureSlot& l_Slot = m_TextureSlots[slotIndex];
+        l_Slot.m_RequestedMipDrop = residencyMipDrop;
+        l_Slot.m_StreamTicket = m_TextureStreamer.Request(l_Slot.m_SourcePath, m_TextureMipDropCount + residencyMipDrop, s_MinDroppedTextureSize, l_Slot.m_Linear);
+        m_StreamingTextureSlots.emplace(l_Slot.m_StreamTicket, slotIndex);
+    }
 
-        if (vkCreateSampler(l_Device, &l_SamplerInfo, nullptr, &slot.m_Sampler) != VK_SUCCESS)
+    void Renderer::RetireTextureSlot(TextureSlot& slot)
+    {
+        if (slot.m_Image == VK_NULL_HANDLE && slot.m_View == VK_NULL_HANDLE && slot.m_Sampler == VK_NULL_HANDLE && slot.m_Memory == VK_NULL_HANDLE)
         {
-            DestroyTextureSlot(slot);
-            return false;
+            return;
         }
 
-        slot.m_Descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        slot.m_Descriptor.imageView = slot.m_View;
-        slot.m_Descriptor.sampler = slot.m_Sampler;
+        // Frames already submitted may still sample the view, so the handles are released once the timeline passes them.
+        // Callers mark the slot dirty, so each image's set is rewritten before that image is recorded again.
+        TextureSlot l_Retired{};
+        l_Retired.m_Image = slot.m_Image;
+        l_Retired.m_Memory = slot.m_Memory;
+        l_Retired.m_View = slot.m_View;
+        l_Retired.m_Sampler = slot.m_Sampler;
+        m_Buffers.Retire([this, l_Retired]() mutable
+            {
+                DestroyTextureSlot(l_Retired);
+            });
 
-        return true;
+        slot.m_Image = VK_NULL_HANDLE;
+        slot.m_Memory = VK_NULL_HANDLE;
+        slot.m_View = VK_NULL_HANDLE;
+        slot.m_Sampler = VK_NULL_HANDLE;
+        slot.m_Descriptor = {};
+        slot.m_ResidentBytes = 0;
     }
 
-    void Renderer::EnsureTextureDescriptorCapacity()
+    void Renderer::QueryTextureMemoryBudget(uint64_t residentBytes)
     {
-        if (m_TextureDescriptorCache.size() != Pipeline::s_MaxMaterialTextures)
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT l_HeapBudgets{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT };
+        VkPhysicalDeviceMemoryProperties2 l_MemoryProperties{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2 };
+        l_MemoryProperties.pNext = Startup::SupportsMemoryBudget() ? &l_HeapBudgets : nullptr;
+        vkGetPhysicalDeviceMemoryProperties2(Startup::GetPhysicalDevice(), &l_MemoryProperties);
+
+        uint64_t l_HeapSize = 0;
+        uint64_t l_HeapBudget = 0;
+        uint64_t l_HeapUsage = 0;
+        for (uint32_t it_Heap = 0; it_Heap < l_MemoryProperties.memoryProperties.memoryHeapCount; ++it_Heap)
+        {
+            if ((l_MemoryProperties.memoryProperties.memoryHeaps[it_Heap].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) == 0)
+            {
+                continue;
+            }
+
+            l_HeapSize += l_MemoryProperties.memoryProperties.memoryHeaps[it_Heap].size;
+            l_HeapBudget += l_HeapBudgets.heapBudget[it_Heap];
+            l_HeapUsage += l_HeapBudgets.heapUsage[it_Heap];
+        }
+
+        uint64_t l_Budget = m_TextureMemoryBudget != 0 ? m_TextureMemoryBudget : l_HeapSize / 2;
+        bool l_DriverBudget = false;
+        if (Startup::SupportsMemoryBudget() && l_HeapBudget > 0)
         {
-            m_TextureDescriptorCache.resize(Pipeline::s_MaxMaterialTextures);
+            // Usage already counts resident textures. A tenth of the heap budget stays free for render targets and buffers.
+            const uint64_t l_Reserve = l_HeapBudget / 10;
+            const uint64_t l_Available = l_HeapBudget > l_HeapUsage + l_Reserve ? l_HeapBudget - l_HeapUsage - l_Reserve : 0;
+            if (residentBytes + l_Available < l_Budget)
+            {
+                l_Budget = residentBytes + l_Available;
+                l_DriverBudget = true;
+            }
         }
+
+        m_TextureResidencyStats.m_BudgetBytes = l_Budget;
+        m_TextureResidencyStats.m_DriverBudget = l_DriverBudget;
     }
 
-    void Renderer::RefreshTextureDescriptorBindings()
+    void Renderer::UpdateTextureResidency()
     {
-        if (m_DescriptorSets.empty())
+        m_TextureResidencyTime = std::chrono::steady_clock::now();
+
+        uint64_t l_ResidentBytes = 0;
+        for (const TextureSlot& it_Slot : m_TextureSlots)
         {
-            return;
+            l_ResidentBytes += it_Slot.m_ResidentBytes;
         }
 
-        if (m_TextureSlots.empty())
+        if (m_TextureResidencyStats.m_BudgetBytes == 0 || m_TextureResidencyTime - m_TextureBudgetQueryTime >= s_TextureBudgetQueryInterval)
         {
-            TR_CORE_WARN("Texture descriptor refresh skipped because no slots were initialised");
-            return;
+            QueryTextureMemoryBudget(l_ResidentBytes);
+            m_TextureBudgetQueryTime = m_TextureResidencyTime;
         }
 
-        EnsureTextureDescriptorCapacity();
-
-        const VkDescriptorImageInfo l_DefaultDescriptor = m_TextureSlots.front().m_Descriptor;
-        for (uint32_t it_Index = 0; it_Index < Pipeline::s_MaxMaterialTextures; ++it_Index)
+        // Eviction and mip dropping rely on streaming the texture back in, so the synchronous fallback keeps everything resident.
+        const uint64_t l_Budget = m_TextureResidencyStats.m_BudgetBytes;
+        if (m_TextureStreamer.IsEnabled() && m_TextureSlots.size() > 1)
         {
-            if (it_Index < m_TextureSlots.size())
+            // Least recently used first; slot 0 is the default texture and slots with an upload in flight are left alone.
+            std::vector<uint32_t> l_Candidates;
+            l_Candidates.reserve(m_TextureSlots.size());
+            uint64_t l_PendingSavings = 0;
+            bool l_RestorePending = false;
+            for (uint32_t it_Index = 1; it_Index < m_TextureSlots.size(); ++it_Index)
+            {
+                const TextureSlot& l_Slot = m_TextureSlots[it_Index];
+                if (l_Slot.m_View != VK_NULL_HANDLE && l_Slot.m_StreamTicket == 0)
+                {
+                    l_Candidates.push_back(it_Index);
+                }
+                else if (l_Slot.m_View != VK_NULL_HANDLE && l_Slot.m_RequestedMipDrop > l_Slot.m_ResidencyMipDrop)
+                {
+                    // Reductions still in flight already count towards the budget, otherwise every frame would drop more.
+                    l_PendingSavings += l_Slot.m_ResidentBytes - l_Slot.m_ResidentBytes / 4;
+                }
+                else if (l_Slot.m_View != VK_NULL_HANDLE && l_Slot.m_RequestedMipDrop < l_Slot.m_ResidencyMipDrop)
+                {
+                    l_RestorePending = true;
+                }
+            }
+            std::sort(l_Candidates.begin(), l_Candidates.end(), [this](uint32_t lhs, uint32_t rhs)
+                {
+                    return m_TextureSlots[lhs].m_LastUsedTime < m_TextureSlots[rhs].m_LastUsedTime;
+                });
+
+            if (l_ResidentBytes > l_Budget)
             {
-                m_TextureDescriptorCache[it_Index] = m_TextureSlots[it_Index].m_Descriptor;
+                uint64_t l_ProjectedBytes = l_ResidentBytes - std::min(l_PendingSavings, l_ResidentBytes);
+                for (uint32_t it_Index : l_Candidates)
+                {
+                    if (l_ProjectedBytes <= l_Budget)
+                    {
+                        break;
+                    }
+
+                    TextureSlot& l_Slot = m_TextureSlots[it_Index];
+                    if (m_TextureResidencyTime - l_Slot.m_LastUsedTime >= s_TextureIdleTime)
+                    {
+                        l_ProjectedBytes -= l_Slot.m_ResidentBytes;
+                        RetireTextureSlot(l_Slot);
+                        MarkTextureSlotDirty(it_Index);
+                        l_Slot.m_Evicted = true;
+                        l_Slot.m_ResidencyMipDrop = 0;
+                        ++m_WindowEvictions;
+                    }
+                    else if (l_Slot.m_ResidencyMipDrop < s_MaxResidencyMipDrop && l_Slot.m_MipLevels > static_cast<uint32_t>(std::bit_width(s_MinDroppedTextureSize)))
+                    {
+                        // Still in use, so keep it bound and swap in a copy without its top mip once that upload retires.
+                        l_ProjectedBytes -= l_Slot.m_ResidentBytes - l_Slot.m_ResidentBytes / 4;
+                        RestreamTextureSlot(it_Index, l_Slot.m_ResidencyMipDrop + 1);
+                        ++m_WindowMipDrops;
+                    }
+                }
             }
             else
             {
-                m_TextureDescriptorCache[it_Index] = l_DefaultDescriptor;
+                // Restore one reduced texture at a time, most recently used first, while the larger copy still fits comfortably.
+                const uint64_t l_RestoreLimit = static_cast<uint64_t>(static_cast<double>(l_Budget) * s_TextureRestoreThreshold);
+                for (auto it_Candidate = l_Candidates.rbegin(); !l_RestorePending && it_Candidate != l_Candidates.rend(); ++it_Candidate)
+                {
+                    const TextureSlot& l_Slot = m_TextureSlots[*it_Candidate];
+                    if (l_Slot.m_ResidencyMipDrop == 0 || m_TextureResidencyTime - l_Slot.m_LastUsedTime >= s_TextureIdleTime)
+                    {
+                        continue;
+                    }
+
+                    // Restoring one mip roughly quadruples the footprint, and the old image stays resident until the swap.
+                    if (l_PendingSavings == 0 && l_ResidentBytes + l_Slot.m_ResidentBytes * 4 <= l_RestoreLimit)
+                    {
+                        RestreamTextureSlot(*it_Candidate, l_Slot.m_ResidencyMipDrop - 1);
+                    }
+                    break;
+                }
             }
         }
 
-        for (VkDescriptorSet l_Set : m_DescriptorSets)
+        TextureResidencyStats& l_Stats = m_TextureResidencyStats;
+        l_Stats.m_ResidentBytes = 0;
+        l_Stats.m_ResidentTextures = 0;
+        l_Stats.m_ReducedTextures = 0;
+        l_Stats.m_EvictedTextures = 0;
+        for (const TextureSlot& it_Slot : m_TextureSlots)
         {
-            VkWriteDescriptorSet l_TextureWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-            l_TextureWrite.dstSet = l_Set;
-            l_TextureWrite.dstBinding = 2;
-            l_TextureWrite.dstArrayElement = 0;
-            l_TextureWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-            l_TextureWrite.descriptorCount = Pipeline::s_MaxMaterialTextures;
-            l_TextureWrite.pImageInfo = m_TextureDescriptorCache.data();
+            l_Stats.m_ResidentBytes += it_Slot.m_ResidentBytes;
+            l_Stats.m_ResidentTextures += it_Slot.m_View != VK_NULL_HANDLE ? 1u : 0u;
+            l_Stats.m_ReducedTextures += it_Slot.m_View != VK_NULL_HANDLE && it_Slot.m_ResidencyMipDrop > 0 ? 1u : 0u;
+            l_Stats.m_EvictedTextures += it_Slot.m_Evicted ? 1u : 0u;
+        }
+        l_Stats.m_HeadroomBytes = static_cast<int64_t>(l_Stats.m_BudgetBytes) - static_cast<int64_t>(l_Stats.m_ResidentBytes);
 
-            vkUpdateDescriptorSets(Startup::GetDevice(), 1, &l_TextureWrite, 0, nullptr);
+        const auto l_Now = m_TextureResidencyTime;
+        const double l_WindowSeconds = std::chrono::duration<double>(l_Now - m_ResidencyWindowStart).count();
+        if (l_WindowSeconds >= 1.0)
+        {
+            l_Stats.m_EvictionsPerSecond = static_cast<double>(m_WindowEvictions) / l_WindowSeconds;
+            l_Stats.m_MipDropsPerSecond = static_cast<double>(m_WindowMipDrops) / l_WindowSeconds;
+            m_WindowEvictions = 0;
+            m_WindowMipDrops = 0;
+            m_ResidencyWindowStart = l_Now;
         }
     }
 
@@ -3684,14 +5091,7 @@ namespace Trident
             return static_cast<int32_t>(a_Existing->second);
         }
 
-        // Load the texture data on demand; the renderer caches GPU uploads so subsequent resolves are inexpensive.
-        Loader::TextureData l_TextureData = Loader::TextureLoader::Load(l_NormalizedPath);
-        const uint32_t l_SlotIndex = AcquireTextureSlot(l_NormalizedPath, l_TextureData);
-        // Refresh descriptor arrays so any new slot becomes available to materials and push constants immediately.
-        RefreshTextureDescriptorBindings();
-
-        // Future follow-up: detect when no new slot was created and skip the descriptor refresh to save CPU work.
-        return static_cast<int32_t>(l_SlotIndex);
+        return static_cast<int32_t>(RequestTextureSlot(l_NormalizedPath, false));
     }
 
     std::string Renderer::NormalizeTexturePath(const std::string& texturePath) const
@@ -3704,22 +5104,23 @@ namespace Trident
         return Utilities::FileManagement::NormalizePath(texturePath);
     }
 
-    uint32_t Renderer::AcquireTextureSlot(const std::string& normalizedPath, const Loader::TextureData& textureData)
+    uint32_t Renderer::AcquireTextureSlot(const std::string& normalizedPath, const Loader::TextureData& textureData, bool linear)
     {
         if (normalizedPath.empty())
         {
             return 0;
         }
 
-        auto a_Existing = m_TextureSlotLookup.find(normalizedPath);
+        const std::string l_Key = GetTextureSlotKey(normalizedPath, linear);
+        auto a_Existing = m_TextureSlotLookup.find(l_Key);
         if (a_Existing != m_TextureSlotLookup.end())
         {
             return a_Existing->second;
         }
 
-        if (m_TextureSlots.size() >= Pipeline::s_MaxMaterialTextures)
+        if (m_TextureSlots.size() >= m_Pipeline.GetMaterialTextureCapacity())
         {
-            TR_CORE_WARN("Material texture budget ({}) exhausted. {} will fall back to the default slot.", Pipeline::s_MaxMaterialTextures, normalizedPath.c_str());
+            TR_CORE_WARN("Material texture budget ({}) exhausted. {} will fall back to the default slot.", m_Pipeline.GetMaterialTextureCapacity(), normalizedPath.c_str());
         }
         else if (!textureData.Pixels.empty())
         {
@@ -3727,9 +5128,12 @@ namespace Trident
             if (PopulateTextureSlot(l_NewSlot, textureData))
             {
                 l_NewSlot.m_SourcePath = normalizedPath;
+                l_NewSlot.m_LastUsedTime = m_TextureResidencyTime;
+                l_NewSlot.m_Linear = linear;
                 m_TextureSlots.push_back(std::move(l_NewSlot));
                 const uint32_t l_NewIndex = static_cast<uint32_t>(m_TextureSlots.size() - 1);
-                m_TextureSlotLookup.emplace(normalizedPath, l_NewIndex);
+                m_TextureSlotLookup.emplace(l_Key, l_NewIndex);
+                MarkTextureSlotDirty(l_NewIndex);
                 return l_NewIndex;
             }
 
@@ -3740,10 +5144,53 @@ namespace Trident
             TR_CORE_WARN("Texture '{}' provided no pixel data. Using the default slot instead.", normalizedPath.c_str());
         }
 
-        m_TextureSlotLookup.emplace(normalizedPath, 0u);
+        m_TextureSlotLookup.emplace(l_Key, 0u);
         return 0;
     }
 
+    uint32_t Renderer::RequestTextureSlot(const std::string& normalizedPath, bool linear)
+    {
+        if (normalizedPath.empty())
+        {
+            return 0;
+        }
+
+        const std::string l_Key = GetTextureSlotKey(normalizedPath, linear);
+        auto a_Existing = m_TextureSlotLookup.find(l_Key);
+        if (a_Existing != m_TextureSlotLookup.end())
+        {
+            return a_Existing->second;
+        }
+
+        if (!m_TextureStreamer.IsEnabled())
+        {
+            return AcquireTextureSlot(normalizedPath, Loader::TextureLoader::Load(normalizedPath, linear), linear);
+        }
+
+        if (m_TextureSlots.size() >= m_Pipeline.GetMaterialTextureCapacity())
+        {
+            TR_CORE_WARN("Material texture budget ({}) exhausted. {} will fall back to the default slot.", m_Pipeline.GetMaterialTextureCapacity(), normalizedPath.c_str());
+            m_TextureSlotLookup.emplace(l_Key, 0u);
+            return 0;
+        }
+
+        // The slot index is handed out immediately; it samples the default texture until the streamed upload retires.
+        TextureSlot l_PendingSlot{};
+        l_PendingSlot.m_SourcePath = normalizedPath;
+        l_PendingSlot.m_LastUsedTime = m_TextureResidencyTime;
+        l_PendingSlot.m_Linear = linear;
+        l_PendingSlot.m_StreamTicket = m_TextureStreamer.Request(normalizedPath, m_TextureMipDropCount, s_MinDroppedTextureSize, linear);
+        m_TextureSlots.push_back(std::move(l_PendingSlot));
+
+        const uint32_t l_NewIndex = static_cast<uint32_t>(m_TextureSlots.size() - 1);
+        m_TextureSlotLookup.emplace(l_Key, l_NewIndex);
+        m_StreamingTextureSlots.emplace(m_TextureSlots.back().m_StreamTicket, l_NewIndex);
+        // Only the new slot is written; on bindless devices this keeps descriptor work per import proportional to new textures.
+        MarkTextureSlotDirty(l_NewIndex);
+
+        return l_NewIndex;
+    }
+
     void Renderer::ResolveMaterialTextureSlots(const std::vector<std::string>& textures, size_t materialOffset, size_t materialCount)
     {
         if (m_Materials.empty())
@@ -3759,48 +5206,29 @@ namespace Trident
 
         for (const std::string& it_Path : textures)
         {
-            std::string l_Normalized = NormalizeTexturePath(it_Path);
-            l_NormalizedPaths.push_back(l_Normalized);
+            l_NormalizedPaths.push_back(NormalizeTexturePath(it_Path));
+        }
 
-            if (l_Normalized.empty() || m_TextureSlotLookup.find(l_Normalized) != m_TextureSlotLookup.end())
+        // Slots are requested per use so data maps load as UNORM; missing sources resolve to slot 0, the default white texture.
+        auto a_ResolveSlot = [this, &l_NormalizedPaths](int textureIndex, bool linear) -> int
             {
-                continue;
-            }
+                if (textureIndex < 0 || static_cast<size_t>(textureIndex) >= l_NormalizedPaths.size())
+                {
+                    return 0;
+                }
 
-            Loader::TextureData l_TextureData = Loader::TextureLoader::Load(l_Normalized);
-            AcquireTextureSlot(l_Normalized, l_TextureData);
-        }
+                return static_cast<int>(RequestTextureSlot(l_NormalizedPaths[static_cast<size_t>(textureIndex)], linear));
+            };
 
         for (size_t it_Index = 0; it_Index < l_ResolvedCount; ++it_Index)
         {
             Geometry::Material& l_Material = m_Materials[l_SafeOffset + it_Index];
-            l_Material.BaseColorTextureSlot = 0; // Fallback to the default white texture when the source is missing.
-
-            if (l_Material.BaseColorTextureIndex < 0)
-            {
-                continue;
-            }
-
-            const size_t l_TextureIndex = static_cast<size_t>(l_Material.BaseColorTextureIndex);
-            if (l_TextureIndex >= l_NormalizedPaths.size())
-            {
-                continue;
-            }
-
-            const std::string& l_Path = l_NormalizedPaths[l_TextureIndex];
-            if (l_Path.empty())
-            {
-                continue;
-            }
-
-            auto a_Mapping = m_TextureSlotLookup.find(l_Path);
-            if (a_Mapping != m_TextureSlotLookup.end())
-            {
-                l_Material.BaseColorTextureSlot = static_cast<int32_t>(a_Mapping->second);
-            }
+            l_Material.BaseColorTextureSlot = a_ResolveSlot(l_Material.BaseColorTextureIndex, false);
+            l_Material.MetallicRoughnessTextureSlot = a_ResolveSlot(l_Material.MetallicRoughnessTextureIndex, true);
+            l_Material.NormalTextureSlot = a_ResolveSlot(l_Material.NormalTextureIndex, true);
         }
 
-        RefreshTextureDescriptorBindings();
+        MarkMaterialsDirty(l_SafeOffset, l_ResolvedCount);
     }
 
     void Renderer::CreateDefaultSkybox()
@@ -3810,7 +5238,7 @@ namespace Trident
         // Build a placeholder cubemap so the dedicated skybox shaders have a valid texture binding.
         CreateSkyboxCubemap();
 
-        m_Skybox.Init(m_Buffers, m_Commands.GetOneTimePool());
+        m_Skybox.Init(m_Buffers);
 
         TR_CORE_TRACE("Default Skybox Created");
     }
@@ -4058,7 +5486,8 @@ namespace Trident
         vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
             0, nullptr, 0, nullptr, 1, &l_BarrierToShader);
 
-        m_Commands.EndSingleTimeCommands(l_CommandBuffer);
+        // The skybox is first sampled by a later frame on the same queue, so the upload runs without a CPU wait.
+        m_Commands.SubmitSingleTimeCommands(l_CommandBuffer);
 
         m_Buffers.DestroyBuffer(l_StagingBuffer, l_StagingMemory);
 
@@ -4153,6 +5582,16 @@ namespace Trident
         l_AllocateInfo.descriptorSetCount = l_ImageCount32;
         l_AllocateInfo.pSetLayouts = l_Layouts.data();
 
+        // Bindless sets only allocate the capacity the renderer uses rather than the device limit declared by the layout.
+        std::vector<uint32_t> l_TextureCounts(l_ImageCount, m_Pipeline.GetMaterialTextureCapacity());
+        VkDescriptorSetVariableDescriptorCountAllocateInfo l_VariableCountInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO };
+        l_VariableCountInfo.descriptorSetCount = l_ImageCount32;
+        l_VariableCountInfo.pDescriptorCounts = l_TextureCounts.data();
+        if (m_Pipeline.UsesBindlessTextures())
+        {
+            l_AllocateInfo.pNext = &l_VariableCountInfo;
+        }
+
         m_DescriptorSets.resize(l_ImageCount);
         if (vkAllocateDescriptorSets(Startup::GetDevice(), &l_AllocateInfo, m_DescriptorSets.data()) != VK_SUCCESS)
         {
@@ -4198,8 +5637,7 @@ namespace Trident
             l_MaterialWrite.dstSet = m_DescriptorSets[i];
             l_MaterialWrite.dstBinding = 1;
             l_MaterialWrite.dstArrayElement = 0;
-            // Bind the material data as a uniform buffer so the shader receives the expected descriptor type.
-            l_MaterialWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            l_MaterialWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             l_MaterialWrite.descriptorCount = 1;
             l_MaterialWrite.pBufferInfo = &l_MaterialBufferInfo;
 
@@ -4213,7 +5651,7 @@ namespace Trident
 
             VkWriteDescriptorSet l_AiWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
             l_AiWrite.dstSet = m_DescriptorSets[i];
-            l_AiWrite.dstBinding = 5;
+            l_AiWrite.dstBinding = 2;
             l_AiWrite.dstArrayElement = 0;
             l_AiWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             l_AiWrite.descriptorCount = 1;
@@ -4223,6 +5661,15 @@ namespace Trident
             vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(std::size(l_Writes)), l_Writes, 0, nullptr);
         }
 
+        // The loop above bound the current material and bone palette buffers, so those sets start up to date.
+        m_MaterialDescriptorGenerations.assign(l_ImageCount, m_MaterialBufferGeneration);
+        m_BonePaletteDescriptorGenerations.assign(l_ImageCount, m_BonePaletteGeneration);
+        m_SceneBufferDescriptorGenerations.assign(l_ImageCount, 0);
+        for (uint32_t it_Image = 0; it_Image < l_ImageCount32; ++it_Image)
+        {
+            RefreshSceneBufferDescriptor(it_Image);
+        }
+
         RefreshTextureDescriptorBindings();
         UpdateSkyboxBindingOnMainSets();
         UpdateAiDescriptorBinding();
@@ -4279,70 +5726,231 @@ namespace Trident
             m_MaterialBufferElementCount = l_RequiredCount;
             m_MaterialBuffers.clear();
             m_MaterialBuffersMemory.clear();
-            m_MaterialBufferDirty.clear();
+            m_MaterialBuffersMapped.clear();
+            m_MaterialDirtyRanges.clear();
             return;
         }
 
-        const bool l_SizeMismatch = (l_RequiredCount != m_MaterialBufferElementCount);
+        // Grow geometrically and never shrink so repeated imports do not reallocate and rewrite the table every time.
+        const bool l_NeedsGrowth = (l_RequiredCount > m_MaterialBufferElementCount) || m_MaterialBuffers.empty();
         const bool l_ImageMismatch = (m_MaterialBuffers.size() != l_ImageCount);
-        if (!l_SizeMismatch && !l_ImageMismatch)
+        if (!l_NeedsGrowth && !l_ImageMismatch)
         {
             return;
         }
 
-        if (!m_MaterialBuffers.empty() && m_ResourceFence != VK_NULL_HANDLE)
+        // The old buffers are retired against the frame timeline and each set is repointed when its image is next recorded,
+        // so frames in flight keep reading the table they were recorded with.
+        const size_t l_PreviousCount = m_MaterialBuffers.empty() ? 0 : m_MaterialBufferElementCount;
+        const size_t l_TargetCount = std::max(l_RequiredCount, l_PreviousCount + l_PreviousCount / 2);
+        DestroyMaterialBuffers();
+
+        const VkDeviceSize l_BufferSize = static_cast<VkDeviceSize>(l_TargetCount * sizeof(MaterialUniformBuffer));
+        m_Buffers.CreateStorageBuffers(static_cast<uint32_t>(l_ImageCount), l_BufferSize, m_MaterialBuffers, m_MaterialBuffersMemory);
+
+        // The memory is host-coherent, so records written before a submission are visible to it without a flush.
+        m_MaterialBuffersMapped.assign(m_MaterialBuffers.size(), nullptr);
+        for (size_t it_Index = 0; it_Index < m_MaterialBuffersMemory.size(); ++it_Index)
         {
-            // Guarantee that no in-flight draw is still referencing the previous buffers before we recycle them.
-            vkWaitForFences(Startup::GetDevice(), 1, &m_ResourceFence, VK_TRUE, UINT64_MAX);
+            if (vkMapMemory(Startup::GetDevice(), m_MaterialBuffersMemory[it_Index], 0, l_BufferSize, 0, &m_MaterialBuffersMapped[it_Index]) != VK_SUCCESS)
+            {
+                TR_CORE_ERROR("Failed to map material buffer {}", it_Index);
+                m_MaterialBuffersMapped[it_Index] = nullptr;
+            }
         }
 
+        m_MaterialBufferElementCount = l_TargetCount;
+        ++m_MaterialBufferGeneration;
+        MarkMaterialBuffersDirty();
+    }
+
+    void Renderer::DestroyMaterialBuffers()
+    {
         for (size_t it_Index = 0; it_Index < m_MaterialBuffers.size(); ++it_Index)
         {
+            if (it_Index < m_MaterialBuffersMapped.size() && m_MaterialBuffersMapped[it_Index] != nullptr)
+            {
+                vkUnmapMemory(Startup::GetDevice(), m_MaterialBuffersMemory[it_Index]);
+            }
+
             m_Buffers.DestroyBuffer(m_MaterialBuffers[it_Index], m_MaterialBuffersMemory[it_Index]);
         }
 
-        const VkDeviceSize l_BufferSize = static_cast<VkDeviceSize>(l_RequiredCount * sizeof(MaterialUniformBuffer));
-        // Material data is consumed through a uniform buffer binding, so allocate matching buffers per swapchain image.
-        m_Buffers.CreateUniformBuffers(static_cast<uint32_t>(l_ImageCount), l_BufferSize, m_MaterialBuffers, m_MaterialBuffersMemory);
-
-        m_MaterialBufferElementCount = l_RequiredCount;
-        MarkMaterialBuffersDirty();
-        UpdateMaterialDescriptorBindings();
+        m_MaterialBuffers.clear();
+        m_MaterialBuffersMemory.clear();
+        m_MaterialBuffersMapped.clear();
     }
 
-    void Renderer::UpdateMaterialDescriptorBindings()
+    void Renderer::RefreshMaterialDescriptor(uint32_t imageIndex)
     {
-        if (m_DescriptorSets.empty() || m_MaterialBuffers.empty())
+        if (imageIndex >= m_DescriptorSets.size() || imageIndex >= m_MaterialDescriptorGenerations.size() || imageIndex >= m_MaterialBuffers.size())
         {
             return;
         }
 
-        const VkDeviceSize l_MaterialRange = static_cast<VkDeviceSize>(std::max<size_t>(m_MaterialBufferElementCount, static_cast<size_t>(1)) * sizeof(MaterialUniformBuffer));
-        for (size_t it_Image = 0; it_Image < m_DescriptorSets.size() && it_Image < m_MaterialBuffers.size(); ++it_Image)
+        if (m_MaterialDescriptorGenerations[imageIndex] == m_MaterialBufferGeneration)
         {
-            VkDescriptorBufferInfo l_MaterialInfo{};
-            l_MaterialInfo.buffer = m_MaterialBuffers[it_Image];
-            l_MaterialInfo.offset = 0;
-            l_MaterialInfo.range = l_MaterialRange;
+            return;
+        }
 
-            VkWriteDescriptorSet l_MaterialWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-            l_MaterialWrite.dstSet = m_DescriptorSets[it_Image];
-            l_MaterialWrite.dstBinding = 1;
-            l_MaterialWrite.dstArrayElement = 0;
-            // Maintain uniform buffer bindings whenever the material payload changes.
-            l_MaterialWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-            l_MaterialWrite.descriptorCount = 1;
-            l_MaterialWrite.pBufferInfo = &l_MaterialInfo;
+        VkDescriptorBufferInfo l_MaterialInfo{};
+        l_MaterialInfo.buffer = m_MaterialBuffers[imageIndex];
+        l_MaterialInfo.offset = 0;
+        l_MaterialInfo.range = static_cast<VkDeviceSize>(std::max<size_t>(m_MaterialBufferElementCount, static_cast<size_t>(1)) * sizeof(MaterialUniformBuffer));
 
-            vkUpdateDescriptorSets(Startup::GetDevice(), 1, &l_MaterialWrite, 0, nullptr);
-        }
+        VkWriteDescriptorSet l_MaterialWrite{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        l_MaterialWrite.dstSet = m_DescriptorSets[imageIndex];
+        l_MaterialWrite.dstBinding = 1;
+        l_MaterialWrite.dstArrayElement = 0;
+        l_MaterialWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_MaterialWrite.descriptorCount = 1;
+        l_MaterialWrite.pBufferInfo = &l_MaterialInfo;
+        vkUpdateDescriptorSets(Startup::GetDevice(), 1, &l_MaterialWrite, 0, nullptr);
+
+        m_MaterialDescriptorGenerations[imageIndex] = m_MaterialBufferGeneration;
     }
 
     void Renderer::MarkMaterialBuffersDirty()
     {
         const size_t l_ImageCount = m_Swapchain.GetImageCount();
-        m_MaterialBufferDirty.resize(l_ImageCount);
-        std::fill(m_MaterialBufferDirty.begin(), m_MaterialBufferDirty.end(), true);
+        const uint32_t l_RecordCount = static_cast<uint32_t>(m_MaterialBufferElementCount);
+        m_MaterialDirtyRanges.resize(l_ImageCount);
+        for (std::vector<std::pair<uint32_t, uint32_t>>& it_Ranges : m_MaterialDirtyRanges)
+        {
+            // Covers the padding records past m_Materials too, so a fresh or shrunk table never exposes stale data.
+            it_Ranges.assign(1, { 0u, l_RecordCount });
+        }
+    }
+
+    void Renderer::MarkMaterialsDirty(size_t firstMaterial, size_t count)
+    {
+        if (count == 0 || firstMaterial >= m_Materials.size())
+        {
+            return;
+        }
+
+        const uint32_t l_First = static_cast<uint32_t>(firstMaterial);
+        const uint32_t l_End = static_cast<uint32_t>(std::min(firstMaterial + count, m_Materials.size()));
+        m_MaterialDirtyRanges.resize(m_Swapchain.GetImageCount());
+        for (std::vector<std::pair<uint32_t, uint32_t>>& it_Ranges : m_MaterialDirtyRanges)
+        {
+            it_Ranges.emplace_back(l_First, l_End);
+            if (it_Ranges.size() > s_MaxMaterialDirtyRanges)
+            {
+                // An image that has not been drawn for a while collapses its backlog into one span instead of growing.
+                uint32_t l_SpanFirst = std::numeric_limits<uint32_t>::max();
+                uint32_t l_SpanEnd = 0;
+                for (const std::pair<uint32_t, uint32_t>& it_Range : it_Ranges)
+                {
+                    l_SpanFirst = std::min(l_SpanFirst, it_Range.first);
+                    l_SpanEnd = std::max(l_SpanEnd, it_Range.second);
+                }
+                it_Ranges.assign(1, { l_SpanFirst, l_SpanEnd });
+            }
+        }
+    }
+
+    void Renderer::SetMaterial(size_t materialIndex, const Geometry::Material& material)
+    {
+        if (materialIndex >= m_Materials.size())
+        {
+            TR_CORE_WARN("Ignoring edit to material {} (only {} loaded)", materialIndex, m_Materials.size());
+            return;
+        }
+
+        m_Materials[materialIndex] = material;
+        MarkMaterialsDirty(materialIndex);
+    }
+
+    int32_t Renderer::GetResidentTextureSlot(int32_t slotIndex) const
+    {
+        if (slotIndex <= 0 || static_cast<size_t>(slotIndex) >= m_TextureSlots.size() || m_TextureSlots[slotIndex].m_View == VK_NULL_HANDLE)
+        {
+            return 0;
+        }
+
+        return slotIndex;
+    }
+
+    void Renderer::MarkMaterialsForTextureResidency()
+    {
+        if (m_TextureResidencyChanges.empty())
+        {
+            return;
+        }
+
+        std::sort(m_TextureResidencyChanges.begin(), m_TextureResidencyChanges.end());
+        auto a_Changed = [this](int32_t slotIndex)
+            {
+                return slotIndex > 0 && std::binary_search(m_TextureResidencyChanges.begin(), m_TextureResidencyChanges.end(), static_cast<uint32_t>(slotIndex));
+            };
+
+        // Records that reference a changed data slot are rewritten in runs, so a large import costs a handful of ranges.
+        size_t l_RunStart = m_Materials.size();
+        for (size_t it_Index = 0; it_Index <= m_Materials.size(); ++it_Index)
+        {
+            const bool l_Changed = it_Index < m_Materials.size()
+                && (a_Changed(m_Materials[it_Index].MetallicRoughnessTextureSlot) || a_Changed(m_Materials[it_Index].NormalTextureSlot));
+            if (l_Changed && l_RunStart == m_Materials.size())
+            {
+                l_RunStart = it_Index;
+            }
+            else if (!l_Changed && l_RunStart != m_Materials.size())
+            {
+                MarkMaterialsDirty(l_RunStart, it_Index - l_RunStart);
+                l_RunStart = m_Materials.size();
+            }
+        }
+
+        m_TextureResidencyChanges.clear();
+    }
+
+    void Renderer::FlushMaterialBuffer(uint32_t imageIndex)
+    {
+        if (imageIndex >= m_MaterialDirtyRanges.size() || imageIndex >= m_MaterialBuffersMapped.size())
+        {
+            return;
+        }
+
+        std::vector<std::pair<uint32_t, uint32_t>>& l_Ranges = m_MaterialDirtyRanges[imageIndex];
+        MaterialUniformBuffer* l_Records = static_cast<MaterialUniformBuffer*>(m_MaterialBuffersMapped[imageIndex]);
+        if (l_Ranges.empty() || l_Records == nullptr)
+        {
+            return;
+        }
+
+        // Sorted ranges are walked once; records already written by an overlapping range are skipped.
+        std::sort(l_Ranges.begin(), l_Ranges.end());
+        const uint32_t l_Capacity = static_cast<uint32_t>(m_MaterialBufferElementCount);
+        uint32_t l_WrittenEnd = 0;
+        for (const std::pair<uint32_t, uint32_t>& it_Range : l_Ranges)
+        {
+            const uint32_t l_End = std::min(it_Range.second, l_Capacity);
+            for (uint32_t it_Index = std::max(it_Range.first, l_WrittenEnd); it_Index < l_End; ++it_Index)
+            {
+                MaterialUniformBuffer l_Record{};
+                l_Record.BaseColorFactor = glm::vec4(1.0f);
+                l_Record.MaterialFactors = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+                l_Record.TextureSlots = glm::ivec4(0);
+
+                if (it_Index < m_Materials.size())
+                {
+                    const Geometry::Material& l_Material = m_Materials[it_Index];
+                    l_Record.BaseColorFactor = l_Material.BaseColorFactor;
+                    // w carries the alpha cutoff; only the alpha-test permutation reads it.
+                    l_Record.MaterialFactors = glm::vec4(l_Material.MetallicFactor, l_Material.RoughnessFactor, 1.0f, l_Material.AlphaCutoff);
+                    // Non-resident data slots would sample the white default, which is no neutral normal, so they read as absent.
+                    l_Record.TextureSlots = glm::ivec4(l_Material.BaseColorTextureSlot, GetResidentTextureSlot(l_Material.MetallicRoughnessTextureSlot),
+                        GetResidentTextureSlot(l_Material.NormalTextureSlot), 0);
+                }
+
+                l_Records[it_Index] = l_Record;
+            }
+
+            l_WrittenEnd = std::max(l_WrittenEnd, l_End);
+        }
+
+        l_Ranges.clear();
     }
 
     void Renderer::CreateSkyboxDescriptorSets()
@@ -4417,81 +6025,27 @@ namespace Trident
 
     void Renderer::DestroyOffscreenResources(uint32_t viewportID)
     {
-        if (viewportID == 0)
-        {
-            return;
-        }
-
-        ViewportContext* l_Context = FindViewportContext(viewportID);
-        if (l_Context == nullptr)
-        {
-            return;
-        }
-
-        VkDevice l_Device = Startup::GetDevice();
-        OffscreenTarget& l_Target = l_Context->m_Target;
-
-        vkDeviceWaitIdle(l_Device);
-
-        // TODO: LOOK INTO RAII TO HANDLE ALL THIS RESOURCE
-        //if (l_Target.m_TextureID != VK_NULL_HANDLE)
-        //{
-        //    ImGui_ImplVulkan_RemoveTexture(l_Target.m_TextureID);
-        //    l_Target.m_TextureID = VK_NULL_HANDLE;
-        //}
-
-        // The renderer owns these handles; releasing them here avoids dangling ImGui descriptors or image memory leaks. 
-        if (l_Target.m_Framebuffer != VK_NULL_HANDLE)
-        {
-            vkDestroyFramebuffer(l_Device, l_Target.m_Framebuffer, nullptr);
-            l_Target.m_Framebuffer = VK_NULL_HANDLE;
-        }
-
-        if (l_Target.m_DepthView != VK_NULL_HANDLE)
-        {
-            vkDestroyImageView(l_Device, l_Target.m_DepthView, nullptr);
-            l_Target.m_DepthView = VK_NULL_HANDLE;
-        }
-
-        if (l_Target.m_ImageView != VK_NULL_HANDLE)
-        {
-            vkDestroyImageView(l_Device, l_Target.m_ImageView, nullptr);
-            l_Target.m_ImageView = VK_NULL_HANDLE;
-        }
-
-        if (l_Target.m_DepthImage != VK_NULL_HANDLE)
+        if (viewportID == 0)
         {
-            vkDestroyImage(l_Device, l_Target.m_DepthImage, nullptr);
-            l_Target.m_DepthImage = VK_NULL_HANDLE;
+            return;
         }
 
-        if (l_Target.m_Image != VK_NULL_HANDLE)
-        {
-            vkDestroyImage(l_Device, l_Target.m_Image, nullptr);
-            l_Target.m_Image = VK_NULL_HANDLE;
-        }
-        if (l_Target.m_DepthMemory != VK_NULL_HANDLE)
+        ViewportContext* l_Context = FindViewportContext(viewportID);
+        if (l_Context == nullptr)
         {
-            vkFreeMemory(l_Device, l_Target.m_DepthMemory, nullptr);
-            l_Target.m_DepthMemory = VK_NULL_HANDLE;
+            return;
         }
 
-        if (l_Target.m_Memory != VK_NULL_HANDLE)
-        {
-            vkFreeMemory(l_Device, l_Target.m_Memory, nullptr);
-            l_Target.m_Memory = VK_NULL_HANDLE;
-        }
+        OffscreenTarget& l_Target = l_Context->m_Target;
 
-        if (l_Target.m_Sampler != VK_NULL_HANDLE)
-        {
-            vkDestroySampler(l_Device, l_Target.m_Sampler, nullptr);
-            l_Target.m_Sampler = VK_NULL_HANDLE;
-        }
+        m_ClusterCuller.ReleaseView(viewportID);
 
-        l_Target.m_Extent = { 0, 0 };
-        l_Target.m_CurrentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        l_Target.m_DepthLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        // TODO: LOOK INTO RAII TO HANDLE ALL THIS RESOURCE
+        // Closed or minimised panels hand their target to the pool so reopening them (or another panel of a similar size)
+        // skips the allocation; anything the pool evicts is retired against the frame timeline.
+        PoolOffscreenTarget(l_Target);
         l_Context->m_CachedExtent = { 0, 0 };
+        l_Context->m_StableFrames = 0;
         l_Context->m_Info.Size = { 0.0f, 0.0f };
     }
 
@@ -4506,7 +6060,7 @@ namespace Trident
             DestroyOffscreenResources(l_ViewportId);
         }
 
-        // Future: consider retaining unused targets in a pool so secondary editor panels can resume instantly.
+        ClearOffscreenTargetPool();
         m_ActiveViewportId = 0;
     }
 
@@ -4573,75 +6127,92 @@ namespace Trident
         return (m_RuntimeCameraReady && m_RuntimeCamera) ? m_RuntimeCamera : nullptr;
     }
 
-    void Renderer::CreateOrResizeOffscreenResources(OffscreenTarget& target, VkExtent2D extent)
+    void Renderer::RetireOffscreenTarget(OffscreenTarget& target, bool removeTexture)
     {
-        VkDevice l_Device = Startup::GetDevice();
-
-        // Ensure the GPU is idle before we reuse or release any image memory.
-        vkDeviceWaitIdle(l_Device);
+        OffscreenTarget l_Retired{};
+        std::swap(l_Retired.m_Image, target.m_Image);
+        std::swap(l_Retired.m_Memory, target.m_Memory);
+        std::swap(l_Retired.m_ImageView, target.m_ImageView);
+        std::swap(l_Retired.m_DepthImage, target.m_DepthImage);
+        std::swap(l_Retired.m_DepthMemory, target.m_DepthMemory);
+        std::swap(l_Retired.m_DepthView, target.m_DepthView);
+        std::swap(l_Retired.m_Framebuffer, target.m_Framebuffer);
+        std::swap(l_Retired.m_Sampler, target.m_Sampler);
+        if (removeTexture)
+        {
+            std::swap(l_Retired.m_TextureID, target.m_TextureID);
+        }
+
+        target.m_Extent = { 0, 0 };
+        target.m_AllocatedExtent = { 0, 0 };
+        target.m_CurrentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        target.m_DepthLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
-        auto a_ResetTarget = [l_Device](OffscreenTarget& target)
+        m_Buffers.Retire([l_Retired]()
             {
-                if (target.m_TextureID != VK_NULL_HANDLE)
+                VkDevice l_Device = Startup::GetDevice();
+
+                // The ImGui backend may already be gone when the queue drains during shutdown; its pool owns the set then.
+                if (l_Retired.m_TextureID != VK_NULL_HANDLE && ImGui::GetCurrentContext() != nullptr && ImGui::GetIO().BackendRendererUserData != nullptr)
                 {
-                    ImGui_ImplVulkan_RemoveTexture(target.m_TextureID);
-                    target.m_TextureID = VK_NULL_HANDLE;
+                    ImGui_ImplVulkan_RemoveTexture(l_Retired.m_TextureID);
                 }
 
-                if (target.m_Framebuffer != VK_NULL_HANDLE)
+                if (l_Retired.m_Framebuffer != VK_NULL_HANDLE)
                 {
-                    vkDestroyFramebuffer(l_Device, target.m_Framebuffer, nullptr);
-                    target.m_Framebuffer = VK_NULL_HANDLE;
+                    vkDestroyFramebuffer(l_Device, l_Retired.m_Framebuffer, nullptr);
                 }
 
-                if (target.m_DepthView != VK_NULL_HANDLE)
+                if (l_Retired.m_DepthView != VK_NULL_HANDLE)
                 {
-                    vkDestroyImageView(l_Device, target.m_DepthView, nullptr);
-                    target.m_DepthView = VK_NULL_HANDLE;
+                    vkDestroyImageView(l_Device, l_Retired.m_DepthView, nullptr);
                 }
 
-                if (target.m_ImageView != VK_NULL_HANDLE)
+                if (l_Retired.m_ImageView != VK_NULL_HANDLE)
                 {
-                    vkDestroyImageView(l_Device, target.m_ImageView, nullptr);
-                    target.m_ImageView = VK_NULL_HANDLE;
+                    vkDestroyImageView(l_Device, l_Retired.m_ImageView, nullptr);
                 }
 
-                if (target.m_DepthImage != VK_NULL_HANDLE)
+                if (l_Retired.m_DepthImage != VK_NULL_HANDLE)
                 {
-                    vkDestroyImage(l_Device, target.m_DepthImage, nullptr);
-                    target.m_DepthImage = VK_NULL_HANDLE;
+                    vkDestroyImage(l_Device, l_Retired.m_DepthImage, nullptr);
                 }
 
-                if (target.m_Image != VK_NULL_HANDLE)
+                if (l_Retired.m_Image != VK_NULL_HANDLE)
                 {
-                    vkDestroyImage(l_Device, target.m_Image, nullptr);
-                    target.m_Image = VK_NULL_HANDLE;
+                    vkDestroyImage(l_Device, l_Retired.m_Image, nullptr);
                 }
 
-                if (target.m_DepthMemory != VK_NULL_HANDLE)
+                if (l_Retired.m_DepthMemory != VK_NULL_HANDLE)
                 {
-                    vkFreeMemory(l_Device, target.m_DepthMemory, nullptr);
-                    target.m_DepthMemory = VK_NULL_HANDLE;
+                    vkFreeMemory(l_Device, l_Retired.m_DepthMemory, nullptr);
                 }
 
-                if (target.m_Memory != VK_NULL_HANDLE)
+                if (l_Retired.m_Memory != VK_NULL_HANDLE)
                 {
-                    vkFreeMemory(l_Device, target.m_Memory, nullptr);
-                    target.m_Memory = VK_NULL_HANDLE;
+                    vkFreeMemory(l_Device, l_Retired.m_Memory, nullptr);
                 }
 
-                if (target.m_Sampler != VK_NULL_HANDLE)
+                if (l_Retired.m_Sampler != VK_NULL_HANDLE)
                 {
-                    vkDestroySampler(l_Device, target.m_Sampler, nullptr);
-                    target.m_Sampler = VK_NULL_HANDLE;
+                    vkDestroySampler(l_Device, l_Retired.m_Sampler, nullptr);
                 }
+            });
+    }
+
+    void Renderer::CreateOrResizeOffscreenResources(OffscreenTarget& target, VkExtent2D extent)
+    {
+        VkDevice l_Device = Startup::GetDevice();
 
-                target.m_Extent = { 0, 0 };
-                target.m_CurrentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-                target.m_DepthLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        // The previous attachments are retired rather than destroyed: frames still in flight may render into or sample them.
+        auto a_ResetTarget = [this](OffscreenTarget& target)
+            {
+                RetireOffscreenTarget(target, true);
             };
 
         a_ResetTarget(target);
+        // Anything derived from the old attachments (such as the occlusion depth pyramid) keys off this to rebuild.
+        ++target.m_Revision;
 
         if (extent.width == 0 || extent.height == 0)
         {
@@ -4719,7 +6290,8 @@ namespace Trident
         l_DepthInfo.format = m_Pipeline.GetDepthFormat();
         l_DepthInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
         l_DepthInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        l_DepthInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        // Sampled so the cluster culler can reduce depth into its occlusion pyramid between the early and late passes.
+        l_DepthInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
         l_DepthInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         l_DepthInfo.samples = VK_SAMPLE_COUNT_1_BIT;
 
@@ -4813,10 +6385,7 @@ namespace Trident
             return;
         }
 
-        VkCommandBuffer l_BootstrapCommandBuffer = m_Commands.GetOneTimePool().Acquire();
-        VkCommandBufferBeginInfo l_BootstrapBeginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-        l_BootstrapBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        vkBeginCommandBuffer(l_BootstrapCommandBuffer, &l_BootstrapBeginInfo);
+        VkCommandBuffer l_BootstrapCommandBuffer = m_Commands.BeginSingleTimeCommands();
 
         VkImageMemoryBarrier l_BootstrapBarrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
         l_BootstrapBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
@@ -4835,26 +6404,115 @@ namespace Trident
         // Bootstrap the image layout so descriptor writes and validation stay in sync when the viewport samples before the first render pass.
         vkCmdPipelineBarrier(l_BootstrapCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_BootstrapBarrier);
 
-        vkEndCommandBuffer(l_BootstrapCommandBuffer);
-
-        VkSubmitInfo l_BootstrapSubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
-        l_BootstrapSubmitInfo.commandBufferCount = 1;
-        l_BootstrapSubmitInfo.pCommandBuffers = &l_BootstrapCommandBuffer;
-
-        vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_BootstrapSubmitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(Startup::GetGraphicsQueue());
-
-        m_Commands.GetOneTimePool().Release(l_BootstrapCommandBuffer);
+        // Frames that sample the target are submitted after this on the same queue, so nothing needs to wait for it.
+        m_Commands.SubmitSingleTimeCommands(l_BootstrapCommandBuffer);
 
         // Register (or refresh) the descriptor used by the viewport panel and keep it cached for quick retrieval.
         target.m_TextureID = ImGui_ImplVulkan_AddTexture(target.m_Sampler, target.m_ImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
         target.m_Extent = extent;
+        target.m_AllocatedExtent = extent;
         target.m_CurrentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         target.m_DepthLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
         //TR_CORE_TRACE("Offscreen render target resized to {}x{}", extent.width, extent.height);
     }
 
+    void Renderer::ApplyOffscreenExtent(ViewportContext& context, VkExtent2D extent, bool allowReallocation)
+    {
+        OffscreenTarget& l_Target = context.m_Target;
+        const bool l_Suitable = l_Target.m_Image != VK_NULL_HANDLE && IsAllocationSuitable(l_Target.m_AllocatedExtent, extent, s_OffscreenBucketSize);
+
+        if (allowReallocation && !l_Suitable)
+        {
+            PoolOffscreenTarget(l_Target);
+            if (!AcquirePooledOffscreenTarget(l_Target, extent))
+            {
+                CreateOrResizeOffscreenResources(l_Target, RoundUpToBucket(extent, s_OffscreenBucketSize));
+            }
+        }
+
+        if (l_Target.m_Image == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        // Render area, scissor and copies use the cropped region. Until a growing panel settles the region is clamped to the
+        // allocation and the panel stretches it, which keeps dragging at full frame rate.
+        l_Target.m_Extent.width = std::min(extent.width, l_Target.m_AllocatedExtent.width);
+        l_Target.m_Extent.height = std::min(extent.height, l_Target.m_AllocatedExtent.height);
+    }
+
+    void Renderer::UpdateOffscreenTargets()
+    {
+        for (auto& it_Context : m_ViewportContexts)
+        {
+            ViewportContext& l_Context = it_Context.second;
+            if (l_Context.m_Target.m_Image == VK_NULL_HANDLE || l_Context.m_StableFrames >= s_OffscreenSettleFrames)
+            {
+                continue;
+            }
+
+            // Reallocate exactly once per settled size; a target that already suits the size only has its crop refreshed.
+            if (++l_Context.m_StableFrames == s_OffscreenSettleFrames && l_Context.m_CachedExtent.width > 0 && l_Context.m_CachedExtent.height > 0)
+            {
+                ApplyOffscreenExtent(l_Context, l_Context.m_CachedExtent, true);
+            }
+        }
+    }
+
+    void Renderer::PoolOffscreenTarget(OffscreenTarget& target)
+    {
+        const uint32_t l_Revision = target.m_Revision;
+        if (target.m_Image == VK_NULL_HANDLE)
+        {
+            RetireOffscreenTarget(target, true);
+        }
+        else
+        {
+            m_OffscreenTargetPool.push_back(target);
+            target = OffscreenTarget{};
+        }
+
+        // Whatever replaces the target must read as new to anything derived from the old attachments.
+        target.m_Revision = l_Revision + 1;
+
+        while (m_OffscreenTargetPool.size() > s_MaxPooledOffscreenTargets)
+        {
+            RetireOffscreenTarget(m_OffscreenTargetPool.front(), true);
+            m_OffscreenTargetPool.pop_front();
+        }
+    }
+
+    bool Renderer::AcquirePooledOffscreenTarget(OffscreenTarget& target, VkExtent2D extent)
+    {
+        for (auto it_Pooled = m_OffscreenTargetPool.begin(); it_Pooled != m_OffscreenTargetPool.end(); ++it_Pooled)
+        {
+            if (!IsAllocationSuitable(it_Pooled->m_AllocatedExtent, extent, s_OffscreenBucketSize))
+            {
+                continue;
+            }
+
+            const uint32_t l_Revision = target.m_Revision;
+            target = *it_Pooled;
+            target.m_Revision = l_Revision;
+            m_OffscreenTargetPool.erase(it_Pooled);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void Renderer::ClearOffscreenTargetPool()
+    {
+        for (OffscreenTarget& it_Pooled : m_OffscreenTargetPool)
+        {
+            RetireOffscreenTarget(it_Pooled, true);
+        }
+
+        m_OffscreenTargetPool.clear();
+    }
+
     bool Renderer::AcquireNextImage(uint32_t& imageIndex, VkFence inFlightFence)
     {
         VkResult l_Result = vkAcquireNextImageKHR(Startup::GetDevice(), m_Swapchain.GetSwapchain(), UINT64_MAX,
@@ -4935,8 +6593,15 @@ namespace Trident
         bool l_RenderedViewport = false;
 
         // Prepare the shared draw lists once so each viewport iteration can reuse the same data set.
+        m_SceneBuffer.BeginFrame();
         GatherMeshDraws();
         PrepareBonePaletteBuffer(imageIndex);
+        RefreshBonePaletteDescriptor(imageIndex);
+        RefreshMaterialDescriptor(imageIndex);
+        m_SceneBuffer.RecordUpload(l_CommandBuffer, imageIndex);
+        RefreshSceneBufferDescriptor(imageIndex);
+        PrepareSkinning(l_CommandBuffer, imageIndex);
+        PrepareClusterInstances(imageIndex);
 
         auto a_RenderViewport = [&](uint32_t viewportID, ViewportContext& context, bool isPrimary)
             {
@@ -4967,6 +6632,16 @@ namespace Trident
                 }
 
                 UpdateUniformBuffer(imageIndex, l_ContextCamera, l_CommandBuffer);
+                // Cull clusters against this viewport's camera before the render pass consumes the indirect commands.
+                ClusterCuller::ViewTarget l_CullTarget{};
+                l_CullTarget.m_ViewportId = viewportID;
+                l_CullTarget.m_DepthImage = l_Target.m_DepthImage;
+                l_CullTarget.m_DepthView = l_Target.m_DepthView;
+                l_CullTarget.m_Extent = l_Target.m_Extent;
+                l_CullTarget.m_AttachmentExtent = l_Target.m_AllocatedExtent;
+                l_CullTarget.m_Revision = l_Target.m_Revision;
+                const ClusterCuller::CullResult l_CullResult = m_ClusterCuller.RecordCulling(l_CommandBuffer, imageIndex, l_ContextCamera, l_CullTarget,
+                    m_OcclusionCullingEnabled);
 
                 // Restore the previously active viewport so editor interactions remain consistent outside this pass.
                 m_ActiveViewportId = l_PreviousViewportId;
@@ -5087,8 +6762,8 @@ namespace Trident
                     TR_CORE_WARN("Skybox pipeline missing; skipping skybox draw for viewport {} until the pipeline is rebuilt.", context.m_Info.ViewportID);
                 }
 
-                const VkPipeline l_RenderPipeline = m_Pipeline.GetPipeline();
-                const bool l_CanRender = l_RenderPipeline != VK_NULL_HANDLE;
+                const VkPipeline l_RenderPipeline = m_Pipeline.GetPipeline(GetMeshPipelineFeatures(-1));
+                const bool l_CanRender = m_Pipeline.IsGraphicsPipelineReady();
                 if (l_CanRender)
                 {
                     // Avoid binding a null pipeline so command recording stays valid if hot-reload briefly invalidates pipelines.
@@ -5100,55 +6775,113 @@ namespace Trident
                         vkCmdBindDescriptorSets(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline.GetPipelineLayout(), 0, 1, &m_DescriptorSets[imageIndex], 0, nullptr);
                     }
 
-                    if (m_VertexBuffer != VK_NULL_HANDLE && m_IndexBuffer != VK_NULL_HANDLE && !m_MeshDrawInfo.empty() && !m_MeshDrawCommands.empty() && l_HasDescriptorSet)
-                    {
-                        VkBuffer l_VertexBuffers[] = { m_VertexBuffer };
-                        VkDeviceSize l_Offsets[] = { 0 };
-                        vkCmdBindVertexBuffers(l_CommandBuffer, 0, 1, l_VertexBuffers, l_Offsets);
-                        vkCmdBindIndexBuffer(l_CommandBuffer, m_IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-
-                        for (const MeshDrawCommand& l_Command : m_MeshDrawCommands)
+                    auto a_RecordMeshDraws = [&](ClusterCuller::CullPhase phase)
                         {
-                            if (!l_Command.m_Component)
-                            {
-                                continue;
-                            }
-
-                            const MeshComponent& l_Component = *l_Command.m_Component;
-                            if (l_Component.m_MeshIndex >= m_MeshDrawInfo.size())
-                            {
-                                continue;
-                            }
-
-                            const MeshDrawInfo& l_DrawInfo = m_MeshDrawInfo[l_Component.m_MeshIndex];
-                            if (l_DrawInfo.m_IndexCount == 0)
+                            if (m_VertexBuffer != VK_NULL_HANDLE && m_IndexBuffer != VK_NULL_HANDLE && !m_MeshDrawInfo.empty() && !m_MeshDrawCommands.empty() && l_HasDescriptorSet)
                             {
-                                continue;
+                                VkBuffer l_VertexBuffers[] = { m_VertexBuffer };
+                                VkDeviceSize l_Offsets[] = { 0 };
+                                vkCmdBindVertexBuffers(l_CommandBuffer, 0, 1, l_VertexBuffers, l_Offsets);
+                                vkCmdBindIndexBuffer(l_CommandBuffer, m_IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+
+                                // Skinned instances read the vertices the compute pre-pass produced; every viewport shares them.
+                                const VkBuffer l_SkinnedVertices = m_SkinningPass.GetOutputBuffer(imageIndex);
+                                VkBuffer l_BoundVertexBuffer = m_VertexBuffer;
+                                VkPipeline l_BoundPipeline = l_RenderPipeline;
+                                for (const MeshDrawCommand& l_Command : m_MeshDrawCommands)
+                                {
+                                    // The late phase only adds clusters the depth pyramid revealed; direct draws all happened early.
+                                    const bool l_UseClusters = l_CullResult != ClusterCuller::CullResult::Unculled && l_Command.m_ClusterCommandCount > 0;
+                                    if (!l_Command.m_Component || (phase == ClusterCuller::CullPhase::Late && !l_UseClusters))
+                                    {
+                                        continue;
+                                    }
+
+                                    const MeshComponent& l_Component = *l_Command.m_Component;
+                                    if (l_Component.m_MeshIndex >= m_MeshDrawInfo.size())
+                                    {
+                                        continue;
+                                    }
+
+                                    const MeshDrawInfo& l_DrawInfo = m_MeshDrawInfo[l_Component.m_MeshIndex];
+                                    if (l_DrawInfo.m_IndexCount == 0)
+                                    {
+                                        continue;
+                                    }
+
+                                    RenderablePushConstant l_PushConstant{};
+                                    l_PushConstant.m_ModelMatrix = l_Command.m_ModelMatrix;
+                                    int32_t l_MaterialIndex = l_DrawInfo.m_MaterialIndex;
+                                    int32_t l_TextureSlot = 0;
+                                    if (l_Command.m_TextureComponent != nullptr && l_Command.m_TextureComponent->m_TextureSlot >= 0)
+                                    {
+                                        // Prefer the entity supplied texture slot so material overrides remain reactive in-editor.
+                                        l_TextureSlot = l_Command.m_TextureComponent->m_TextureSlot;
+                                    }
+                                    else if (l_MaterialIndex >= 0 && static_cast<size_t>(l_MaterialIndex) < m_Materials.size())
+                                    {
+                                        l_TextureSlot = m_Materials[l_MaterialIndex].BaseColorTextureSlot;
+                                    }
+
+                                    l_PushConstant.m_TextureSlot = l_TextureSlot;
+                                    l_PushConstant.m_MaterialIndex = l_MaterialIndex;
+                                    l_PushConstant.m_BoneOffset = static_cast<int32_t>(l_Command.m_BoneOffset);
+                                    l_PushConstant.m_BoneCount = static_cast<int32_t>(l_Command.m_BoneCount);
+                                    l_PushConstant.m_InstanceIndex = static_cast<int32_t>(l_Command.m_SceneIndex);
+
+                                    // Alpha-masked materials switch to the alpha-test permutation; everything else stays on the opaque one.
+                                    const VkPipeline l_DrawPipeline = m_Pipeline.GetPipeline(GetMeshPipelineFeatures(l_MaterialIndex));
+                                    if (l_DrawPipeline != l_BoundPipeline)
+                                    {
+                                        vkCmdBindPipeline(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, l_DrawPipeline);
+                                        l_BoundPipeline = l_DrawPipeline;
+                                    }
+
+                                    vkCmdPushConstants(l_CommandBuffer, m_Pipeline.GetPipelineLayout(), VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
+                                        sizeof(RenderablePushConstant), &l_PushConstant);
+
+                                    const bool l_Skinned = l_Command.m_SkinnedBaseVertex >= 0;
+                                    const VkBuffer l_DrawVertexBuffer = l_Skinned ? l_SkinnedVertices : m_VertexBuffer;
+                                    if (l_DrawVertexBuffer != l_BoundVertexBuffer)
+                                    {
+                                        vkCmdBindVertexBuffers(l_CommandBuffer, 0, 1, &l_DrawVertexBuffer, l_Offsets);
+                                        l_BoundVertexBuffer = l_DrawVertexBuffer;
+                                    }
+
+                                    if (l_UseClusters)
+                                    {
+                                        m_ClusterCuller.DrawClusters(l_CommandBuffer, imageIndex, phase, l_Command.m_ClusterCommandOffset, l_Command.m_ClusterCommandCount);
+                                        continue;
+                                    }
+
+                                    const MeshLodRange& l_Lod = l_DrawInfo.m_Lods[std::min(l_Command.m_LodLevel, l_DrawInfo.m_LodCount - 1)];
+                                    vkCmdDrawIndexed(l_CommandBuffer, l_Lod.m_IndexCount, 1, l_Lod.m_FirstIndex, l_Skinned ? l_Command.m_SkinnedBaseVertex : l_DrawInfo.m_BaseVertex, 0);
+                                }
                             }
+                        };
 
-                            RenderablePushConstant l_PushConstant{};
-                            l_PushConstant.m_ModelMatrix = l_Command.m_ModelMatrix;
-                            int32_t l_MaterialIndex = l_DrawInfo.m_MaterialIndex;
-                            int32_t l_TextureSlot = 0;
-                            if (l_Command.m_TextureComponent != nullptr && l_Command.m_TextureComponent->m_TextureSlot >= 0)
-                            {
-                                // Prefer the entity supplied texture slot so material overrides remain reactive in-editor.
-                                l_TextureSlot = l_Command.m_TextureComponent->m_TextureSlot;
-                            }
-                            else if (l_MaterialIndex >= 0 && static_cast<size_t>(l_MaterialIndex) < m_Materials.size())
-                            {
-                                l_TextureSlot = m_Materials[l_MaterialIndex].BaseColorTextureSlot;
-                            }
+                    a_RecordMeshDraws(ClusterCuller::CullPhase::Early);
 
-                            l_PushConstant.m_TextureSlot = l_TextureSlot;
-                            l_PushConstant.m_MaterialIndex = l_MaterialIndex;
-                            l_PushConstant.m_BoneOffset = static_cast<int32_t>(l_Command.m_BoneOffset);
-                            l_PushConstant.m_BoneCount = static_cast<int32_t>(l_Command.m_BoneCount);
-                            vkCmdPushConstants(l_CommandBuffer, m_Pipeline.GetPipelineLayout(), VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
-                                sizeof(RenderablePushConstant), &l_PushConstant);
+                    const VkRenderPass l_ContinuationPass = m_Pipeline.GetContinuationRenderPass();
+                    if (l_CullResult == ClusterCuller::CullResult::TwoPhase && l_HasDescriptorSet && l_ContinuationPass != VK_NULL_HANDLE)
+                    {
+                        // Reduce the early depth into the pyramid, re-test everything against it, then resume on the same attachments.
+                        vkCmdEndRenderPass(l_CommandBuffer);
+                        m_ClusterCuller.RecordOcclusionPass(l_CommandBuffer, imageIndex, viewportID);
+
+                        VkRenderPassBeginInfo l_ContinuationInfo{ VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+                        l_ContinuationInfo.renderPass = l_ContinuationPass;
+                        l_ContinuationInfo.framebuffer = l_Target.m_Framebuffer;
+                        l_ContinuationInfo.renderArea.offset = { 0, 0 };
+                        l_ContinuationInfo.renderArea.extent = l_Target.m_Extent;
+                        vkCmdBeginRenderPass(l_CommandBuffer, &l_ContinuationInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+                        vkCmdSetViewport(l_CommandBuffer, 0, 1, &l_OffscreenViewport);
+                        vkCmdSetScissor(l_CommandBuffer, 0, 1, &l_OffscreenScissor);
+                        vkCmdBindPipeline(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, l_RenderPipeline);
+                        vkCmdBindDescriptorSets(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline.GetPipelineLayout(), 0, 1, &m_DescriptorSets[imageIndex], 0, nullptr);
 
-                            vkCmdDrawIndexed(l_CommandBuffer, l_DrawInfo.m_IndexCount, 1, l_DrawInfo.m_FirstIndex, l_DrawInfo.m_BaseVertex, 0);
-                        }
+                        a_RecordMeshDraws(ClusterCuller::CullPhase::Late);
                     }
 
                     if (l_HasDescriptorSet)
@@ -5296,12 +7029,34 @@ namespace Trident
 
         if (l_PrimaryViewportActive)
         {
-            if (m_ReadbackEnabled && imageIndex < m_FrameReadbackBuffers.size() && imageIndex < m_FrameReadbackPending.size())
+            VkBuffer l_PreprocessBuffer = VK_NULL_HANDLE;
+            ReadbackPreprocessLayout l_PreprocessLayout{};
+            // Readback is copied every frame into the next free ring slot. Resolution mismatches, and a ring whose slots are all
+            // still in flight or pinned by consumers, skip the copy for this frame instead of waiting.
+            const bool l_ExtentMatches = (m_FrameReadbackExtent.width == l_PrimaryTarget->m_Extent.width) && (m_FrameReadbackExtent.height == l_PrimaryTarget->m_Extent.height);
+            const uint32_t l_ReadbackSlot = (m_ReadbackEnabled && l_ExtentMatches) ? AcquireReadbackSlot() : s_InvalidReadbackSlot;
+            if (l_ReadbackSlot != s_InvalidReadbackSlot)
             {
-                const bool l_ExtentMatches = (m_FrameReadbackExtent.width == l_PrimaryTarget->m_Extent.width) && (m_FrameReadbackExtent.height == l_PrimaryTarget->m_Extent.height);
-                VkBuffer l_ReadbackBuffer = m_FrameReadbackBuffers[imageIndex];
+                ReadbackRingSlot& l_Slot = m_ReadbackRing[l_ReadbackSlot];
+                VkBuffer l_ReadbackBuffer = l_Slot.m_Staging.m_Buffer;
+
+                if (m_ReadbackPreprocessor.IsReady())
+                {
+                    l_PreprocessLayout = BuildReadbackPreprocessLayout(m_FrameReadbackExtent, m_FrameReadbackChannelCount);
+                    if (l_PreprocessLayout.m_TotalSize > m_FrameReadbackBufferSize)
+                    {
+                        // A consumer started or changed shape after the buffers were sized; grow them and copy raw pixels meanwhile.
+                        RequestReadbackResize(m_LastReadbackExtent, true);
+                        l_PreprocessLayout = {};
+                    }
+                }
 
-                if (l_ExtentMatches && l_ReadbackBuffer != VK_NULL_HANDLE)
+                if (!l_PreprocessLayout.IsEmpty())
+                {
+                    // The pass samples the target once it is back in shader-read layout below, so no raw copy is needed.
+                    l_PreprocessBuffer = l_ReadbackBuffer;
+                }
+                else
                 {
                     VkBufferImageCopy l_ReadbackRegion{};
                     l_ReadbackRegion.bufferOffset = 0;
@@ -5328,19 +7083,11 @@ namespace Trident
 
                     vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &l_ReadbackBarrier, 0, nullptr);
 
-                    m_FrameReadbackPending[imageIndex] = true;
-                }
-                else
-                {
-                    // Resolution mismatches are expected once asynchronous readback arrives; skip the copy for now.
-                    m_FrameReadbackPending[imageIndex] = false;
+                    l_Slot.m_Layout = {};
+                    l_Slot.m_State = ReadbackSlotState::Recorded;
+                    m_RecordedReadbackSlot = l_ReadbackSlot;
                 }
             }
-            else if (imageIndex < m_FrameReadbackPending.size())
-            {
-                // Disable readback when it is not required so staging buffers are not touched.
-                m_FrameReadbackPending[imageIndex] = false;
-            }
 
             // Multi-panel path: copy the rendered viewport into the swapchain image so every editor panel sees a synchronized back buffer.
             VkImageBlit l_BlitRegion{};
@@ -5375,19 +7122,28 @@ namespace Trident
             l_ToSample.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
             l_ToSample.image = l_PrimaryTarget->m_Image;
 
-            vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+            vkCmdPipelineBarrier(l_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                 0, 0, nullptr, 0, nullptr, 1, &l_ToSample);
             l_PrimaryTarget->m_CurrentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
+            if (l_PreprocessBuffer != VK_NULL_HANDLE)
+            {
+                // Write the tensor and encoder planes straight into the readback buffer so the CPU only copies final bytes.
+                const bool l_Recorded = m_ReadbackPreprocessor.Record(l_CommandBuffer, imageIndex, l_PrimaryTarget->m_ImageView, l_PrimaryTarget->m_Extent,
+                    l_PrimaryTarget->m_AllocatedExtent, IsSrgbFormat(m_Swapchain.GetImageFormat()), l_PreprocessLayout, l_PreprocessBuffer);
+                if (l_Recorded)
+                {
+                    ReadbackRingSlot& l_Slot = m_ReadbackRing[l_ReadbackSlot];
+                    l_Slot.m_Layout = l_PreprocessLayout;
+                    l_Slot.m_State = ReadbackSlotState::Recorded;
+                    m_RecordedReadbackSlot = l_ReadbackSlot;
+                }
+            }
+
             // Future improvement: evaluate layered compositing so multiple render targets can blend before hitting the back buffer.
         }
         else
         {
-            if (imageIndex < m_FrameReadbackPending.size())
-            {
-                m_FrameReadbackPending[imageIndex] = false;
-            }
-
             // Legacy path clear performed via transfer op now that the render pass load operation no longer performs it implicitly.
             VkClearColorValue l_ClearValue{};
             l_ClearValue.float32[0] = m_ClearColor.r;
@@ -5511,8 +7267,8 @@ namespace Trident
                 TR_CORE_WARN("Skybox pipeline missing; skipping swapchain skybox draw until the pipeline is rebuilt.");
             }
 
-            const VkPipeline l_RenderPipeline = m_Pipeline.GetPipeline();
-            const bool l_CanRender = l_RenderPipeline != VK_NULL_HANDLE;
+            const VkPipeline l_RenderPipeline = m_Pipeline.GetPipeline(GetMeshPipelineFeatures(-1));
+            const bool l_CanRender = m_Pipeline.IsGraphicsPipelineReady();
             if (l_CanRender)
             {
                 vkCmdBindPipeline(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, l_RenderPipeline);
@@ -5523,8 +7279,7 @@ namespace Trident
                     vkCmdBindDescriptorSets(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline.GetPipelineLayout(), 0, 1, &m_DescriptorSets[imageIndex], 0, nullptr);
                 }
 
-                GatherMeshDraws();
-
+                // The draw list gathered at the top of the frame is reused, so skinned output and bone ranges stay valid here.
                 if (m_VertexBuffer != VK_NULL_HANDLE && m_IndexBuffer != VK_NULL_HANDLE && !m_MeshDrawInfo.empty() && !m_MeshDrawCommands.empty() && l_HasDescriptorSet)
                 {
                     VkBuffer l_VertexBuffers[] = { m_VertexBuffer };
@@ -5532,6 +7287,9 @@ namespace Trident
                     vkCmdBindVertexBuffers(l_CommandBuffer, 0, 1, l_VertexBuffers, l_Offsets);
                     vkCmdBindIndexBuffer(l_CommandBuffer, m_IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
 
+                    const VkBuffer l_SkinnedVertices = m_SkinningPass.GetOutputBuffer(imageIndex);
+                    VkBuffer l_BoundVertexBuffer = m_VertexBuffer;
+                    VkPipeline l_BoundPipeline = l_RenderPipeline;
                     for (const MeshDrawCommand& l_Command : m_MeshDrawCommands)
                     {
                         if (!l_Command.m_Component)
@@ -5569,10 +7327,28 @@ namespace Trident
                         l_PushConstant.m_MaterialIndex = l_MaterialIndex;
                         l_PushConstant.m_BoneOffset = static_cast<int32_t>(l_Command.m_BoneOffset);
                         l_PushConstant.m_BoneCount = static_cast<int32_t>(l_Command.m_BoneCount);
+                        l_PushConstant.m_InstanceIndex = static_cast<int32_t>(l_Command.m_SceneIndex);
+
+                        const VkPipeline l_DrawPipeline = m_Pipeline.GetPipeline(GetMeshPipelineFeatures(l_MaterialIndex));
+                        if (l_DrawPipeline != l_BoundPipeline)
+                        {
+                            vkCmdBindPipeline(l_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, l_DrawPipeline);
+                            l_BoundPipeline = l_DrawPipeline;
+                        }
+
                         vkCmdPushConstants(l_CommandBuffer, m_Pipeline.GetPipelineLayout(), VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
                             sizeof(RenderablePushConstant), &l_PushConstant);
 
-                        vkCmdDrawIndexed(l_CommandBuffer, l_DrawInfo.m_IndexCount, 1, l_DrawInfo.m_FirstIndex, l_DrawInfo.m_BaseVertex, 0);
+                        const bool l_Skinned = l_Command.m_SkinnedBaseVertex >= 0;
+                        const VkBuffer l_DrawVertexBuffer = l_Skinned ? l_SkinnedVertices : m_VertexBuffer;
+                        if (l_DrawVertexBuffer != l_BoundVertexBuffer)
+                        {
+                            vkCmdBindVertexBuffers(l_CommandBuffer, 0, 1, &l_DrawVertexBuffer, l_Offsets);
+                            l_BoundVertexBuffer = l_DrawVertexBuffer;
+                        }
+
+                        const MeshLodRange& l_Lod = l_DrawInfo.m_Lods[std::min(l_Command.m_LodLevel, l_DrawInfo.m_LodCount - 1)];
+                        vkCmdDrawIndexed(l_CommandBuffer, l_Lod.m_IndexCount, 1, l_Lod.m_FirstIndex, l_Skinned ? l_Command.m_SkinnedBaseVertex : l_DrawInfo.m_BaseVertex, 0);
                     }
                 }
 
@@ -5644,23 +7420,27 @@ namespace Trident
         // 1. Wait for the swapchain image acquired semaphore tied to the frame slot (keeps acquire/submit pacing aligned).
         // 2. Submit work that renders into the image for this frame-in-flight.
         // 3. Signal the image-scoped render-finished semaphore so presentation waits on the exact same handle when that image is presented.
-        VkSemaphore l_WaitSemaphores[] = { m_Commands.GetImageAvailableSemaphorePerImage(l_CurrentFrame) };
-        VkPipelineStageFlags l_WaitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+        // 4. Wait on the texture streaming timeline at the last value swapped in, so transfer-queue copies are visible to shaders.
+        //    The host already observed that value, so the wait never stalls the GPU.
+        VkSemaphore l_WaitSemaphores[] = { m_Commands.GetImageAvailableSemaphorePerImage(l_CurrentFrame), m_TextureStreamer.GetSemaphore() };
+        VkPipelineStageFlags l_WaitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT };
         VkSemaphore l_SignalSemaphores[] = { m_Commands.GetRenderFinishedSemaphoreForImage(imageIndex), m_Commands.GetFrameTimelineSemaphore() };
-        uint64_t l_WaitValues[] = { 0 };
+        const bool l_WaitForStreaming = m_Commands.SupportsTimelineSemaphores() && m_TextureStreamer.IsEnabled() && m_TextureStreamer.GetCompletedValue() > 0;
+        uint64_t l_WaitValues[] = { 0, m_TextureStreamer.GetCompletedValue() };
         uint64_t l_SignalValues[] = { 0, 0 };
 
+        // Increment the shared timeline so each queue submission signals a unique, increasing value across all frames. Without
+        // timeline semaphores the value is tied to the in-flight fence instead, which is how retirement learns it completed.
+        const uint64_t l_NextTimelineValue = m_Commands.IncrementTimelineValue();
+
         VkTimelineSemaphoreSubmitInfo l_TimelineSubmitInfo{ VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO };
         if (m_Commands.SupportsTimelineSemaphores())
         {
-            // Increment the shared timeline so each queue submission signals a unique, increasing value across all frames.
-            const uint64_t l_NextTimelineValue = m_Commands.IncrementTimelineValue();
-
             l_WaitValues[0] = 0;
             l_SignalValues[0] = 0; // Binary semaphore still signals render completion for presentation.
             l_SignalValues[1] = l_NextTimelineValue;
 
-            l_TimelineSubmitInfo.waitSemaphoreValueCount = 1;
+            l_TimelineSubmitInfo.waitSemaphoreValueCount = l_WaitForStreaming ? 2 : 1;
             l_TimelineSubmitInfo.pWaitSemaphoreValues = l_WaitValues;
             l_TimelineSubmitInfo.signalSemaphoreValueCount = 2;
             l_TimelineSubmitInfo.pSignalSemaphoreValues = l_SignalValues;
@@ -5668,7 +7448,7 @@ namespace Trident
 
         VkSubmitInfo l_SubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
         l_SubmitInfo.pNext = m_Commands.SupportsTimelineSemaphores() ? &l_TimelineSubmitInfo : nullptr;
-        l_SubmitInfo.waitSemaphoreCount = 1;
+        l_SubmitInfo.waitSemaphoreCount = l_WaitForStreaming ? 2 : 1;
         l_SubmitInfo.pWaitSemaphores = l_WaitSemaphores;
         l_SubmitInfo.pWaitDstStageMask = l_WaitStages;
         l_SubmitInfo.commandBufferCount = 1;
@@ -5679,27 +7459,15 @@ namespace Trident
         if (vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_SubmitInfo, inFlightFence) != VK_SUCCESS)
         {
             TR_CORE_CRITICAL("Failed to submit draw command buffer!");
+            // Nothing will signal the value now; hand it back so later waits on the timeline do not hang.
+            m_Commands.RollbackTimelineValue();
 
             // Notify the caller that the queue submission failed so the frame can be skipped cleanly.
 
             return false;
         }
 
-        if (vkGetFenceStatus(Startup::GetDevice(), m_ResourceFence) == VK_NOT_READY)
-        {
-            vkWaitForFences(Startup::GetDevice(), 1, &m_ResourceFence, VK_TRUE, UINT64_MAX);
-        }
-
-        vkResetFences(Startup::GetDevice(), 1, &m_ResourceFence);
-        VkSubmitInfo l_FenceSubmit{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
-        l_FenceSubmit.commandBufferCount = 0;
-        if (vkQueueSubmit(Startup::GetGraphicsQueue(), 1, &l_FenceSubmit, m_ResourceFence) != VK_SUCCESS)
-        {
-            TR_CORE_CRITICAL("Failed to submit resource fence");
-            // Allow the caller to decide how to recover from a failed fence submission.
-
-            return false;
-        }
+        m_Commands.TrackFrameSubmission(l_CurrentFrame, l_NextTimelineValue);
 
         return true;
     }
@@ -5736,18 +7504,39 @@ namespace Trident
         }
     }
 
+    void Renderer::CheckSteadyStateDeviceIdle()
+    {
+        // Any idle between two ordinary frames means a resource path bypassed the timeline retirement queues. Model reloads,
+        // texture refreshes and material or bone palette growth retire the replaced buffers and repoint each image's set when
+        // it is next recorded, so only swapchain recreation is exempt; the per-image in-flight fences are the only frame waits.
+        const uint64_t l_DeviceIdleCount = Startup::GetDeviceIdleCount();
+        if (l_DeviceIdleCount != m_DeviceIdleCountAtLastFrame && !m_DeviceIdleExpected)
+        {
+            TR_CORE_ERROR("vkDeviceWaitIdle ran {} time(s) during a steady-state frame", l_DeviceIdleCount - m_DeviceIdleCountAtLastFrame);
+#ifdef _DEBUG
+            assert(false && "Steady-state frames must not idle the device");
+#endif
+        }
+
+        m_DeviceIdleCountAtLastFrame = l_DeviceIdleCount;
+        m_DeviceIdleExpected = false;
+    }
+
     void Renderer::ProcessReloadEvents()
     {
+        // Model and texture reloads replace GPU resources through the same retirement paths as editor uploads, so the device
+        // is never idled here.
         auto& a_Watcher = Utilities::FileWatcher::Get();
-        bool l_DeviceIdle = false;
 
         while (auto a_Event = a_Watcher.PopPendingEvent())
         {
-            if (!l_DeviceIdle)
+            if (a_Event->Type == Utilities::FileWatcher::WatchType::Shader)
             {
-                // Block the graphics queue once before processing the first reload to ensure resources are idle.
-                vkDeviceWaitIdle(Startup::GetDevice());
-                l_DeviceIdle = true;
+                // Shader rebuilds run on the pipeline's worker and never idle the device; the event stays queued until
+                // ApplyPendingReload reports how the rebuild went.
+                m_Pipeline.RequestReload();
+                m_PendingShaderReloadEvents.push_back(a_Event->Id);
+                continue;
             }
 
             bool l_Success = false;
@@ -5755,21 +7544,6 @@ namespace Trident
 
             switch (a_Event->Type)
             {
-            case Utilities::FileWatcher::WatchType::Shader:
-            {
-                // Shader reload leverages the existing hot-reload path but skips the internal wait because we already idled above.
-                bool l_Reloaded = m_Pipeline.ReloadIfNeeded(m_Swapchain, false);
-                if (l_Reloaded && m_Pipeline.GetPipeline() != VK_NULL_HANDLE)
-                {
-                    l_Success = true;
-                    l_Message = "Graphics pipeline rebuilt";
-                }
-                else
-                {
-                    l_Message = "Shader reload failed - check compiler output";
-                }
-                break;
-            }
             case Utilities::FileWatcher::WatchType::Model:
             {
                 auto a_ModelData = Loader::ModelLoader::Load(a_Event->Path);
@@ -5819,9 +7593,36 @@ namespace Trident
         }
     }
 
+    void Renderer::CompleteShaderReloadEvents(Pipeline::ReloadResult result)
+    {
+        if (m_PendingShaderReloadEvents.empty())
+        {
+            return;
+        }
+
+        auto& a_Watcher = Utilities::FileWatcher::Get();
+        for (uint64_t it_EventId : m_PendingShaderReloadEvents)
+        {
+            switch (result)
+            {
+            case Pipeline::ReloadResult::Applied:
+                a_Watcher.MarkEventSuccess(it_EventId, "Graphics pipeline rebuilt");
+                break;
+            case Pipeline::ReloadResult::Unchanged:
+                a_Watcher.MarkEventSuccess(it_EventId, "Shader source unchanged");
+                break;
+            default:
+                a_Watcher.MarkEventFailure(it_EventId, "Shader reload failed - check compiler output");
+                break;
+            }
+        }
+
+        m_PendingShaderReloadEvents.clear();
+    }
+
     void Renderer::UpdateUniformBuffer(uint32_t currentImage, const Camera* cameraOverride, VkCommandBuffer commandBuffer)
     {
-        if (currentImage >= m_GlobalUniformBuffersMemory.size() || currentImage >= m_MaterialBuffersMemory.size())
+        if (currentImage >= m_GlobalUniformBuffersMemory.size())
         {
             return;
         }
@@ -5913,7 +7714,7 @@ namespace Trident
         l_Global.DirectionalLightColor = glm::vec4(l_DirectionalColor, l_DirectionalIntensity);
         l_Global.LightCounts = glm::uvec4(l_DirectionalUsed, l_PointLightWriteCount, 0u, 0u);
 
-        if (m_AiTextureReady && m_AiTextureExtent.width > 0 && m_AiTextureExtent.height > 0)
+        if (IsAiBlendActive())
         {
             const float l_InvWidth = 1.0f / static_cast<float>(std::max<uint32_t>(m_AiTextureExtent.width, 1));
             const float l_InvHeight = 1.0f / static_cast<float>(std::max<uint32_t>(m_AiTextureExtent.height, 1));
@@ -5924,40 +7725,10 @@ namespace Trident
             l_Global.AiBlendConfig = glm::vec4(0.0f);
         }
 
-        auto BuildMaterialPayload = [this]()
-            {
-                std::vector<MaterialUniformBuffer> l_Payload{};
-                const size_t l_TargetCount = std::max(m_MaterialBufferElementCount, static_cast<size_t>(1));
-                l_Payload.reserve(l_TargetCount);
-
-                for (const Geometry::Material& it_Material : m_Materials)
-                {
-                    MaterialUniformBuffer l_Record{};
-                    l_Record.BaseColorFactor = it_Material.BaseColorFactor;
-                    l_Record.MaterialFactors = glm::vec4(it_Material.MetallicFactor, it_Material.RoughnessFactor, 1.0f, 0.0f);
-                    l_Payload.push_back(l_Record);
-                }
-
-                MaterialUniformBuffer l_Default{};
-                l_Default.BaseColorFactor = glm::vec4(1.0f);
-                l_Default.MaterialFactors = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
-
-                while (l_Payload.size() < l_TargetCount)
-                {
-                    l_Payload.push_back(l_Default);
-                }
-
-                return l_Payload;
-            };
-
-        const bool l_HasMaterialBuffers = currentImage < m_MaterialBuffers.size() && currentImage < m_MaterialBuffersMemory.size();
-
         if (commandBuffer != VK_NULL_HANDLE)
         {
             // Record GPU-side buffer updates so each viewport captures the correct camera state before its render pass begins.
             vkCmdUpdateBuffer(commandBuffer, m_GlobalUniformBuffers[currentImage], 0, sizeof(l_Global), &l_Global);
-            std::vector<VkBufferMemoryBarrier> l_Barriers{};
-            l_Barriers.reserve(2);
 
             VkBufferMemoryBarrier l_GlobalBarrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
             l_GlobalBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -5967,48 +7738,11 @@ namespace Trident
             l_GlobalBarrier.buffer = m_GlobalUniformBuffers[currentImage];
             l_GlobalBarrier.offset = 0;
             l_GlobalBarrier.size = sizeof(l_Global);
-            l_Barriers.push_back(l_GlobalBarrier);
-
-            if (l_HasMaterialBuffers && currentImage < m_MaterialBufferDirty.size() && m_MaterialBufferDirty[currentImage])
-            {
-                std::vector<MaterialUniformBuffer> l_MaterialPayload = BuildMaterialPayload();
-                const VkDeviceSize l_CopySize = static_cast<VkDeviceSize>(l_MaterialPayload.size() * sizeof(MaterialUniformBuffer));
-                if (l_CopySize > 0)
-                {
-                    const uint8_t* l_RawData = reinterpret_cast<const uint8_t*>(l_MaterialPayload.data());
-                    VkDeviceSize l_Remaining = l_CopySize;
-                    VkDeviceSize l_Offset = 0;
-                    const VkDeviceSize l_MaxChunk = 65536;
-
-                    while (l_Remaining > 0)
-                    {
-                        const VkDeviceSize l_ChunkSize = std::min(l_Remaining, l_MaxChunk);
-                        vkCmdUpdateBuffer(commandBuffer, m_MaterialBuffers[currentImage], l_Offset, l_ChunkSize, l_RawData + l_Offset);
-                        l_Remaining -= l_ChunkSize;
-                        l_Offset += l_ChunkSize;
-                    }
-
-                    VkBufferMemoryBarrier l_MaterialBarrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
-                    l_MaterialBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                    // Ensure uniform buffer reads see the freshly uploaded material parameters.
-                    l_MaterialBarrier.dstAccessMask = VK_ACCESS_UNIFORM_READ_BIT;
-                    l_MaterialBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                    l_MaterialBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                    l_MaterialBarrier.buffer = m_MaterialBuffers[currentImage];
-                    l_MaterialBarrier.offset = 0;
-                    l_MaterialBarrier.size = l_CopySize;
-                    l_Barriers.push_back(l_MaterialBarrier);
-
-                    m_MaterialBufferDirty[currentImage] = false;
-                }
-            }
 
             // Guarantee the transfer writes are visible before the shader stages fetch the uniform data.
-            if (!l_Barriers.empty())
-            {
-                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                    0, 0, nullptr, static_cast<uint32_t>(l_Barriers.size()), l_Barriers.data(), 0, nullptr);
-            }
+            // Material records need no barrier: FlushMaterialBuffer writes them through host-coherent memory before submission.
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                0, 0, nullptr, 1, &l_GlobalBarrier, 0, nullptr);
         }
         else
         {
@@ -6017,34 +7751,6 @@ namespace Trident
             vkMapMemory(Startup::GetDevice(), m_GlobalUniformBuffersMemory[currentImage], 0, sizeof(l_Global), 0, &l_Data);
             std::memcpy(l_Data, &l_Global, sizeof(l_Global));
             vkUnmapMemory(Startup::GetDevice(), m_GlobalUniformBuffersMemory[currentImage]);
-
-            if (l_HasMaterialBuffers)
-            {
-                const bool l_ShouldUploadAll = std::any_of(m_MaterialBufferDirty.begin(), m_MaterialBufferDirty.end(), [](bool it_Dirty) { return it_Dirty; });
-                if (l_ShouldUploadAll)
-                {
-                    std::vector<MaterialUniformBuffer> l_MaterialPayload = BuildMaterialPayload();
-                    const VkDeviceSize l_CopySize = static_cast<VkDeviceSize>(l_MaterialPayload.size() * sizeof(MaterialUniformBuffer));
-                    for (size_t it_Image = 0; it_Image < m_MaterialBuffersMemory.size() && it_Image < m_MaterialBufferDirty.size(); ++it_Image)
-                    {
-                        if (!m_MaterialBufferDirty[it_Image])
-                        {
-                            continue;
-                        }
-
-                        if (m_MaterialBuffersMemory[it_Image] == VK_NULL_HANDLE)
-                        {
-                            continue;
-                        }
-
-                        void* l_MaterialData = nullptr;
-                        vkMapMemory(Startup::GetDevice(), m_MaterialBuffersMemory[it_Image], 0, l_CopySize, 0, &l_MaterialData);
-                        std::memcpy(l_MaterialData, l_MaterialPayload.data(), static_cast<size_t>(l_CopySize));
-                        vkUnmapMemory(Startup::GetDevice(), m_MaterialBuffersMemory[it_Image]);
-                        m_MaterialBufferDirty[it_Image] = false;
-                    }
-                }
-            }
         }
 
         // TODO: Expand the uniform population to handle per-camera post-processing once those systems exist.
@@ -6169,6 +7875,80 @@ namespace Trident
     }
 
     bool Renderer::SetViewportRecordingEnabled(bool enabled, uint32_t viewportID, VkExtent2D extent, const std::filesystem::path& outputPath)
+    {
+        if (!enabled && m_RecordingToReplay)
+        {
+            // No clip export is running; the replay buffer owns the capture and keeps going.
+            return true;
+        }
+
+        m_RecordingToReplay = false;
+
+        return SetViewportCaptureEnabled(enabled, viewportID, extent, outputPath);
+    }
+
+    bool Renderer::SetViewportReplayEnabled(bool enabled, uint32_t viewportID, VkExtent2D extent)
+    {
+        if (!enabled)
+        {
+            if (!m_RecordingToReplay)
+            {
+                return true;
+            }
+
+            const bool l_Stopped = SetViewportCaptureEnabled(false, viewportID, extent, {});
+            m_RecordingToReplay = false;
+
+            return l_Stopped;
+        }
+
+        // Clip export and the replay buffer share the readback path and encoder, so starting one replaces the other.
+        m_RecordingToReplay = true;
+        if (!SetViewportCaptureEnabled(true, viewportID, extent, {}))
+        {
+            m_RecordingToReplay = false;
+
+            return false;
+        }
+
+        return true;
+    }
+
+    bool Renderer::SaveViewportReplay(const std::filesystem::path& outputPath)
+    {
+        if (!m_VideoEncoder)
+        {
+            TR_CORE_WARN("Replay save to {} ignored because the replay buffer has not been started.", outputPath.string());
+
+            return false;
+        }
+
+        return m_VideoEncoder->SaveReplay(outputPath);
+    }
+
+    void Renderer::SetReplayBudget(size_t budgetBytes)
+    {
+        m_ReplayBudget = budgetBytes;
+        if (m_VideoEncoder)
+        {
+            m_VideoEncoder->SetReplayBudget(budgetBytes);
+        }
+    }
+
+    ReplayBuffer::Stats Renderer::GetReplayStats() const
+    {
+        if (!m_VideoEncoder)
+        {
+            ReplayBuffer::Stats l_Stats{};
+            l_Stats.m_BudgetBytes = m_ReplayBudget;
+
+            return l_Stats;
+        }
+
+        return m_VideoEncoder->GetReplayStats();
+    }
+
+    bool Renderer::SetViewportCaptureEnabled(bool enabled, uint32_t viewportID, VkExtent2D extent, const std::filesystem::path& outputPath)
     {
         if (enabled)
         {
@@ -6193,7 +7973,7 @@ namespace Trident
 
             if (ViewportContext* l_Context = FindViewportContext(viewportID))
             {
-                CreateOrResizeOffscreenResources(l_Context->m_Target, l_SanitizedExtent);
+                ApplyOffscreenExtent(*l_Context, l_SanitizedExtent, true);
                 // Update the cached info so the layout system doesn't immediately shrink it back.
                 l_Context->m_CachedExtent = l_SanitizedExtent;
             }
@@ -6229,6 +8009,9 @@ namespace Trident
             if (!m_VideoEncoder)
             {
                 m_VideoEncoder = std::make_unique<VideoEncoder>();
+                m_VideoEncoder->SetQueuePolicy(m_RecordingQueuePolicy, m_RecordingQueueBudget);
+                m_VideoEncoder->SetReplayBudget(m_ReplayBudget);
+                m_VideoEncoder->SetSegmentEncoderCount(m_RecordingSegmentEncoders);
             }
 
             if (!m_VideoEncoder)
@@ -6238,7 +8021,8 @@ namespace Trident
                 return false;
             }
 
-            const bool l_SessionStarted = m_VideoEncoder->BeginSession(outputPath, l_SanitizedExtent, 1);
+            const bool l_SessionStarted = m_RecordingToReplay ? m_VideoEncoder->BeginReplaySession(l_SanitizedExtent, s_ReplayTargetFps)
+                : m_VideoEncoder->BeginSession(outputPath, l_SanitizedExtent, 1);
             const bool l_SessionActive = l_SessionStarted && m_VideoEncoder->IsSessionActive();
 
             // Reject the start request if the encoder did not accept the session so the caller can surface an error.
@@ -11,6 +11,13 @@
 #include "Renderer/Buffers.h"
 #include "Renderer/Commands.h"
 #include "Renderer/Skybox.h"
+#include "Renderer/ClusterCuller.h"
+#include "Renderer/SceneBuffer.h"
+#include "Renderer/SkinningPass.h"
+#include "Renderer/TextureStreamer.h"
+#include "Renderer/ReadbackConverter.h"
+#include "Renderer/ReadbackPreprocessor.h"
+#include "Renderer/ReadbackFrame.h"
 #include "Renderer/TextRenderer.h"
 #include "Renderer/VideoEncoder.h"
 #include "AI/FrameGenerator.h"
@@ -18,6 +25,7 @@
 
 #include "Geometry/Mesh.h"
 #include "Geometry/Material.h"
+#include "Geometry/MeshSimplifier.h"
 #include "Loader/TextureLoader.h"
 
 #include "ECS/Entity.h"
@@ -35,6 +43,7 @@
 #include <vector>
 #include <array>
 #include <memory>
+#include <atomic>
 #include <functional>
 #include <chrono>
 #include <unordered_map>
@@ -43,6 +52,8 @@
 #include <string>
 #include <string_view>
 #include <filesystem>
+#include <utility>
+#include <deque>
 
 namespace Trident
 {
@@ -95,6 +106,27 @@ namespace Trident
             double AverageFPS = 0.0;
         };
 
+        // Material texture residency as of the most recent frame.
+        struct TextureResidencyStats
+        {
+            uint64_t m_ResidentBytes = 0;                    // Device memory held by material texture slots.
+            uint64_t m_BudgetBytes = 0;                      // Effective budget after clamping to the driver-reported headroom.
+            int64_t m_HeadroomBytes = 0;                     // Budget minus resident bytes; negative while over budget.
+            double m_EvictionsPerSecond = 0.0;               // Idle textures released over the last second.
+            double m_MipDropsPerSecond = 0.0;                // Textures re-streamed without their top mip over the last second.
+            uint32_t m_ResidentTextures = 0;
+            uint32_t m_ReducedTextures = 0;                  // Resident with mips dropped by the residency manager.
+            uint32_t m_EvictedTextures = 0;                  // Sampling the default texture until a draw needs them again.
+            bool m_DriverBudget = false;                     // True when VK_EXT_memory_budget lowered the configured budget.
+        };
+
+        // CPU consumers of the per-frame readback, each sampling it under its own ReadbackConsumerPolicy.
+        enum class ReadbackConsumer
+        {
+            Ai,
+            Recording
+        };
+
         // Surface AI pipeline metrics so editor tooling can reason about queue depth and timing behaviour.
         struct AiDebugStats
         {
@@ -103,6 +135,13 @@ namespace Trident
             uint64_t m_CompletedInferenceCount = 0;          // Total number of jobs that produced an output tensor.
             double m_LastInferenceMilliseconds = 0.0;        // Duration of the most recent inference in milliseconds.
             double m_AverageInferenceMilliseconds = 0.0;     // Average duration across all completed runs.
+            uint32_t m_LastBatchSize = 0;                    // Frames packed into the most recent run.
+            double m_AverageBatchSize = 0.0;                 // Frames per run since the model was loaded.
+            double m_LatencyP50Milliseconds = 0.0;           // Per-frame submit-to-output latency over recent frames.
+            double m_LatencyP95Milliseconds = 0.0;
+            double m_LatencyP99Milliseconds = 0.0;
+            uint64_t m_DroppedReadbackFrames = 0;            // Completed readbacks replaced before inference picked them up.
+            uint64_t m_SkippedReadbackFrames = 0;            // Frames rendered without a readback copy because every ring slot was busy.
             bool m_TextureReady = false;                     // Signals whether the AI texture is bound for sampling.
             float m_BlendStrength = 0.0f;                    // Current blend factor applied during compositing.
             VkExtent2D m_TextureExtent{ 0, 0 };              // Resolution of the uploaded AI texture.
@@ -152,6 +191,18 @@ namespace Trident
          */
         uint32_t GetFrameDatasetCaptureInterval() const { return m_FrameDatasetCaptureInterval; }
 
+        /**
+         * @brief Choose which completed readbacks a consumer receives.
+         *
+         * Readback is copied every frame; the policy replaces the old fixed throttle. The interval only applies to EveryNth.
+         */
+        void SetReadbackConsumerPolicy(ReadbackConsumer consumer, ReadbackConsumerPolicy policy, uint32_t interval = 1);
+
+        /**
+         * @brief Query the sampling policy applied to a readback consumer.
+         */
+        ReadbackConsumerPolicy GetReadbackConsumerPolicy(ReadbackConsumer consumer) const;
+
         /**
          * @brief Expose whether dataset capture is currently active.
          */
@@ -192,6 +243,29 @@ namespace Trident
         size_t GetLastFrameAllocationCount() const { return m_FrameAllocationCount; }
         size_t GetModelCount() const { return m_ModelCount; }
         size_t GetTriangleCount() const { return m_TriangleCount; }
+        // Triangles skipped this frame because a coarser LOD was drawn instead of LOD0.
+        size_t GetLodTrianglesSaved() const { return m_LodTrianglesSaved; }
+        // Positive bias favours coarser LODs (each step doubles the pixel error budget); negative keeps detail longer.
+        void SetLodBias(float bias);
+        float GetLodBias() const { return m_LodBias; }
+        // Toggle the compute cluster-culling pass; disabled meshes fall back to one indexed draw per LOD.
+        void SetClusterCullingEnabled(bool enabled) { m_ClusterCullingEnabled = enabled; }
+        bool IsClusterCullingEnabled() const { return m_ClusterCullingEnabled; }
+        // Toggle two-phase hierarchical-Z occlusion on top of cluster culling; only takes effect while cluster culling is on.
+        void SetOcclusionCullingEnabled(bool enabled) { m_OcclusionCullingEnabled = enabled; }
+        bool IsOcclusionCullingEnabled() const { return m_OcclusionCullingEnabled; }
+        const ClusterCuller::CullingStats& GetClusterCullingStats() const { return m_ClusterCuller.GetStats(); }
+        const SceneBuffer::UploadStats& GetSceneBufferStats() const { return m_SceneBuffer.GetStats(); }
+        // Anisotropy applies to every material sampler immediately (clamped to the device limit).
+        void SetTextureAnisotropy(float anisotropy);
+        float GetTextureAnisotropy() const { return m_TextureAnisotropy; }
+        // Number of top mips skipped for textures uploaded from now on; trades sharpness for memory.
+        void SetTextureMipDropCount(uint32_t count);
+        uint32_t GetTextureMipDropCount() const { return m_TextureMipDropCount; }
+        // 0 selects half of the device-local heap; VK_EXT_memory_budget can lower the effective budget further.
+        void SetTextureMemoryBudget(uint64_t bytes);
+        uint64_t GetTextureMemoryBudget() const { return m_TextureMemoryBudget; }
+        const TextureResidencyStats& GetTextureResidencyStats() const { return m_TextureResidencyStats; }
         const FrameTimingStats& GetFrameTimingStats() const { return m_PerformanceStats; }
         size_t GetFrameTimingHistoryCount() const { return m_PerformanceSampleCount; }
         const std::vector<FrameTimingSample>& GetFrameTimingHistory() const { return m_PerformanceHistory; }
@@ -205,17 +279,57 @@ namespace Trident
         bool SetViewportRecordingEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent, const std::filesystem::path& outputPath);
 
         /**
-         * @brief Submit the latest readback buffer as a recorded frame when available.
+         * @brief Submit every resolved readback as a recorded frame, tagged with its own capture time and image.
          */
-        void SubmitViewportFrame(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp);
+        void SubmitViewportFrame();
 
         /**
          * @brief Query whether the renderer is actively recording viewport frames.
          */
         bool IsViewportRecording() const { return m_ViewportRecordingEnabled; }
 
+        /**
+         * @brief Keep the last stretch of a viewport in an in-memory ring of encoded video, bounded by the replay budget.
+         *
+         * Shares the capture path with clip export, so starting either one stops the other.
+         */
+        bool SetViewportReplayEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent);
+        bool IsViewportReplayActive() const { return m_ViewportRecordingEnabled && m_RecordingToReplay; }
+
+        /**
+         * @brief Write the replay ring to outputPath on a background thread; also works after the replay was stopped.
+         */
+        bool SaveViewportReplay(const std::filesystem::path& outputPath);
+        void SetReplayBudget(size_t budgetBytes);
+        size_t GetReplayBudget() const { return m_ReplayBudget; }
+        ReplayBuffer::Stats GetReplayStats() const;
+
+        /**
+         * @brief Bound the encoder's frame queue and pick what happens when recording outpaces encoding.
+         *
+         * Kept across recording sessions; the budget is in bytes of queued pixel data.
+         */
+        void SetRecordingQueuePolicy(VideoEncoder::QueueOverflowPolicy policy, size_t budgetBytes);
+        VideoEncoder::QueueOverflowPolicy GetRecordingQueuePolicy() const { return m_RecordingQueuePolicy; }
+        size_t GetRecordingQueueBudget() const { return m_RecordingQueueBudget; }
+
+        /**
+         * @brief Split file recordings across several encoder instances, one fixed-length segment each.
+         *
+         * Takes effect when the next recording starts.
+         */
+        void SetRecordingSegmentEncoders(uint32_t encoderCount);
+        uint32_t GetRecordingSegmentEncoders() const { return m_RecordingSegmentEncoders; }
+
+        /**
+         * @brief Snapshot the encoder queue depth, drops and latency for the recording UI.
+         */
+        VideoEncoder::QueueStats GetRecordingQueueStats() const;
+
         /**
          * @brief Inspect buffered viewport frames so tooling can visualise progress.
+         *
+         * Holds metadata for the most recent frames only, never more than twice s_MaxViewportFrameHistory entries.
          */
         const std::vector<VideoEncoder::RecordedFrame>& GetViewportFrameBuffer() const { return m_ViewportFrameBuffer; }
 
@@ -233,6 +347,8 @@ namespace Trident
         void SetWorldTransform(ECS::Entity entity, const glm::mat4& worldTransform);
         ViewportInfo GetViewport() const;
         VkDescriptorSet GetViewportTexture(uint32_t viewportId) const;
+        // Bottom-right UV of the rendered region; viewport targets are allocated in size buckets and cropped to the panel.
+        glm::vec2 GetViewportTextureUV(uint32_t viewportId) const;
         ECS::Entity GetViewportCamera() const { return m_ViewportCamera; }
 
         // Provide tooling with the matrices required for gizmo overlay composition.
@@ -247,6 +363,9 @@ namespace Trident
         // Access to the CPU-side material cache so editor widgets can tweak shading values.
         std::vector<Geometry::Material>& GetMaterials() { return m_Materials; }
         const std::vector<Geometry::Material>& GetMaterials() const { return m_Materials; }
+        // Call after editing materials in place; only the records in [firstMaterial, firstMaterial + count) are re-uploaded.
+        void MarkMaterialsDirty(size_t firstMaterial, size_t count = 1);
+        void SetMaterial(size_t materialIndex, const Geometry::Material& material);
 
         VkRenderPass GetRenderPass() const { return m_Pipeline.GetRenderPass(); }
         uint32_t GetImageCount() const { return m_Swapchain.GetImageCount(); }
@@ -272,6 +391,15 @@ namespace Trident
          */
         float GetAiBlendStrength() const { return m_AiBlendStrength; }
 
+        /**
+         * @brief Batch queued AI frames into one inference run for offline or dataset work that favours throughput.
+         *
+         * A batch size of one keeps the low-latency default. Pair larger batches with a readback policy that hands
+         * over every frame, otherwise the latest-only queue rarely lets a batch fill before the wait expires.
+         */
+        void SetAiBatching(uint32_t maxBatchSize, std::chrono::milliseconds maxWait);
+        uint32_t GetAiMaxBatchSize() const { return m_FrameGenerator.GetMaxBatchSize(); }
+
         /**
          * @brief Placeholder for tooling that wishes to display the AI texture in UI panels.
          *
@@ -290,12 +418,27 @@ namespace Trident
     private:
         static constexpr uint32_t s_MaxBonesPerSkeleton = 128; // Enough for Mixamo rigs with headroom for future assets.
 
+        struct MeshLodRange
+        {
+            uint32_t m_FirstIndex = 0;            // First index of this LOD inside the shared index buffer.
+            uint32_t m_IndexCount = 0;            // Number of indices submitted when this LOD is selected.
+            float m_Error = 0.0f;                 // Object-space error reported by the simplifier.
+        };
+
         struct MeshDrawInfo
         {
             uint32_t m_FirstIndex = 0;            // First index in the shared buffer for the mesh.
             uint32_t m_IndexCount = 0;            // Number of indices the draw call should submit.
             int32_t m_BaseVertex = 0;             // Base vertex offset applied during drawing.
+            uint32_t m_VertexCount = 0;           // Vertices owned by the mesh; the skinning pass processes all of them.
             int32_t m_MaterialIndex = -1;         // Material resolved at upload time.
+            std::array<MeshLodRange, Geometry::MeshSimplifier::s_MaxLodCount> m_Lods{}; // LOD0 mirrors m_FirstIndex/m_IndexCount.
+            uint32_t m_LodCount = 1;              // Number of valid entries in m_Lods.
+            glm::vec3 m_BoundsCenter{ 0.0f };     // Object-space bounding sphere centre used for LOD selection.
+            float m_BoundsRadius = 0.0f;          // Object-space bounding sphere radius.
+            uint32_t m_FirstCluster = 0;          // First entry in the cluster culling table.
+            uint32_t m_ClusterCount = 0;          // Zero when the mesh was too small to be clustered.
+            std::array<uint32_t, Geometry::MeshSimplifier::s_MaxLodCount> m_LodClusters{}; // Whole-LOD cluster used when meshlets are unavailable.
         };
 
         struct MeshDrawCommand
@@ -306,6 +449,11 @@ namespace Trident
             const AnimationComponent* m_AnimationComponent = nullptr; // Optional animation data driving skinning.
             uint32_t m_BoneOffset = 0;            // Offset into the bone palette buffer assigned during batching.
             uint32_t m_BoneCount = 0;             // Number of matrices contributing to this palette.
+            uint32_t m_LodLevel = 0;              // Index into MeshDrawInfo::m_Lods chosen during gathering.
+            uint32_t m_ClusterCommandOffset = 0;  // First indirect command written by the cluster culling pass.
+            uint32_t m_ClusterCommandCount = 0;   // Non-zero when the draw goes through ClusterCuller::DrawClusters.
+            uint32_t m_SceneIndex = 0;            // Persistent SceneBuffer slot holding this entity's instance record.
+            int32_t m_SkinnedBaseVertex = -1;     // First vertex in the skinning pass output; -1 draws from the shared buffer.
             ECS::Entity m_Entity = 0;             // Owning entity for debugging and picking hooks.
         };
 
@@ -326,13 +474,21 @@ namespace Trident
         };
 
         void GatherMeshDraws();
+        uint32_t SelectMeshLod(const MeshDrawInfo& drawInfo, const glm::mat4& modelMatrix, uint32_t currentLod, const glm::vec3& cameraPosition,
+            float projectionScale, bool orthographic) const;
         void BuildSpriteGeometry();
         void DestroySpriteGeometry();
         void GatherSpriteDraws();
         void DrawSprites(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+        // Pipeline permutation bits shared by every draw this frame, and the per-mesh bits layered on top of them.
+        uint32_t GetFramePipelineFeatures() const;
+        uint32_t GetMeshPipelineFeatures(int32_t materialIndex) const;
         void EnsureSkinningBufferCapacity(size_t requiredMatrices);
-        void RefreshBonePaletteDescriptors();
+        void RefreshBonePaletteDescriptor(uint32_t imageIndex);
         void PrepareBonePaletteBuffer(uint32_t imageIndex);
+        void PrepareClusterInstances(uint32_t imageIndex);
+        void RefreshSceneBufferDescriptor(uint32_t imageIndex);
+        void PrepareSkinning(VkCommandBuffer commandBuffer, uint32_t imageIndex);
         size_t CreatePrimitiveMeshInCache(MeshComponent::PrimitiveType primitiveType);
         void EnsurePrimitiveMeshesInCache();
 
@@ -354,23 +510,30 @@ namespace Trident
         VkDeviceSize m_BonePaletteBufferSize = 0;               // Size in bytes of each bone palette buffer.
         size_t m_BonePaletteMatrixCapacity = 0;                 // Number of matrices allocated per swapchain image.
         std::vector<glm::mat4> m_BonePaletteScratch;            // CPU staging area populated before uploading to the GPU.
+        uint64_t m_BonePaletteGeneration = 0;                   // Bumped whenever the palette buffers are reallocated.
+        std::vector<uint64_t> m_BonePaletteDescriptorGenerations; // Bone palette generation each descriptor set last bound.
 
         // Pipeline
         Pipeline m_Pipeline;
+        std::vector<uint64_t> m_PendingShaderReloadEvents;       // File watcher events waiting on the pipeline's background rebuild.
 
         // Command pool, buffers and sync objects
         Commands m_Commands;
-        VkFence m_ResourceFence = VK_NULL_HANDLE;
+        uint64_t m_DeviceIdleCountAtLastFrame = 0;               // Startup::GetDeviceIdleCount() when the previous frame began.
+        bool m_DeviceIdleExpected = true;                        // Set by swapchain recreation, the only per-frame path still allowed to idle.
 
         // Descriptor sets & uniform buffers
         VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
         std::vector<VkDescriptorSet> m_DescriptorSets;
         std::vector<VkBuffer> m_GlobalUniformBuffers;
         std::vector<VkDeviceMemory> m_GlobalUniformBuffersMemory;
-        std::vector<VkBuffer> m_MaterialBuffers;               // Per-frame GPU-visible cache of material records.
+        std::vector<VkBuffer> m_MaterialBuffers;               // Per-image storage buffers indexed by RenderablePushConstant::m_MaterialIndex.
         std::vector<VkDeviceMemory> m_MaterialBuffersMemory;    // Backing memory for the material storage buffers.
-        std::vector<bool> m_MaterialBufferDirty;                // Tracks which per-frame material uploads still need refreshing.
+        std::vector<void*> m_MaterialBuffersMapped;             // Persistently mapped, host-coherent views of m_MaterialBuffersMemory.
+        std::vector<std::vector<std::pair<uint32_t, uint32_t>>> m_MaterialDirtyRanges; // Per image [first, end) records not yet copied.
         size_t m_MaterialBufferElementCount = 0;                // Number of MaterialUniformBuffer records resident on the GPU.
+        uint64_t m_MaterialBufferGeneration = 0;                // Bumped whenever the material buffers are reallocated.
+        std::vector<uint64_t> m_MaterialDescriptorGenerations;  // Material buffer generation each descriptor set last bound.
         struct TextureSlot
         {
             VkImage m_Image = VK_NULL_HANDLE;                    // Backing image containing the texture pixels.
@@ -378,12 +541,33 @@ namespace Trident
             VkImageView m_View = VK_NULL_HANDLE;                 // View used for sampling.
             VkSampler m_Sampler = VK_NULL_HANDLE;                // Sampler describing filtering/wrapping.
             VkDescriptorImageInfo m_Descriptor{};                // Cached descriptor info for descriptor writes.
+            uint32_t m_MipLevels = 1;                            // Mip levels resident in m_Image.
             std::string m_SourcePath{};                          // Normalized path of the source asset.
+            uint64_t m_StreamTicket = 0;                         // Non-zero while a streamed upload for the slot is in flight.
+            VkDeviceSize m_ResidentBytes = 0;                    // Device memory bound to m_Image.
+            std::chrono::steady_clock::time_point m_LastUsedTime{}; // m_TextureResidencyTime of the last gathered draw that sampled the slot.
+            uint32_t m_ResidencyMipDrop = 0;                     // Mips dropped under memory pressure, on top of m_TextureMipDropCount.
+            uint32_t m_RequestedMipDrop = 0;                     // Residency drop of the upload in flight.
+            bool m_Evicted = false;                              // Released under memory pressure; streamed back when a draw samples it.
+            bool m_Linear = false;                               // Data map (normal, metallic-roughness) stored as UNORM.
         };
 
         std::vector<TextureSlot> m_TextureSlots;                 // GPU texture slots shared across materials.
         std::unordered_map<std::string, uint32_t> m_TextureSlotLookup; // Maps normalized texture paths to slot indices.
         std::vector<VkDescriptorImageInfo> m_TextureDescriptorCache;   // Scratch buffer used when updating descriptor arrays.
+        std::vector<VkWriteDescriptorSet> m_TextureDescriptorWrites;   // One write per run of consecutive dirty slots.
+        std::vector<bool> m_TextureDescriptorDirty;              // Per-image sets whose texture array is rewritten once that image is reacquired.
+        std::vector<std::vector<uint32_t>> m_TextureDescriptorUpdates; // Per-image slots written at that image's next flush.
+        std::vector<uint32_t> m_TextureResidencyChanges;         // Slots whose descriptor changed this frame; their materials are re-recorded.
+        TextureStreamer m_TextureStreamer;                       // Worker decode + transfer-queue uploads for material textures.
+        std::unordered_map<uint64_t, uint32_t> m_StreamingTextureSlots; // Stream ticket -> slot awaiting that upload.
+        std::chrono::steady_clock::time_point m_TextureResidencyTime{}; // Sampled once per frame before draws are gathered.
+        std::chrono::steady_clock::time_point m_TextureBudgetQueryTime{}; // Last VK_EXT_memory_budget query.
+        uint64_t m_TextureMemoryBudget = 0;                      // Configured texture budget in bytes; 0 selects the automatic default.
+        TextureResidencyStats m_TextureResidencyStats{};
+        uint32_t m_WindowEvictions = 0;                          // Evictions since m_ResidencyWindowStart.
+        uint32_t m_WindowMipDrops = 0;                           // Mip drops since m_ResidencyWindowStart.
+        std::chrono::steady_clock::time_point m_ResidencyWindowStart{};
         VkBuffer m_SpriteVertexBuffer = VK_NULL_HANDLE;      // Shared quad geometry for batched sprites.
         VkDeviceMemory m_SpriteVertexMemory = VK_NULL_HANDLE;// Memory backing the sprite vertex buffer.
         VkBuffer m_SpriteIndexBuffer = VK_NULL_HANDLE;       // Index buffer referencing the shared quad.
@@ -412,9 +596,11 @@ namespace Trident
             VkFramebuffer m_Framebuffer = VK_NULL_HANDLE;
             VkDescriptorSet m_TextureID = VK_NULL_HANDLE;
             VkSampler m_Sampler = VK_NULL_HANDLE;
-            VkExtent2D m_Extent{ 0, 0 };
+            VkExtent2D m_Extent{ 0, 0 };               // Rendered region; render area, scissor and copies are cropped to it.
+            VkExtent2D m_AllocatedExtent{ 0, 0 };      // Bucketed size the attachments were created with.
             VkImageLayout m_CurrentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
             VkImageLayout m_DepthLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            uint32_t m_Revision = 0;                   // Bumped on every recreation so dependent resources can rebuild.
         };
 
         // Offscreen rendering resources keyed by viewport identifier so multiple panels can co-exist.
@@ -423,14 +609,25 @@ namespace Trident
             ViewportInfo m_Info{};                     // Latest position/size reported by the owning panel.
             VkExtent2D m_CachedExtent{ 0, 0 };         // Cached Vulkan extent used to avoid redundant resizes.
             OffscreenTarget m_Target{};                // Offscreen render target backing the viewport.
+            uint32_t m_StableFrames = 0;               // Frames since m_CachedExtent last changed; reallocation waits for it to settle.
         };
 
         std::unordered_map<uint32_t, ViewportContext> m_ViewportContexts;
+        std::deque<OffscreenTarget> m_OffscreenTargetPool; // Detached targets kept for reuse, oldest first.
+        static constexpr uint32_t s_OffscreenBucketSize = 64;        // Allocation granularity of viewport targets in pixels.
+        static constexpr uint32_t s_OffscreenSettleFrames = 8;       // Stable frames before a target is reallocated to fit.
+        static constexpr size_t s_MaxPooledOffscreenTargets = 4;
         uint32_t m_ActiveViewportId = 0;
         static constexpr uint32_t s_InvalidViewportId = std::numeric_limits<uint32_t>::max();
         ECS::Entity m_ViewportCamera = std::numeric_limits<ECS::Entity>::max();
 
         Buffers m_Buffers;
+        ClusterCuller m_ClusterCuller;
+        SceneBuffer m_SceneBuffer;                  // Persistent per-entity instance records read through set 0, binding 5.
+        std::vector<uint64_t> m_SceneBufferDescriptorGenerations; // Scene buffer generation each descriptor set last bound.
+        SkinningPass m_SkinningPass;                // Skins animated meshes once per frame for every viewport.
+        bool m_ClusterCullingEnabled = true;        // Editor toggle used to compare culled and unculled throughput.
+        bool m_OcclusionCullingEnabled = true;      // Editor toggle for the depth-pyramid occlusion phase.
 
         TextRenderer m_TextRenderer;
         std::unordered_map<uint32_t, std::vector<TextSubmission>> m_TextSubmissionQueue; // Per-viewport text queued this frame.
@@ -459,6 +656,20 @@ namespace Trident
 
         size_t m_ModelCount = 0;
         size_t m_TriangleCount = 0;
+        size_t m_LodTrianglesSaved = 0;            // Per-frame triangle reduction gained from LOD selection.
+        float m_LodBias = 0.0f;                    // Editor-controlled bias applied to the LOD pixel error threshold.
+        float m_TextureAnisotropy = 8.0f;          // Requested anisotropy for material samplers.
+        uint32_t m_TextureMipDropCount = 0;        // Top mips skipped when uploading material textures.
+        static constexpr float s_MaxTextureAnisotropy = 16.0f;
+        static constexpr uint32_t s_MaxTextureMipDropCount = 4;
+        static constexpr uint32_t s_MinDroppedTextureSize = 64; // Textures at or below this size keep their top mip.
+        static constexpr std::chrono::seconds s_TextureIdleTime{ 2 }; // Time without a draw before a texture may be evicted outright.
+        static constexpr uint32_t s_MaxResidencyMipDrop = 3;    // Mips the residency manager may drop from textures still in use.
+        static constexpr std::chrono::milliseconds s_TextureBudgetQueryInterval{ 500 }; // Time between VK_EXT_memory_budget queries.
+        static constexpr double s_TextureRestoreThreshold = 0.75; // Dropped mips come back only while residency is below this fraction of the budget.
+        static constexpr size_t s_MaxMaterialDirtyRanges = 64;  // Pending ranges per image before they collapse into one span.
+        static constexpr float s_LodPixelErrorThreshold = 1.0f; // Screen-space error (pixels) tolerated before refining.
+        static constexpr float s_LodHysteresis = 0.25f;         // Relative band that keeps LODs from flickering at boundaries.
 
         static constexpr uint32_t s_MaxPointLights = kMaxPointLights; // Mirror uniform buffer light budget.
         static constexpr glm::vec3 s_DefaultDirectionalDirection{ -0.5f, -1.0f, -0.3f }; // Fallback sun direction.
@@ -481,10 +692,52 @@ namespace Trident
 
         AI::FrameGenerator m_FrameGenerator;                   // Helper that owns the ONNX runtime bindings.
         std::vector<float> m_AiInterpolationBuffer;            // Latest AI output available for dependent passes.
-        std::vector<float> m_PendingFrameReadback;             // Staging buffer populated once GPU readback hooks are ready.
-        std::vector<VkBuffer> m_FrameReadbackBuffers;          // CPU-visible buffers receiving colour copies per swapchain image.
-        std::vector<VkDeviceMemory> m_FrameReadbackMemory;     // Host-visible allocations backing the staging buffers.
-        std::vector<bool> m_FrameReadbackPending;              // Flags indicating which buffers contain fresh GPU data.
+
+        // Host-visible readback buffer, mapped once at creation. Consumers read it in place through ReadbackFrame handles.
+        struct ReadbackStagingBuffer
+        {
+            VkBuffer m_Buffer = VK_NULL_HANDLE;
+            VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+            uint8_t* m_Mapped = nullptr;
+            VkDeviceSize m_Size = 0;
+            bool m_HostCached = false;                         // Cached memory is not coherent; mapped ranges are invalidated before reads.
+            std::shared_ptr<std::atomic<bool>> m_InUse;        // Set while a ReadbackLease over this buffer is alive.
+
+            bool IsInUse() const { return m_InUse && m_InUse->load(std::memory_order_acquire); }
+        };
+
+        enum class ReadbackSlotState
+        {
+            Free,        // Resolved or never written; the next copy may land here.
+            Recorded,    // A copy was recorded into this frame's command buffer but not submitted yet.
+            Submitted    // Waiting for the GPU to reach m_TimelineValue.
+        };
+
+        // One entry of the readback ring. Slots are picked up only once the timeline shows their copy finished, never waited on.
+        struct ReadbackRingSlot
+        {
+            ReadbackStagingBuffer m_Staging;
+            ReadbackPreprocessLayout m_Layout{};               // Layout the pre-process wrote; empty means raw pixels.
+            ReadbackSlotState m_State = ReadbackSlotState::Free;
+            uint64_t m_TimelineValue = 0;                      // Frame submission that writes the slot.
+            std::chrono::system_clock::time_point m_CaptureTimestamp{};
+            uint32_t m_ImageIndex = 0;                         // Swapchain image the copy reads from.
+        };
+
+        ReadbackConsumerQueue m_AiReadbackQueue;               // Tensors waiting for the AI helper; latest-only by default.
+        ReadbackConsumerQueue m_EncoderReadbackQueue;          // Encoder payloads waiting for submission; every frame by default.
+        ReadbackConverter m_ReadbackConverter;                 // Converts raw readback on the CPU when the GPU pre-process is unavailable.
+        ReadbackPreprocessor m_ReadbackPreprocessor;           // Writes the tensor and encoder planes straight into the readback buffers.
+        std::vector<ReadbackRingSlot> m_ReadbackRing;          // Frames in flight to the CPU; one more than the frames the GPU can have queued.
+        uint32_t m_ReadbackRingCursor = 0;                     // Slot the next copy tries first, so slots are reused round robin.
+        uint32_t m_RecordedReadbackSlot = s_InvalidReadbackSlot; // Slot written by the command buffer being recorded.
+        uint64_t m_SkippedReadbackFrames = 0;                  // Frames recorded without a copy because every slot was still busy.
+        static constexpr uint32_t s_InvalidReadbackSlot = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t s_MaxReadbackRingSize = 8;
+        std::vector<ReadbackStagingBuffer> m_HeldReadbackStaging;  // Swapped out while consumers still read them.
+        std::vector<ReadbackStagingBuffer> m_SpareReadbackStaging; // Released buffers of the current size, ready to swap in.
+        static constexpr size_t s_MaxHeldReadbackStaging = 6;  // Beyond this, frames are skipped until consumers catch up.
+        static constexpr size_t s_MaxSpareReadbackStaging = 2;
         VkExtent2D m_FrameReadbackExtent{ 0, 0 };              // Cached extent used to validate copy/readback paths.
         VkExtent2D m_LastReadbackExtent{ 0, 0 };               // Tracks the last requested readback extent to avoid redundant resizes.
         VkExtent2D m_PendingReadbackExtent{ 0, 0 };            // Extent staged for the next resize operation.
@@ -517,10 +770,6 @@ namespace Trident
         bool m_FrameDatasetCaptureEnabled = false;             // Indicates whether dataset capture is currently running.
         uint32_t m_FrameDatasetCaptureInterval = 1;            // Frequency at which frames are sampled for dataset capture.
         std::filesystem::path m_FrameDatasetCaptureDirectory;  // Target directory for captured dataset artefacts.
-        std::chrono::steady_clock::time_point m_NextReadbackTime{ std::chrono::steady_clock::time_point::min() }; // Next time a readback resolve is allowed.
-        std::chrono::steady_clock::time_point m_NextAiInferenceTime{ std::chrono::steady_clock::time_point::min() }; // Next time an AI inference is allowed.
-        std::chrono::milliseconds m_ReadbackThrottleInterval{ 66 }; // Throttle interval for readback resolves to reduce per-frame overhead.
-        std::chrono::milliseconds m_AiInferenceThrottleInterval{ 66 }; // Throttle interval for AI submissions to decouple from the render loop.
         bool m_ReadbackEnabled = false;                       // Indicates whether CPU readback is currently required by AI or recording.
         bool m_ReadbackDestroyPending = false;               // True when readback buffers should be destroyed once GPU work completes.
         bool m_ViewportRecordingEnabled = false;               // Tracks whether viewport capture is active.
@@ -529,16 +778,23 @@ namespace Trident
         std::filesystem::path m_RecordingOutputPath{};         // Destination file path for the recording session.
         std::unique_ptr<VideoEncoder> m_VideoEncoder;          // Helper that streams recorded frames to disk.
         bool m_ViewportRecordingSessionActive = false;         // Tracks whether the encoder session is ready to accept frames.
-        std::vector<uint8_t> m_PendingFrameReadbackBytes;      // Raw RGBA data copied from the GPU for capture.
-        std::vector<VideoEncoder::RecordedFrame> m_ViewportFrameBuffer; // Buffered frames retained for status displays.
-        std::chrono::system_clock::time_point m_LastReadbackTimestamp{}; // Timestamp captured alongside the last readback.
+        std::vector<VideoEncoder::RecordedFrame> m_ViewportFrameBuffer; // Metadata of submitted frames retained for status displays.
+        static constexpr size_t s_MaxViewportFrameHistory = 256;
+        VideoEncoder::QueueOverflowPolicy m_RecordingQueuePolicy = VideoEncoder::QueueOverflowPolicy::DropOldest; // Applied to every encoder session.
+        size_t m_RecordingQueueBudget = VideoEncoder::s_DefaultQueueBudgetBytes; // Byte budget for frames waiting on the encoder.
+        uint32_t m_RecordingSegmentEncoders = 1; // Parallel segment encoders for file recordings.
+        bool m_RecordingToReplay = false;                      // The capture session feeds the replay ring instead of a file.
+        size_t m_ReplayBudget = VideoEncoder::s_DefaultReplayBudgetBytes; // Bytes of encoded video the replay ring keeps.
+        static constexpr uint32_t s_ReplayTargetFps = 60;
 
     private:
         // Core setup
         void ProcessAiFrame();
         bool TryInitialiseAiModel();
         void SetReadbackEnabled(bool enabled, VkExtent2D resizeTarget);
-        bool TryAcquireRenderedFrame(std::vector<float>& outPixels);
+        // Shared start and stop for clip export and the replay buffer; m_RecordingToReplay picks the encoder session.
+        bool SetViewportCaptureEnabled(bool enabled, uint32_t viewportId, VkExtent2D extent, const std::filesystem::path& outputPath);
+        bool TryAcquireRenderedFrame(ReadbackFrame& outFrame);
         std::optional<std::filesystem::path> ResolveAiModelPath() const;
         void RequestReadbackResize(VkExtent2D targetExtent, bool force = false);
         void ApplyPendingReadbackResize();
@@ -546,7 +802,17 @@ namespace Trident
         void CreateOrResizeReadbackResources(VkExtent2D targetExtent);
         void DestroyReadbackResources();
         void TryCompleteReadbackDestroy();
-        void ResolvePendingReadback(uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp);
+        void ResolveCompletedReadbacks();
+        void ResolveReadbackSlot(ReadbackRingSlot& slot);
+        uint32_t AcquireReadbackSlot();
+        void CompleteReadbackSubmission(bool submitted, uint32_t imageIndex, std::chrono::system_clock::time_point captureTimestamp);
+        uint32_t GetReadbackRingSize() const;
+        ReadbackStagingBuffer CreateReadbackStaging(VkDeviceSize size);
+        void DestroyReadbackStaging(ReadbackStagingBuffer& staging);
+        void ReleaseReadbackStaging(ReadbackStagingBuffer& staging);
+        void CollectReleasedReadbackStaging();
+        bool EnsureWritableReadbackStaging(ReadbackStagingBuffer& staging);
+        ReadbackPreprocessLayout BuildReadbackPreprocessLayout(VkExtent2D readbackExtent, uint32_t readbackChannelCount) const;
         bool EnsureAiTextureResources(VkExtent2D extent);
         void DestroyAiResources();
         void UploadAiInterpolationToGpu();
@@ -564,15 +830,30 @@ namespace Trident
 
         void DestroyTextureSlot(TextureSlot& slot);
         bool PopulateTextureSlot(TextureSlot& slot, const Loader::TextureData& textureData);
-        void EnsureTextureDescriptorCapacity();
+        bool CreateTextureSampler(uint32_t mipLevels, VkSampler& sampler) const;
         void RefreshTextureDescriptorBindings();
-        uint32_t AcquireTextureSlot(const std::string& normalizedPath, const Loader::TextureData& textureData);
+        void MarkTextureDescriptorsDirty();
+        void MarkTextureSlotDirty(uint32_t slotIndex);
+        void FlushTextureDescriptorSet(uint32_t imageIndex);
+        void ApplyStreamedTextures();
+        uint32_t AcquireTextureSlot(const std::string& normalizedPath, const Loader::TextureData& textureData, bool linear);
+        uint32_t RequestTextureSlot(const std::string& normalizedPath, bool linear);
+        void RefreshTextureSlot(const std::string& normalizedPath, bool linear, const Loader::TextureData& texture);
+        void MarkTextureSlotUsed(int32_t slotIndex);
+        void RestreamTextureSlot(uint32_t slotIndex, uint32_t residencyMipDrop);
+        void RetireTextureSlot(TextureSlot& slot);
+        void QueryTextureMemoryBudget(uint64_t residentBytes);
+        void UpdateTextureResidency();
         void ResolveMaterialTextureSlots(const std::vector<std::string>& textures, size_t materialOffset, size_t materialCount);
         std::string NormalizeTexturePath(const std::string& texturePath) const;
 
         void EnsureMaterialBufferCapacity(size_t materialCount);
-        void UpdateMaterialDescriptorBindings();
+        void DestroyMaterialBuffers();
+        void RefreshMaterialDescriptor(uint32_t imageIndex);
         void MarkMaterialBuffersDirty();
+        void FlushMaterialBuffer(uint32_t imageIndex);
+        int32_t GetResidentTextureSlot(int32_t slotIndex) const;
+        void MarkMaterialsForTextureResidency();
 
         void UpdateUniformBuffer(uint32_t currentImage, const Camera* cameraOverride = nullptr, VkCommandBuffer commandBuffer = VK_NULL_HANDLE);
         void UploadMeshFromCache();
@@ -583,7 +864,9 @@ namespace Trident
         void PresentFrame(uint32_t imageIndex);
 
         bool IsValidViewport(const ViewportInfo& info) const { return info.Size.x > 0 && info.Size.y > 0; }
+        bool IsAiBlendActive() const { return m_AiTextureReady && m_AiTextureExtent.width > 0 && m_AiTextureExtent.height > 0; }
         void ProcessReloadEvents();
+        void CompleteShaderReloadEvents(Pipeline::ReloadResult result);
         void AccumulateFrameTiming(double frameMilliseconds, double framesPerSecond, VkExtent2D extent, std::chrono::system_clock::time_point captureTimestamp);
         void UpdateFrameTimingStats();
         void ExportPerformanceCapture();
@@ -593,6 +876,15 @@ namespace Trident
         const ViewportContext* FindViewportContext(uint32_t viewportId) const;
         ViewportContext* FindViewportContext(uint32_t viewportId);
         void CreateOrResizeOffscreenResources(OffscreenTarget& target, VkExtent2D extent);
+        // Crops the target to extent when its allocation can hold it, otherwise reallocates (when allowed) or clamps.
+        void ApplyOffscreenExtent(ViewportContext& context, VkExtent2D extent, bool allowReallocation);
+        void UpdateOffscreenTargets();
+        void PoolOffscreenTarget(OffscreenTarget& target);
+        bool AcquirePooledOffscreenTarget(OffscreenTarget& target, VkExtent2D extent);
+        void ClearOffscreenTargetPool();
+        // Hands the target's attachments to the retirement queue and resets it; in-flight frames keep using the old handles.
+        void RetireOffscreenTarget(OffscreenTarget& target, bool removeTexture);
+        void CheckSteadyStateDeviceIdle();
         const Camera* GetActiveCamera(const ViewportContext& context) const;
         void SyncFrameDatasetRecorder();
     };
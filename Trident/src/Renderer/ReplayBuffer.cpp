@@ -0,0 +1,326 @@
+#include "Renderer/ReplayBuffer.h"
+
+#include "Core/Utilities.h"
+
+#include <string>
+#include <utility>
+
+extern "C"
+{
+    #include <libavcodec/avcodec.h>
+    #include <libavformat/avformat.h>
+}
+
+namespace Trident
+{
+    ReplayBuffer::~ReplayBuffer()
+    {
+        if (m_SaveThread.joinable())
+        {
+            m_SaveThread.join();
+        }
+
+        ReleasePackets();
+        avcodec_parameters_free(&m_CodecParameters);
+    }
+
+    bool ReplayBuffer::Reset(const AVCodecContext* codecContext)
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+        ReleasePackets();
+
+        if (m_CodecParameters == nullptr)
+        {
+            m_CodecParameters = avcodec_parameters_alloc();
+        }
+
+        if (m_CodecParameters == nullptr || avcodec_parameters_from_context(m_CodecParameters, codecContext) < 0)
+        {
+            TR_CORE_WARN("Replay buffer could not capture the encoder's stream parameters.");
+
+            return false;
+        }
+
+        m_TimeBaseNum = codecContext->time_base.num;
+        m_TimeBaseDen = codecContext->time_base.den;
+
+        return true;
+    }
+
+    void ReplayBuffer::Clear()
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+        ReleasePackets();
+    }
+
+    void ReplayBuffer::SetBudget(size_t budgetBytes)
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+        m_BudgetBytes = budgetBytes;
+        TrimToBudget();
+    }
+
+    size_t ReplayBuffer::GetBudget() const
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+
+        return m_BudgetBytes;
+    }
+
+    void ReplayBuffer::PushPacket(AVPacket* packet)
+    {
+        // Until the first keyframe arrives there is nothing a player could start decoding from.
+        const bool l_IsKeyframe = (packet->flags & AV_PKT_FLAG_KEY) != 0;
+
+        std::scoped_lock l_Lock(m_Mutex);
+        if (m_Packets.empty() && !l_IsKeyframe)
+        {
+            av_packet_unref(packet);
+
+            return;
+        }
+
+        AVPacket* l_Packet = av_packet_alloc();
+        if (l_Packet == nullptr)
+        {
+            av_packet_unref(packet);
+
+            return;
+        }
+
+        av_packet_move_ref(l_Packet, packet);
+        m_BufferedBytes += static_cast<size_t>(l_Packet->size);
+        m_Packets.push_back(l_Packet);
+
+        TrimToBudget();
+    }
+
+    bool ReplayBuffer::SaveAsync(const std::filesystem::path& outputPath)
+    {
+        if (m_Saving.exchange(true))
+        {
+            TR_CORE_WARN("Replay save to {} ignored because an earlier save is still running.", outputPath.string());
+
+            return false;
+        }
+
+        // The previous save finished (m_Saving was clear), so this join returns immediately.
+        if (m_SaveThread.joinable())
+        {
+            m_SaveThread.join();
+        }
+
+        std::vector<AVPacket*> l_Packets;
+        AVCodecParameters* l_CodecParameters = nullptr;
+        int32_t l_TimeBaseNum = 1;
+        int32_t l_TimeBaseDen = 1;
+        {
+            // Cloning only adds references to the payloads, so the encoder thread is held up for microseconds.
+            std::scoped_lock l_Lock(m_Mutex);
+            if (!m_Packets.empty() && m_CodecParameters != nullptr)
+            {
+                l_CodecParameters = avcodec_parameters_alloc();
+                if (l_CodecParameters != nullptr && avcodec_parameters_copy(l_CodecParameters, m_CodecParameters) >= 0)
+                {
+                    l_Packets.reserve(m_Packets.size());
+                    for (const AVPacket* it_Packet : m_Packets)
+                    {
+                        if (AVPacket* l_Clone = av_packet_clone(it_Packet))
+                        {
+                            l_Packets.push_back(l_Clone);
+                        }
+                    }
+                }
+
+                l_TimeBaseNum = m_TimeBaseNum;
+                l_TimeBaseDen = m_TimeBaseDen;
+            }
+        }
+
+        if (l_Packets.empty())
+        {
+            TR_CORE_WARN("Replay save to {} skipped because the replay buffer is empty.", outputPath.string());
+
+            avcodec_parameters_free(&l_CodecParameters);
+            m_Saving = false;
+
+            return false;
+        }
+
+        m_SaveThread = std::thread(&ReplayBuffer::SaveWorker, this, outputPath, l_CodecParameters, l_TimeBaseNum, l_TimeBaseDen, std::move(l_Packets));
+
+        return true;
+    }
+
+    ReplayBuffer::Stats ReplayBuffer::GetStats() const
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+
+        Stats l_Stats{};
+        l_Stats.m_BufferedBytes = m_BufferedBytes;
+        l_Stats.m_BudgetBytes = m_BudgetBytes;
+        l_Stats.m_BufferedPackets = m_Packets.size();
+        l_Stats.m_Saving = m_Saving.load();
+        if (!m_Packets.empty() && m_TimeBaseDen != 0)
+        {
+            // The span between the first and last decode timestamps, plus the last frame, is the buffered duration.
+            const int64_t l_Ticks = m_Packets.back()->dts - m_Packets.front()->dts + 1;
+            l_Stats.m_BufferedSeconds = static_cast<double>(l_Ticks) * m_TimeBaseNum / m_TimeBaseDen;
+        }
+
+        return l_Stats;
+    }
+
+    void ReplayBuffer::TrimToBudget()
+    {
+        while (m_BufferedBytes > m_BudgetBytes)
+        {
+            // Find where the second GOP starts; with a single GOP left there is nothing that can be dropped cleanly.
+            size_t l_NextKeyframe = 1;
+            while (l_NextKeyframe < m_Packets.size() && (m_Packets[l_NextKeyframe]->flags & AV_PKT_FLAG_KEY) == 0)
+            {
+                ++l_NextKeyframe;
+            }
+
+            if (l_NextKeyframe >= m_Packets.size())
+            {
+                break;
+            }
+
+            for (size_t it_Index = 0; it_Index < l_NextKeyframe; ++it_Index)
+            {
+                AVPacket* l_Packet = m_Packets.front();
+                m_BufferedBytes -= static_cast<size_t>(l_Packet->size);
+                av_packet_free(&l_Packet);
+                m_Packets.pop_front();
+            }
+        }
+    }
+
+    void ReplayBuffer::ReleasePackets()
+    {
+        for (AVPacket*& it_Packet : m_Packets)
+        {
+            av_packet_free(&it_Packet);
+        }
+
+        m_Packets.clear();
+        m_BufferedBytes = 0;
+    }
+
+    void ReplayBuffer::SaveWorker(std::filesystem::path outputPath, AVCodecParameters* codecParameters, int32_t timeBaseNum, int32_t timeBaseDen,
+        std::vector<AVPacket*> packets)
+    {
+        const size_t l_PacketCount = packets.size();
+        if (MuxPackets(outputPath, codecParameters, timeBaseNum, timeBaseDen, packets))
+        {
+            TR_CORE_INFO("Replay saved to {} ({} packets)", outputPath.string(), l_PacketCount);
+        }
+
+        for (AVPacket*& it_Packet : packets)
+        {
+            av_packet_free(&it_Packet);
+        }
+        avcodec_parameters_free(&codecParameters);
+
+        m_Saving = false;
+    }
+
+    bool ReplayBuffer::MuxPackets(const std::filesystem::path& outputPath, const AVCodecParameters* codecParameters, int32_t timeBaseNum,
+        int32_t timeBaseDen, std::vector<AVPacket*>& packets)
+    {
+        const std::string l_OutputString = outputPath.string();
+
+        AVFormatContext* l_FormatContext = nullptr;
+        int32_t l_Result = avformat_alloc_output_context2(&l_FormatContext, nullptr, nullptr, l_OutputString.c_str());
+        if (l_Result < 0 || l_FormatContext == nullptr)
+        {
+            TR_CORE_WARN("Replay save could not allocate an FFmpeg format context for {}.", l_OutputString);
+
+            return false;
+        }
+
+        const auto a_Cleanup = [&l_FormatContext]()
+            {
+                if (l_FormatContext->pb != nullptr && !(l_FormatContext->oformat->flags & AVFMT_NOFILE))
+                {
+                    avio_closep(&l_FormatContext->pb);
+                }
+                avformat_free_context(l_FormatContext);
+            };
+
+        AVStream* l_Stream = avformat_new_stream(l_FormatContext, nullptr);
+        if (l_Stream == nullptr || avcodec_parameters_copy(l_Stream->codecpar, codecParameters) < 0)
+        {
+            TR_CORE_WARN("Replay save could not create the video stream for {}.", l_OutputString);
+
+            a_Cleanup();
+            return false;
+        }
+
+        // Let the muxer pick the codec tag for its own container.
+        l_Stream->codecpar->codec_tag = 0;
+        l_Stream->time_base = { timeBaseNum, timeBaseDen };
+
+        if (!(l_FormatContext->oformat->flags & AVFMT_NOFILE))
+        {
+            l_Result = avio_open(&l_FormatContext->pb, l_OutputString.c_str(), AVIO_FLAG_WRITE);
+            if (l_Result < 0)
+            {
+                TR_CORE_WARN("Replay save could not open {} for writing (error {}).", l_OutputString, l_Result);
+
+                a_Cleanup();
+                return false;
+            }
+        }
+
+        l_Result = avformat_write_header(l_FormatContext, nullptr);
+        if (l_Result < 0)
+        {
+            TR_CORE_WARN("Replay save could not write the header for {} (error {}).", l_OutputString, l_Result);
+
+            a_Cleanup();
+            return false;
+        }
+
+        // Shift the clip so it starts at zero; the ring usually begins somewhere in the middle of the recording.
+        const int64_t l_Offset = (packets.front()->dts != AV_NOPTS_VALUE) ? packets.front()->dts : packets.front()->pts;
+        const AVRational l_CodecTimeBase{ timeBaseNum, timeBaseDen };
+        bool l_Success = true;
+        for (AVPacket* it_Packet : packets)
+        {
+            if (it_Packet->pts != AV_NOPTS_VALUE)
+            {
+                it_Packet->pts -= l_Offset;
+            }
+            if (it_Packet->dts != AV_NOPTS_VALUE)
+            {
+                it_Packet->dts -= l_Offset;
+            }
+
+            it_Packet->stream_index = l_Stream->index;
+            av_packet_rescale_ts(it_Packet, l_CodecTimeBase, l_Stream->time_base);
+
+            l_Result = av_interleaved_write_frame(l_FormatContext, it_Packet);
+            if (l_Result < 0)
+            {
+                TR_CORE_WARN("Replay save could not write a packet to {} (error {}).", l_OutputString, l_Result);
+
+                l_Success = false;
+                break;
+            }
+        }
+
+        l_Result = av_write_trailer(l_FormatContext);
+        if (l_Result < 0)
+        {
+            TR_CORE_ERROR("Replay save failed to finalize {} (error {}).", l_OutputString, l_Result);
+
+            l_Success = false;
+        }
+
+        a_Cleanup();
+
+        return l_Success;
+    }
+}
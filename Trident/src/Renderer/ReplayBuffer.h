@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    struct AVCodecContext;
+    struct AVCodecParameters;
+    struct AVPacket;
+}
+
+namespace Trident
+{
+    /**
+     * @brief Fixed-budget ring of encoded video packets that can be saved as a clip after the fact.
+     *
+     * The ring drops whole GOPs: once the budget is exceeded the oldest packets go up to the next keyframe, so the
+     * buffered stream always starts on a decodable frame. The newest GOP is never split, even when it alone is over
+     * budget. Saving only takes new references to the packets and muxes them into a container on a background thread.
+     */
+    class ReplayBuffer
+    {
+    public:
+        struct Stats
+        {
+            size_t m_BufferedBytes = 0;
+            size_t m_BudgetBytes = 0;
+            size_t m_BufferedPackets = 0;
+            double m_BufferedSeconds = 0.0;
+            bool m_Saving = false;  // A save is still muxing in the background.
+        };
+
+        explicit ReplayBuffer(size_t budgetBytes) : m_BudgetBytes(budgetBytes) {}
+        ~ReplayBuffer();
+
+        ReplayBuffer(const ReplayBuffer&) = delete;
+        ReplayBuffer& operator=(const ReplayBuffer&) = delete;
+
+        // Drops buffered packets and captures the stream parameters of the encoder that feeds the ring next.
+        bool Reset(const AVCodecContext* codecContext);
+        void Clear();
+        void SetBudget(size_t budgetBytes);
+        size_t GetBudget() const;
+
+        // Moves the packet's payload reference into the ring and leaves the packet blank, as av_packet_unref would.
+        void PushPacket(AVPacket* packet);
+
+        // Returns false if the ring is empty or an earlier save is still running.
+        bool SaveAsync(const std::filesystem::path& outputPath);
+        Stats GetStats() const;
+
+    private:
+        void TrimToBudget();
+        void ReleasePackets();
+        void SaveWorker(std::filesystem::path outputPath, AVCodecParameters* codecParameters, int32_t timeBaseNum, int32_t timeBaseDen,
+            std::vector<AVPacket*> packets);
+        static bool MuxPackets(const std::filesystem::path& outputPath, const AVCodecParameters* codecParameters, int32_t timeBaseNum,
+            int32_t timeBaseDen, std::vector<AVPacket*>& packets);
+
+    private:
+        mutable std::mutex m_Mutex;
+        std::deque<AVPacket*> m_Packets;                    // Encode order; the front is always a keyframe.
+        size_t m_BufferedBytes = 0;
+        size_t m_BudgetBytes = 0;
+        AVCodecParameters* m_CodecParameters = nullptr;     // Stream layout copied from the encoder, extradata included.
+        int32_t m_TimeBaseNum = 1;                          // Codec time base the packet timestamps are in.
+        int32_t m_TimeBaseDen = 30;
+
+        std::thread m_SaveThread;
+        std::atomic<bool> m_Saving{ false };
+    };
+}
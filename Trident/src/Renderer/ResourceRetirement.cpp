@@ -0,0 +1,52 @@
+#include "Renderer/ResourceRetirement.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Trident
+{
+    void ResourceRetirement::Retire(uint64_t timelineValue, std::function<void()> release)
+    {
+        if (!release)
+        {
+            return;
+        }
+
+        // Keep the queue ordered by value; an older tag only shows up when a caller retires against a known submission.
+        auto a_Position = m_Pending.end();
+        if (!m_Pending.empty() && m_Pending.back().m_TimelineValue > timelineValue)
+        {
+            a_Position = std::upper_bound(m_Pending.begin(), m_Pending.end(), timelineValue, [](uint64_t value, const RetiredResource& retired)
+                {
+                    return value < retired.m_TimelineValue;
+                });
+        }
+
+        m_Pending.insert(a_Position, RetiredResource{ timelineValue, std::move(release) });
+    }
+
+    size_t ResourceRetirement::Collect(uint64_t completedValue)
+    {
+        size_t l_Released = 0;
+        while (!m_Pending.empty() && m_Pending.front().m_TimelineValue <= completedValue)
+        {
+            // Pop before running so a callback that retires something else never observes itself in the queue.
+            std::function<void()> l_Release = std::move(m_Pending.front().m_Release);
+            m_Pending.pop_front();
+            l_Release();
+            ++l_Released;
+        }
+
+        return l_Released;
+    }
+
+    void ResourceRetirement::ReleaseAll()
+    {
+        while (!m_Pending.empty())
+        {
+            std::function<void()> l_Release = std::move(m_Pending.front().m_Release);
+            m_Pending.pop_front();
+            l_Release();
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace Trident
+{
+    /**
+     * @brief Defers releasing GPU objects until the frame timeline reaches the value of the last submission that may use them.
+     *
+     * Owners hand over a release callback tagged with a value of the Commands frame timeline instead of idling the device
+     * before destroying something. Collect runs every callback whose value the GPU has reached. Tags normally arrive in
+     * increasing order, so the queue stays sorted and Collect only ever looks at its front.
+     */
+    class ResourceRetirement
+    {
+    public:
+        void Retire(uint64_t timelineValue, std::function<void()> release);
+        // Runs the callbacks tagged at or below completedValue and returns how many ran.
+        size_t Collect(uint64_t completedValue);
+        // Runs every remaining callback. Only valid once the device is idle.
+        void ReleaseAll();
+
+        bool IsEmpty() const { return m_Pending.empty(); }
+        size_t GetPendingCount() const { return m_Pending.size(); }
+
+    private:
+        struct RetiredResource
+        {
+            uint64_t m_TimelineValue = 0;
+            std::function<void()> m_Release;
+        };
+
+        std::deque<RetiredResource> m_Pending;
+    };
+}
@@ -0,0 +1,147 @@
+#include "Renderer/RowBandDispatcher.h"
+
+#include <algorithm>
+
+namespace Trident
+{
+    void RowBandDispatcher::Init(uint32_t workerCount)
+    {
+        {
+            std::scoped_lock l_Lock(m_Mutex);
+            m_WorkersShouldStop = false;
+        }
+
+        for (uint32_t it_Worker = 0; it_Worker < workerCount; ++it_Worker)
+        {
+            m_Workers.emplace_back(&RowBandDispatcher::WorkerLoop, this);
+        }
+    }
+
+    void RowBandDispatcher::Shutdown()
+    {
+        {
+            std::scoped_lock l_Lock(m_Mutex);
+            m_WorkersShouldStop = true;
+        }
+        m_WorkAvailable.notify_all();
+
+        for (std::thread& it_Worker : m_Workers)
+        {
+            if (it_Worker.joinable())
+            {
+                it_Worker.join();
+            }
+        }
+        m_Workers.clear();
+    }
+
+    void RowBandDispatcher::Dispatch(uint32_t rowCount, uint32_t rowAlignment, BandFunction function, const void* context)
+    {
+        if (rowCount == 0 || function == nullptr)
+        {
+            return;
+        }
+
+        const uint32_t l_Alignment = std::max(1u, rowAlignment);
+        if (m_Workers.empty())
+        {
+            function(context, 0, rowCount);
+
+            return;
+        }
+
+        const uint32_t l_TargetBands = (GetWorkerCount() + 1) * s_BandsPerThread;
+        uint32_t l_BandRows = std::max(1u, (rowCount + l_TargetBands - 1) / l_TargetBands);
+        l_BandRows = (l_BandRows + l_Alignment - 1) / l_Alignment * l_Alignment;
+
+        BandJob l_Job{};
+        l_Job.m_Function = function;
+        l_Job.m_Context = context;
+        l_Job.m_RowCount = rowCount;
+        l_Job.m_BandRows = l_BandRows;
+        l_Job.m_BandCount = (rowCount + l_BandRows - 1) / l_BandRows;
+
+        {
+            std::unique_lock<std::mutex> l_Lock(m_Mutex);
+            // A worker that woke late for the previous job still holds its description; let it drain first.
+            m_WorkFinished.wait(l_Lock, [this]()
+                {
+                    return m_ActiveWorkers == 0;
+                });
+
+            m_Job = l_Job;
+            m_NextBand.store(0);
+            m_BandsRemaining = l_Job.m_BandCount;
+            ++m_Generation;
+        }
+        m_WorkAvailable.notify_all();
+
+        const uint32_t l_Processed = ProcessBands(l_Job);
+
+        std::unique_lock<std::mutex> l_Lock(m_Mutex);
+        m_BandsRemaining -= l_Processed;
+        m_WorkFinished.wait(l_Lock, [this]()
+            {
+                return m_BandsRemaining == 0;
+            });
+    }
+
+    void RowBandDispatcher::WorkerLoop()
+    {
+        uint64_t l_SeenGeneration = 0;
+        {
+            std::scoped_lock l_Lock(m_Mutex);
+            l_SeenGeneration = m_Generation;
+        }
+
+        while (true)
+        {
+            BandJob l_Job{};
+            {
+                std::unique_lock<std::mutex> l_Lock(m_Mutex);
+                m_WorkAvailable.wait(l_Lock, [this, &l_SeenGeneration]()
+                    {
+                        return m_WorkersShouldStop || m_Generation != l_SeenGeneration;
+                    });
+
+                if (m_WorkersShouldStop)
+                {
+                    break;
+                }
+
+                l_SeenGeneration = m_Generation;
+                l_Job = m_Job;
+                ++m_ActiveWorkers;
+            }
+
+            const uint32_t l_Processed = ProcessBands(l_Job);
+
+            {
+                std::scoped_lock l_Lock(m_Mutex);
+                m_BandsRemaining -= l_Processed;
+                --m_ActiveWorkers;
+            }
+            m_WorkFinished.notify_all();
+        }
+    }
+
+    uint32_t RowBandDispatcher::ProcessBands(const BandJob& job)
+    {
+        // The context is only touched for bands of the current job, and Dispatch is still waiting for those.
+        uint32_t l_Processed = 0;
+        while (true)
+        {
+            const uint32_t l_Band = m_NextBand.fetch_add(1);
+            if (l_Band >= job.m_BandCount)
+            {
+                break;
+            }
+
+            const uint32_t l_FirstRow = l_Band * job.m_BandRows;
+            job.m_Function(job.m_Context, l_FirstRow, std::min(job.m_BandRows, job.m_RowCount - l_FirstRow));
+            ++l_Processed;
+        }
+
+        return l_Processed;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Trident
+{
+    /**
+     * @brief Splits a per-row image job into bands and runs them on the calling thread plus a small worker pool.
+     *
+     * Dispatch returns only when every band is finished, so the job's context may live on the caller's stack. Jobs are
+     * a plain function pointer and context to keep a dispatch free of allocations; one thread dispatches at a time.
+     */
+    class RowBandDispatcher
+    {
+    public:
+        using BandFunction = void(*)(const void* context, uint32_t firstRow, uint32_t rowCount);
+
+        void Init(uint32_t workerCount);
+        void Shutdown();
+
+        // Band starts are multiples of rowAlignment, e.g. 2 so each band covers whole 4:2:0 chroma rows.
+        void Dispatch(uint32_t rowCount, uint32_t rowAlignment, BandFunction function, const void* context);
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    private:
+        struct BandJob
+        {
+            BandFunction m_Function = nullptr;
+            const void* m_Context = nullptr;
+            uint32_t m_RowCount = 0;
+            uint32_t m_BandRows = 0;
+            uint32_t m_BandCount = 0;
+        };
+
+        void WorkerLoop();
+        uint32_t ProcessBands(const BandJob& job);
+
+    private:
+        static constexpr uint32_t s_BandsPerThread = 2;            // Extra bands smooth out uneven scheduling.
+
+        std::vector<std::thread> m_Workers;
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkAvailable;
+        std::condition_variable m_WorkFinished;
+
+        BandJob m_Job{};
+        std::atomic<uint32_t> m_NextBand{ 0 };
+        uint32_t m_BandsRemaining = 0;
+        uint32_t m_ActiveWorkers = 0;      // Workers holding a copy of m_Job; a new job waits for them to drain.
+        uint64_t m_Generation = 0;
+        bool m_WorkersShouldStop = false;
+    };
+}
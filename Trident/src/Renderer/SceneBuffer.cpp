@@ -0,0 +1,370 @@
+#include "Renderer/SceneBuffer.h"
+
+#include "Renderer/Buffers.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Trident
+{
+    namespace
+    {
+        static_assert(sizeof(SceneBuffer::InstanceRecord) == 176, "InstanceRecord must match the std430 layout in Default.vert");
+
+        constexpr VkDeviceSize s_RecordSize = sizeof(SceneBuffer::InstanceRecord);
+        constexpr uint32_t s_MinStagingRecords = 64;
+
+        // Conservative world-space sphere: the centre follows the matrix and the radius takes the largest axis scale.
+        glm::vec4 TransformBounds(const glm::mat4& worldMatrix, const glm::vec4& objectBounds)
+        {
+            const glm::vec3 l_Centre = glm::vec3(worldMatrix * glm::vec4(glm::vec3(objectBounds), 1.0f));
+            const float l_Scale = std::max({ glm::length(glm::vec3(worldMatrix[0])), glm::length(glm::vec3(worldMatrix[1])), glm::length(glm::vec3(worldMatrix[2])) });
+
+            return glm::vec4(l_Centre, objectBounds.w * l_Scale);
+        }
+    }
+
+    void SceneBuffer::Init(Buffers& buffers)
+    {
+        m_Buffers = &buffers;
+        Reset();
+
+        m_Buffers->CreateBuffer(s_InitialCapacity * s_RecordSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Buffer, m_Memory);
+        m_Capacity = s_InitialCapacity;
+        ++m_Generation;
+
+        TR_CORE_TRACE("Scene buffer initialised ({} records)", m_Capacity);
+    }
+
+    void SceneBuffer::Shutdown()
+    {
+        for (StagingBuffer& it_Staging : m_Staging)
+        {
+            DestroyStaging(it_Staging);
+        }
+        m_Staging.clear();
+
+        if (m_Buffers)
+        {
+            m_Buffers->DestroyBuffer(m_Buffer, m_Memory);
+        }
+
+        m_Buffer = VK_NULL_HANDLE;
+        m_Memory = VK_NULL_HANDLE;
+        m_Capacity = 0;
+        Reset();
+        m_Buffers = nullptr;
+    }
+
+    void SceneBuffer::Reset()
+    {
+        m_Slots.clear();
+        m_FreeSlots.clear();
+        m_EntitySlots.clear();
+        m_DirtySlots.clear();
+        m_MovedSlots.clear();
+        m_SettlingSlots.clear();
+        m_Stats = {};
+    }
+
+    void SceneBuffer::BeginFrame()
+    {
+        ++m_Frame;
+
+        // Slots that moved last frame report that frame's matrix as "previous" once, then stop being dirty.
+        m_SettlingSlots.swap(m_MovedSlots);
+        m_MovedSlots.clear();
+        for (uint32_t it_Slot : m_SettlingSlots)
+        {
+            Slot& l_Slot = m_Slots[it_Slot];
+            if ((l_Slot.m_Record.m_Flags & s_InstanceLive) != 0 && l_Slot.m_MovedFrame + 1 == m_Frame)
+            {
+                l_Slot.m_Record.m_PreviousWorldMatrix = l_Slot.m_Record.m_WorldMatrix;
+                MarkDirty(it_Slot);
+            }
+        }
+        m_SettlingSlots.clear();
+
+        // Only a frame counter is compared per slot; nothing is re-derived for entities that are still drawn.
+        for (uint32_t it_Slot = 0; it_Slot < static_cast<uint32_t>(m_Slots.size()); ++it_Slot)
+        {
+            const Slot& l_Slot = m_Slots[it_Slot];
+            if ((l_Slot.m_Record.m_Flags & s_InstanceLive) != 0 && l_Slot.m_LastUsedFrame + 1 < m_Frame)
+            {
+                ReleaseSlot(it_Slot);
+            }
+        }
+    }
+
+    uint32_t SceneBuffer::AcquireSlot(ECS::Entity entity)
+    {
+        auto a_Existing = m_EntitySlots.find(entity);
+        if (a_Existing != m_EntitySlots.end())
+        {
+            m_Slots[a_Existing->second].m_LastUsedFrame = m_Frame;
+            return a_Existing->second;
+        }
+
+        uint32_t l_Index = 0;
+        if (!m_FreeSlots.empty())
+        {
+            l_Index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            l_Index = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.emplace_back();
+        }
+
+        Slot& l_Slot = m_Slots[l_Index];
+        const bool l_WasDirty = l_Slot.m_Dirty;
+        l_Slot = {};
+        l_Slot.m_Dirty = l_WasDirty;
+        l_Slot.m_Entity = entity;
+        l_Slot.m_LastUsedFrame = m_Frame;
+        l_Slot.m_Record.m_Flags = s_InstanceLive;
+        m_EntitySlots.emplace(entity, l_Index);
+        MarkDirty(l_Index);
+
+        return l_Index;
+    }
+
+    bool SceneBuffer::HasTransformChanged(uint32_t slot, const Transform& transform) const
+    {
+        const Slot& l_Slot = m_Slots[slot];
+
+        return !l_Slot.m_HasTransform || l_Slot.m_Transform.Position != transform.Position || l_Slot.m_Transform.Rotation != transform.Rotation
+            || l_Slot.m_Transform.Scale != transform.Scale;
+    }
+
+    void SceneBuffer::SetTransform(uint32_t slot, const Transform& transform, const glm::mat4& worldMatrix)
+    {
+        Slot& l_Slot = m_Slots[slot];
+        if (l_Slot.m_HasTransform)
+        {
+            // A second change in the same frame keeps the matrix the GPU drew with last frame as the previous one.
+            if (l_Slot.m_MovedFrame != m_Frame)
+            {
+                l_Slot.m_Record.m_PreviousWorldMatrix = l_Slot.m_Record.m_WorldMatrix;
+                l_Slot.m_MovedFrame = m_Frame;
+                m_MovedSlots.push_back(slot);
+            }
+        }
+        else
+        {
+            // A newly placed instance has no motion to report.
+            l_Slot.m_Record.m_PreviousWorldMatrix = worldMatrix;
+        }
+
+        l_Slot.m_Record.m_WorldMatrix = worldMatrix;
+        l_Slot.m_Record.m_BoundingSphere = TransformBounds(worldMatrix, l_Slot.m_ObjectBounds);
+        l_Slot.m_Transform = transform;
+        l_Slot.m_HasTransform = true;
+        MarkDirty(slot);
+    }
+
+    void SceneBuffer::SetDrawParameters(uint32_t slot, const DrawParameters& parameters)
+    {
+        Slot& l_Slot = m_Slots[slot];
+        InstanceRecord& l_Record = l_Slot.m_Record;
+        if (l_Slot.m_ObjectBounds == parameters.m_ObjectBounds && l_Record.m_MaterialIndex == parameters.m_MaterialIndex
+            && l_Record.m_TextureSlot == parameters.m_TextureSlot && l_Record.m_FirstIndex == parameters.m_FirstIndex
+            && l_Record.m_IndexCount == parameters.m_IndexCount && l_Record.m_BaseVertex == parameters.m_BaseVertex)
+        {
+            return;
+        }
+
+        l_Slot.m_ObjectBounds = parameters.m_ObjectBounds;
+        l_Record.m_BoundingSphere = TransformBounds(l_Record.m_WorldMatrix, parameters.m_ObjectBounds);
+        l_Record.m_MaterialIndex = parameters.m_MaterialIndex;
+        l_Record.m_TextureSlot = parameters.m_TextureSlot;
+        l_Record.m_FirstIndex = parameters.m_FirstIndex;
+        l_Record.m_IndexCount = parameters.m_IndexCount;
+        l_Record.m_BaseVertex = parameters.m_BaseVertex;
+        MarkDirty(slot);
+    }
+
+    void SceneBuffer::SetBoneRange(uint32_t slot, uint32_t boneOffset, uint32_t boneCount)
+    {
+        InstanceRecord& l_Record = m_Slots[slot].m_Record;
+        if (l_Record.m_BoneOffset == boneOffset && l_Record.m_BoneCount == boneCount)
+        {
+            return;
+        }
+
+        l_Record.m_BoneOffset = boneOffset;
+        l_Record.m_BoneCount = boneCount;
+        MarkDirty(slot);
+    }
+
+    void SceneBuffer::RecordUpload(VkCommandBuffer commandBuffer, uint32_t imageIndex)
+    {
+        m_Stats.m_Instances = static_cast<uint32_t>(m_EntitySlots.size());
+        m_Stats.m_UploadedRecords = 0;
+        m_Stats.m_CopyRegions = 0;
+
+        if (m_DirtySlots.empty() || commandBuffer == VK_NULL_HANDLE || m_Buffer == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        // Growing re-marks every slot, so check capacity before sizing the staging buffer for the dirty list.
+        if (!EnsureCapacity(static_cast<uint32_t>(m_Slots.size())) || !EnsureStaging(imageIndex, static_cast<uint32_t>(m_DirtySlots.size())))
+        {
+            return;
+        }
+
+        // Sorting lets adjacent slots share a copy region, since they are packed back to back in staging as well.
+        std::sort(m_DirtySlots.begin(), m_DirtySlots.end());
+
+        InstanceRecord* l_Staging = static_cast<InstanceRecord*>(m_Staging[imageIndex].m_Mapped);
+        m_CopyRegions.clear();
+        for (size_t it_Index = 0; it_Index < m_DirtySlots.size(); ++it_Index)
+        {
+            const uint32_t l_SlotIndex = m_DirtySlots[it_Index];
+            Slot& l_Slot = m_Slots[l_SlotIndex];
+            l_Staging[it_Index] = l_Slot.m_Record;
+            l_Slot.m_Dirty = false;
+
+            const VkDeviceSize l_SourceOffset = static_cast<VkDeviceSize>(it_Index) * s_RecordSize;
+            const VkDeviceSize l_TargetOffset = static_cast<VkDeviceSize>(l_SlotIndex) * s_RecordSize;
+            if (!m_CopyRegions.empty() && m_CopyRegions.back().dstOffset + m_CopyRegions.back().size == l_TargetOffset)
+            {
+                m_CopyRegions.back().size += s_RecordSize;
+                continue;
+            }
+
+            m_CopyRegions.push_back({ l_SourceOffset, l_TargetOffset, s_RecordSize });
+        }
+
+        // Earlier frames on this queue may still be reading the records being replaced.
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+        vkCmdCopyBuffer(commandBuffer, m_Staging[imageIndex].m_Buffer, m_Buffer, static_cast<uint32_t>(m_CopyRegions.size()), m_CopyRegions.data());
+
+        VkBufferMemoryBarrier l_Barrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+        l_Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        l_Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        l_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.buffer = m_Buffer;
+        l_Barrier.offset = 0;
+        l_Barrier.size = VK_WHOLE_SIZE;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 0, nullptr, 1, &l_Barrier, 0, nullptr);
+
+        m_Stats.m_UploadedRecords = static_cast<uint32_t>(m_DirtySlots.size());
+        m_Stats.m_CopyRegions = static_cast<uint32_t>(m_CopyRegions.size());
+        m_DirtySlots.clear();
+    }
+
+    void SceneBuffer::MarkDirty(uint32_t slot)
+    {
+        Slot& l_Slot = m_Slots[slot];
+        if (!l_Slot.m_Dirty)
+        {
+            l_Slot.m_Dirty = true;
+            m_DirtySlots.push_back(slot);
+        }
+    }
+
+    void SceneBuffer::ReleaseSlot(uint32_t slot)
+    {
+        Slot& l_Slot = m_Slots[slot];
+        m_EntitySlots.erase(l_Slot.m_Entity);
+
+        // The cleared record is uploaded too, so GPU passes walking the table see the slot as free.
+        const bool l_WasDirty = l_Slot.m_Dirty;
+        l_Slot = {};
+        l_Slot.m_Dirty = l_WasDirty;
+        MarkDirty(slot);
+        m_FreeSlots.push_back(slot);
+    }
+
+    bool SceneBuffer::EnsureCapacity(uint32_t recordCount)
+    {
+        if (recordCount <= m_Capacity)
+        {
+            return true;
+        }
+
+        VkBuffer l_Buffer = VK_NULL_HANDLE;
+        VkDeviceMemory l_Memory = VK_NULL_HANDLE;
+        const uint32_t l_Capacity = std::max(recordCount, m_Capacity * 2);
+        m_Buffers->CreateBuffer(static_cast<VkDeviceSize>(l_Capacity) * s_RecordSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, l_Buffer, l_Memory);
+        if (l_Buffer == VK_NULL_HANDLE)
+        {
+            TR_CORE_ERROR("Failed to grow the scene buffer to {} records", l_Capacity);
+            return false;
+        }
+
+        // Frames still in flight keep reading the old table until their descriptor sets are rebound.
+        m_Buffers->DestroyBuffer(m_Buffer, m_Memory);
+        m_Buffer = l_Buffer;
+        m_Memory = l_Memory;
+        m_Capacity = l_Capacity;
+        ++m_Generation;
+
+        for (uint32_t it_Slot = 0; it_Slot < static_cast<uint32_t>(m_Slots.size()); ++it_Slot)
+        {
+            MarkDirty(it_Slot);
+        }
+
+        TR_CORE_TRACE("Scene buffer grown to {} records", m_Capacity);
+
+        return true;
+    }
+
+    bool SceneBuffer::EnsureStaging(uint32_t imageIndex, uint32_t recordCount)
+    {
+        if (imageIndex >= m_Staging.size())
+        {
+            m_Staging.resize(static_cast<size_t>(imageIndex) + 1);
+        }
+
+        StagingBuffer& l_Staging = m_Staging[imageIndex];
+        if (l_Staging.m_Capacity >= recordCount && l_Staging.m_Mapped != nullptr)
+        {
+            return true;
+        }
+
+        DestroyStaging(l_Staging);
+
+        const uint32_t l_Capacity = std::max({ recordCount, l_Staging.m_Capacity * 2, s_MinStagingRecords });
+        const VkDeviceSize l_Size = static_cast<VkDeviceSize>(l_Capacity) * s_RecordSize;
+        m_Buffers->CreateBuffer(l_Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            l_Staging.m_Buffer, l_Staging.m_Memory);
+        if (l_Staging.m_Buffer == VK_NULL_HANDLE || vkMapMemory(Startup::GetDevice(), l_Staging.m_Memory, 0, l_Size, 0, &l_Staging.m_Mapped) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create scene buffer staging for image {}", imageIndex);
+            DestroyStaging(l_Staging);
+            return false;
+        }
+
+        l_Staging.m_Capacity = l_Capacity;
+
+        return true;
+    }
+
+    void SceneBuffer::DestroyStaging(StagingBuffer& staging)
+    {
+        if (staging.m_Mapped != nullptr)
+        {
+            vkUnmapMemory(Startup::GetDevice(), staging.m_Memory);
+        }
+
+        if (m_Buffers)
+        {
+            m_Buffers->DestroyBuffer(staging.m_Buffer, staging.m_Memory);
+        }
+
+        const uint32_t l_Capacity = staging.m_Capacity;
+        staging = {};
+        // Remembered so the next allocation keeps growing geometrically.
+        staging.m_Capacity = l_Capacity;
+    }
+}
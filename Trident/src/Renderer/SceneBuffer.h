@@ -0,0 +1,137 @@
+#pragma once
+
+#include "ECS/Entity.h"
+#include "ECS/Components/TransformComponent.h"
+
+#include <vulkan/vulkan.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Trident
+{
+    class Buffers;
+
+    /**
+     * @brief Persistent device-local table holding one record per renderable entity.
+     *
+     * Entities keep the slot they were given for as long as they are drawn, so the record only changes when its inputs
+     * do. The renderer syncs every draw against the cached inputs while gathering; changed slots land on a compact dirty
+     * list and RecordUpload scatters just those records from a per-image staging buffer with one copy region per run of
+     * adjacent slots. Per-frame upload therefore follows how much of the scene changed rather than how large it is.
+     *
+     * Records carry last frame's world matrix alongside the current one for motion vectors, and world-space bounds for
+     * GPU culling. Slots whose entity was not drawn during the previous frame are released and cleared.
+     */
+    class SceneBuffer
+    {
+    public:
+        // Mirrors the std430 InstanceRecord consumed through set 0, binding 5 of the main pipeline.
+        struct InstanceRecord
+        {
+            glm::mat4 m_WorldMatrix{ 1.0f };
+            glm::mat4 m_PreviousWorldMatrix{ 1.0f };   // World matrix of the previous frame; equals m_WorldMatrix when static.
+            glm::vec4 m_BoundingSphere{ 0.0f };        // xyz = world-space centre, w = radius.
+            int32_t m_MaterialIndex = -1;
+            int32_t m_TextureSlot = 0;                 // Base-color slot after any TextureComponent override.
+            uint32_t m_FirstIndex = 0;                 // Index range of the LOD selected this frame.
+            uint32_t m_IndexCount = 0;
+            int32_t m_BaseVertex = 0;
+            uint32_t m_BoneOffset = 0;
+            uint32_t m_BoneCount = 0;
+            uint32_t m_Flags = 0;                      // s_InstanceLive while the slot belongs to an entity.
+        };
+
+        // Everything a draw contributes besides its transform and bone range.
+        struct DrawParameters
+        {
+            glm::vec4 m_ObjectBounds{ 0.0f };          // xyz = object-space centre, w = radius.
+            int32_t m_MaterialIndex = -1;
+            int32_t m_TextureSlot = 0;
+            uint32_t m_FirstIndex = 0;
+            uint32_t m_IndexCount = 0;
+            int32_t m_BaseVertex = 0;
+        };
+
+        struct UploadStats
+        {
+            uint32_t m_Instances = 0;                  // Live slots after the most recent upload.
+            uint32_t m_UploadedRecords = 0;            // Records scattered by the most recent upload.
+            uint32_t m_CopyRegions = 0;                // Copy regions those records were coalesced into.
+        };
+
+        static constexpr uint32_t s_InstanceLive = 1u << 0;
+
+        void Init(Buffers& buffers);
+        void Shutdown();
+        // Drops every slot, e.g. when the renderer switches registries and entity ids stop meaning the same thing.
+        void Reset();
+
+        // Releases slots not drawn last frame and settles the previous-frame matrix of slots that moved last frame.
+        void BeginFrame();
+        uint32_t AcquireSlot(ECS::Entity entity);
+        bool HasTransformChanged(uint32_t slot, const Transform& transform) const;
+        void SetTransform(uint32_t slot, const Transform& transform, const glm::mat4& worldMatrix);
+        void SetDrawParameters(uint32_t slot, const DrawParameters& parameters);
+        void SetBoneRange(uint32_t slot, uint32_t boneOffset, uint32_t boneCount);
+        const glm::mat4& GetWorldMatrix(uint32_t slot) const { return m_Slots[slot].m_Record.m_WorldMatrix; }
+
+        // Recorded outside any render pass, before the frame's draws read the buffer.
+        void RecordUpload(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+
+        VkBuffer GetBuffer() const { return m_Buffer; }
+        // Bumped whenever the device buffer is replaced so descriptor sets know to rebind it.
+        uint64_t GetGeneration() const { return m_Generation; }
+        const UploadStats& GetStats() const { return m_Stats; }
+
+    private:
+        struct Slot
+        {
+            InstanceRecord m_Record{};
+            Transform m_Transform{};                   // Inputs m_Record.m_WorldMatrix was composed from.
+            glm::vec4 m_ObjectBounds{ 0.0f };
+            ECS::Entity m_Entity = 0;
+            uint64_t m_LastUsedFrame = 0;
+            uint64_t m_MovedFrame = 0;                 // Frame whose sync changed the transform.
+            bool m_HasTransform = false;
+            bool m_Dirty = false;
+        };
+
+        struct StagingBuffer
+        {
+            VkBuffer m_Buffer = VK_NULL_HANDLE;
+            VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+            void* m_Mapped = nullptr;
+            uint32_t m_Capacity = 0;                   // In records.
+        };
+
+        void MarkDirty(uint32_t slot);
+        void ReleaseSlot(uint32_t slot);
+        bool EnsureCapacity(uint32_t recordCount);
+        bool EnsureStaging(uint32_t imageIndex, uint32_t recordCount);
+        void DestroyStaging(StagingBuffer& staging);
+
+    private:
+        static constexpr uint32_t s_InitialCapacity = 1024;
+
+        Buffers* m_Buffers = nullptr;
+        VkBuffer m_Buffer = VK_NULL_HANDLE;            // Device-local record table shared by every frame.
+        VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+        uint32_t m_Capacity = 0;
+        uint64_t m_Generation = 0;
+
+        std::vector<Slot> m_Slots;
+        std::vector<uint32_t> m_FreeSlots;
+        std::unordered_map<ECS::Entity, uint32_t> m_EntitySlots;
+        std::vector<uint32_t> m_DirtySlots;            // Compact list of slots whose record must be scattered.
+        std::vector<uint32_t> m_MovedSlots;            // Slots whose transform changed during the current frame.
+        std::vector<uint32_t> m_SettlingSlots;         // Slots that moved last frame and now need m_PreviousWorldMatrix caught up.
+        std::vector<VkBufferCopy> m_CopyRegions;
+        std::vector<StagingBuffer> m_Staging;          // One per swapchain image, written only once that image has retired.
+        uint64_t m_Frame = 1;
+        UploadStats m_Stats{};
+    };
+}
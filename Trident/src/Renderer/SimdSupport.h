@@ -0,0 +1,58 @@
+#pragma once
+
+// Shared by the CPU pixel kernels (readback conversion, video colour conversion): which instruction sets the build can
+// target and which ones the running CPU actually supports. Kernels are compiled for every set the platform can have and
+// picked once at runtime, so one binary runs everywhere.
+#if defined(_M_X64) || defined(__x86_64__)
+#define TRIDENT_SIMD_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+// GCC and Clang only emit SSSE3/AVX2 instructions inside functions that opt in; MSVC accepts the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define TRIDENT_SIMD_TARGET(features) __attribute__((target(features)))
+#else
+#define TRIDENT_SIMD_TARGET(features)
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define TRIDENT_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace Trident::Simd
+{
+#if defined(TRIDENT_SIMD_X64)
+    inline bool SupportsSsse3()
+    {
+#if defined(_MSC_VER)
+        int l_Info[4]{};
+        __cpuid(l_Info, 1);
+
+        return (l_Info[2] & (1 << 9)) != 0;
+#else
+        return __builtin_cpu_supports("ssse3");
+#endif
+    }
+
+    inline bool SupportsAvx2()
+    {
+#if defined(_MSC_VER)
+        int l_Info[4]{};
+        __cpuid(l_Info, 1);
+        // The OS must save the upper YMM halves on context switches before AVX registers are safe to use.
+        const bool l_OsSavesYmm = (l_Info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        if (!l_OsSavesYmm)
+        {
+            return false;
+        }
+
+        __cpuidex(l_Info, 7, 0);
+
+        return (l_Info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+}
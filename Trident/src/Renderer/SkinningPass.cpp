@@ -0,0 +1,271 @@
+#include "Renderer/SkinningPass.h"
+
+#include "Renderer/Buffers.h"
+#include "Renderer/Pipeline.h"
+#include "Renderer/Vertex.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace Trident
+{
+    namespace
+    {
+        // Skinning.comp addresses vertices as 25 packed 32-bit words; these offsets are baked into the shader.
+        static_assert(sizeof(Vertex) == 100, "Vertex must match the packed layout read by Skinning.comp");
+        static_assert(offsetof(Vertex, m_BoneIndices) == 68 && offsetof(Vertex, m_BoneWeights) == 84, "Bone attributes moved; update Skinning.comp");
+    }
+
+    void SkinningPass::Init(Pipeline& pipeline, Buffers& buffers)
+    {
+        m_Buffers = &buffers;
+
+        static_assert(sizeof(SkinningPushConstants) == 20, "SkinningPushConstants must match Skinning.comp");
+
+        CreateDescriptorResources();
+
+        VkPushConstantRange l_PushConstant{};
+        l_PushConstant.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        l_PushConstant.offset = 0;
+        l_PushConstant.size = sizeof(SkinningPushConstants);
+
+        VkPipelineLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.setLayoutCount = 1;
+        l_LayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        l_LayoutInfo.pushConstantRangeCount = 1;
+        l_LayoutInfo.pPushConstantRanges = &l_PushConstant;
+
+        if (m_DescriptorSetLayout == VK_NULL_HANDLE || vkCreatePipelineLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create skinning pipeline layout");
+            return;
+        }
+
+        m_ComputePipeline = pipeline.CreateComputePipeline("Skinning.comp", m_PipelineLayout);
+        if (m_ComputePipeline == VK_NULL_HANDLE)
+        {
+            TR_CORE_WARN("Compute skinning disabled; animated meshes will be drawn in their bind pose");
+        }
+
+        TR_CORE_TRACE("SkinningPass initialised (Ready = {})", IsReady());
+    }
+
+    void SkinningPass::Shutdown()
+    {
+        VkDevice l_Device = Startup::GetDevice();
+
+        for (FrameResources& it_Frame : m_Frames)
+        {
+            if (m_Buffers)
+            {
+                m_Buffers->DestroyBuffer(it_Frame.m_OutputBuffer, it_Frame.m_OutputMemory);
+            }
+        }
+        m_Frames.clear();
+
+        if (m_ComputePipeline != VK_NULL_HANDLE)
+        {
+            vkDestroyPipeline(l_Device, m_ComputePipeline, nullptr);
+            m_ComputePipeline = VK_NULL_HANDLE;
+        }
+
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(l_Device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(l_Device, m_DescriptorPool, nullptr);
+            m_DescriptorPool = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(l_Device, m_DescriptorSetLayout, nullptr);
+            m_DescriptorSetLayout = VK_NULL_HANDLE;
+        }
+
+        m_PendingInstances.clear();
+        m_PendingVertexCount = 0;
+        m_Buffers = nullptr;
+    }
+
+    void SkinningPass::BeginFrame()
+    {
+        m_PendingInstances.clear();
+        m_PendingVertexCount = 0;
+    }
+
+    uint32_t SkinningPass::QueueInstance(int32_t baseVertex, uint32_t vertexCount, uint32_t boneOffset, uint32_t boneCount)
+    {
+        SkinningPushConstants l_Instance{};
+        l_Instance.m_SourceVertex = static_cast<uint32_t>(std::max(baseVertex, 0));
+        l_Instance.m_TargetVertex = m_PendingVertexCount;
+        l_Instance.m_VertexCount = vertexCount;
+        l_Instance.m_BoneOffset = boneOffset;
+        l_Instance.m_BoneCount = boneCount;
+        m_PendingInstances.push_back(l_Instance);
+
+        m_PendingVertexCount += vertexCount;
+
+        return l_Instance.m_TargetVertex;
+    }
+
+    bool SkinningPass::RecordSkinning(VkCommandBuffer commandBuffer, uint32_t frameIndex, VkBuffer sourceVertices, VkBuffer bonePalette)
+    {
+        if (m_PendingInstances.empty())
+        {
+            return true;
+        }
+
+        if (!IsReady() || commandBuffer == VK_NULL_HANDLE || sourceVertices == VK_NULL_HANDLE || bonePalette == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        if (!EnsureFrame(frameIndex, m_PendingVertexCount))
+        {
+            return false;
+        }
+
+        // The caller has waited on this image, so its set is idle; rewriting it every frame also follows palette reallocations.
+        FrameResources& l_Frame = m_Frames[frameIndex];
+        std::array<VkDescriptorBufferInfo, 3> l_BufferInfos{};
+        l_BufferInfos[0] = { sourceVertices, 0, VK_WHOLE_SIZE };
+        l_BufferInfos[1] = { bonePalette, 0, VK_WHOLE_SIZE };
+        l_BufferInfos[2] = { l_Frame.m_OutputBuffer, 0, VK_WHOLE_SIZE };
+
+        std::array<VkWriteDescriptorSet, 3> l_Writes{};
+        for (uint32_t it_Binding = 0; it_Binding < l_Writes.size(); ++it_Binding)
+        {
+            l_Writes[it_Binding] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            l_Writes[it_Binding].dstSet = l_Frame.m_DescriptorSet;
+            l_Writes[it_Binding].dstBinding = it_Binding;
+            l_Writes[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            l_Writes[it_Binding].descriptorCount = 1;
+            l_Writes[it_Binding].pBufferInfo = &l_BufferInfos[it_Binding];
+        }
+        vkUpdateDescriptorSets(Startup::GetDevice(), static_cast<uint32_t>(l_Writes.size()), l_Writes.data(), 0, nullptr);
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_ComputePipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, 1, &l_Frame.m_DescriptorSet, 0, nullptr);
+
+        // Instances are few and sized very differently, so each gets its own dispatch rather than a shared job table.
+        for (const SkinningPushConstants& it_Instance : m_PendingInstances)
+        {
+            vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(SkinningPushConstants), &it_Instance);
+            vkCmdDispatch(commandBuffer, (it_Instance.m_VertexCount + s_WorkGroupSize - 1) / s_WorkGroupSize, 1, 1);
+        }
+
+        VkBufferMemoryBarrier l_Barrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+        l_Barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        l_Barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+        l_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        l_Barrier.buffer = l_Frame.m_OutputBuffer;
+        l_Barrier.offset = 0;
+        l_Barrier.size = VK_WHOLE_SIZE;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, nullptr, 1, &l_Barrier, 0, nullptr);
+
+        return true;
+    }
+
+    VkBuffer SkinningPass::GetOutputBuffer(uint32_t frameIndex) const
+    {
+        return frameIndex < m_Frames.size() ? m_Frames[frameIndex].m_OutputBuffer : VK_NULL_HANDLE;
+    }
+
+    void SkinningPass::CreateDescriptorResources()
+    {
+        std::array<VkDescriptorSetLayoutBinding, 3> l_Bindings{};
+        for (uint32_t it_Binding = 0; it_Binding < l_Bindings.size(); ++it_Binding)
+        {
+            // 0 -> Shared source vertices, 1 -> Bone palette, 2 -> Skinned output vertices.
+            l_Bindings[it_Binding].binding = it_Binding;
+            l_Bindings[it_Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            l_Bindings[it_Binding].descriptorCount = 1;
+            l_Bindings[it_Binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo l_LayoutInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+        l_LayoutInfo.bindingCount = static_cast<uint32_t>(l_Bindings.size());
+        l_LayoutInfo.pBindings = l_Bindings.data();
+
+        if (vkCreateDescriptorSetLayout(Startup::GetDevice(), &l_LayoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create skinning descriptor set layout");
+            return;
+        }
+
+        VkDescriptorPoolSize l_PoolSize{};
+        l_PoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        l_PoolSize.descriptorCount = static_cast<uint32_t>(l_Bindings.size()) * s_MaxFrames;
+
+        VkDescriptorPoolCreateInfo l_PoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+        l_PoolInfo.maxSets = s_MaxFrames;
+        l_PoolInfo.poolSizeCount = 1;
+        l_PoolInfo.pPoolSizes = &l_PoolSize;
+
+        if (vkCreateDescriptorPool(Startup::GetDevice(), &l_PoolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
+        {
+            TR_CORE_CRITICAL("Failed to create skinning descriptor pool");
+        }
+    }
+
+    bool SkinningPass::EnsureFrame(uint32_t frameIndex, uint32_t vertexCount)
+    {
+        if (frameIndex >= s_MaxFrames || m_DescriptorPool == VK_NULL_HANDLE)
+        {
+            TR_CORE_ERROR("Compute skinning supports at most {} frames; frame {} draws the bind pose", s_MaxFrames, frameIndex);
+            return false;
+        }
+
+        if (frameIndex >= m_Frames.size())
+        {
+            const size_t l_FirstNew = m_Frames.size();
+            m_Frames.resize(static_cast<size_t>(frameIndex) + 1);
+
+            for (size_t it_Index = l_FirstNew; it_Index < m_Frames.size(); ++it_Index)
+            {
+                VkDescriptorSetAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+                l_AllocateInfo.descriptorPool = m_DescriptorPool;
+                l_AllocateInfo.descriptorSetCount = 1;
+                l_AllocateInfo.pSetLayouts = &m_DescriptorSetLayout;
+                if (vkAllocateDescriptorSets(Startup::GetDevice(), &l_AllocateInfo, &m_Frames[it_Index].m_DescriptorSet) != VK_SUCCESS)
+                {
+                    TR_CORE_ERROR("Failed to allocate skinning descriptor set for frame {}", it_Index);
+                }
+            }
+        }
+
+        FrameResources& l_Frame = m_Frames[frameIndex];
+        if (l_Frame.m_DescriptorSet == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        // Grow by 1.5x so characters streaming in one at a time do not reallocate every frame.
+        if (vertexCount > l_Frame.m_VertexCapacity || l_Frame.m_OutputBuffer == VK_NULL_HANDLE)
+        {
+            m_Buffers->DestroyBuffer(l_Frame.m_OutputBuffer, l_Frame.m_OutputMemory);
+
+            l_Frame.m_VertexCapacity = std::max(vertexCount, l_Frame.m_VertexCapacity + l_Frame.m_VertexCapacity / 2);
+            m_Buffers->CreateBuffer(static_cast<VkDeviceSize>(l_Frame.m_VertexCapacity) * sizeof(Vertex),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, l_Frame.m_OutputBuffer,
+                l_Frame.m_OutputMemory);
+            if (l_Frame.m_OutputBuffer == VK_NULL_HANDLE)
+            {
+                TR_CORE_ERROR("Failed to allocate {} skinned vertices for frame {}", l_Frame.m_VertexCapacity, frameIndex);
+                l_Frame.m_VertexCapacity = 0;
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
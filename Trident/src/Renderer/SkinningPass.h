@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Trident
+{
+    class Buffers;
+    class Pipeline;
+
+    /**
+     * @brief Skins every animated mesh instance once per frame in compute, ahead of all render passes.
+     *
+     * Each queued instance gets its own range in the frame's output buffer, laid out exactly like the shared vertex
+     * buffer so the main pipeline consumes it without a skinning-aware vertex shader. Draws bind the output buffer and
+     * replace the mesh's base vertex with the instance's first output vertex; the index ranges stay untouched, so every
+     * LOD and every viewport reuses the same skinned vertices.
+     */
+    class SkinningPass
+    {
+    public:
+        void Init(Pipeline& pipeline, Buffers& buffers);
+        void Shutdown();
+
+        void BeginFrame();
+        // Returns the first vertex of the instance's output range, used as vertexOffset when drawing it.
+        uint32_t QueueInstance(int32_t baseVertex, uint32_t vertexCount, uint32_t boneOffset, uint32_t boneCount);
+        // Recorded outside any render pass; returns false when the queued instances must fall back to the bind pose.
+        bool RecordSkinning(VkCommandBuffer commandBuffer, uint32_t frameIndex, VkBuffer sourceVertices, VkBuffer bonePalette);
+
+        VkBuffer GetOutputBuffer(uint32_t frameIndex) const;
+        bool IsReady() const { return m_ComputePipeline != VK_NULL_HANDLE; }
+        uint32_t GetSkinnedVertexCount() const { return m_PendingVertexCount; }
+
+    private:
+        // Mirrors the push constant block in Skinning.comp.
+        struct SkinningPushConstants
+        {
+            uint32_t m_SourceVertex = 0;
+            uint32_t m_TargetVertex = 0;
+            uint32_t m_VertexCount = 0;
+            uint32_t m_BoneOffset = 0;
+            uint32_t m_BoneCount = 0;
+        };
+
+        struct FrameResources
+        {
+            VkBuffer m_OutputBuffer = VK_NULL_HANDLE;          // Device-local skinned vertices read by every viewport this frame.
+            VkDeviceMemory m_OutputMemory = VK_NULL_HANDLE;
+            VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+            uint32_t m_VertexCapacity = 0;
+        };
+
+        void CreateDescriptorResources();
+        bool EnsureFrame(uint32_t frameIndex, uint32_t vertexCount);
+
+    private:
+        static constexpr uint32_t s_MaxFrames = 8;        // Upper bound on swapchain images served by the descriptor pool.
+        static constexpr uint32_t s_WorkGroupSize = 64;   // Must match local_size_x in Skinning.comp.
+
+        Buffers* m_Buffers = nullptr;
+
+        VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
+        VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        VkPipeline m_ComputePipeline = VK_NULL_HANDLE;
+
+        std::vector<FrameResources> m_Frames;
+        std::vector<SkinningPushConstants> m_PendingInstances;
+        uint32_t m_PendingVertexCount = 0;
+    };
+}
@@ -9,7 +9,7 @@
 
 namespace Trident
 {
-    void Skybox::Init(Buffers& buffers, CommandBufferPool& pool)
+    void Skybox::Init(Buffers& buffers)
     {
         // Only the vertex positions are required to compute cubemap directions in the shader, so keep the layout minimal.
         std::array<glm::vec3, 8> l_Positions =
@@ -36,8 +36,8 @@ namespace Trident
         };
 
         // Upload the minimal position-only cube. Additional attributes are derived from the cubemap lookup, so no extra data is transferred.
-        buffers.CreateVertexBuffer(l_Positions.data(), l_Positions.size(), sizeof(glm::vec3), pool, m_VertexBuffer, m_VertexBufferMemory);
-        buffers.CreateIndexBuffer(l_Indices, pool, m_IndexBuffer, m_IndexBufferMemory, m_IndexCount);
+        buffers.CreateVertexBuffer(l_Positions.data(), l_Positions.size(), sizeof(glm::vec3), m_VertexBuffer, m_VertexBufferMemory);
+        buffers.CreateIndexBuffer(l_Indices, m_IndexBuffer, m_IndexBufferMemory, m_IndexCount);
 
         // TODO: Expand the layout when we introduce per-vertex skybox parallax or procedural horizon blending.
     }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "Renderer/Buffers.h"
-#include "Renderer/CommandBufferPool.h"
 
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
@@ -13,7 +12,7 @@ namespace Trident
     class Skybox
     {
     public:
-        void Init(Buffers& buffers, CommandBufferPool& pool);
+        void Init(Buffers& buffers);
         void Cleanup(Buffers& buffers);
         void Record(VkCommandBuffer cmdBuffer, VkPipelineLayout layout, const VkDescriptorSet* descriptorSets, uint32_t imageIndex);
 
@@ -0,0 +1,574 @@
+#include "Renderer/TextureStreamer.h"
+
+#include "Renderer/Buffers.h"
+#include "Application/Startup.h"
+#include "Core/Utilities.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Trident
+{
+    namespace
+    {
+        // vkCmdCopyBufferToImage wants each bufferOffset on a texel block boundary (8 or 16 bytes for BC formats) and transfer
+        // queues additionally want multiples of 4, so every texture in a batch starts on the larger of 16 and its block size.
+        VkDeviceSize GetStagingAlignment(VkFormat format)
+        {
+            VkDeviceSize l_BlockBytes = 4;
+            switch (format)
+            {
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC4_UNORM_BLOCK:
+            case VK_FORMAT_BC4_SNORM_BLOCK:
+                l_BlockBytes = 8;
+                break;
+            case VK_FORMAT_BC2_UNORM_BLOCK:
+            case VK_FORMAT_BC2_SRGB_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC5_SNORM_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+                l_BlockBytes = 16;
+                break;
+            default:
+                break;
+            }
+
+            return std::max<VkDeviceSize>(16, l_BlockBytes);
+        }
+
+        VkDeviceSize AlignStagingOffset(VkDeviceSize offset, VkDeviceSize alignment)
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        // Builds the chain the upload copies verbatim. Cooked textures already carry one and only lose their top levels.
+        void PrepareMipChain(Loader::TextureData& texture, uint32_t mipDropCount, uint32_t minDroppedSize)
+        {
+            if (!texture.Mips.empty())
+            {
+                size_t l_FirstLevel = 0;
+                while (l_FirstLevel < mipDropCount && l_FirstLevel + 1 < texture.Mips.size()
+                    && std::max(texture.Mips[l_FirstLevel].m_Width, texture.Mips[l_FirstLevel].m_Height) > minDroppedSize)
+                {
+                    ++l_FirstLevel;
+                }
+
+                texture.Mips.erase(texture.Mips.begin(), texture.Mips.begin() + static_cast<std::ptrdiff_t>(l_FirstLevel));
+                texture.Width = static_cast<int>(texture.Mips.front().m_Width);
+                texture.Height = static_cast<int>(texture.Mips.front().m_Height);
+
+                return;
+            }
+
+            for (uint32_t it_Drop = 0; it_Drop < mipDropCount; ++it_Drop)
+            {
+                if (std::max(texture.Width, texture.Height) <= static_cast<int>(minDroppedSize))
+                {
+                    break;
+                }
+
+                Loader::TextureData l_Reduced = Loader::TextureLoader::Downsample(texture);
+                if (l_Reduced.Pixels.empty())
+                {
+                    break;
+                }
+
+                texture = std::move(l_Reduced);
+            }
+
+            std::vector<Loader::TextureMipRegion> l_Mips{ { 0, texture.Pixels.size(), static_cast<uint32_t>(texture.Width), static_cast<uint32_t>(texture.Height) } };
+            texture.Pixels.reserve(texture.Pixels.size() + texture.Pixels.size() / 3 + 16);
+
+            Loader::TextureData l_Level = Loader::TextureLoader::Downsample(texture);
+            while (!l_Level.Pixels.empty())
+            {
+                l_Mips.push_back({ texture.Pixels.size(), l_Level.Pixels.size(), static_cast<uint32_t>(l_Level.Width), static_cast<uint32_t>(l_Level.Height) });
+                texture.Pixels.insert(texture.Pixels.end(), l_Level.Pixels.begin(), l_Level.Pixels.end());
+                if (l_Level.Width == 1 && l_Level.Height == 1)
+                {
+                    break;
+                }
+
+                l_Level = Loader::TextureLoader::Downsample(l_Level);
+            }
+
+            texture.Mips = std::move(l_Mips);
+        }
+    }
+
+    bool TextureStreamer::Init(Buffers& buffers, uint32_t workerCount)
+    {
+        m_Buffers = &buffers;
+
+        if (!Startup::SupportsTimelineSemaphores())
+        {
+            TR_CORE_WARN("Texture streaming disabled because timeline semaphores are unavailable; textures upload synchronously");
+            return false;
+        }
+
+        const QueueFamilyIndices l_Families = Startup::GetQueueFamilyIndices();
+        const uint32_t l_GraphicsFamily = l_Families.GraphicsFamily.value();
+        const uint32_t l_TransferFamily = l_Families.TransferFamily.value_or(l_GraphicsFamily);
+        m_SharedFamilies.clear();
+        if (l_TransferFamily != l_GraphicsFamily)
+        {
+            m_SharedFamilies = { l_GraphicsFamily, l_TransferFamily };
+        }
+
+        VkCommandPoolCreateInfo l_PoolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        l_PoolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        l_PoolInfo.queueFamilyIndex = l_TransferFamily;
+        if (vkCreateCommandPool(Startup::GetDevice(), &l_PoolInfo, nullptr, &m_CommandPool) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create the texture streaming command pool");
+            return false;
+        }
+
+        VkSemaphoreTypeCreateInfo l_TimelineInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
+        l_TimelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        l_TimelineInfo.initialValue = 0;
+        VkSemaphoreCreateInfo l_SemaphoreInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+        l_SemaphoreInfo.pNext = &l_TimelineInfo;
+        if (vkCreateSemaphore(Startup::GetDevice(), &l_SemaphoreInfo, nullptr, &m_TimelineSemaphore) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to create the texture streaming timeline semaphore");
+            vkDestroyCommandPool(Startup::GetDevice(), m_CommandPool, nullptr);
+            m_CommandPool = VK_NULL_HANDLE;
+
+            return false;
+        }
+
+        m_SubmittedValue = 0;
+        m_CompletedValue = 0;
+        m_WorkersShouldStop = false;
+        const uint32_t l_WorkerCount = std::max(workerCount, 1u);
+        for (uint32_t it_Worker = 0; it_Worker < l_WorkerCount; ++it_Worker)
+        {
+            m_Workers.emplace_back(&TextureStreamer::WorkerLoop, this);
+        }
+
+        TR_CORE_TRACE("TextureStreamer initialised (Workers = {}, Transfer family = {}, Dedicated = {})", l_WorkerCount, l_TransferFamily,
+            l_TransferFamily != l_GraphicsFamily);
+
+        return true;
+    }
+
+    void TextureStreamer::Shutdown()
+    {
+        {
+            std::scoped_lock l_Lock(m_QueueMutex);
+            m_WorkersShouldStop = true;
+            m_Jobs.clear();
+        }
+        m_QueueCondition.notify_all();
+
+        for (std::thread& it_Worker : m_Workers)
+        {
+            if (it_Worker.joinable())
+            {
+                it_Worker.join();
+            }
+        }
+        m_Workers.clear();
+        m_Decoded.clear();
+
+        if (!m_Batches.empty() && m_TimelineSemaphore != VK_NULL_HANDLE)
+        {
+            // Teardown is the one place allowed to block; in-flight copies must finish before their images are freed.
+            VkSemaphoreWaitInfo l_WaitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+            l_WaitInfo.semaphoreCount = 1;
+            l_WaitInfo.pSemaphores = &m_TimelineSemaphore;
+            l_WaitInfo.pValues = &m_SubmittedValue;
+            vkWaitSemaphores(Startup::GetDevice(), &l_WaitInfo, UINT64_MAX);
+        }
+
+        for (UploadBatch& it_Batch : m_Batches)
+        {
+            DestroyBatch(it_Batch, true);
+        }
+        m_Batches.clear();
+
+        if (m_TimelineSemaphore != VK_NULL_HANDLE)
+        {
+            vkDestroySemaphore(Startup::GetDevice(), m_TimelineSemaphore, nullptr);
+            m_TimelineSemaphore = VK_NULL_HANDLE;
+        }
+
+        if (m_CommandPool != VK_NULL_HANDLE)
+        {
+            vkDestroyCommandPool(Startup::GetDevice(), m_CommandPool, nullptr);
+            m_CommandPool = VK_NULL_HANDLE;
+        }
+
+        m_PendingCount = 0;
+    }
+
+    uint64_t TextureStreamer::Request(const std::string& filePath, uint32_t mipDropCount, uint32_t minDroppedSize, bool linear)
+    {
+        const uint64_t l_Ticket = m_NextTicket++;
+        {
+            std::scoped_lock l_Lock(m_QueueMutex);
+            m_Jobs.push_back({ l_Ticket, filePath, mipDropCount, minDroppedSize, linear });
+        }
+        m_QueueCondition.notify_one();
+        ++m_PendingCount;
+
+        return l_Ticket;
+    }
+
+    void TextureStreamer::Update(std::vector<StreamedTexture>& completed)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        const size_t l_FirstCompleted = completed.size();
+
+        // Retire every batch the transfer queue has finished; the counter only moves forward so the front retires first.
+        uint64_t l_SignalledValue = 0;
+        vkGetSemaphoreCounterValue(Startup::GetDevice(), m_TimelineSemaphore, &l_SignalledValue);
+        while (!m_Batches.empty() && m_Batches.front().m_SignalValue <= l_SignalledValue)
+        {
+            UploadBatch& l_Batch = m_Batches.front();
+            completed.insert(completed.end(), l_Batch.m_Textures.begin(), l_Batch.m_Textures.end());
+            m_CompletedValue = l_Batch.m_SignalValue;
+            DestroyBatch(l_Batch, false);
+            m_Batches.pop_front();
+        }
+
+        std::vector<DecodedTexture> l_Decoded;
+        {
+            std::scoped_lock l_Lock(m_QueueMutex);
+            VkDeviceSize l_BatchBytes = 0;
+            while (!m_Decoded.empty())
+            {
+                const VkDeviceSize l_Bytes = static_cast<VkDeviceSize>(m_Decoded.front().m_Data.Pixels.size());
+                if (!l_Decoded.empty() && l_BatchBytes + l_Bytes > s_MaxBatchBytes)
+                {
+                    break;
+                }
+
+                l_BatchBytes += l_Bytes;
+                l_Decoded.push_back(std::move(m_Decoded.front()));
+                m_Decoded.pop_front();
+            }
+        }
+
+        if (!l_Decoded.empty())
+        {
+            SubmitBatch(l_Decoded, completed);
+        }
+
+        m_PendingCount -= std::min(m_PendingCount, static_cast<uint32_t>(completed.size() - l_FirstCompleted));
+    }
+
+    void TextureStreamer::Discard(StreamedTexture& texture)
+    {
+        VkDevice l_Device = Startup::GetDevice();
+        if (texture.m_View != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(l_Device, texture.m_View, nullptr);
+        }
+
+        if (texture.m_Image != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(l_Device, texture.m_Image, nullptr);
+        }
+
+        if (texture.m_Memory != VK_NULL_HANDLE)
+        {
+            vkFreeMemory(l_Device, texture.m_Memory, nullptr);
+        }
+
+        texture = StreamedTexture{ texture.m_Ticket };
+    }
+
+    void TextureStreamer::WorkerLoop()
+    {
+        while (true)
+        {
+            DecodeJob l_Job{};
+            {
+                std::unique_lock<std::mutex> l_Lock(m_QueueMutex);
+                m_QueueCondition.wait(l_Lock, [this]()
+                    {
+                        return m_WorkersShouldStop || !m_Jobs.empty();
+                    });
+
+                if (m_WorkersShouldStop)
+                {
+                    break;
+                }
+
+                l_Job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+            }
+
+            DecodedTexture l_Decoded{ l_Job.m_Ticket, Loader::TextureLoader::Load(l_Job.m_FilePath, l_Job.m_Linear) };
+            if (!l_Decoded.m_Data.Pixels.empty())
+            {
+                PrepareMipChain(l_Decoded.m_Data, l_Job.m_MipDropCount, l_Job.m_MinDroppedSize);
+            }
+
+            std::scoped_lock l_Lock(m_QueueMutex);
+            m_Decoded.push_back(std::move(l_Decoded));
+        }
+    }
+
+    void TextureStreamer::SubmitBatch(std::vector<DecodedTexture>& decoded, std::vector<StreamedTexture>& completed)
+    {
+        VkDevice l_Device = Startup::GetDevice();
+
+        UploadBatch l_Batch{};
+        std::vector<const Loader::TextureData*> l_Sources;
+        VkDeviceSize l_StagingSize = 0;
+        for (DecodedTexture& it_Decoded : decoded)
+        {
+            StreamedTexture l_Texture{ it_Decoded.m_Ticket };
+            if (it_Decoded.m_Data.Pixels.empty() || !CreateImage(it_Decoded.m_Data, l_Texture))
+            {
+                // Failures are reported straight away so the slot can stop waiting; it keeps the placeholder.
+                completed.push_back(l_Texture);
+                continue;
+            }
+
+            l_Batch.m_Textures.push_back(l_Texture);
+            l_Sources.push_back(&it_Decoded.m_Data);
+            l_StagingSize = AlignStagingOffset(l_StagingSize, GetStagingAlignment(it_Decoded.m_Data.Format))
+                + static_cast<VkDeviceSize>(it_Decoded.m_Data.Pixels.size());
+        }
+
+        if (l_Batch.m_Textures.empty())
+        {
+            return;
+        }
+
+        m_Buffers->CreateBuffer(l_StagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            l_Batch.m_StagingBuffer, l_Batch.m_StagingMemory);
+
+        VkCommandBufferAllocateInfo l_AllocateInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        l_AllocateInfo.commandPool = m_CommandPool;
+        l_AllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        l_AllocateInfo.commandBufferCount = 1;
+
+        void* l_Mapped = nullptr;
+        if (l_Batch.m_StagingBuffer == VK_NULL_HANDLE || vkMapMemory(l_Device, l_Batch.m_StagingMemory, 0, l_StagingSize, 0, &l_Mapped) != VK_SUCCESS
+            || vkAllocateCommandBuffers(l_Device, &l_AllocateInfo, &l_Batch.m_CommandBuffer) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to prepare a texture streaming batch of {} bytes", static_cast<uint64_t>(l_StagingSize));
+            for (StreamedTexture& it_Texture : l_Batch.m_Textures)
+            {
+                Discard(it_Texture);
+                completed.push_back(it_Texture);
+            }
+            l_Batch.m_Textures.clear();
+            DestroyBatch(l_Batch, false);
+
+            return;
+        }
+
+        VkCommandBufferBeginInfo l_BeginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        l_BeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(l_Batch.m_CommandBuffer, &l_BeginInfo);
+
+        std::vector<VkBufferImageCopy> l_CopyRegions;
+        VkDeviceSize l_StagingOffset = 0;
+        for (size_t it_Index = 0; it_Index < l_Batch.m_Textures.size(); ++it_Index)
+        {
+            const StreamedTexture& l_Texture = l_Batch.m_Textures[it_Index];
+            const Loader::TextureData& l_Source = *l_Sources[it_Index];
+            l_StagingOffset = AlignStagingOffset(l_StagingOffset, GetStagingAlignment(l_Source.Format));
+            std::memcpy(static_cast<uint8_t*>(l_Mapped) + l_StagingOffset, l_Source.Pixels.data(), l_Source.Pixels.size());
+
+            l_CopyRegions.clear();
+            for (uint32_t it_Level = 0; it_Level < l_Texture.m_MipLevels; ++it_Level)
+            {
+                const Loader::TextureMipRegion& l_Region = l_Source.Mips[it_Level];
+
+                VkBufferImageCopy l_CopyRegion{};
+                l_CopyRegion.bufferOffset = l_StagingOffset + static_cast<VkDeviceSize>(l_Region.m_Offset);
+                l_CopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                l_CopyRegion.imageSubresource.mipLevel = it_Level;
+                l_CopyRegion.imageSubresource.baseArrayLayer = 0;
+                l_CopyRegion.imageSubresource.layerCount = 1;
+                l_CopyRegion.imageOffset = { 0, 0, 0 };
+                l_CopyRegion.imageExtent = { l_Region.m_Width, l_Region.m_Height, 1 };
+                l_CopyRegions.push_back(l_CopyRegion);
+            }
+
+            VkImageMemoryBarrier l_Barrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            l_Barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            l_Barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            l_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            l_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            l_Barrier.image = l_Texture.m_Image;
+            l_Barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            l_Barrier.subresourceRange.baseMipLevel = 0;
+            l_Barrier.subresourceRange.levelCount = l_Texture.m_MipLevels;
+            l_Barrier.subresourceRange.baseArrayLayer = 0;
+            l_Barrier.subresourceRange.layerCount = 1;
+            l_Barrier.srcAccessMask = 0;
+            l_Barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(l_Batch.m_CommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+            vkCmdCopyBufferToImage(l_Batch.m_CommandBuffer, l_Batch.m_StagingBuffer, l_Texture.m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                static_cast<uint32_t>(l_CopyRegions.size()), l_CopyRegions.data());
+
+            // Transfer queues cannot name fragment stages; the graphics-side semaphore wait supplies visibility instead.
+            l_Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            l_Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            l_Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            l_Barrier.dstAccessMask = 0;
+            vkCmdPipelineBarrier(l_Batch.m_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &l_Barrier);
+
+            l_StagingOffset += static_cast<VkDeviceSize>(l_Source.Pixels.size());
+        }
+
+        vkUnmapMemory(l_Device, l_Batch.m_StagingMemory);
+        vkEndCommandBuffer(l_Batch.m_CommandBuffer);
+
+        l_Batch.m_SignalValue = m_SubmittedValue + 1;
+
+        VkTimelineSemaphoreSubmitInfo l_TimelineSubmitInfo{ VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO };
+        l_TimelineSubmitInfo.signalSemaphoreValueCount = 1;
+        l_TimelineSubmitInfo.pSignalSemaphoreValues = &l_Batch.m_SignalValue;
+
+        VkSubmitInfo l_SubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        l_SubmitInfo.pNext = &l_TimelineSubmitInfo;
+        l_SubmitInfo.commandBufferCount = 1;
+        l_SubmitInfo.pCommandBuffers = &l_Batch.m_CommandBuffer;
+        l_SubmitInfo.signalSemaphoreCount = 1;
+        l_SubmitInfo.pSignalSemaphores = &m_TimelineSemaphore;
+
+        if (vkQueueSubmit(Startup::GetTransferQueue(), 1, &l_SubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+        {
+            TR_CORE_ERROR("Failed to submit {} streamed textures to the transfer queue", l_Batch.m_Textures.size());
+            for (StreamedTexture& it_Texture : l_Batch.m_Textures)
+            {
+                Discard(it_Texture);
+                completed.push_back(it_Texture);
+            }
+            l_Batch.m_Textures.clear();
+            DestroyBatch(l_Batch, false);
+
+            return;
+        }
+
+        m_SubmittedValue = l_Batch.m_SignalValue;
+        m_Batches.push_back(std::move(l_Batch));
+    }
+
+    bool TextureStreamer::CreateImage(const Loader::TextureData& texture, StreamedTexture& outTexture) const
+    {
+        VkDevice l_Device = Startup::GetDevice();
+        const uint32_t l_MipLevels = static_cast<uint32_t>(texture.Mips.size());
+        if (l_MipLevels == 0)
+        {
+            return false;
+        }
+
+        VkImageCreateInfo l_ImageInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        l_ImageInfo.imageType = VK_IMAGE_TYPE_2D;
+        l_ImageInfo.extent.width = texture.Mips.front().m_Width;
+        l_ImageInfo.extent.height = texture.Mips.front().m_Height;
+        l_ImageInfo.extent.depth = 1;
+        l_ImageInfo.mipLevels = l_MipLevels;
+        l_ImageInfo.arrayLayers = 1;
+        l_ImageInfo.format = texture.Format;
+        l_ImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        l_ImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        l_ImageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        l_ImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        // Concurrent sharing lets the graphics queue sample what the transfer queue wrote without an ownership handoff.
+        l_ImageInfo.sharingMode = m_SharedFamilies.empty() ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
+        l_ImageInfo.queueFamilyIndexCount = static_cast<uint32_t>(m_SharedFamilies.size());
+        l_ImageInfo.pQueueFamilyIndices = m_SharedFamilies.empty() ? nullptr : m_SharedFamilies.data();
+
+        if (vkCreateImage(l_Device, &l_ImageInfo, nullptr, &outTexture.m_Image) != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        VkMemoryRequirements l_MemoryRequirements{};
+        vkGetImageMemoryRequirements(l_Device, outTexture.m_Image, &l_MemoryRequirements);
+
+        VkMemoryAllocateInfo l_AllocInfo{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        l_AllocInfo.allocationSize = l_MemoryRequirements.size;
+        l_AllocInfo.memoryTypeIndex = m_Buffers->FindMemoryType(l_MemoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (vkAllocateMemory(l_Device, &l_AllocInfo, nullptr, &outTexture.m_Memory) != VK_SUCCESS)
+        {
+            vkDestroyImage(l_Device, outTexture.m_Image, nullptr);
+            outTexture.m_Image = VK_NULL_HANDLE;
+
+            return false;
+        }
+
+        vkBindImageMemory(l_Device, outTexture.m_Image, outTexture.m_Memory, 0);
+
+        VkImageViewCreateInfo l_ViewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+        l_ViewInfo.image = outTexture.m_Image;
+        l_ViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        l_ViewInfo.format = texture.Format;
+        l_ViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        l_ViewInfo.subresourceRange.baseMipLevel = 0;
+        l_ViewInfo.subresourceRange.levelCount = l_MipLevels;
+        l_ViewInfo.subresourceRange.baseArrayLayer = 0;
+        l_ViewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(l_Device, &l_ViewInfo, nullptr, &outTexture.m_View) != VK_SUCCESS)
+        {
+            vkDestroyImage(l_Device, outTexture.m_Image, nullptr);
+            vkFreeMemory(l_Device, outTexture.m_Memory, nullptr);
+            outTexture.m_Image = VK_NULL_HANDLE;
+            outTexture.m_Memory = VK_NULL_HANDLE;
+
+            return false;
+        }
+
+        outTexture.m_MipLevels = l_MipLevels;
+        outTexture.m_Bytes = l_AllocInfo.allocationSize;
+
+        return true;
+    }
+
+    void TextureStreamer::DestroyBatch(UploadBatch& batch, bool destroyTextures)
+    {
+        VkDevice l_Device = Startup::GetDevice();
+        if (batch.m_CommandBuffer != VK_NULL_HANDLE)
+        {
+            vkFreeCommandBuffers(l_Device, m_CommandPool, 1, &batch.m_CommandBuffer);
+            batch.m_CommandBuffer = VK_NULL_HANDLE;
+        }
+
+        // Staging memory never reaches the graphics queue, so it is released as soon as the copy retires.
+        if (batch.m_StagingBuffer != VK_NULL_HANDLE)
+        {
+            vkDestroyBuffer(l_Device, batch.m_StagingBuffer, nullptr);
+            batch.m_StagingBuffer = VK_NULL_HANDLE;
+        }
+
+        if (batch.m_StagingMemory != VK_NULL_HANDLE)
+        {
+            vkFreeMemory(l_Device, batch.m_StagingMemory, nullptr);
+            batch.m_StagingMemory = VK_NULL_HANDLE;
+        }
+
+        if (destroyTextures)
+        {
+            for (StreamedTexture& it_Texture : batch.m_Textures)
+            {
+                Discard(it_Texture);
+            }
+        }
+        batch.m_Textures.clear();
+    }
+}
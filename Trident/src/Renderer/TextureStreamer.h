@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Loader/TextureLoader.h"
+
+#include <vulkan/vulkan.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Trident
+{
+    class Buffers;
+
+    /**
+     * @brief Decodes material textures on worker threads and uploads them on the transfer queue without stalling the frame.
+     *
+     * Workers decode the image and build its full mip chain on the CPU, so transfer-only queues (which cannot blit) can
+     * upload it. Update() packs the finished decodes into one staging buffer per frame, records the copies on the
+     * transfer queue and signals a timeline semaphore. Images are returned only after the host observes that value, so
+     * callers keep a placeholder bound until then and never wait. Graphics submissions wait on GetSemaphore() at
+     * GetCompletedValue() so the copies are visible to shaders; that wait is already satisfied when it is reached.
+     */
+    class TextureStreamer
+    {
+    public:
+        struct StreamedTexture
+        {
+            uint64_t m_Ticket = 0;                              // Value returned by Request.
+            VkImage m_Image = VK_NULL_HANDLE;                   // Null when the texture could not be decoded or uploaded.
+            VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+            VkImageView m_View = VK_NULL_HANDLE;
+            uint32_t m_MipLevels = 0;
+            VkDeviceSize m_Bytes = 0;                           // Device memory backing m_Image.
+        };
+
+        // Streaming needs timeline semaphores; Init returns false and leaves the streamer disabled without them.
+        bool Init(Buffers& buffers, uint32_t workerCount);
+        void Shutdown();
+
+        // Returns a non-zero ticket that identifies the texture once it is handed back by Update. Data maps pass linear.
+        uint64_t Request(const std::string& filePath, uint32_t mipDropCount, uint32_t minDroppedSize, bool linear);
+        // Never blocks: submits textures decoded since the last call and returns the ones whose upload has retired.
+        void Update(std::vector<StreamedTexture>& completed);
+        // Releases a returned texture that no slot wants any more; its upload has already retired.
+        void Discard(StreamedTexture& texture);
+
+        bool IsEnabled() const { return m_TimelineSemaphore != VK_NULL_HANDLE; }
+        VkSemaphore GetSemaphore() const { return m_TimelineSemaphore; }
+        uint64_t GetCompletedValue() const { return m_CompletedValue; }
+        uint32_t GetPendingCount() const { return m_PendingCount; }
+
+    private:
+        struct DecodeJob
+        {
+            uint64_t m_Ticket = 0;
+            std::string m_FilePath{};
+            uint32_t m_MipDropCount = 0;
+            uint32_t m_MinDroppedSize = 0;
+            bool m_Linear = false;                              // Decoded as UNORM with a plainly averaged chain.
+        };
+
+        struct DecodedTexture
+        {
+            uint64_t m_Ticket = 0;
+            Loader::TextureData m_Data{};                       // Mips always populated; levels are uploaded as-is.
+        };
+
+        struct UploadBatch
+        {
+            uint64_t m_SignalValue = 0;                         // Timeline value signalled when every copy has finished.
+            VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+            VkBuffer m_StagingBuffer = VK_NULL_HANDLE;
+            VkDeviceMemory m_StagingMemory = VK_NULL_HANDLE;
+            std::vector<StreamedTexture> m_Textures;
+        };
+
+        void WorkerLoop();
+        void SubmitBatch(std::vector<DecodedTexture>& decoded, std::vector<StreamedTexture>& completed);
+        bool CreateImage(const Loader::TextureData& texture, StreamedTexture& outTexture) const;
+        void DestroyBatch(UploadBatch& batch, bool destroyTextures);
+
+    private:
+        static constexpr VkDeviceSize s_MaxBatchBytes = 64ull * 1024ull * 1024ull; // Staging budget per frame; one texture always goes through.
+
+        Buffers* m_Buffers = nullptr;
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;           // Allocated from the transfer family.
+        VkSemaphore m_TimelineSemaphore = VK_NULL_HANDLE;
+        uint64_t m_SubmittedValue = 0;
+        uint64_t m_CompletedValue = 0;                          // Highest value whose textures were handed back.
+        std::vector<uint32_t> m_SharedFamilies;                 // Graphics + transfer when they differ, so no ownership transfer is needed.
+        std::deque<UploadBatch> m_Batches;                      // In submission order, so they retire front to back.
+        uint64_t m_NextTicket = 1;
+        uint32_t m_PendingCount = 0;                            // Requests not yet handed back by Update.
+
+        std::vector<std::thread> m_Workers;
+        std::mutex m_QueueMutex;                                // Guards m_Jobs, m_Decoded and m_WorkersShouldStop.
+        std::condition_variable m_QueueCondition;
+        std::deque<DecodeJob> m_Jobs;
+        std::deque<DecodedTexture> m_Decoded;
+        bool m_WorkersShouldStop = false;
+    };
+}
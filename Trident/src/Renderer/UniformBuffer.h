@@ -27,9 +27,10 @@ struct GlobalUniformBuffer
     PointLightUniform PointLights[kMaxPointLights]; // Packed array of active point lights
 };
 
-// Material parameters consumed by the fragment shader.
+// One record of the std430 material storage buffer, indexed by the draw's material index in the fragment shader.
 struct MaterialUniformBuffer
 {
     glm::vec4 BaseColorFactor;            // Base color multiplier from the material definition
     glm::vec4 MaterialFactors;            // x = metallic, y = roughness, z = ambient strength, w reserved
+    glm::ivec4 TextureSlots;              // x = base color, y = metallic-roughness, z = normal (0 = none), w reserved
 };
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <cstring>
 #include <string>
+#include <thread>
 #include <utility>
 
 extern "C"
@@ -11,18 +14,91 @@ extern "C"
     #include <libavformat/avformat.h>
     #include <libavutil/imgutils.h>
     #include <libavutil/opt.h>
-    #include <libswscale/swscale.h>
 }
 
 namespace Trident
 {
+    std::shared_ptr<std::vector<uint8_t>> PixelBufferPool::Acquire(size_t size)
+    {
+        std::unique_ptr<std::vector<uint8_t>> l_Buffer;
+        {
+            std::scoped_lock l_Lock(m_Mutex);
+            if (!m_FreeBuffers.empty())
+            {
+                // Prefer a buffer that already holds the size so resizing never reallocates.
+                auto a_Found = std::find_if(m_FreeBuffers.begin(), m_FreeBuffers.end(), [size](const std::unique_ptr<std::vector<uint8_t>>& buffer)
+                    {
+                        return buffer->capacity() >= size;
+                    });
+                if (a_Found == m_FreeBuffers.end())
+                {
+                    a_Found = m_FreeBuffers.begin();
+                }
+
+                l_Buffer = std::move(*a_Found);
+                m_FreeBuffers.erase(a_Found);
+            }
+        }
+
+        if (!l_Buffer)
+        {
+            l_Buffer = std::make_unique<std::vector<uint8_t>>();
+        }
+        l_Buffer->resize(size);
+
+        const std::weak_ptr<PixelBufferPool> l_Pool = weak_from_this();
+
+        return std::shared_ptr<std::vector<uint8_t>>(l_Buffer.release(), [l_Pool](std::vector<uint8_t>* buffer)
+            {
+                if (const std::shared_ptr<PixelBufferPool> l_Owner = l_Pool.lock())
+                {
+                    l_Owner->Recycle(buffer);
+
+                    return;
+                }
+
+                delete buffer;
+            });
+    }
+
+    void PixelBufferPool::Clear()
+    {
+        std::scoped_lock l_Lock(m_Mutex);
+        m_FreeBuffers.clear();
+    }
+
+    void PixelBufferPool::Recycle(std::vector<uint8_t>* buffer)
+    {
+        std::unique_ptr<std::vector<uint8_t>> l_Buffer(buffer);
+
+        std::scoped_lock l_Lock(m_Mutex);
+        if (m_FreeBuffers.size() < m_MaxRetained)
+        {
+            m_FreeBuffers.push_back(std::move(l_Buffer));
+        }
+    }
+
     bool VideoEncoder::BeginSession(const std::filesystem::path& outputPath, VkExtent2D extent, uint32_t targetFps)
+    {
+        return OpenSession(outputPath, extent, targetFps, false);
+    }
+
+    bool VideoEncoder::BeginReplaySession(VkExtent2D extent, uint32_t targetFps)
+    {
+        return OpenSession({}, extent, targetFps, true);
+    }
+
+    bool VideoEncoder::OpenSession(const std::filesystem::path& outputPath, VkExtent2D extent, uint32_t targetFps, bool replay)
     {
         ResetSession();
 
+        m_ReplayMode = replay;
         m_OutputPath = outputPath;
         m_OutputExtent = extent;
         m_TargetFps = (targetFps == 0) ? 30u : targetFps;
+        // Replay packets go into one ring in encode order, so only file sessions are split across encoders.
+        m_ActiveSegmentEncoders = m_ReplayMode ? 1u : m_SegmentEncoderCount;
+        m_SegmentFrames = std::max(m_TargetFps, s_MinSegmentFrames);
 
         if (m_OutputExtent.width == 0 || m_OutputExtent.height == 0)
         {
@@ -38,7 +114,7 @@ namespace Trident
                 return static_cast<char>(std::tolower(c));
             });
 
-        const bool l_UsingFfmpeg = (l_NormalisedExtension == ".mp4" || l_NormalisedExtension == ".mov" || l_NormalisedExtension == ".avi");
+        const bool l_UsingFfmpeg = m_ReplayMode || (l_NormalisedExtension == ".mp4" || l_NormalisedExtension == ".mov" || l_NormalisedExtension == ".avi");
         if (l_UsingFfmpeg)
         {
             const bool l_IsWidthOdd = (m_OutputExtent.width % 2u) != 0u;
@@ -57,6 +133,9 @@ namespace Trident
             }
         }
 
+        // The encoder thread (or the caller, for Y4M) converts one band itself; the helpers split the rest of the frame.
+        m_YuvConverter.Init(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u) - 1);
+
         if (!InitialiseCodec())
         {
             TR_CORE_WARN("Video encoder rejected begin request because codec initialisation failed.");
@@ -78,13 +157,26 @@ namespace Trident
 
         m_SessionActive = true;
         m_SessionStartTime = std::chrono::system_clock::now();
+        {
+            std::scoped_lock l_StatsLock(m_FfmpegQueueMutex);
+            m_RateWindowStart = std::chrono::steady_clock::now();
+        }
         m_TargetFrameDuration = std::chrono::nanoseconds(1'000'000'000ull / static_cast<uint64_t>(m_TargetFps));
-        TR_CORE_INFO("Video encoder session started at {} ({}x{}, {} FPS)", m_OutputPath.string(), m_OutputExtent.width, m_OutputExtent.height, m_TargetFps);
+        if (m_ReplayMode)
+        {
+            TR_CORE_INFO("Video encoder replay buffer started ({}x{}, {} FPS, {} MB budget)", m_OutputExtent.width, m_OutputExtent.height, m_TargetFps,
+                m_ReplayBuffer.GetBudget() / (1024 * 1024));
+        }
+        else
+        {
+            TR_CORE_INFO("Video encoder session started at {} ({}x{}, {} FPS, {} encoder(s))", m_OutputPath.string(), m_OutputExtent.width, m_OutputExtent.height, m_TargetFps,
+                m_ActiveSegmentEncoders);
+        }
 
         return true;
     }
 
-    bool VideoEncoder::SubmitFrame(const RecordedFrame& frame)
+    bool VideoEncoder::SubmitFrame(RecordedFrame frame)
     {
         if (!m_SessionActive)
         {
@@ -94,7 +186,7 @@ namespace Trident
             return false;
         }
 
-        if (frame.m_Pixels.empty())
+        if (frame.GetPixels().empty())
         {
             // Prevent writing frames that do not contain any pixel data.
             TR_CORE_WARN("Video encoder rejected frame {} because the pixel buffer was empty.", frame.m_FrameIndex);
@@ -110,6 +202,13 @@ namespace Trident
             return false;
         }
 
+        if (frame.m_Layout == PixelLayout::Yuv420 && !HasValidYuv420Layout(frame))
+        {
+            TR_CORE_WARN("Video encoder rejected frame {} because its YUV420 planes do not cover the frame.", frame.m_FrameIndex);
+
+            return false;
+        }
+
         if (m_UsingFfmpegContainer)
         {
             // Queue the frame so the worker can handle scaling and encoding.
@@ -120,16 +219,49 @@ namespace Trident
                 return false;
             }
 
+            const size_t l_FrameBytes = frame.GetPixels().size();
+            const int64_t l_CapturePts = CalculateCapturePts(frame.m_Timestamp);
+            std::vector<QueuedFrame> l_EvictedFrames{};
+            bool l_Admitted = false;
+            {
+                std::unique_lock<std::mutex> l_QueueLock(m_FfmpegQueueMutex);
+                if (m_ReplayMode && l_CapturePts < m_NextPts)
+                {
+                    // Replays skip frames that arrive ahead of the target rate instead of stretching the ring's timeline.
+                    return true;
+                }
+
+                const std::chrono::steady_clock::time_point l_Now = std::chrono::steady_clock::now();
+                ++m_SubmittedFrames;
+                UpdateFrameRates(l_Now);
+
+                l_Admitted = AdmitFrame(l_QueueLock, l_FrameBytes, l_EvictedFrames);
+                if (l_Admitted)
+                {
+                    // Stamp the frame by capture time so frames dropped under load leave a gap; pts still has to increase strictly.
+                    const int64_t l_Pts = std::max(m_NextPts, l_CapturePts);
+                    m_NextPts = l_Pts + 1;
+                    m_AdmittedSegment = static_cast<uint64_t>(l_Pts) / m_SegmentFrames;
+
+                    m_FfmpegFrameQueue.push_back({ std::move(frame), l_FrameBytes, l_Now, l_Pts, m_AdmittedSegment });
+                    m_QueuedBytes += l_FrameBytes;
+                }
+            }
+
+            // Evicted frames release their staging or pooled buffers here, outside the queue lock.
+            l_EvictedFrames.clear();
+            if (l_Admitted)
             {
-                std::lock_guard<std::mutex> l_QueueLock(m_FfmpegQueueMutex);
-                m_FfmpegFrameQueue.push(frame);
+                // Segment encoders each wait for frames of their own segment, so all of them have to look.
+                m_FfmpegQueueCondition.notify_all();
             }
-            m_FfmpegQueueCondition.notify_one();
 
+            // A frame dropped by the overflow policy is expected under load; it shows up in the queue stats instead.
             return true;
         }
         else if (m_UsingY4mContainer)
         {
+            const std::chrono::steady_clock::time_point l_EncodeStart = std::chrono::steady_clock::now();
             const bool l_Written = WriteFrameToY4m(frame);
             if (!l_Written)
             {
@@ -139,6 +271,13 @@ namespace Trident
             }
 
             ++m_FrameCounter;
+            {
+                std::scoped_lock l_StatsLock(m_FfmpegQueueMutex);
+                ++m_SubmittedFrames;
+                UpdateFrameRates(l_EncodeStart);
+            }
+            // Y4M frames are written on the caller's thread, so there is no queue wait to add to the latency.
+            RecordEncodedFrame(l_EncodeStart, l_EncodeStart);
 
             return true;
         }
@@ -148,6 +287,40 @@ namespace Trident
         return false;
     }
 
+    void VideoEncoder::SetQueuePolicy(QueueOverflowPolicy policy, size_t budgetBytes)
+    {
+        {
+            std::scoped_lock l_Lock(m_FfmpegQueueMutex);
+            m_QueuePolicy = policy;
+            m_QueueBudgetBytes = budgetBytes;
+            m_FrameRateDivisor = 1;
+            m_FrameRateCounter = 0;
+        }
+        // A blocked submit re-checks against the new budget, or stops waiting if the policy no longer blocks.
+        m_FfmpegSpaceCondition.notify_all();
+    }
+
+    VideoEncoder::QueueStats VideoEncoder::GetQueueStats() const
+    {
+        std::scoped_lock l_Lock(m_FfmpegQueueMutex);
+
+        QueueStats l_Stats{};
+        l_Stats.m_QueuedFrames = m_FfmpegFrameQueue.size();
+        l_Stats.m_QueuedBytes = m_QueuedBytes;
+        l_Stats.m_BudgetBytes = m_QueueBudgetBytes;
+        l_Stats.m_EncodedFrames = m_EncodedFrames;
+        l_Stats.m_DroppedFrames = m_DroppedFrames;
+        l_Stats.m_FrameRateDivisor = m_FrameRateDivisor;
+        l_Stats.m_AverageLatencyMs = m_AverageLatencyMs;
+        l_Stats.m_MaxLatencyMs = m_MaxLatencyMs;
+        l_Stats.m_AverageEncodeMs = m_AverageEncodeMs;
+        l_Stats.m_CaptureFps = m_CaptureFps;
+        l_Stats.m_EncodeFps = m_EncodeFps;
+        l_Stats.m_SegmentEncoders = m_ActiveSegmentEncoders;
+
+        return l_Stats;
+    }
+
     bool VideoEncoder::EndSession()
     {
         if (!m_SessionActive)
@@ -170,13 +343,17 @@ namespace Trident
             m_OutputStream.close();
         }
 
-        if (l_SessionSuccess)
+        if (m_ReplayMode)
         {
-            TR_CORE_INFO("Video encoder finalized output at {} ({} frames)", m_OutputPath.string(), m_FrameCounter);
+            TR_CORE_INFO("Video encoder replay buffer stopped ({} frames encoded)", m_FrameCounter.load());
+        }
+        else if (l_SessionSuccess)
+        {
+            TR_CORE_INFO("Video encoder finalized output at {} ({} frames)", m_OutputPath.string(), m_FrameCounter.load());
         }
         else
         {
-            TR_CORE_WARN("Video encoder session ended with errors at {} ({} frames)", m_OutputPath.string(), m_FrameCounter);
+            TR_CORE_WARN("Video encoder session ended with errors at {} ({} frames)", m_OutputPath.string(), m_FrameCounter.load());
         }
 
         ResetSession();
@@ -186,6 +363,14 @@ namespace Trident
 
     bool VideoEncoder::InitialiseCodec()
     {
+        if (m_ReplayMode)
+        {
+            // Replay packets stay in memory, so only the FFmpeg encoder on the worker thread is needed.
+            m_UsingFfmpegContainer = true;
+
+            return true;
+        }
+
         // Validate extension to guard against writing raw buffers to unsupported containers.
         const std::string l_Extension = m_OutputPath.extension().string();
         std::string l_NormalisedExtension = l_Extension;
@@ -226,16 +411,19 @@ namespace Trident
 
     bool VideoEncoder::InitialiseFfmpegEncoder()
     {
-        // Prepare FFmpeg contexts for writing an H.264 stream to common containers.
-        const std::string l_OutputString = m_OutputPath.string();
+        // Prepare FFmpeg contexts for writing an H.264 stream to common containers, or to the replay ring without one.
+        const std::string l_OutputString = m_ReplayMode ? std::string("the replay buffer") : m_OutputPath.string();
 
-        const int32_t l_FormatResult = avformat_alloc_output_context2(&m_FfmpegFormatContext, nullptr, nullptr, l_OutputString.c_str());
-        if (l_FormatResult < 0 || m_FfmpegFormatContext == nullptr)
+        if (!m_ReplayMode)
         {
-            TR_CORE_WARN("Video encoder could not allocate an FFmpeg format context for {}.", l_OutputString);
+            const int32_t l_FormatResult = avformat_alloc_output_context2(&m_FfmpegFormatContext, nullptr, nullptr, l_OutputString.c_str());
+            if (l_FormatResult < 0 || m_FfmpegFormatContext == nullptr)
+            {
+                TR_CORE_WARN("Video encoder could not allocate an FFmpeg format context for {}.", l_OutputString);
 
-            CleanupFfmpegEncoder();
-            return false;
+                CleanupFfmpegEncoder();
+                return false;
+            }
         }
 
         const AVCodec* l_Codec = avcodec_find_encoder(AV_CODEC_ID_H264);
@@ -247,16 +435,21 @@ namespace Trident
             return false;
         }
 
-        m_FfmpegStream = avformat_new_stream(m_FfmpegFormatContext, l_Codec);
-        if (m_FfmpegStream == nullptr)
+        if (!m_ReplayMode)
         {
-            TR_CORE_WARN("Video encoder could not create an FFmpeg stream for {}.", l_OutputString);
+            m_FfmpegStream = avformat_new_stream(m_FfmpegFormatContext, l_Codec);
+            if (m_FfmpegStream == nullptr)
+            {
+                TR_CORE_WARN("Video encoder could not create an FFmpeg stream for {}.", l_OutputString);
 
-            CleanupFfmpegEncoder();
-            return false;
+                CleanupFfmpegEncoder();
+                return false;
+            }
         }
 
-        m_FfmpegCodecContext = avcodec_alloc_context3(l_Codec);
+        // Replays are saved as MP4, which wants SPS/PPS in the stream extradata rather than in every keyframe.
+        const bool l_GlobalHeader = m_ReplayMode || (m_FfmpegFormatContext->oformat != nullptr && (m_FfmpegFormatContext->oformat->flags & AVFMT_GLOBALHEADER) != 0);
+        m_FfmpegCodecContext = CreateCodecContext(l_Codec, l_GlobalHeader);
         if (m_FfmpegCodecContext == nullptr)
         {
             TR_CORE_WARN("Video encoder could not allocate an FFmpeg codec context for {}.", l_OutputString);
@@ -265,20 +458,7 @@ namespace Trident
             return false;
         }
 
-        m_FfmpegCodecContext->codec_id = AV_CODEC_ID_H264;
-        m_FfmpegCodecContext->width = static_cast<int32_t>(m_OutputExtent.width);
-        m_FfmpegCodecContext->height = static_cast<int32_t>(m_OutputExtent.height);
-        m_FfmpegCodecContext->time_base = { 1, static_cast<int32_t>(m_TargetFps) };
-        m_FfmpegCodecContext->framerate = { static_cast<int32_t>(m_TargetFps), 1 };
-        m_FfmpegCodecContext->bit_rate = 8'000'000;
-        m_FfmpegCodecContext->gop_size = static_cast<int32_t>(m_TargetFps);
-        m_FfmpegCodecContext->pix_fmt = AV_PIX_FMT_YUV420P;
-
-        if (m_FfmpegFormatContext->oformat != nullptr && (m_FfmpegFormatContext->oformat->flags & AVFMT_GLOBALHEADER) != 0)
-        {
-            m_FfmpegCodecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
-        }
-
+        // In segmented sessions this context only supplies the stream header; the segment encoders open their own.
         int32_t l_Result = avcodec_open2(m_FfmpegCodecContext, l_Codec, nullptr);
         if (l_Result < 0)
         {
@@ -288,46 +468,48 @@ namespace Trident
             return false;
         }
 
-        l_Result = avcodec_parameters_from_context(m_FfmpegStream->codecpar, m_FfmpegCodecContext);
-        if (l_Result < 0)
+        if (m_ReplayMode)
         {
-            TR_CORE_WARN("Video encoder could not copy codec parameters for {} (error {}).", l_OutputString, l_Result);
-
-            CleanupFfmpegEncoder();
-            return false;
+            // Starting a replay session discards the previous ring; a save already in flight keeps its own references.
+            if (!m_ReplayBuffer.Reset(m_FfmpegCodecContext))
+            {
+                CleanupFfmpegEncoder();
+                return false;
+            }
         }
-
-        m_FfmpegStream->time_base = m_FfmpegCodecContext->time_base;
-
-        if (!(m_FfmpegFormatContext->oformat->flags & AVFMT_NOFILE))
+        else
         {
-            l_Result = avio_open(&m_FfmpegFormatContext->pb, l_OutputString.c_str(), AVIO_FLAG_WRITE);
+            l_Result = avcodec_parameters_from_context(m_FfmpegStream->codecpar, m_FfmpegCodecContext);
             if (l_Result < 0)
             {
-                TR_CORE_WARN("Video encoder could not open {} for writing (error {}).", l_OutputString, l_Result);
+                TR_CORE_WARN("Video encoder could not copy codec parameters for {} (error {}).", l_OutputString, l_Result);
 
                 CleanupFfmpegEncoder();
                 return false;
             }
-        }
 
-        l_Result = avformat_write_header(m_FfmpegFormatContext, nullptr);
-        if (l_Result < 0)
-        {
-            TR_CORE_WARN("Video encoder could not write the FFmpeg header for {} (error {}).", l_OutputString, l_Result);
+            m_FfmpegStream->time_base = m_FfmpegCodecContext->time_base;
 
-            CleanupFfmpegEncoder();
-            return false;
-        }
+            if (!(m_FfmpegFormatContext->oformat->flags & AVFMT_NOFILE))
+            {
+                l_Result = avio_open(&m_FfmpegFormatContext->pb, l_OutputString.c_str(), AVIO_FLAG_WRITE);
+                if (l_Result < 0)
+                {
+                    TR_CORE_WARN("Video encoder could not open {} for writing (error {}).", l_OutputString, l_Result);
 
-        m_FfmpegSwsContext = sws_getContext(static_cast<int32_t>(m_OutputExtent.width), static_cast<int32_t>(m_OutputExtent.height), AV_PIX_FMT_RGBA,
-            static_cast<int32_t>(m_OutputExtent.width), static_cast<int32_t>(m_OutputExtent.height), m_FfmpegCodecContext->pix_fmt, SWS_BILINEAR, nullptr, nullptr, nullptr);
-        if (m_FfmpegSwsContext == nullptr)
-        {
-            TR_CORE_WARN("Video encoder could not create a scaling context for {}.", l_OutputString);
+                    CleanupFfmpegEncoder();
+                    return false;
+                }
+            }
 
-            CleanupFfmpegEncoder();
-            return false;
+            l_Result = avformat_write_header(m_FfmpegFormatContext, nullptr);
+            if (l_Result < 0)
+            {
+                TR_CORE_WARN("Video encoder could not write the FFmpeg header for {} (error {}).", l_OutputString, l_Result);
+
+                CleanupFfmpegEncoder();
+                return false;
+            }
         }
 
         m_FfmpegFrame = av_frame_alloc();
@@ -362,17 +544,69 @@ namespace Trident
 
         m_UsingFfmpegContainer = true;
 
-        TR_CORE_INFO("Video encoder configured FFmpeg H.264 output at {}x{} ({} FPS) to {}.", m_OutputExtent.width, m_OutputExtent.height, m_TargetFps, l_OutputString);
+        TR_CORE_INFO("Video encoder configured FFmpeg H.264 output at {}x{} ({} FPS, {} codec threads) to {}.", m_OutputExtent.width, m_OutputExtent.height, m_TargetFps,
+            m_FfmpegCodecContext->thread_count, l_OutputString);
 
         return true;
     }
 
+    AVCodecContext* VideoEncoder::CreateCodecContext(const AVCodec* codec, bool globalHeader) const
+    {
+        AVCodecContext* l_Context = avcodec_alloc_context3(codec);
+        if (l_Context == nullptr)
+        {
+            return nullptr;
+        }
+
+        l_Context->codec_id = AV_CODEC_ID_H264;
+        l_Context->width = static_cast<int32_t>(m_OutputExtent.width);
+        l_Context->height = static_cast<int32_t>(m_OutputExtent.height);
+        l_Context->time_base = { 1, static_cast<int32_t>(m_TargetFps) };
+        l_Context->framerate = { static_cast<int32_t>(m_TargetFps), 1 };
+        l_Context->bit_rate = 8'000'000;
+        l_Context->gop_size = static_cast<int32_t>(m_TargetFps);
+        l_Context->pix_fmt = AV_PIX_FMT_YUV420P;
+        // Frames arrive as limited-range BT.601 from the GPU pre-process or the CPU converter; tag the stream to match.
+        l_Context->color_range = AVCOL_RANGE_MPEG;
+        l_Context->colorspace = AVCOL_SPC_SMPTE170M;
+
+        if (globalHeader)
+        {
+            l_Context->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+        }
+
+        // Let the codec spread each frame over its own threads where it can; segment encoders split the cores between them.
+        int32_t l_ThreadType = 0;
+        if ((codec->capabilities & (AV_CODEC_CAP_FRAME_THREADS | AV_CODEC_CAP_OTHER_THREADS)) != 0)
+        {
+            l_ThreadType |= FF_THREAD_FRAME;
+        }
+        if ((codec->capabilities & (AV_CODEC_CAP_SLICE_THREADS | AV_CODEC_CAP_OTHER_THREADS)) != 0)
+        {
+            l_ThreadType |= FF_THREAD_SLICE;
+        }
+        if (l_ThreadType != 0)
+        {
+            l_Context->thread_type = l_ThreadType;
+            l_Context->thread_count = (m_ActiveSegmentEncoders > 1)
+                ? static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency() / m_ActiveSegmentEncoders)) : 0;
+        }
+
+        if (m_ActiveSegmentEncoders > 1)
+        {
+            // Without reordering, decode timestamps equal pts, so segments from different encoders concatenate with monotonic dts.
+            l_Context->max_b_frames = 0;
+        }
+
+        return l_Context;
+    }
+
     bool VideoEncoder::WriteY4mHeader()
     {
         // Provide a simple container header so the output is playable by standard Y4M readers.
         const uint64_t l_FpsNumerator = static_cast<uint64_t>(m_TargetFps);
         const uint64_t l_FpsDenominator = 1;
-        m_OutputStream << "YUV4MPEG2 W" << m_OutputExtent.width << " H" << m_OutputExtent.height << " F" << l_FpsNumerator << ":" << l_FpsDenominator << " Ip A0:0 C444" << '\n';
+        m_OutputStream << "YUV4MPEG2 W" << m_OutputExtent.width << " H" << m_OutputExtent.height << " F" << l_FpsNumerator << ":" << l_FpsDenominator << " Ip A0:0 C420jpeg" << '\n';
 
         if (!m_OutputStream.good())
         {
@@ -392,12 +626,50 @@ namespace Trident
             return false;
         }
 
-        // Convert RGBA data to YUV444 planar layout so that each frame is playable.
-        std::vector<uint8_t> l_YuvBuffer;
-        l_YuvBuffer.resize(static_cast<size_t>(frame.m_Extent.width) * static_cast<size_t>(frame.m_Extent.height) * 3ull);
-        ConvertRgbaToYuv444(frame.m_Pixels, frame.m_Extent, l_YuvBuffer);
+        const uint32_t l_Width = frame.m_Extent.width;
+        const uint32_t l_Height = frame.m_Extent.height;
+        const uint32_t l_ChromaWidth = (l_Width + 1) / 2;
+        const uint32_t l_ChromaHeight = (l_Height + 1) / 2;
 
-        m_OutputStream.write(reinterpret_cast<const char*>(l_YuvBuffer.data()), static_cast<std::streamsize>(l_YuvBuffer.size()));
+        if (frame.m_Layout == PixelLayout::Yuv420)
+        {
+            // Planes arrive converted; Y4M wants them tightly packed, so only the row padding is dropped.
+            const uint8_t* l_Luma = frame.GetPixels().data();
+            const uint8_t* l_U = l_Luma + static_cast<size_t>(frame.m_LumaStride) * l_Height;
+            const uint8_t* l_V = l_U + static_cast<size_t>(frame.m_ChromaStride) * l_ChromaHeight;
+            for (uint32_t it_Row = 0; it_Row < l_Height; ++it_Row)
+            {
+                m_OutputStream.write(reinterpret_cast<const char*>(l_Luma + static_cast<size_t>(it_Row) * frame.m_LumaStride), l_Width);
+            }
+            for (const uint8_t* it_Plane : { l_U, l_V })
+            {
+                for (uint32_t it_Row = 0; it_Row < l_ChromaHeight; ++it_Row)
+                {
+                    m_OutputStream.write(reinterpret_cast<const char*>(it_Plane + static_cast<size_t>(it_Row) * frame.m_ChromaStride), l_ChromaWidth);
+                }
+            }
+        }
+        else
+        {
+            // Convert RGBA data to tightly packed full-range I420 in the reused scratch planes so that each frame is playable.
+            m_Y4mPlanes.resize(static_cast<size_t>(l_Width) * l_Height + 2ull * l_ChromaWidth * l_ChromaHeight);
+
+            YuvConversionDesc l_Conversion{};
+            l_Conversion.m_Source = frame.GetPixels().data();
+            l_Conversion.m_Width = l_Width;
+            l_Conversion.m_Height = l_Height;
+            l_Conversion.m_FullRange = true;
+            l_Conversion.m_ChromaLayout = YuvChromaLayout::I420;
+            l_Conversion.m_Planes[0] = m_Y4mPlanes.data();
+            l_Conversion.m_Planes[1] = l_Conversion.m_Planes[0] + static_cast<size_t>(l_Width) * l_Height;
+            l_Conversion.m_Planes[2] = l_Conversion.m_Planes[1] + static_cast<size_t>(l_ChromaWidth) * l_ChromaHeight;
+            l_Conversion.m_Strides[0] = l_Width;
+            l_Conversion.m_Strides[1] = l_ChromaWidth;
+            l_Conversion.m_Strides[2] = l_ChromaWidth;
+            m_YuvConverter.Convert(l_Conversion);
+
+            m_OutputStream.write(reinterpret_cast<const char*>(m_Y4mPlanes.data()), static_cast<std::streamsize>(m_Y4mPlanes.size()));
+        }
 
         // Track timing to ensure frames are emitted with a consistent cadence.
         const std::chrono::system_clock::time_point l_CaptureTime = (frame.m_Timestamp.time_since_epoch().count() == 0) ? std::chrono::system_clock::now() : frame.m_Timestamp;
@@ -411,14 +683,14 @@ namespace Trident
         return m_OutputStream.good();
     }
 
-    bool VideoEncoder::WriteFrameToFfmpeg(const RecordedFrame& frame)
+    bool VideoEncoder::WriteFrameToFfmpeg(const RecordedFrame& frame, int64_t pts)
     {
-        if (m_FfmpegCodecContext == nullptr || m_FfmpegFrame == nullptr || m_FfmpegPacket == nullptr || m_FfmpegSwsContext == nullptr)
+        if (m_FfmpegCodecContext == nullptr || m_FfmpegFrame == nullptr || m_FfmpegPacket == nullptr)
         {
             return false;
         }
 
-        // Ensure the frame buffer can be updated before scaling RGBA data into YUV420P.
+        // Ensure the frame buffer can be updated before converting RGBA data into YUV420P.
         int32_t l_Result = av_frame_make_writable(m_FfmpegFrame);
         if (l_Result < 0)
         {
@@ -427,15 +699,8 @@ namespace Trident
             return false;
         }
 
-        uint8_t* l_Data[4] = {};
-        int32_t l_Linesize[4] = {};
-        l_Data[0] = const_cast<uint8_t*>(frame.m_Pixels.data());
-        l_Linesize[0] = static_cast<int32_t>(m_OutputExtent.width * 4u);
-
-        sws_scale(m_FfmpegSwsContext, l_Data, l_Linesize, 0, static_cast<int32_t>(m_OutputExtent.height), m_FfmpegFrame->data, m_FfmpegFrame->linesize);
-
-        const uint64_t l_FrameNumber = m_FrameCounter;
-        m_FfmpegFrame->pts = static_cast<int64_t>(l_FrameNumber);
+        FillCodecFrame(frame, m_FfmpegFrame, true);
+        m_FfmpegFrame->pts = pts;
 
         l_Result = avcodec_send_frame(m_FfmpegCodecContext, m_FfmpegFrame);
         if (l_Result < 0)
@@ -459,11 +724,7 @@ namespace Trident
                 return false;
             }
 
-            m_FfmpegPacket->stream_index = m_FfmpegStream->index;
-            av_packet_rescale_ts(m_FfmpegPacket, m_FfmpegCodecContext->time_base, m_FfmpegStream->time_base);
-
-            l_Result = av_write_frame(m_FfmpegFormatContext, m_FfmpegPacket);
-            av_packet_unref(m_FfmpegPacket);
+            l_Result = WriteEncodedPacket(m_FfmpegPacket);
             if (l_Result < 0)
             {
                 TR_CORE_WARN("Video encoder could not write packet for frame {} (error {}).", frame.m_FrameIndex, l_Result);
@@ -477,17 +738,107 @@ namespace Trident
         return true;
     }
 
-    bool VideoEncoder::StartFfmpegWorker()
+    void VideoEncoder::FillCodecFrame(const RecordedFrame& frame, AVFrame* codecFrame, bool useConverterBands)
     {
-        // Ensure any previous worker is stopped before starting a new one.
-        StopFfmpegWorker();
+        if (frame.m_Layout == PixelLayout::Yuv420)
+        {
+            // The GPU already produced the codec's YUV420P planes, so rows are copied instead of scaled.
+            const uint32_t l_ChromaWidth = (m_OutputExtent.width + 1) / 2;
+            const uint32_t l_ChromaHeight = (m_OutputExtent.height + 1) / 2;
+            const uint8_t* l_Planes[3] = {};
+            l_Planes[0] = frame.GetPixels().data();
+            l_Planes[1] = l_Planes[0] + static_cast<size_t>(frame.m_LumaStride) * m_OutputExtent.height;
+            l_Planes[2] = l_Planes[1] + static_cast<size_t>(frame.m_ChromaStride) * l_ChromaHeight;
+            const uint32_t l_SourceStrides[3] = { frame.m_LumaStride, frame.m_ChromaStride, frame.m_ChromaStride };
+            const uint32_t l_RowBytes[3] = { m_OutputExtent.width, l_ChromaWidth, l_ChromaWidth };
+            const uint32_t l_RowCounts[3] = { m_OutputExtent.height, l_ChromaHeight, l_ChromaHeight };
+
+            for (uint32_t it_Plane = 0; it_Plane < 3; ++it_Plane)
+            {
+                for (uint32_t it_Row = 0; it_Row < l_RowCounts[it_Plane]; ++it_Row)
+                {
+                    std::memcpy(codecFrame->data[it_Plane] + static_cast<size_t>(it_Row) * codecFrame->linesize[it_Plane],
+                        l_Planes[it_Plane] + static_cast<size_t>(it_Row) * l_SourceStrides[it_Plane], l_RowBytes[it_Plane]);
+                }
+            }
+        }
+        else
+        {
+            // RGBA frames are converted straight into the codec's planes, split into row bands across the converter threads.
+            // Segment encoders already run in parallel, so each converts its own frames on its own thread.
+            YuvConversionDesc l_Conversion{};
+            l_Conversion.m_Source = frame.GetPixels().data();
+            l_Conversion.m_Width = m_OutputExtent.width;
+            l_Conversion.m_Height = m_OutputExtent.height;
+            l_Conversion.m_FullRange = false;
+            l_Conversion.m_ChromaLayout = YuvChromaLayout::I420;
+            for (uint32_t it_Plane = 0; it_Plane < 3; ++it_Plane)
+            {
+                l_Conversion.m_Planes[it_Plane] = codecFrame->data[it_Plane];
+                l_Conversion.m_Strides[it_Plane] = static_cast<uint32_t>(codecFrame->linesize[it_Plane]);
+            }
 
+            if (useConverterBands)
+            {
+                m_YuvConverter.Convert(l_Conversion);
+            }
+            else
+            {
+                YuvConverter::ConvertRows(l_Conversion, 0, m_OutputExtent.height);
+            }
+        }
+    }
+
+    int32_t VideoEncoder::WriteEncodedPacket(AVPacket* packet)
+    {
+        if (m_ReplayMode)
         {
-            std::lock_guard<std::mutex> l_QueueLock(m_FfmpegQueueMutex);
-            std::queue<RecordedFrame> l_EmptyQueue{};
-            std::swap(m_FfmpegFrameQueue, l_EmptyQueue);
+            // Timestamps stay in the codec time base; the replay buffer rescales them when a save is muxed.
+            m_ReplayBuffer.PushPacket(packet);
+
+            return 0;
         }
 
+        packet->stream_index = m_FfmpegStream->index;
+        av_packet_rescale_ts(packet, m_FfmpegCodecContext->time_base, m_FfmpegStream->time_base);
+
+        const int32_t l_Result = av_write_frame(m_FfmpegFormatContext, packet);
+        av_packet_unref(packet);
+
+        return l_Result;
+    }
+
+    int64_t VideoEncoder::CalculateCapturePts(std::chrono::system_clock::time_point timestamp) const
+    {
+        const std::chrono::system_clock::time_point l_CaptureTime = (timestamp.time_since_epoch().count() == 0) ? std::chrono::system_clock::now() : timestamp;
+        const double l_ElapsedSeconds = std::chrono::duration<double>(l_CaptureTime - m_SessionStartTime).count();
+
+        return static_cast<int64_t>(std::llround(l_ElapsedSeconds * static_cast<double>(m_TargetFps)));
+    }
+
+    void VideoEncoder::UpdateFrameRates(std::chrono::steady_clock::time_point now)
+    {
+        // Caller holds m_FfmpegQueueMutex.
+        const std::chrono::steady_clock::duration l_Elapsed = now - m_RateWindowStart;
+        if (l_Elapsed < s_FrameRateWindow)
+        {
+            return;
+        }
+
+        const double l_Seconds = std::chrono::duration<double>(l_Elapsed).count();
+        m_CaptureFps = static_cast<double>(m_SubmittedFrames - m_RateWindowSubmitted) / l_Seconds;
+        m_EncodeFps = static_cast<double>(m_EncodedFrames - m_RateWindowEncoded) / l_Seconds;
+        m_RateWindowStart = now;
+        m_RateWindowSubmitted = m_SubmittedFrames;
+        m_RateWindowEncoded = m_EncodedFrames;
+    }
+
+    bool VideoEncoder::StartFfmpegWorker()
+    {
+        // Ensure any previous worker is stopped before starting a new one.
+        StopFfmpegWorker();
+        ClearFrameQueue();
+
         m_FfmpegWorkerShouldStop = false;
         m_FfmpegWorkerReady = false;
         m_FfmpegWorkerInitialised = false;
@@ -528,6 +879,7 @@ namespace Trident
             m_FfmpegWorkerShouldStop = true;
         }
         m_FfmpegQueueCondition.notify_all();
+        m_FfmpegSpaceCondition.notify_all();
 
         if (m_FfmpegWorkerThread.joinable())
         {
@@ -538,9 +890,99 @@ namespace Trident
         m_FfmpegWorkerShouldStop = false;
 
         // Clear any queued frames to ensure the next session starts cleanly.
-        std::lock_guard<std::mutex> l_QueueLock(m_FfmpegQueueMutex);
-        std::queue<RecordedFrame> l_EmptyQueue{};
-        std::swap(m_FfmpegFrameQueue, l_EmptyQueue);
+        ClearFrameQueue();
+    }
+
+    bool VideoEncoder::AdmitFrame(std::unique_lock<std::mutex>& queueLock, size_t frameBytes, std::vector<QueuedFrame>& evictedFrames)
+    {
+        // An empty queue always takes the frame, so a budget below one frame degrades to a single frame in flight.
+        const auto a_Fits = [this, frameBytes]()
+            {
+                return m_FfmpegFrameQueue.empty() || m_QueuedBytes + frameBytes <= m_QueueBudgetBytes;
+            };
+
+        switch (m_QueuePolicy)
+        {
+        case QueueOverflowPolicy::Block:
+            m_FfmpegSpaceCondition.wait(queueLock, [this, &a_Fits]()
+                {
+                    return m_FfmpegWorkerShouldStop || m_QueuePolicy != QueueOverflowPolicy::Block || a_Fits();
+                });
+            if (a_Fits())
+            {
+                return true;
+            }
+            break;
+        case QueueOverflowPolicy::DropOldest:
+            while (!a_Fits())
+            {
+                m_QueuedBytes -= m_FfmpegFrameQueue.front().m_Bytes;
+                evictedFrames.push_back(std::move(m_FfmpegFrameQueue.front()));
+                m_FfmpegFrameQueue.pop_front();
+                ++m_DroppedFrames;
+            }
+            return true;
+        case QueueOverflowPolicy::DropNewest:
+            if (a_Fits())
+            {
+                return true;
+            }
+            break;
+        case QueueOverflowPolicy::LowerFrameRate:
+            if ((m_FrameRateCounter++ % m_FrameRateDivisor) != 0)
+            {
+                break;
+            }
+
+            if (!a_Fits())
+            {
+                m_FrameRateDivisor = std::min(m_FrameRateDivisor * 2, s_MaxFrameRateDivisor);
+                break;
+            }
+
+            // Step back towards the full rate only once the encoder has clearly caught up.
+            if (m_FrameRateDivisor > 1 && m_QueuedBytes <= m_QueueBudgetBytes / 4)
+            {
+                m_FrameRateDivisor /= 2;
+            }
+            return true;
+        }
+
+        ++m_DroppedFrames;
+
+        return false;
+    }
+
+    void VideoEncoder::ClearFrameQueue()
+    {
+        std::deque<QueuedFrame> l_EmptyQueue{};
+        {
+            std::lock_guard<std::mutex> l_QueueLock(m_FfmpegQueueMutex);
+            std::swap(m_FfmpegFrameQueue, l_EmptyQueue);
+            m_QueuedBytes = 0;
+        }
+        m_FfmpegSpaceCondition.notify_all();
+    }
+
+    void VideoEncoder::RecordEncodedFrame(std::chrono::steady_clock::time_point submitTime, std::chrono::steady_clock::time_point encodeStart)
+    {
+        const std::chrono::steady_clock::time_point l_Now = std::chrono::steady_clock::now();
+        const double l_LatencyMs = std::chrono::duration<double, std::milli>(l_Now - submitTime).count();
+        const double l_EncodeMs = std::chrono::duration<double, std::milli>(l_Now - encodeStart).count();
+
+        std::scoped_lock l_Lock(m_FfmpegQueueMutex);
+        if (m_EncodedFrames == 0)
+        {
+            m_AverageLatencyMs = l_LatencyMs;
+            m_AverageEncodeMs = l_EncodeMs;
+        }
+        else
+        {
+            m_AverageLatencyMs += (l_LatencyMs - m_AverageLatencyMs) * s_StatsSmoothing;
+            m_AverageEncodeMs += (l_EncodeMs - m_AverageEncodeMs) * s_StatsSmoothing;
+        }
+        m_MaxLatencyMs = std::max(m_MaxLatencyMs, l_LatencyMs);
+        ++m_EncodedFrames;
     }
 
     void VideoEncoder::FfmpegWorkerLoop()
@@ -559,9 +1001,28 @@ namespace Trident
             return;
         }
 
-        while (true)
+        const bool l_Segmented = m_ActiveSegmentEncoders > 1;
+        if (l_Segmented)
+        {
+            std::vector<std::thread> l_SegmentWorkers;
+            l_SegmentWorkers.reserve(m_ActiveSegmentEncoders);
+            for (uint32_t it_Encoder = 0; it_Encoder < m_ActiveSegmentEncoders; ++it_Encoder)
+            {
+                l_SegmentWorkers.emplace_back(&VideoEncoder::SegmentWorkerLoop, this, it_Encoder);
+            }
+
+            for (std::thread& it_Worker : l_SegmentWorkers)
+            {
+                it_Worker.join();
+            }
+
+            // Every segment has been handed in by now; write whatever is still parked behind a failed or empty one.
+            CompleteSegment(0, {}, true);
+        }
+
+        while (!l_Segmented)
         {
-            RecordedFrame l_PendingFrame{};
+            QueuedFrame l_PendingFrame{};
 
             {
                 std::unique_lock<std::mutex> l_Lock(m_FfmpegQueueMutex);
@@ -576,10 +1037,17 @@ namespace Trident
                 }
 
                 l_PendingFrame = std::move(m_FfmpegFrameQueue.front());
-                m_FfmpegFrameQueue.pop();
+                m_FfmpegFrameQueue.pop_front();
+                m_QueuedBytes -= l_PendingFrame.m_Bytes;
             }
+            m_FfmpegSpaceCondition.notify_one();
 
-            if (!WriteFrameToFfmpeg(l_PendingFrame))
+            const std::chrono::steady_clock::time_point l_EncodeStart = std::chrono::steady_clock::now();
+            if (WriteFrameToFfmpeg(l_PendingFrame.m_Frame, l_PendingFrame.m_Pts))
+            {
+                RecordEncodedFrame(l_PendingFrame.m_SubmitTime, l_EncodeStart);
+            }
+            else
             {
                 m_FfmpegWorkerSessionSuccess = false;
             }
@@ -589,8 +1057,9 @@ namespace Trident
         // Flush any buffered frames before writing the trailer so the container closes cleanly.
         if (m_FfmpegCodecContext != nullptr && m_FfmpegPacket != nullptr)
         {
-            const int32_t l_SendResult = avcodec_send_frame(m_FfmpegCodecContext, nullptr);
-            if (l_SendResult >= 0)
+            // Segment encoders flush their own codecs; the session context never saw a frame.
+            const int32_t l_SendResult = l_Segmented ? 0 : avcodec_send_frame(m_FfmpegCodecContext, nullptr);
+            if (l_SendResult >= 0 && !l_Segmented)
             {
                 while (true)
                 {
@@ -608,18 +1077,15 @@ namespace Trident
                         break;
                     }
 
-                    m_FfmpegPacket->stream_index = m_FfmpegStream->index;
-                    av_packet_rescale_ts(m_FfmpegPacket, m_FfmpegCodecContext->time_base, m_FfmpegStream->time_base);
-                    av_write_frame(m_FfmpegFormatContext, m_FfmpegPacket);
-                    av_packet_unref(m_FfmpegPacket);
+                    WriteEncodedPacket(m_FfmpegPacket);
                 }
             }
-            else
+            else if (l_SendResult < 0)
             {
                 l_FlushSuccess = false;
             }
 
-            const int32_t l_TrailerResult = av_write_trailer(m_FfmpegFormatContext);
+            const int32_t l_TrailerResult = (m_FfmpegFormatContext != nullptr) ? av_write_trailer(m_FfmpegFormatContext) : 0;
             if (l_TrailerResult < 0)
             {
                 TR_CORE_ERROR("Video encoder failed to finalize FFmpeg output at {} (error {}).", m_OutputPath.string(), l_TrailerResult);
@@ -633,6 +1099,198 @@ namespace Trident
         CleanupFfmpegEncoder();
     }
 
+    void VideoEncoder::SegmentWorkerLoop(uint32_t encoderIndex)
+    {
+        // Each segment encoder owns every N-th segment and opens a fresh codec per segment, so each one starts on an IDR
+        // frame and its packets can be written after the previous segment's without touching the bitstream.
+        const AVCodec* l_Codec = avcodec_find_encoder(AV_CODEC_ID_H264);
+        const bool l_GlobalHeader = (m_FfmpegCodecContext->flags & AV_CODEC_FLAG_GLOBAL_HEADER) != 0;
+
+        AVFrame* l_Frame = av_frame_alloc();
+        AVPacket* l_Packet = av_packet_alloc();
+        bool l_Ready = l_Codec != nullptr && l_Frame != nullptr && l_Packet != nullptr;
+        if (l_Ready)
+        {
+            l_Frame->format = AV_PIX_FMT_YUV420P;
+            l_Frame->width = static_cast<int32_t>(m_OutputExtent.width);
+            l_Frame->height = static_cast<int32_t>(m_OutputExtent.height);
+            l_Ready = av_frame_get_buffer(l_Frame, 32) >= 0;
+        }
+
+        if (!l_Ready)
+        {
+            // Keep draining this encoder's segments so the queue and the ordered writer never wait on it.
+            TR_CORE_WARN("Video encoder segment worker {} could not allocate its frame buffers.", encoderIndex);
+
+            m_FfmpegWorkerSessionSuccess = false;
+        }
+
+        uint64_t l_Segment = encoderIndex;
+        while (true)
+        {
+            AVCodecContext* l_Context = nullptr;
+            bool l_SegmentFailed = !l_Ready;
+            std::vector<AVPacket*> l_SegmentPackets;
+
+            while (true)
+            {
+                QueuedFrame l_PendingFrame{};
+                {
+                    std::unique_lock<std::mutex> l_Lock(m_FfmpegQueueMutex);
+                    auto a_FindFrame = [this, l_Segment]()
+                        {
+                            return std::find_if(m_FfmpegFrameQueue.begin(), m_FfmpegFrameQueue.end(), [l_Segment](const QueuedFrame& queuedFrame)
+                                {
+                                    return queuedFrame.m_Segment == l_Segment;
+                                });
+                        };
+
+                    // The segment is closed once a later one has been admitted or the session stops with nothing left for it.
+                    m_FfmpegQueueCondition.wait(l_Lock, [this, l_Segment, &a_FindFrame]()
+                        {
+                            return m_FfmpegWorkerShouldStop || m_AdmittedSegment > l_Segment || a_FindFrame() != m_FfmpegFrameQueue.end();
+                        });
+
+                    const auto a_Found = a_FindFrame();
+                    if (a_Found == m_FfmpegFrameQueue.end())
+                    {
+                        break;
+                    }
+
+                    l_PendingFrame = std::move(*a_Found);
+                    m_FfmpegFrameQueue.erase(a_Found);
+                    m_QueuedBytes -= l_PendingFrame.m_Bytes;
+                }
+                m_FfmpegSpaceCondition.notify_one();
+
+                if (l_SegmentFailed)
+                {
+                    continue;
+                }
+
+                const std::chrono::steady_clock::time_point l_EncodeStart = std::chrono::steady_clock::now();
+                if (l_Context == nullptr)
+                {
+                    l_Context = CreateCodecContext(l_Codec, l_GlobalHeader);
+                    if (l_Context == nullptr || avcodec_open2(l_Context, l_Codec, nullptr) < 0)
+                    {
+                        TR_CORE_WARN("Video encoder could not open the H.264 encoder for segment {}.", l_Segment);
+
+                        l_SegmentFailed = true;
+                        m_FfmpegWorkerSessionSuccess = false;
+                        continue;
+                    }
+                }
+
+                if (av_frame_make_writable(l_Frame) < 0)
+                {
+                    l_SegmentFailed = true;
+                    m_FfmpegWorkerSessionSuccess = false;
+                    continue;
+                }
+
+                FillCodecFrame(l_PendingFrame.m_Frame, l_Frame, false);
+                l_Frame->pts = l_PendingFrame.m_Pts;
+                if (!EncodeSegmentFrame(l_Context, l_Frame, l_Packet, l_SegmentPackets))
+                {
+                    TR_CORE_WARN("Video encoder could not encode frame {} in segment {}.", l_PendingFrame.m_Frame.m_FrameIndex, l_Segment);
+
+                    l_SegmentFailed = true;
+                    m_FfmpegWorkerSessionSuccess = false;
+                    continue;
+                }
+
+                ++m_FrameCounter;
+                RecordEncodedFrame(l_PendingFrame.m_SubmitTime, l_EncodeStart);
+            }
+
+            if (l_Context != nullptr)
+            {
+                if (!l_SegmentFailed && !EncodeSegmentFrame(l_Context, nullptr, l_Packet, l_SegmentPackets))
+                {
+                    TR_CORE_WARN("Video encoder failed to flush segment {}.", l_Segment);
+
+                    m_FfmpegWorkerSessionSuccess = false;
+                }
+                avcodec_free_context(&l_Context);
+            }
+
+            // Empty and failed segments are still handed in so the writer can move past them.
+            CompleteSegment(l_Segment, std::move(l_SegmentPackets), false);
+
+            l_Segment += m_ActiveSegmentEncoders;
+            {
+                std::scoped_lock l_Lock(m_FfmpegQueueMutex);
+                if (m_FfmpegWorkerShouldStop && l_Segment > m_AdmittedSegment)
+                {
+                    break;
+                }
+            }
+        }
+
+        av_packet_free(&l_Packet);
+        av_frame_free(&l_Frame);
+    }
+
+    bool VideoEncoder::EncodeSegmentFrame(AVCodecContext* codecContext, const AVFrame* codecFrame, AVPacket* packet, std::vector<AVPacket*>& segmentPackets)
+    {
+        // A null frame drains the codec at the end of the segment.
+        int32_t l_Result = avcodec_send_frame(codecContext, codecFrame);
+        while (l_Result >= 0)
+        {
+            l_Result = avcodec_receive_packet(codecContext, packet);
+            if (l_Result == AVERROR(EAGAIN) || l_Result == AVERROR_EOF)
+            {
+                return true;
+            }
+            else if (l_Result < 0)
+            {
+                break;
+            }
+
+            AVPacket* l_Packet = av_packet_alloc();
+            if (l_Packet == nullptr)
+            {
+                av_packet_unref(packet);
+
+                return false;
+            }
+
+            av_packet_move_ref(l_Packet, packet);
+            segmentPackets.push_back(l_Packet);
+        }
+
+        return false;
+    }
+
+    void VideoEncoder::CompleteSegment(uint64_t segment, std::vector<AVPacket*> packets, bool writeAll)
+    {
+        std::scoped_lock l_Lock(m_SegmentMuxMutex);
+        if (!packets.empty() || !writeAll)
+        {
+            m_CompletedSegments.emplace(segment, std::move(packets));
+        }
+
+        // Segments finish out of order across encoders; write every one whose predecessors are already in the file.
+        while (!m_CompletedSegments.empty() && (writeAll || m_CompletedSegments.begin()->first == m_NextSegmentToWrite))
+        {
+            auto a_Next = m_CompletedSegments.begin();
+            for (AVPacket*& it_Packet : a_Next->second)
+            {
+                if (m_FfmpegWorkerSessionSuccess && WriteEncodedPacket(it_Packet) < 0)
+                {
+                    TR_CORE_WARN("Video encoder could not write a packet of segment {} to {}.", a_Next->first, m_OutputPath.string());
+
+                    m_FfmpegWorkerSessionSuccess = false;
+                }
+                av_packet_free(&it_Packet);
+            }
+
+            m_NextSegmentToWrite = a_Next->first + 1;
+            m_CompletedSegments.erase(a_Next);
+        }
+    }
+
     void VideoEncoder::ResetSession()
     {
         StopFfmpegWorker();
@@ -643,6 +1301,10 @@ namespace Trident
         }
 
         CleanupFfmpegEncoder();
+        m_YuvConverter.Shutdown();
+        m_Y4mPlanes.clear();
+        m_Y4mPlanes.shrink_to_fit();
+        m_PixelBufferPool->Clear();
 
         m_SessionActive = false;
         m_OutputPath.clear();
@@ -650,12 +1312,46 @@ namespace Trident
         m_TargetFps = 30;
         m_UsingY4mContainer = false;
         m_UsingFfmpegContainer = false;
+        m_ReplayMode = false;
         m_SessionStartTime = {};
         m_TargetFrameDuration = {};
         m_FrameCounter = 0;
+        m_NextPts = 0;
         m_FfmpegWorkerInitialised = false;
         m_FfmpegWorkerReady = false;
         m_FfmpegWorkerSessionSuccess = true;
+
+        {
+            // Only left behind if a worker bailed out mid-session; the ordered writer normally drains these.
+            std::scoped_lock l_MuxLock(m_SegmentMuxMutex);
+            for (auto& it_Segment : m_CompletedSegments)
+            {
+                for (AVPacket*& it_Packet : it_Segment.second)
+                {
+                    av_packet_free(&it_Packet);
+                }
+            }
+            m_CompletedSegments.clear();
+            m_NextSegmentToWrite = 0;
+        }
+
+        // The policy and budget carry over to the next session; its telemetry starts fresh.
+        std::scoped_lock l_StatsLock(m_FfmpegQueueMutex);
+        m_FrameRateDivisor = 1;
+        m_FrameRateCounter = 0;
+        m_EncodedFrames = 0;
+        m_DroppedFrames = 0;
+        m_AverageLatencyMs = 0.0;
+        m_MaxLatencyMs = 0.0;
+        m_AverageEncodeMs = 0.0;
+        m_RateWindowStart = {};
+        m_SubmittedFrames = 0;
+        m_RateWindowSubmitted = 0;
+        m_RateWindowEncoded = 0;
+        m_CaptureFps = 0.0;
+        m_EncodeFps = 0.0;
+        m_ActiveSegmentEncoders = 1;
+        m_AdmittedSegment = 0;
     }
 
     void VideoEncoder::CleanupFfmpegEncoder()
@@ -689,49 +1385,20 @@ namespace Trident
             m_FfmpegFormatContext = nullptr;
         }
 
-        if (m_FfmpegSwsContext != nullptr)
-        {
-            sws_freeContext(m_FfmpegSwsContext);
-            m_FfmpegSwsContext = nullptr;
-        }
-
         m_FfmpegStream = nullptr;
     }
 
-    uint8_t VideoEncoder::ClampChannel(double value)
+    bool VideoEncoder::HasValidYuv420Layout(const RecordedFrame& frame)
     {
-        if (value < 0.0)
+        const uint32_t l_ChromaWidth = (frame.m_Extent.width + 1) / 2;
+        const size_t l_ChromaHeight = (frame.m_Extent.height + 1) / 2;
+        if (frame.m_LumaStride < frame.m_Extent.width || frame.m_ChromaStride < l_ChromaWidth)
         {
-            return 0;
-        }
-
-        if (value > 255.0)
-        {
-            return 255;
+            return false;
         }
 
-        return static_cast<uint8_t>(value);
-    }
+        const size_t l_RequiredBytes = static_cast<size_t>(frame.m_LumaStride) * frame.m_Extent.height + 2 * static_cast<size_t>(frame.m_ChromaStride) * l_ChromaHeight;
 
-    void VideoEncoder::ConvertRgbaToYuv444(const std::vector<uint8_t>& inputRGBA, VkExtent2D extent, std::vector<uint8_t>& outYUV)
-    {
-        // Basic RGBA to YUV444 conversion. Alpha channel is discarded because the container expects opaque frames.
-        const size_t l_PixelCount = static_cast<size_t>(extent.width) * static_cast<size_t>(extent.height);
-        for (size_t l_Index = 0; l_Index < l_PixelCount; ++l_Index)
-        {
-            const size_t l_RgbaOffset = l_Index * 4ull;
-            const uint8_t l_R = inputRGBA[l_RgbaOffset + 0];
-            const uint8_t l_G = inputRGBA[l_RgbaOffset + 1];
-            const uint8_t l_B = inputRGBA[l_RgbaOffset + 2];
-
-            // Use Rec. 601 full range conversion.
-            const double l_Y = 0.299 * static_cast<double>(l_R) + 0.587 * static_cast<double>(l_G) + 0.114 * static_cast<double>(l_B);
-            const double l_U = -0.169 * static_cast<double>(l_R) - 0.331 * static_cast<double>(l_G) + 0.5 * static_cast<double>(l_B) + 128.0;
-            const double l_V = 0.5 * static_cast<double>(l_R) - 0.419 * static_cast<double>(l_G) - 0.081 * static_cast<double>(l_B) + 128.0;
-
-            outYUV[l_Index] = ClampChannel(l_Y);
-            outYUV[l_PixelCount + l_Index] = ClampChannel(l_U);
-            outYUV[(2 * l_PixelCount) + l_Index] = ClampChannel(l_V);
-        }
+        return frame.GetPixels().size() >= l_RequiredBytes;
     }
 }
\ No newline at end of file
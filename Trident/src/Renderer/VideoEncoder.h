@@ -1,64 +1,190 @@
 #pragma once
 
 #include "Core/Utilities.h"
+#include "Renderer/ReplayBuffer.h"
+#include "Renderer/YuvConverter.h"
 
 #include <vector>
 #include <filesystem>
+#include <memory>
+#include <span>
 #include <chrono>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <map>
 #include <mutex>
-#include <queue>
 #include <thread>
 
 extern "C"
 {
+    struct AVCodec;
     struct AVCodecContext;
     struct AVFormatContext;
     struct AVFrame;
     struct AVPacket;
     struct AVStream;
-    struct SwsContext;
 }
 
 namespace Trident
 {
+    /**
+     * @brief Recycles the byte buffers recorded frames are written into.
+     *
+     * Acquire hands out a shared buffer that returns to the pool when its last reference drops, on whichever thread
+     * that happens, so steady-state recording allocates nothing per frame. Buffers that outlive the pool are freed.
+     */
+    class PixelBufferPool : public std::enable_shared_from_this<PixelBufferPool>
+    {
+    public:
+        explicit PixelBufferPool(size_t maxRetained) : m_MaxRetained(maxRetained) {}
+
+        std::shared_ptr<std::vector<uint8_t>> Acquire(size_t size);
+        void Clear();
+
+    private:
+        void Recycle(std::vector<uint8_t>* buffer);
+
+        std::mutex m_Mutex;
+        std::vector<std::unique_ptr<std::vector<uint8_t>>> m_FreeBuffers;
+        size_t m_MaxRetained = 0;
+    };
+
     /**
      * @brief Minimal helper that streams raw viewport frames to a video container.
      */
     class VideoEncoder
     {
     public:
+        enum class PixelLayout : uint8_t
+        {
+            Rgba8,      // Tightly packed RGBA rows.
+            Yuv420      // I420 planes (Y, U, V) with padded rows, as written by the GPU readback pre-process.
+        };
+
         struct RecordedFrame
         {
-            std::vector<uint8_t> m_Pixels; // Raw RGBA byte payload for the frame.
+            std::shared_ptr<const void> m_PixelOwner; // Keeps m_PixelView alive until encoded: a mapped readback or a pooled buffer.
+            std::span<const uint8_t> m_PixelView;     // RGBA or I420 byte payload for the frame.
             VkExtent2D m_Extent{ 0, 0 };   // Resolution of the supplied frame.
+            PixelLayout m_Layout = PixelLayout::Rgba8;
+            uint32_t m_LumaStride = 0;     // Bytes per Y row for I420 frames.
+            uint32_t m_ChromaStride = 0;   // Bytes per U and V row for I420 frames.
             std::chrono::system_clock::time_point m_Timestamp{}; // Capture timestamp.
             uint32_t m_FrameIndex = 0;     // Swapchain image index used for the frame.
             uint32_t m_ViewportId = 0;     // Viewport identifier associated with the frame.
+
+            std::span<const uint8_t> GetPixels() const { return m_PixelView; }
         };
 
+        // What SubmitFrame does when a frame would push the encoder queue past its byte budget.
+        enum class QueueOverflowPolicy : uint8_t
+        {
+            Block,          // Wait on the caller's thread until the encoder frees enough space.
+            DropOldest,     // Discard queued frames, oldest first, to make room.
+            DropNewest,     // Discard the incoming frame.
+            LowerFrameRate  // Keep every Nth frame, doubling N on overflow and halving it once the queue drains.
+        };
+
+        struct QueueStats
+        {
+            size_t m_QueuedFrames = 0;
+            size_t m_QueuedBytes = 0;
+            size_t m_BudgetBytes = 0;
+            uint64_t m_EncodedFrames = 0;
+            uint64_t m_DroppedFrames = 0;     // Frames discarded by the overflow policy, including decimated ones.
+            uint32_t m_FrameRateDivisor = 1;  // Current N for QueueOverflowPolicy::LowerFrameRate.
+            double m_AverageLatencyMs = 0.0;  // Submit to written, smoothed.
+            double m_MaxLatencyMs = 0.0;
+            double m_AverageEncodeMs = 0.0;   // Conversion and encode time per frame, smoothed.
+            double m_CaptureFps = 0.0;        // Frames offered to SubmitFrame over the last rate window.
+            double m_EncodeFps = 0.0;         // Frames the encoder finished over the same window, across all segment encoders.
+            uint32_t m_SegmentEncoders = 1;   // Codec instances encoding the current session.
+        };
+
+        static constexpr size_t s_DefaultQueueBudgetBytes = 256ull * 1024 * 1024;
+        static constexpr size_t s_DefaultReplayBudgetBytes = 64ull * 1024 * 1024;   // About a minute of 8 Mbit/s H.264.
+
         VideoEncoder() = default;
 
         bool BeginSession(const std::filesystem::path& outputPath, VkExtent2D extent, uint32_t targetFps);
-        bool SubmitFrame(const RecordedFrame& frame);
+        // Encodes H.264 into the in-memory replay ring instead of a file. Frames arriving faster than targetFps are skipped
+        // so the ring's duration follows wall-clock time.
+        bool BeginReplaySession(VkExtent2D extent, uint32_t targetFps);
+        // The frame is moved through the encoder queue; only its owner reference travels with it, never the pixels.
+        bool SubmitFrame(RecordedFrame frame);
         bool EndSession();
 
+        // Applies to the current and later sessions. A budget smaller than one frame still admits a frame into an empty queue.
+        void SetQueuePolicy(QueueOverflowPolicy policy, size_t budgetBytes);
+        QueueOverflowPolicy GetQueuePolicy() const { return m_QueuePolicy; }
+        size_t GetQueueBudget() const { return m_QueueBudgetBytes; }
+        QueueStats GetQueueStats() const;
+
+        // With more than one encoder, file sessions split the stream into fixed-length segments of closed GOPs and encode
+        // them round-robin on that many codec instances, written back in order as they finish. Encoders only overlap while
+        // the queue holds frames of more than one segment, so pair this with a budget of a few seconds of frames. Applies
+        // from the next BeginSession; replay sessions always use one encoder.
+        void SetSegmentEncoderCount(uint32_t encoderCount) { m_SegmentEncoderCount = std::clamp(encoderCount, 1u, s_MaxSegmentEncoders); }
+        uint32_t GetSegmentEncoderCount() const { return m_SegmentEncoderCount; }
+
+        // Buffers for CPU-produced frames; they return to the pool once the encoder has written them.
+        std::shared_ptr<std::vector<uint8_t>> AcquirePixelBuffer(size_t size) { return m_PixelBufferPool->Acquire(size); }
+
+        // The ring keeps its packets after the session ends, so a replay can still be saved once capture has stopped.
+        bool SaveReplay(const std::filesystem::path& outputPath) { return m_ReplayBuffer.SaveAsync(outputPath); }
+        void SetReplayBudget(size_t budgetBytes) { m_ReplayBuffer.SetBudget(budgetBytes); }
+        size_t GetReplayBudget() const { return m_ReplayBuffer.GetBudget(); }
+        ReplayBuffer::Stats GetReplayStats() const { return m_ReplayBuffer.GetStats(); }
+
         bool IsSessionActive() const { return m_SessionActive; }
+        bool IsReplaySession() const { return m_ReplayMode; }
+        VkExtent2D GetOutputExtent() const { return m_OutputExtent; }
+        // Y4M output keeps the full-range conversion it always used; the H.264 stream is tagged as limited range.
+        bool UsesFullRangeYuv() const { return m_UsingY4mContainer; }
 
     private:
+        struct QueuedFrame
+        {
+            RecordedFrame m_Frame;
+            size_t m_Bytes = 0;
+            std::chrono::steady_clock::time_point m_SubmitTime{};
+            int64_t m_Pts = 0;              // Assigned on admission so every segment encoder shares one timeline.
+            uint64_t m_Segment = 0;         // m_Pts / m_SegmentFrames; picks the segment encoder in segmented sessions.
+        };
+
+        bool OpenSession(const std::filesystem::path& outputPath, VkExtent2D extent, uint32_t targetFps, bool replay);
         bool InitialiseCodec();
         bool InitialiseFfmpegEncoder();
+        AVCodecContext* CreateCodecContext(const AVCodec* codec, bool globalHeader) const;
+        void FillCodecFrame(const RecordedFrame& frame, AVFrame* codecFrame, bool useConverterBands);
         bool WriteY4mHeader();
         bool WriteFrameToY4m(const RecordedFrame& frame);
-        bool WriteFrameToFfmpeg(const RecordedFrame& frame);
+        bool WriteFrameToFfmpeg(const RecordedFrame& frame, int64_t pts);
+        int32_t WriteEncodedPacket(AVPacket* packet);
         bool StartFfmpegWorker();
         void StopFfmpegWorker();
         void FfmpegWorkerLoop();
+        void SegmentWorkerLoop(uint32_t encoderIndex);
+        bool EncodeSegmentFrame(AVCodecContext* codecContext, const AVFrame* codecFrame, AVPacket* packet, std::vector<AVPacket*>& segmentPackets);
+        void CompleteSegment(uint64_t segment, std::vector<AVPacket*> packets, bool writeAll);
+        int64_t CalculateCapturePts(std::chrono::system_clock::time_point timestamp) const;
+        void UpdateFrameRates(std::chrono::steady_clock::time_point now);
+        bool AdmitFrame(std::unique_lock<std::mutex>& queueLock, size_t frameBytes, std::vector<QueuedFrame>& evictedFrames);
+        void ClearFrameQueue();
+        void RecordEncodedFrame(std::chrono::steady_clock::time_point submitTime, std::chrono::steady_clock::time_point encodeStart);
         void CleanupFfmpegEncoder();
         void ResetSession();
-        static uint8_t ClampChannel(double value);
-        static void ConvertRgbaToYuv444(const std::vector<uint8_t>& inputRGBA, VkExtent2D extent, std::vector<uint8_t>& outYUV);
+        static bool HasValidYuv420Layout(const RecordedFrame& frame);
+
+        static constexpr size_t s_MaxPooledPixelBuffers = 4;   // Covers the frames normally queued between render and encoder threads.
+        static constexpr uint32_t s_MaxFrameRateDivisor = 8;
+        static constexpr double s_StatsSmoothing = 0.1;
+        static constexpr uint32_t s_MaxSegmentEncoders = 8;
+        static constexpr uint32_t s_MinSegmentFrames = 30;      // Each segment opens a fresh codec, so keep segments long enough to amortise it.
+        static constexpr std::chrono::milliseconds s_FrameRateWindow{ 1000 };
 
         bool m_SessionActive = false;
         std::filesystem::path m_OutputPath{};
@@ -66,28 +192,59 @@ namespace Trident
         uint32_t m_TargetFps = 24;
         bool m_UsingY4mContainer = false;
         bool m_UsingFfmpegContainer = false;
+        bool m_ReplayMode = false;      // Packets go to m_ReplayBuffer; there is no container or output file.
         std::ofstream m_OutputStream{};
         std::chrono::system_clock::time_point m_SessionStartTime{};
         std::chrono::nanoseconds m_TargetFrameDuration{};
-        uint64_t m_FrameCounter = 0;
+        std::atomic<uint64_t> m_FrameCounter{ 0 };
+        int64_t m_NextPts = 0;          // Frames carry their capture time, so dropped frames leave gaps instead of speeding up playback.
 
         AVFormatContext* m_FfmpegFormatContext = nullptr;
         AVCodecContext* m_FfmpegCodecContext = nullptr;
         AVStream* m_FfmpegStream = nullptr;
-        SwsContext* m_FfmpegSwsContext = nullptr;
         AVFrame* m_FfmpegFrame = nullptr;
         AVPacket* m_FfmpegPacket = nullptr;
 
         std::thread m_FfmpegWorkerThread{};
         std::condition_variable m_FfmpegQueueCondition{};
-        std::mutex m_FfmpegQueueMutex{};
-        std::queue<RecordedFrame> m_FfmpegFrameQueue{};
+        std::condition_variable m_FfmpegSpaceCondition{};       // Signalled when the worker pops a frame; Block waits on it.
+        mutable std::mutex m_FfmpegQueueMutex{};                // Also guards the queue telemetry below.
+        std::deque<QueuedFrame> m_FfmpegFrameQueue{};
+        QueueOverflowPolicy m_QueuePolicy = QueueOverflowPolicy::DropOldest;
+        size_t m_QueueBudgetBytes = s_DefaultQueueBudgetBytes;
+        size_t m_QueuedBytes = 0;
+        uint32_t m_FrameRateDivisor = 1;
+        uint64_t m_FrameRateCounter = 0;
+        uint64_t m_EncodedFrames = 0;
+        uint64_t m_DroppedFrames = 0;
+        double m_AverageLatencyMs = 0.0;
+        double m_MaxLatencyMs = 0.0;
+        double m_AverageEncodeMs = 0.0;
+        std::chrono::steady_clock::time_point m_RateWindowStart{};
+        uint64_t m_SubmittedFrames = 0;
+        uint64_t m_RateWindowSubmitted = 0;   // m_SubmittedFrames and m_EncodedFrames when the rate window opened.
+        uint64_t m_RateWindowEncoded = 0;
+        double m_CaptureFps = 0.0;
+        double m_EncodeFps = 0.0;
         std::condition_variable m_FfmpegWorkerStateCondition{};
         std::mutex m_FfmpegWorkerStateMutex{};
         bool m_FfmpegWorkerShouldStop = false;
         bool m_FfmpegWorkerRunning = false;
         bool m_FfmpegWorkerInitialised = false;
         bool m_FfmpegWorkerReady = false;
-        bool m_FfmpegWorkerSessionSuccess = true;
+        std::atomic<bool> m_FfmpegWorkerSessionSuccess{ true };
+
+        uint32_t m_SegmentEncoderCount = 1;                      // Requested; takes effect at the next session.
+        uint32_t m_ActiveSegmentEncoders = 1;                    // Used by the running session.
+        uint32_t m_SegmentFrames = s_MinSegmentFrames;
+        uint64_t m_AdmittedSegment = 0;                          // Segment of the newest admitted frame; guarded by m_FfmpegQueueMutex.
+        std::mutex m_SegmentMuxMutex{};                          // Serialises container writes from the segment encoders.
+        std::map<uint64_t, std::vector<AVPacket*>> m_CompletedSegments; // Finished segments waiting for earlier ones.
+        uint64_t m_NextSegmentToWrite = 0;
+
+        YuvConverter m_YuvConverter;                             // RGBA frames to the codec's planes, across row bands.
+        std::vector<uint8_t> m_Y4mPlanes;                         // Reused I420 scratch for Y4M frames converted on the CPU.
+        std::shared_ptr<PixelBufferPool> m_PixelBufferPool = std::make_shared<PixelBufferPool>(s_MaxPooledPixelBuffers);
+        ReplayBuffer m_ReplayBuffer{ s_DefaultReplayBudgetBytes };
     };
 }
\ No newline at end of file
@@ -0,0 +1,455 @@
+#include "Renderer/YuvConverter.h"
+
+#include "Core/Utilities.h"
+#include "Renderer/SimdSupport.h"
+
+#include <algorithm>
+#include <initializer_list>
+
+namespace
+{
+    constexpr int32_t s_WeightBits = 15;     // Weights are in 1/32768 units.
+
+    struct YuvWeights
+    {
+        int16_t m_Luma[3];       // R, G and B weights.
+        int16_t m_U[3];
+        int16_t m_V[3];
+        int32_t m_LumaOffset;    // 16 in limited range, 0 in full range.
+    };
+
+    // The BT.601 weights of ReadbackPreprocess.comp; limited range scales luma by 219/255 and chroma by 224/255. Each
+    // chroma row sums to zero so grey stays exactly at 128.
+    constexpr YuvWeights s_FullRangeWeights{ { 9798, 19235, 3735 }, { -5538, -10846, 16384 }, { 16384, -13730, -2654 }, 0 };
+    constexpr YuvWeights s_LimitedRangeWeights{ { 8414, 16519, 3208 }, { -4865, -9527, 14392 }, { 14392, -12061, -2331 }, 16 };
+
+    using LumaRowFunction = void(*)(const uint8_t* source, uint8_t* luma, uint32_t width, const YuvWeights& weights);
+    // chromaStep is 1 for planar output and 2 for NV12, where v points one byte past u.
+    using ChromaRow420Function = void(*)(const uint8_t* upper, const uint8_t* lower, uint8_t* u, uint8_t* v, uint32_t chromaStep, uint32_t width,
+        const YuvWeights& weights);
+    using ChromaRow444Function = void(*)(const uint8_t* source, uint8_t* u, uint8_t* v, uint32_t width, const YuvWeights& weights);
+
+    struct YuvKernels
+    {
+        const char* m_Name = "Scalar";
+        LumaRowFunction m_Luma = nullptr;
+        ChromaRow420Function m_Chroma420 = nullptr;
+        ChromaRow444Function m_Chroma444 = nullptr;
+    };
+
+    uint8_t ClampByte(int32_t value)
+    {
+        return static_cast<uint8_t>(std::clamp(value, 0, 255));
+    }
+
+    int32_t Weigh(const int16_t(&weights)[3], int32_t red, int32_t green, int32_t blue)
+    {
+        return weights[0] * red + weights[1] * green + weights[2] * blue;
+    }
+
+    void LumaRowScalar(const uint8_t* source, uint8_t* luma, uint32_t width, const YuvWeights& weights)
+    {
+        const int32_t l_Bias = (weights.m_LumaOffset << s_WeightBits) + (1 << (s_WeightBits - 1));
+        for (uint32_t it_X = 0; it_X < width; ++it_X)
+        {
+            const uint8_t* l_Pixel = source + static_cast<size_t>(it_X) * 4;
+            luma[it_X] = ClampByte((Weigh(weights.m_Luma, l_Pixel[0], l_Pixel[1], l_Pixel[2]) + l_Bias) >> s_WeightBits);
+        }
+    }
+
+    void ChromaRow420Scalar(const uint8_t* upper, const uint8_t* lower, uint8_t* u, uint8_t* v, uint32_t chromaStep, uint32_t width, const YuvWeights& weights)
+    {
+        // Blocks sum four pixels, so two extra bits of shift turn the weighted sum into the weighted average.
+        constexpr int32_t l_Shift = s_WeightBits + 2;
+        constexpr int32_t l_Bias = (128 << l_Shift) + (1 << (l_Shift - 1));
+        const uint32_t l_ChromaWidth = (width + 1) / 2;
+
+        for (uint32_t it_Sample = 0; it_Sample < l_ChromaWidth; ++it_Sample)
+        {
+            const uint32_t l_Left = it_Sample * 2;
+            const uint32_t l_Right = std::min(l_Left + 1, width - 1);
+            int32_t l_Sums[3] = {};
+            for (const uint8_t* it_Row : { upper, lower })
+            {
+                for (const uint32_t it_Column : { l_Left, l_Right })
+                {
+                    for (uint32_t it_Channel = 0; it_Channel < 3; ++it_Channel)
+                    {
+                        l_Sums[it_Channel] += it_Row[static_cast<size_t>(it_Column) * 4 + it_Channel];
+                    }
+                }
+            }
+
+            u[it_Sample * chromaStep] = ClampByte((Weigh(weights.m_U, l_Sums[0], l_Sums[1], l_Sums[2]) + l_Bias) >> l_Shift);
+            v[it_Sample * chromaStep] = ClampByte((Weigh(weights.m_V, l_Sums[0], l_Sums[1], l_Sums[2]) + l_Bias) >> l_Shift);
+        }
+    }
+
+    void ChromaRow444Scalar(const uint8_t* source, uint8_t* u, uint8_t* v, uint32_t width, const YuvWeights& weights)
+    {
+        constexpr int32_t l_Bias = (128 << s_WeightBits) + (1 << (s_WeightBits - 1));
+        for (uint32_t it_X = 0; it_X < width; ++it_X)
+        {
+            const uint8_t* l_Pixel = source + static_cast<size_t>(it_X) * 4;
+            u[it_X] = ClampByte((Weigh(weights.m_U, l_Pixel[0], l_Pixel[1], l_Pixel[2]) + l_Bias) >> s_WeightBits);
+            v[it_X] = ClampByte((Weigh(weights.m_V, l_Pixel[0], l_Pixel[1], l_Pixel[2]) + l_Bias) >> s_WeightBits);
+        }
+    }
+
+#if defined(TRIDENT_SIMD_X64)
+    // Lays two 16-bit weights out the way madd pairs them with a pixel: low half for R (or G), high half for B (or A).
+    int32_t PackWeights(int16_t low, int16_t high)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(static_cast<uint16_t>(low)) | (static_cast<uint32_t>(static_cast<uint16_t>(high)) << 16));
+    }
+
+    // Splits eight RGBA pixels into R|B and G|A 16-bit pairs per 32-bit lane, so two madds weigh all three channels.
+    TRIDENT_SIMD_TARGET("avx2")
+    inline void SplitPixelsAvx2(const uint8_t* source, __m256i& redBlue, __m256i& greenAlpha)
+    {
+        const __m256i l_ByteMask = _mm256_set1_epi32(0x00FF00FF);
+        const __m256i l_Pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+        redBlue = _mm256_and_si256(l_Pixels, l_ByteMask);
+        greenAlpha = _mm256_and_si256(_mm256_srli_epi32(l_Pixels, 8), l_ByteMask);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    inline __m256i WeighAvx2(__m256i redBlue, __m256i greenAlpha, __m256i redBlueWeights, __m256i greenWeights, __m256i bias, int shift)
+    {
+        const __m256i l_Sum = _mm256_add_epi32(_mm256_madd_epi16(redBlue, redBlueWeights), _mm256_madd_epi16(greenAlpha, greenWeights));
+
+        return _mm256_srai_epi32(_mm256_add_epi32(l_Sum, bias), shift);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    void LumaRowAvx2(const uint8_t* source, uint8_t* luma, uint32_t width, const YuvWeights& weights)
+    {
+        const __m256i l_RedBlueWeights = _mm256_set1_epi32(PackWeights(weights.m_Luma[0], weights.m_Luma[2]));
+        const __m256i l_GreenWeights = _mm256_set1_epi32(PackWeights(weights.m_Luma[1], 0));
+        const __m256i l_Bias = _mm256_set1_epi32((weights.m_LumaOffset << s_WeightBits) + (1 << (s_WeightBits - 1)));
+        // The two pack steps interleave 128-bit lanes; this restores pixel order.
+        const __m256i l_Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        uint32_t it_X = 0;
+        for (; it_X + 32 <= width; it_X += 32)
+        {
+            __m256i l_Luma[4];
+            for (uint32_t it_Group = 0; it_Group < 4; ++it_Group)
+            {
+                __m256i l_RedBlue;
+                __m256i l_GreenAlpha;
+                SplitPixelsAvx2(source + (static_cast<size_t>(it_X) + it_Group * 8) * 4, l_RedBlue, l_GreenAlpha);
+                l_Luma[it_Group] = WeighAvx2(l_RedBlue, l_GreenAlpha, l_RedBlueWeights, l_GreenWeights, l_Bias, s_WeightBits);
+            }
+
+            const __m256i l_Packed = _mm256_packus_epi16(_mm256_packs_epi32(l_Luma[0], l_Luma[1]), _mm256_packs_epi32(l_Luma[2], l_Luma[3]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(luma + it_X), _mm256_permutevar8x32_epi32(l_Packed, l_Order));
+        }
+
+        LumaRowScalar(source + static_cast<size_t>(it_X) * 4, luma + it_X, width - it_X, weights);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    void ChromaRow420Avx2(const uint8_t* upper, const uint8_t* lower, uint8_t* u, uint8_t* v, uint32_t chromaStep, uint32_t width, const YuvWeights& weights)
+    {
+        constexpr int32_t l_Shift = s_WeightBits + 2;
+        const __m256i l_URedBlue = _mm256_set1_epi32(PackWeights(weights.m_U[0], weights.m_U[2]));
+        const __m256i l_UGreen = _mm256_set1_epi32(PackWeights(weights.m_U[1], 0));
+        const __m256i l_VRedBlue = _mm256_set1_epi32(PackWeights(weights.m_V[0], weights.m_V[2]));
+        const __m256i l_VGreen = _mm256_set1_epi32(PackWeights(weights.m_V[1], 0));
+        const __m256i l_Bias = _mm256_set1_epi32((128 << l_Shift) + (1 << (l_Shift - 1)));
+        const __m256i l_Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        // After the horizontal add and both packs the low 16 bytes hold u0 u1 u4 u5 u2 u3 u6 u7 and then v in the same
+        // order; one shuffle sorts them into two planar halves or into NV12 pairs.
+        const __m128i l_Sort = (chromaStep == 2) ? _mm_setr_epi8(0, 8, 1, 9, 4, 12, 5, 13, 2, 10, 3, 11, 6, 14, 7, 15)
+            : _mm_setr_epi8(0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15);
+
+        uint32_t it_X = 0;
+        for (; it_X + 16 <= width; it_X += 16)
+        {
+            __m256i l_RedBlue[2];
+            __m256i l_GreenAlpha[2];
+            for (uint32_t it_Half = 0; it_Half < 2; ++it_Half)
+            {
+                const size_t l_Offset = (static_cast<size_t>(it_X) + it_Half * 8) * 4;
+                __m256i l_UpperRedBlue;
+                __m256i l_UpperGreenAlpha;
+                __m256i l_LowerRedBlue;
+                __m256i l_LowerGreenAlpha;
+                SplitPixelsAvx2(upper + l_Offset, l_UpperRedBlue, l_UpperGreenAlpha);
+                SplitPixelsAvx2(lower + l_Offset, l_LowerRedBlue, l_LowerGreenAlpha);
+                l_RedBlue[it_Half] = _mm256_add_epi16(l_UpperRedBlue, l_LowerRedBlue);
+                l_GreenAlpha[it_Half] = _mm256_add_epi16(l_UpperGreenAlpha, l_LowerGreenAlpha);
+            }
+
+            // Adding neighbouring lanes completes each 2x2 block. The 16-bit sums stay below 1021, so the two halves of
+            // a lane never carry into each other.
+            const __m256i l_BlockRedBlue = _mm256_hadd_epi32(l_RedBlue[0], l_RedBlue[1]);
+            const __m256i l_BlockGreenAlpha = _mm256_hadd_epi32(l_GreenAlpha[0], l_GreenAlpha[1]);
+            const __m256i l_U = WeighAvx2(l_BlockRedBlue, l_BlockGreenAlpha, l_URedBlue, l_UGreen, l_Bias, l_Shift);
+            const __m256i l_V = WeighAvx2(l_BlockRedBlue, l_BlockGreenAlpha, l_VRedBlue, l_VGreen, l_Bias, l_Shift);
+
+            const __m256i l_Words = _mm256_packs_epi32(l_U, l_V);
+            const __m256i l_Bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(l_Words, l_Words), l_Order);
+            const __m128i l_Samples = _mm_shuffle_epi8(_mm256_castsi256_si128(l_Bytes), l_Sort);
+
+            const size_t l_Sample = it_X / 2;
+            if (chromaStep == 2)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(u + l_Sample * 2), l_Samples);
+            }
+            else
+            {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(u + l_Sample), l_Samples);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(v + l_Sample), _mm_srli_si128(l_Samples, 8));
+            }
+        }
+
+        const size_t l_Sample = it_X / 2;
+        ChromaRow420Scalar(upper + static_cast<size_t>(it_X) * 4, lower + static_cast<size_t>(it_X) * 4, u + l_Sample * chromaStep, v + l_Sample * chromaStep,
+            chromaStep, width - it_X, weights);
+    }
+
+    TRIDENT_SIMD_TARGET("avx2")
+    void ChromaRow444Avx2(const uint8_t* source, uint8_t* u, uint8_t* v, uint32_t width, const YuvWeights& weights)
+    {
+        const __m256i l_URedBlue = _mm256_set1_epi32(PackWeights(weights.m_U[0], weights.m_U[2]));
+        const __m256i l_UGreen = _mm256_set1_epi32(PackWeights(weights.m_U[1], 0));
+        const __m256i l_VRedBlue = _mm256_set1_epi32(PackWeights(weights.m_V[0], weights.m_V[2]));
+        const __m256i l_VGreen = _mm256_set1_epi32(PackWeights(weights.m_V[1], 0));
+        const __m256i l_Bias = _mm256_set1_epi32((128 << s_WeightBits) + (1 << (s_WeightBits - 1)));
+        const __m256i l_Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        uint32_t it_X = 0;
+        for (; it_X + 8 <= width; it_X += 8)
+        {
+            __m256i l_RedBlue;
+            __m256i l_GreenAlpha;
+            SplitPixelsAvx2(source + static_cast<size_t>(it_X) * 4, l_RedBlue, l_GreenAlpha);
+            const __m256i l_U = WeighAvx2(l_RedBlue, l_GreenAlpha, l_URedBlue, l_UGreen, l_Bias, s_WeightBits);
+            const __m256i l_V = WeighAvx2(l_RedBlue, l_GreenAlpha, l_VRedBlue, l_VGreen, l_Bias, s_WeightBits);
+
+            // Packing leaves u0-3 v0-3 in the low lane and u4-7 v4-7 in the high one; the permute joins each plane's halves.
+            const __m256i l_Words = _mm256_packs_epi32(l_U, l_V);
+            const __m128i l_Samples = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_packus_epi16(l_Words, l_Words), l_Order));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(u + it_X), l_Samples);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(v + it_X), _mm_srli_si128(l_Samples, 8));
+        }
+
+        ChromaRow444Scalar(source + static_cast<size_t>(it_X) * 4, u + it_X, v + it_X, width - it_X, weights);
+    }
+#elif defined(TRIDENT_SIMD_NEON)
+    // Weighs eight pixels (or 2x2 block sums) held as 16-bit channels; the saturating narrow clamps like ClampByte.
+    template<int TShift>
+    uint8x8_t WeighNeon(uint16x8_t red, uint16x8_t green, uint16x8_t blue, const int16_t(&weights)[3], int32_t bias)
+    {
+        const int16x8_t l_Red = vreinterpretq_s16_u16(red);
+        const int16x8_t l_Green = vreinterpretq_s16_u16(green);
+        const int16x8_t l_Blue = vreinterpretq_s16_u16(blue);
+
+        int32x4_t l_Low = vdupq_n_s32(bias);
+        l_Low = vmlal_n_s16(l_Low, vget_low_s16(l_Red), weights[0]);
+        l_Low = vmlal_n_s16(l_Low, vget_low_s16(l_Green), weights[1]);
+        l_Low = vmlal_n_s16(l_Low, vget_low_s16(l_Blue), weights[2]);
+
+        int32x4_t l_High = vdupq_n_s32(bias);
+        l_High = vmlal_n_s16(l_High, vget_high_s16(l_Red), weights[0]);
+        l_High = vmlal_n_s16(l_High, vget_high_s16(l_Green), weights[1]);
+        l_High = vmlal_n_s16(l_High, vget_high_s16(l_Blue), weights[2]);
+
+        return vqmovn_u16(vcombine_u16(vqmovun_s32(vshrq_n_s32(l_Low, TShift)), vqmovun_s32(vshrq_n_s32(l_High, TShift))));
+    }
+
+    void LumaRowNeon(const uint8_t* source, uint8_t* luma, uint32_t width, const YuvWeights& weights)
+    {
+        const int32_t l_Bias = (weights.m_LumaOffset << s_WeightBits) + (1 << (s_WeightBits - 1));
+
+        uint32_t it_X = 0;
+        for (; it_X + 16 <= width; it_X += 16)
+        {
+            // vld4 deinterleaves sixteen pixels into one register per channel.
+            const uint8x16x4_t l_Pixels = vld4q_u8(source + static_cast<size_t>(it_X) * 4);
+            const uint8x8_t l_Low = WeighNeon<s_WeightBits>(vmovl_u8(vget_low_u8(l_Pixels.val[0])), vmovl_u8(vget_low_u8(l_Pixels.val[1])),
+                vmovl_u8(vget_low_u8(l_Pixels.val[2])), weights.m_Luma, l_Bias);
+            const uint8x8_t l_High = WeighNeon<s_WeightBits>(vmovl_u8(vget_high_u8(l_Pixels.val[0])), vmovl_u8(vget_high_u8(l_Pixels.val[1])),
+                vmovl_u8(vget_high_u8(l_Pixels.val[2])), weights.m_Luma, l_Bias);
+            vst1q_u8(luma + it_X, vcombine_u8(l_Low, l_High));
+        }
+
+        LumaRowScalar(source + static_cast<size_t>(it_X) * 4, luma + it_X, width - it_X, weights);
+    }
+
+    void ChromaRow420Neon(const uint8_t* upper, const uint8_t* lower, uint8_t* u, uint8_t* v, uint32_t chromaStep, uint32_t width, const YuvWeights& weights)
+    {
+        constexpr int32_t l_Shift = s_WeightBits + 2;
+        constexpr int32_t l_Bias = (128 << l_Shift) + (1 << (l_Shift - 1));
+
+        uint32_t it_X = 0;
+        for (; it_X + 16 <= width; it_X += 16)
+        {
+            const uint8x16x4_t l_Upper = vld4q_u8(upper + static_cast<size_t>(it_X) * 4);
+            const uint8x16x4_t l_Lower = vld4q_u8(lower + static_cast<size_t>(it_X) * 4);
+            // Pairwise adds sum neighbouring pixels; accumulating the lower row completes each 2x2 block.
+            const uint16x8_t l_Red = vpadalq_u8(vpaddlq_u8(l_Upper.val[0]), l_Lower.val[0]);
+            const uint16x8_t l_Green = vpadalq_u8(vpaddlq_u8(l_Upper.val[1]), l_Lower.val[1]);
+            const uint16x8_t l_Blue = vpadalq_u8(vpaddlq_u8(l_Upper.val[2]), l_Lower.val[2]);
+            const uint8x8_t l_U = WeighNeon<l_Shift>(l_Red, l_Green, l_Blue, weights.m_U, l_Bias);
+            const uint8x8_t l_V = WeighNeon<l_Shift>(l_Red, l_Green, l_Blue, weights.m_V, l_Bias);
+
+            const size_t l_Sample = it_X / 2;
+            if (chromaStep == 2)
+            {
+                vst2_u8(u + l_Sample * 2, uint8x8x2_t{ { l_U, l_V } });
+            }
+            else
+            {
+                vst1_u8(u + l_Sample, l_U);
+                vst1_u8(v + l_Sample, l_V);
+            }
+        }
+
+        const size_t l_Sample = it_X / 2;
+        ChromaRow420Scalar(upper + static_cast<size_t>(it_X) * 4, lower + static_cast<size_t>(it_X) * 4, u + l_Sample * chromaStep, v + l_Sample * chromaStep,
+            chromaStep, width - it_X, weights);
+    }
+
+    void ChromaRow444Neon(const uint8_t* source, uint8_t* u, uint8_t* v, uint32_t width, const YuvWeights& weights)
+    {
+        constexpr int32_t l_Bias = (128 << s_WeightBits) + (1 << (s_WeightBits - 1));
+
+        uint32_t it_X = 0;
+        for (; it_X + 16 <= width; it_X += 16)
+        {
+            const uint8x16x4_t l_Pixels = vld4q_u8(source + static_cast<size_t>(it_X) * 4);
+            const uint16x8_t l_RedLow = vmovl_u8(vget_low_u8(l_Pixels.val[0]));
+            const uint16x8_t l_GreenLow = vmovl_u8(vget_low_u8(l_Pixels.val[1]));
+            const uint16x8_t l_BlueLow = vmovl_u8(vget_low_u8(l_Pixels.val[2]));
+            const uint16x8_t l_RedHigh = vmovl_u8(vget_high_u8(l_Pixels.val[0]));
+            const uint16x8_t l_GreenHigh = vmovl_u8(vget_high_u8(l_Pixels.val[1]));
+            const uint16x8_t l_BlueHigh = vmovl_u8(vget_high_u8(l_Pixels.val[2]));
+
+            vst1q_u8(u + it_X, vcombine_u8(WeighNeon<s_WeightBits>(l_RedLow, l_GreenLow, l_BlueLow, weights.m_U, l_Bias),
+                WeighNeon<s_WeightBits>(l_RedHigh, l_GreenHigh, l_BlueHigh, weights.m_U, l_Bias)));
+            vst1q_u8(v + it_X, vcombine_u8(WeighNeon<s_WeightBits>(l_RedLow, l_GreenLow, l_BlueLow, weights.m_V, l_Bias),
+                WeighNeon<s_WeightBits>(l_RedHigh, l_GreenHigh, l_BlueHigh, weights.m_V, l_Bias)));
+        }
+
+        ChromaRow444Scalar(source + static_cast<size_t>(it_X) * 4, u + it_X, v + it_X, width - it_X, weights);
+    }
+#endif
+
+    constexpr YuvKernels s_ScalarKernels{ "Scalar", &LumaRowScalar, &ChromaRow420Scalar, &ChromaRow444Scalar };
+
+    YuvKernels SelectKernels()
+    {
+#if defined(TRIDENT_SIMD_X64)
+        if (Trident::Simd::SupportsAvx2())
+        {
+            return { "AVX2", &LumaRowAvx2, &ChromaRow420Avx2, &ChromaRow444Avx2 };
+        }
+
+        return s_ScalarKernels;
+#elif defined(TRIDENT_SIMD_NEON)
+        return { "NEON", &LumaRowNeon, &ChromaRow420Neon, &ChromaRow444Neon };
+#else
+        return s_ScalarKernels;
+#endif
+    }
+
+    const YuvKernels& GetKernels()
+    {
+        static const YuvKernels s_Kernels = SelectKernels();
+
+        return s_Kernels;
+    }
+
+    void ConvertRowsWith(const YuvKernels& kernels, const Trident::YuvConversionDesc& desc, uint32_t firstRow, uint32_t rowCount)
+    {
+        const YuvWeights& l_Weights = desc.m_FullRange ? s_FullRangeWeights : s_LimitedRangeWeights;
+        const size_t l_SourceStride = (desc.m_SourceStride != 0) ? desc.m_SourceStride : static_cast<size_t>(desc.m_Width) * 4;
+        const uint32_t l_EndRow = std::min(firstRow + rowCount, desc.m_Height);
+        const bool l_FullChroma = desc.m_ChromaLayout == Trident::YuvChromaLayout::Yuv444;
+
+        for (uint32_t it_Row = firstRow; it_Row < l_EndRow; ++it_Row)
+        {
+            const uint8_t* l_Source = desc.m_Source + it_Row * l_SourceStride;
+            kernels.m_Luma(l_Source, desc.m_Planes[0] + static_cast<size_t>(it_Row) * desc.m_Strides[0], desc.m_Width, l_Weights);
+            if (l_FullChroma)
+            {
+                kernels.m_Chroma444(l_Source, desc.m_Planes[1] + static_cast<size_t>(it_Row) * desc.m_Strides[1],
+                    desc.m_Planes[2] + static_cast<size_t>(it_Row) * desc.m_Strides[2], desc.m_Width, l_Weights);
+            }
+        }
+
+        if (l_FullChroma)
+        {
+            return;
+        }
+
+        const bool l_Interleaved = desc.m_ChromaLayout == Trident::YuvChromaLayout::Nv12;
+        for (uint32_t it_Row = firstRow; it_Row < l_EndRow; it_Row += 2)
+        {
+            // The last block of an odd height frame pairs its row with itself.
+            const uint8_t* l_Upper = desc.m_Source + it_Row * l_SourceStride;
+            const uint8_t* l_Lower = desc.m_Source + std::min(it_Row + 1, desc.m_Height - 1) * l_SourceStride;
+            const size_t l_ChromaRow = it_Row / 2;
+            uint8_t* l_U = desc.m_Planes[1] + l_ChromaRow * desc.m_Strides[1];
+            uint8_t* l_V = l_Interleaved ? l_U + 1 : desc.m_Planes[2] + l_ChromaRow * desc.m_Strides[2];
+            kernels.m_Chroma420(l_Upper, l_Lower, l_U, l_V, l_Interleaved ? 2u : 1u, desc.m_Width, l_Weights);
+        }
+    }
+}
+
+namespace Trident
+{
+    void YuvConverter::Init(uint32_t workerCount)
+    {
+        m_Bands.Init(workerCount);
+
+        TR_CORE_TRACE("YuvConverter initialised (Workers = {}, Kernels = {})", workerCount, GetKernelName());
+    }
+
+    void YuvConverter::Shutdown()
+    {
+        m_Bands.Shutdown();
+    }
+
+    void YuvConverter::Convert(const YuvConversionDesc& desc)
+    {
+        const bool l_HasChromaPlanes = desc.m_Planes[1] != nullptr && (desc.m_ChromaLayout == YuvChromaLayout::Nv12 || desc.m_Planes[2] != nullptr);
+        if (desc.m_Source == nullptr || desc.m_Planes[0] == nullptr || !l_HasChromaPlanes || desc.m_Width == 0 || desc.m_Height == 0)
+        {
+            return;
+        }
+
+        const uint64_t l_PixelCount = static_cast<uint64_t>(desc.m_Width) * desc.m_Height;
+        if (l_PixelCount < s_MinParallelPixels)
+        {
+            ConvertRows(desc, 0, desc.m_Height);
+
+            return;
+        }
+
+        // Subsampled chroma rows read two source rows, so bands start on even rows and never share a block.
+        const uint32_t l_RowAlignment = (desc.m_ChromaLayout == YuvChromaLayout::Yuv444) ? 1u : 2u;
+        m_Bands.Dispatch(desc.m_Height, l_RowAlignment, [](const void* context, uint32_t firstRow, uint32_t rowCount)
+            {
+                ConvertRows(*static_cast<const YuvConversionDesc*>(context), firstRow, rowCount);
+            }, &desc);
+    }
+
+    void YuvConverter::ConvertRows(const YuvConversionDesc& desc, uint32_t firstRow, uint32_t rowCount)
+    {
+        ConvertRowsWith(GetKernels(), desc, firstRow, rowCount);
+    }
+
+    void YuvConverter::ConvertRowsScalar(const YuvConversionDesc& desc, uint32_t firstRow, uint32_t rowCount)
+    {
+        ConvertRowsWith(s_ScalarKernels, desc, firstRow, rowCount);
+    }
+
+    const char* YuvConverter::GetKernelName()
+    {
+        return GetKernels().m_Name;
+    }
+}
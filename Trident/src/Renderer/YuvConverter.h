@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Renderer/RowBandDispatcher.h"
+
+#include <cstdint>
+
+namespace Trident
+{
+    enum class YuvChromaLayout : uint8_t
+    {
+        I420,       // Separate U and V planes at half resolution in both directions.
+        Nv12,       // One interleaved UV plane at half resolution; m_Planes[2] is unused.
+        Yuv444      // Separate full resolution U and V planes, no subsampling.
+    };
+
+    /**
+     * @brief One RGBA frame and the planes its BT.601 YUV conversion writes to.
+     *
+     * The coefficients match ReadbackPreprocess.comp, so CPU and GPU converted frames look the same. Subsampled chroma
+     * averages each 2x2 block; edge blocks of odd sized frames repeat the last row or column.
+     */
+    struct YuvConversionDesc
+    {
+        const uint8_t* m_Source = nullptr;  // RGBA8 rows; alpha is ignored.
+        uint32_t m_SourceStride = 0;        // Bytes per source row; 0 means tightly packed.
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+        bool m_FullRange = false;           // 0-255 (JPEG) range instead of the 16-235 range H.264 expects.
+        YuvChromaLayout m_ChromaLayout = YuvChromaLayout::I420;
+        uint8_t* m_Planes[3] = {};          // Y, U (or UV), V.
+        uint32_t m_Strides[3] = {};         // Bytes per row of each plane.
+    };
+
+    /**
+     * @brief Converts RGBA frames to YUV with fixed-point SIMD kernels spread across row bands.
+     *
+     * Kernels are picked once per process: AVX2 when the CPU reports it, NEON on ARM64 and a scalar loop elsewhere. All
+     * of them share the same 15-bit integer arithmetic, so their output is bit-identical. Convert runs one band on the
+     * calling thread and returns when the whole frame is written.
+     */
+    class YuvConverter
+    {
+    public:
+        void Init(uint32_t workerCount);
+        void Shutdown();
+
+        void Convert(const YuvConversionDesc& desc);
+
+        // Single-threaded entry points; firstRow must be even when chroma is subsampled.
+        static void ConvertRows(const YuvConversionDesc& desc, uint32_t firstRow, uint32_t rowCount);
+        static void ConvertRowsScalar(const YuvConversionDesc& desc, uint32_t firstRow, uint32_t rowCount);
+        static const char* GetKernelName();
+
+        uint32_t GetWorkerCount() const { return m_Bands.GetWorkerCount(); }
+
+    private:
+        static constexpr uint32_t s_MinParallelPixels = 256 * 256; // Smaller frames finish faster than a worker wakes up.
+
+        RowBandDispatcher m_Bands;
+    };
+}
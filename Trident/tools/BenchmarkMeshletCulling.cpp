@@ -0,0 +1,204 @@
+#include "Geometry/Mesh.h"
+#include "Geometry/MeshletBuilder.h"
+#include "Loader/ModelLoader.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Offline benchmark for meshlet generation and the per-cluster culling tests mirrored from ClusterCull.comp.
+// Pass a model path to measure a real scanned asset; without arguments a dense noisy sphere stands in for one.
+// GPU throughput is compared in the editor by toggling "Cluster culling" in the Rendering panel.
+namespace
+{
+    constexpr uint32_t s_SyntheticRings = 400;
+    constexpr uint32_t s_SyntheticSegments = 800;
+    constexpr uint32_t s_OrbitSteps = 64;
+
+    Trident::Geometry::Mesh BuildScanLikeSphere()
+    {
+        Trident::Geometry::Mesh l_Mesh{};
+        l_Mesh.Vertices.reserve(static_cast<size_t>(s_SyntheticRings + 1) * (s_SyntheticSegments + 1));
+
+        const float l_Pi = 3.14159265358979f;
+        for (uint32_t it_Ring = 0; it_Ring <= s_SyntheticRings; ++it_Ring)
+        {
+            const float l_Theta = l_Pi * static_cast<float>(it_Ring) / static_cast<float>(s_SyntheticRings);
+            for (uint32_t it_Segment = 0; it_Segment <= s_SyntheticSegments; ++it_Segment)
+            {
+                const float l_Phi = 2.0f * l_Pi * static_cast<float>(it_Segment) / static_cast<float>(s_SyntheticSegments);
+                const glm::vec3 l_Direction{ std::sin(l_Theta) * std::cos(l_Phi), std::cos(l_Theta), std::sin(l_Theta) * std::sin(l_Phi) };
+
+                // Low-amplitude ripples imitate the surface noise of photogrammetry captures.
+                const float l_Ripple = 1.0f + 0.01f * std::sin(37.0f * l_Theta) * std::cos(53.0f * l_Phi);
+
+                Vertex l_Vertex{};
+                l_Vertex.Position = l_Direction * l_Ripple;
+                l_Vertex.Normal = l_Direction;
+                l_Mesh.Vertices.push_back(l_Vertex);
+            }
+        }
+
+        const uint32_t l_Stride = s_SyntheticSegments + 1;
+        for (uint32_t it_Ring = 0; it_Ring < s_SyntheticRings; ++it_Ring)
+        {
+            for (uint32_t it_Segment = 0; it_Segment < s_SyntheticSegments; ++it_Segment)
+            {
+                const uint32_t l_I0 = it_Ring * l_Stride + it_Segment;
+                const uint32_t l_I1 = l_I0 + l_Stride;
+                l_Mesh.Indices.insert(l_Mesh.Indices.end(), { l_I0, l_I0 + 1, l_I1, l_I1, l_I0 + 1, l_I1 + 1 });
+            }
+        }
+
+        return l_Mesh;
+    }
+
+    std::array<glm::vec4, 6> ExtractFrustumPlanes(const glm::mat4& viewProjection)
+    {
+        auto a_Row = [&viewProjection](int row)
+            {
+                return glm::vec4(viewProjection[0][row], viewProjection[1][row], viewProjection[2][row], viewProjection[3][row]);
+            };
+
+        std::array<glm::vec4, 6> l_Planes{ a_Row(3) + a_Row(0), a_Row(3) - a_Row(0), a_Row(3) + a_Row(1), a_Row(3) - a_Row(1),
+            a_Row(3) + a_Row(2), a_Row(3) - a_Row(2) };
+        for (glm::vec4& it_Plane : l_Planes)
+        {
+            it_Plane /= glm::length(glm::vec3(it_Plane));
+        }
+
+        return l_Planes;
+    }
+
+    bool IsClusterVisible(const Trident::Geometry::Meshlet& meshlet, const std::array<glm::vec4, 6>& planes, const glm::vec3& cameraPosition)
+    {
+        for (const glm::vec4& it_Plane : planes)
+        {
+            if (glm::dot(glm::vec3(it_Plane), meshlet.Center) + it_Plane.w < -meshlet.Radius)
+            {
+                return false;
+            }
+        }
+
+        if (meshlet.ConeCutoff < 1.0f)
+        {
+            const glm::vec3 l_ToCluster = meshlet.Center - cameraPosition;
+            if (glm::dot(l_ToCluster, meshlet.ConeAxis) >= meshlet.ConeCutoff * glm::length(l_ToCluster) + meshlet.Radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<Trident::Geometry::Mesh> l_Meshes;
+    if (argc > 1)
+    {
+        // The loader already clusters every mesh, so the build timing below re-runs the pass on the imported data.
+        Trident::Loader::ModelData l_Model = Trident::Loader::ModelLoader::Load(argv[1]);
+        l_Meshes = std::move(l_Model.m_Meshes);
+        if (l_Meshes.empty())
+        {
+            std::cerr << "No meshes loaded from '" << argv[1] << "'" << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        l_Meshes.push_back(BuildScanLikeSphere());
+    }
+
+    glm::vec3 l_Min{ std::numeric_limits<float>::max() };
+    glm::vec3 l_Max{ std::numeric_limits<float>::lowest() };
+    size_t l_TotalTriangles = 0;
+
+    const auto l_BuildStart = std::chrono::steady_clock::now();
+    for (Trident::Geometry::Mesh& it_Mesh : l_Meshes)
+    {
+        Trident::Geometry::MeshletBuilder::Build(it_Mesh);
+        l_TotalTriangles += it_Mesh.Indices.size() / 3;
+        for (const Vertex& it_Vertex : it_Mesh.Vertices)
+        {
+            l_Min = glm::min(l_Min, it_Vertex.Position);
+            l_Max = glm::max(l_Max, it_Vertex.Position);
+        }
+    }
+    const double l_BuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_BuildStart).count();
+
+    size_t l_ClusterCount = 0;
+    size_t l_ClusteredTriangles = 0;
+    for (const Trident::Geometry::Mesh& it_Mesh : l_Meshes)
+    {
+        l_ClusterCount += it_Mesh.Meshlets.size();
+        for (const Trident::Geometry::Meshlet& it_Meshlet : it_Mesh.Meshlets)
+        {
+            l_ClusteredTriangles += it_Meshlet.IndexCount / 3;
+        }
+    }
+
+    std::cout << "Meshes: " << l_Meshes.size() << " Triangles: " << l_TotalTriangles << " Clusters: " << l_ClusterCount << std::endl;
+    std::cout << "Meshlet build: " << l_BuildMs << " ms" << std::endl;
+    if (l_ClusterCount == 0)
+    {
+        std::cerr << "No mesh was large enough to cluster" << std::endl;
+        return 2;
+    }
+
+    std::cout << "Average triangles per cluster: " << static_cast<double>(l_ClusteredTriangles) / static_cast<double>(l_ClusterCount) << std::endl;
+
+    // Orbit the bounds at two distances so both whole-object (cone-dominated) and close-up (frustum-dominated) views are covered.
+    const glm::vec3 l_Center = (l_Min + l_Max) * 0.5f;
+    const float l_Radius = std::max(glm::length(l_Max - l_Min) * 0.5f, 1e-3f);
+    const glm::mat4 l_Projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, l_Radius * 0.01f, l_Radius * 10.0f);
+
+    uint64_t l_TestedClusters = 0;
+    uint64_t l_VisibleTriangles = 0;
+    uint64_t l_TestedTriangles = 0;
+
+    const auto l_CullStart = std::chrono::steady_clock::now();
+    for (uint32_t it_Step = 0; it_Step < s_OrbitSteps; ++it_Step)
+    {
+        const float l_Angle = 6.28318530718f * static_cast<float>(it_Step) / static_cast<float>(s_OrbitSteps);
+        const float l_Distance = l_Radius * ((it_Step % 2 == 0) ? 2.5f : 1.2f);
+        const glm::vec3 l_Eye = l_Center + glm::vec3(std::cos(l_Angle), 0.3f, std::sin(l_Angle)) * l_Distance;
+        const glm::mat4 l_View = glm::lookAt(l_Eye, l_Center, glm::vec3(0.0f, 1.0f, 0.0f));
+        const std::array<glm::vec4, 6> l_Planes = ExtractFrustumPlanes(l_Projection * l_View);
+
+        for (const Trident::Geometry::Mesh& it_Mesh : l_Meshes)
+        {
+            for (const Trident::Geometry::Meshlet& it_Meshlet : it_Mesh.Meshlets)
+            {
+                ++l_TestedClusters;
+                l_TestedTriangles += it_Meshlet.IndexCount / 3;
+                if (IsClusterVisible(it_Meshlet, l_Planes, l_Eye))
+                {
+                    l_VisibleTriangles += it_Meshlet.IndexCount / 3;
+                }
+            }
+        }
+    }
+    const double l_CullSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - l_CullStart).count();
+
+    const double l_CulledPercent = l_TestedTriangles > 0 ? 100.0 * static_cast<double>(l_TestedTriangles - l_VisibleTriangles) / static_cast<double>(l_TestedTriangles) : 0.0;
+    std::cout << "Triangles culled across " << s_OrbitSteps << " views: " << l_CulledPercent << "%" << std::endl;
+    std::cout << "Triangles submitted per view: " << l_VisibleTriangles / s_OrbitSteps << " (unculled " << l_TestedTriangles / s_OrbitSteps << ")" << std::endl;
+    if (l_CullSeconds > 0.0)
+    {
+        std::cout << "CPU reference cull rate: " << static_cast<double>(l_TestedClusters) / l_CullSeconds / 1.0e6 << " M clusters/s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include "Renderer/ReadbackConverter.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Micro-benchmark for the frame readback conversion run by Renderer::ResolvePendingReadback.
+// Every swapchain-style format is converted into each output combination by the scalar reference, the SIMD kernels on
+// one thread and the SIMD kernels across the worker bands; results are checked against the reference.
+// Optional arguments: width height (defaults to 4K).
+namespace
+{
+    constexpr uint32_t s_Iterations = 20;
+
+    struct FormatCase
+    {
+        const char* m_Name = "";
+        std::array<uint32_t, 4> m_Mapping{ { 0, 1, 2, 3 } };
+        uint32_t m_ChannelCount = 4;
+    };
+
+    struct OutputCase
+    {
+        const char* m_Name = "";
+        bool m_Floats = false;
+        bool m_Bytes = false;
+    };
+
+    template<typename TConvert>
+    double MeasureMilliseconds(TConvert&& convert)
+    {
+        // One warm-up pass faults the destination pages in so the first timed run is not penalised.
+        convert();
+
+        const auto l_Start = std::chrono::steady_clock::now();
+        for (uint32_t it_Iteration = 0; it_Iteration < s_Iterations; ++it_Iteration)
+        {
+            convert();
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_Start).count() / s_Iterations;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t l_Width = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 3840u;
+    const uint32_t l_Height = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 2160u;
+    if (l_Width == 0 || l_Height == 0)
+    {
+        std::cerr << "Usage: trident_readback_benchmark [width height]" << std::endl;
+        return 1;
+    }
+
+    const size_t l_PixelCount = static_cast<size_t>(l_Width) * l_Height;
+    std::vector<uint8_t> l_Source(l_PixelCount * 4);
+    std::mt19937 l_Random(1337u);
+    for (uint8_t& it_Byte : l_Source)
+    {
+        it_Byte = static_cast<uint8_t>(l_Random());
+    }
+
+    Trident::ReadbackConverter l_Converter;
+    l_Converter.Init(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u) - 1);
+
+    std::cout << "Readback " << l_Width << "x" << l_Height << ", kernels: " << Trident::ReadbackConverter::GetKernelName()
+        << ", conversion threads: " << l_Converter.GetWorkerCount() + 1 << std::endl;
+
+    const std::array<FormatCase, 3> l_Formats{ {
+        { "BGRA8 -> RGBA", { { 2, 1, 0, 3 } }, 4 },
+        { "RGBA8 -> RGBA", { { 0, 1, 2, 3 } }, 4 },
+        { "BGRA8 -> RGB", { { 2, 1, 0, 3 } }, 3 } } };
+    const std::array<OutputCase, 3> l_Outputs{ {
+        { "floats", true, false },
+        { "bytes", false, true },
+        { "floats+bytes", true, true } } };
+
+    int l_Result = 0;
+    for (const FormatCase& it_Format : l_Formats)
+    {
+        const size_t l_ElementCount = l_PixelCount * it_Format.m_ChannelCount;
+        std::vector<float> l_ReferenceFloats(l_ElementCount);
+        std::vector<uint8_t> l_ReferenceBytes(l_ElementCount);
+        std::vector<float> l_Floats(l_ElementCount);
+        std::vector<uint8_t> l_Bytes(l_ElementCount);
+
+        for (const OutputCase& it_Output : l_Outputs)
+        {
+            Trident::ReadbackConversionDesc l_Reference{};
+            l_Reference.m_Source = l_Source.data();
+            l_Reference.m_Width = l_Width;
+            l_Reference.m_Height = l_Height;
+            l_Reference.m_ChannelCount = it_Format.m_ChannelCount;
+            l_Reference.m_ChannelMapping = it_Format.m_Mapping;
+
+            Trident::ReadbackConversionDesc l_Desc = l_Reference;
+            l_Reference.m_Floats = it_Output.m_Floats ? l_ReferenceFloats.data() : nullptr;
+            l_Reference.m_Bytes = it_Output.m_Bytes ? l_ReferenceBytes.data() : nullptr;
+            l_Desc.m_Floats = it_Output.m_Floats ? l_Floats.data() : nullptr;
+            l_Desc.m_Bytes = it_Output.m_Bytes ? l_Bytes.data() : nullptr;
+
+            const double l_ScalarMs = MeasureMilliseconds([&]() { Trident::ReadbackConverter::ConvertRowsScalar(l_Reference, 0, l_Height); });
+            const double l_SimdMs = MeasureMilliseconds([&]() { Trident::ReadbackConverter::ConvertRows(l_Desc, 0, l_Height); });
+            const double l_ThreadedMs = MeasureMilliseconds([&]() { l_Converter.Convert(l_Desc); });
+
+            const bool l_FloatsMatch = !it_Output.m_Floats || std::memcmp(l_Floats.data(), l_ReferenceFloats.data(), l_ElementCount * sizeof(float)) == 0;
+            const bool l_BytesMatch = !it_Output.m_Bytes || l_Bytes == l_ReferenceBytes;
+            if (!l_FloatsMatch || !l_BytesMatch)
+            {
+                l_Result = 2;
+            }
+
+            std::cout << it_Format.m_Name << " [" << it_Output.m_Name << "]: scalar " << l_ScalarMs << " ms, simd " << l_SimdMs << " ms, threaded "
+                << l_ThreadedMs << " ms (" << l_ScalarMs / l_ThreadedMs << "x)" << ((l_FloatsMatch && l_BytesMatch) ? "" : " MISMATCH") << std::endl;
+        }
+    }
+
+    l_Converter.Shutdown();
+
+    return l_Result;
+}
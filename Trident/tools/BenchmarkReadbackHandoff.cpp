@@ -0,0 +1,120 @@
+#include "Renderer/ReadbackPreprocessor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Measures the host copies the readback handoff used to make between the mapped staging buffer and each consumer, and the
+// memory bandwidth removed by handing out shared views of the mapping instead. The old chains per resolved frame were:
+//   tensor:  staging -> pending vector -> acquired vector -> inference staging buffer (-> dataset job when capturing)
+//   encoder: staging -> pending bytes -> RecordedFrame -> retained viewport frame -> encoder queue
+// Every copy reads and writes the payload once; the reads consumers make themselves are the same on both paths.
+// Optional arguments: width height fps (defaults to 1080p60).
+namespace
+{
+    constexpr uint32_t s_Iterations = 30;
+
+    template<typename TStep>
+    double MeasureMilliseconds(TStep&& step)
+    {
+        // One warm-up pass faults the destination pages in so the first timed run is not penalised.
+        step();
+
+        const auto l_Start = std::chrono::steady_clock::now();
+        for (uint32_t it_Iteration = 0; it_Iteration < s_Iterations; ++it_Iteration)
+        {
+            step();
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_Start).count() / s_Iterations;
+    }
+
+    // Copies a payload down a chain of vectors the way the old handoff did, one hop per stage.
+    void RunCopyChain(std::span<const uint8_t> source, std::vector<std::vector<uint8_t>>& stages)
+    {
+        std::span<const uint8_t> l_Previous = source;
+        for (std::vector<uint8_t>& it_Stage : stages)
+        {
+            it_Stage.assign(l_Previous.begin(), l_Previous.end());
+            l_Previous = it_Stage;
+        }
+    }
+
+    // The new handoff: one shared owner and a view per consumer, whatever the payload size.
+    void RunSharedHandoff(const std::shared_ptr<const void>& owner, std::span<const uint8_t> source, std::vector<std::shared_ptr<const void>>& holders,
+        std::vector<std::span<const uint8_t>>& views)
+    {
+        for (size_t it_Index = 0; it_Index < holders.size(); ++it_Index)
+        {
+            holders[it_Index] = owner;
+            views[it_Index] = source;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t l_Width = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1920u;
+    const uint32_t l_Height = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1080u;
+    const uint32_t l_Fps = (argc > 3) ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 60u;
+    if (l_Width == 0 || l_Height == 0 || l_Fps == 0)
+    {
+        std::cerr << "Usage: trident_readback_handoff_benchmark [width height [fps]]" << std::endl;
+        return 1;
+    }
+
+    // Same layout the renderer reads back: an FP32 RGBA tensor at the frame size followed by full-range I420 planes.
+    const VkExtent2D l_Extent{ l_Width, l_Height };
+    const Trident::ReadbackPreprocessLayout l_Layout = Trident::ReadbackPreprocessLayout::Build(l_Extent, 4, false, l_Extent, true);
+    std::vector<uint8_t> l_Staging(static_cast<size_t>(l_Layout.m_TotalSize), 0x5A);
+    const std::span<const uint8_t> l_Tensor(l_Staging.data() + l_Layout.m_TensorOffset, static_cast<size_t>(l_Layout.m_TensorSize));
+    const std::span<const uint8_t> l_Planes(l_Staging.data() + l_Layout.m_YuvOffset, static_cast<size_t>(l_Layout.m_YuvSize));
+
+    struct ChainCase
+    {
+        const char* m_Name = "";
+        std::span<const uint8_t> m_Payload;
+        uint32_t m_Copies = 0;
+        bool m_CountInTotal = true;
+    };
+
+    const ChainCase l_Cases[] = {
+        { "tensor (inference)", l_Tensor, 3, true },
+        { "tensor (inference + dataset capture)", l_Tensor, 4, false },
+        { "I420 planes (encoder)", l_Planes, 4, true } };
+
+    std::cout << "Readback handoff " << l_Width << "x" << l_Height << " at " << l_Fps << " FPS: tensor " << l_Tensor.size() / 1.0e6 << " MB, planes "
+        << l_Planes.size() / 1.0e6 << " MB" << std::endl;
+
+    const std::shared_ptr<const void> l_Owner = std::make_shared<int>(0);
+    double l_TotalSavedGBps = 0.0;
+    for (const ChainCase& it_Case : l_Cases)
+    {
+        std::vector<std::vector<uint8_t>> l_Stages(it_Case.m_Copies);
+        std::vector<std::shared_ptr<const void>> l_Holders(it_Case.m_Copies);
+        std::vector<std::span<const uint8_t>> l_Views(it_Case.m_Copies);
+
+        const double l_CopyMs = MeasureMilliseconds([&]() { RunCopyChain(it_Case.m_Payload, l_Stages); });
+        const double l_SharedMs = MeasureMilliseconds([&]() { RunSharedHandoff(l_Owner, it_Case.m_Payload, l_Holders, l_Views); });
+
+        // Each copy moves the payload across the memory bus twice: once read, once written.
+        const double l_BytesPerFrame = 2.0 * static_cast<double>(it_Case.m_Payload.size()) * it_Case.m_Copies;
+        const double l_SavedGBps = l_BytesPerFrame * l_Fps / 1.0e9;
+        const double l_FrameBudgetPercent = l_CopyMs * l_Fps / 10.0;
+        if (it_Case.m_CountInTotal)
+        {
+            l_TotalSavedGBps += l_SavedGBps;
+        }
+
+        std::cout << it_Case.m_Name << ": " << it_Case.m_Copies << " copies " << l_CopyMs << " ms (" << l_FrameBudgetPercent << "% of one core), shared "
+            << l_SharedMs << " ms; " << l_SavedGBps << " GB/s of memory traffic removed" << std::endl;
+    }
+
+    std::cout << "Inference + recording: " << l_TotalSavedGBps << " GB/s removed at " << l_Fps << " FPS" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,274 @@
+#include "Renderer/VideoEncoder.h"
+#include "Renderer/YuvConverter.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <libswscale/swscale.h>
+}
+
+// Measures the RGBA -> YUV conversion the video encoder runs for every CPU-converted frame, against the paths it
+// replaced: swscale for H.264 output and the per-pixel double loop for Y4M output. Also times the old per-frame pixel
+// vector copied into the encoder queue against a pooled buffer moved through it.
+// Optional arguments: width height (defaults to running 1080p and 4K).
+namespace
+{
+    constexpr uint32_t s_Iterations = 20;
+
+    struct PlaneSet
+    {
+        std::vector<uint8_t> m_Storage;
+        Trident::YuvConversionDesc m_Desc{};
+    };
+
+    struct LayoutCase
+    {
+        const char* m_Name = "";
+        Trident::YuvChromaLayout m_Layout = Trident::YuvChromaLayout::I420;
+        bool m_FullRange = false;
+    };
+
+    template<typename TStep>
+    double MeasureMilliseconds(TStep&& step)
+    {
+        // One warm-up pass faults the destination pages in so the first timed run is not penalised.
+        step();
+
+        const auto l_Start = std::chrono::steady_clock::now();
+        for (uint32_t it_Iteration = 0; it_Iteration < s_Iterations; ++it_Iteration)
+        {
+            step();
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_Start).count() / s_Iterations;
+    }
+
+    PlaneSet MakePlanes(const uint8_t* source, uint32_t width, uint32_t height, const LayoutCase& layoutCase)
+    {
+        const bool l_Subsampled = layoutCase.m_Layout != Trident::YuvChromaLayout::Yuv444;
+        const uint32_t l_ChromaWidth = l_Subsampled ? (width + 1) / 2 : width;
+        const uint32_t l_ChromaHeight = l_Subsampled ? (height + 1) / 2 : height;
+        const size_t l_LumaSize = static_cast<size_t>(width) * height;
+        const size_t l_ChromaSize = static_cast<size_t>(l_ChromaWidth) * l_ChromaHeight;
+
+        PlaneSet l_Set{};
+        l_Set.m_Storage.resize(l_LumaSize + 2 * l_ChromaSize);
+        l_Set.m_Desc.m_Source = source;
+        l_Set.m_Desc.m_Width = width;
+        l_Set.m_Desc.m_Height = height;
+        l_Set.m_Desc.m_FullRange = layoutCase.m_FullRange;
+        l_Set.m_Desc.m_ChromaLayout = layoutCase.m_Layout;
+        l_Set.m_Desc.m_Planes[0] = l_Set.m_Storage.data();
+        l_Set.m_Desc.m_Planes[1] = l_Set.m_Storage.data() + l_LumaSize;
+        l_Set.m_Desc.m_Planes[2] = l_Set.m_Storage.data() + l_LumaSize + l_ChromaSize;
+        l_Set.m_Desc.m_Strides[0] = width;
+        l_Set.m_Desc.m_Strides[1] = (layoutCase.m_Layout == Trident::YuvChromaLayout::Nv12) ? l_ChromaWidth * 2 : l_ChromaWidth;
+        l_Set.m_Desc.m_Strides[2] = l_ChromaWidth;
+
+        return l_Set;
+    }
+
+    uint8_t ClampChannel(double value)
+    {
+        return static_cast<uint8_t>(std::clamp(value, 0.0, 255.0));
+    }
+
+    // The Y4M conversion VideoEncoder used before the fixed-point kernels, kept verbatim as the baseline.
+    void ConvertRgbaToYuv420Legacy(const uint8_t* inputRGBA, uint32_t width, uint32_t height, std::vector<uint8_t>& outYUV)
+    {
+        const size_t l_Width = width;
+        const size_t l_Height = height;
+        const size_t l_ChromaWidth = (l_Width + 1) / 2;
+        const size_t l_ChromaHeight = (l_Height + 1) / 2;
+        uint8_t* l_LumaPlane = outYUV.data();
+        uint8_t* l_UPlane = l_LumaPlane + l_Width * l_Height;
+        uint8_t* l_VPlane = l_UPlane + l_ChromaWidth * l_ChromaHeight;
+
+        for (size_t it_Y = 0; it_Y < l_Height; ++it_Y)
+        {
+            for (size_t it_X = 0; it_X < l_Width; ++it_X)
+            {
+                const uint8_t* l_Pixel = &inputRGBA[(it_Y * l_Width + it_X) * 4ull];
+                const double l_Y = 0.299 * static_cast<double>(l_Pixel[0]) + 0.587 * static_cast<double>(l_Pixel[1]) + 0.114 * static_cast<double>(l_Pixel[2]);
+                l_LumaPlane[it_Y * l_Width + it_X] = ClampChannel(l_Y + 0.5);
+            }
+        }
+
+        for (size_t it_Y = 0; it_Y < l_ChromaHeight; ++it_Y)
+        {
+            for (size_t it_X = 0; it_X < l_ChromaWidth; ++it_X)
+            {
+                double l_Rgb[3] = {};
+                for (size_t it_Sample = 0; it_Sample < 4; ++it_Sample)
+                {
+                    const size_t l_SourceX = std::min(it_X * 2 + (it_Sample & 1), l_Width - 1);
+                    const size_t l_SourceY = std::min(it_Y * 2 + (it_Sample >> 1), l_Height - 1);
+                    const uint8_t* l_Pixel = &inputRGBA[(l_SourceY * l_Width + l_SourceX) * 4ull];
+                    for (size_t it_Channel = 0; it_Channel < 3; ++it_Channel)
+                    {
+                        l_Rgb[it_Channel] += 0.25 * static_cast<double>(l_Pixel[it_Channel]);
+                    }
+                }
+
+                const double l_U = -0.169 * l_Rgb[0] - 0.331 * l_Rgb[1] + 0.5 * l_Rgb[2] + 128.0;
+                const double l_V = 0.5 * l_Rgb[0] - 0.419 * l_Rgb[1] - 0.081 * l_Rgb[2] + 128.0;
+                l_UPlane[it_Y * l_ChromaWidth + it_X] = ClampChannel(l_U + 0.5);
+                l_VPlane[it_Y * l_ChromaWidth + it_X] = ClampChannel(l_V + 0.5);
+            }
+        }
+    }
+
+    int RunResolution(uint32_t width, uint32_t height, Trident::YuvConverter& converter)
+    {
+        const size_t l_FrameBytes = static_cast<size_t>(width) * height * 4;
+        std::vector<uint8_t> l_Source(l_FrameBytes);
+        std::mt19937 l_Random(1337u);
+        for (uint8_t& it_Byte : l_Source)
+        {
+            it_Byte = static_cast<uint8_t>(l_Random());
+        }
+
+        std::cout << "Encoder conversion " << width << "x" << height << ", kernels: " << Trident::YuvConverter::GetKernelName()
+            << ", conversion threads: " << converter.GetWorkerCount() + 1 << std::endl;
+
+        int l_Result = 0;
+
+        // Baselines: the H.264 path scaled with swscale, the Y4M path allocated a plane buffer and ran doubles per pixel.
+        {
+            PlaneSet l_Planes = MakePlanes(l_Source.data(), width, height, { "", Trident::YuvChromaLayout::I420, false });
+            SwsContext* l_Sws = sws_getContext(static_cast<int32_t>(width), static_cast<int32_t>(height), AV_PIX_FMT_RGBA, static_cast<int32_t>(width),
+                static_cast<int32_t>(height), AV_PIX_FMT_YUV420P, SWS_BILINEAR, nullptr, nullptr, nullptr);
+            if (l_Sws != nullptr)
+            {
+                const uint8_t* l_SourcePlanes[1] = { l_Source.data() };
+                const int32_t l_SourceStrides[1] = { static_cast<int32_t>(width * 4) };
+                uint8_t* l_DestinationPlanes[3] = { l_Planes.m_Desc.m_Planes[0], l_Planes.m_Desc.m_Planes[1], l_Planes.m_Desc.m_Planes[2] };
+                const int32_t l_DestinationStrides[3] = { static_cast<int32_t>(l_Planes.m_Desc.m_Strides[0]), static_cast<int32_t>(l_Planes.m_Desc.m_Strides[1]),
+                    static_cast<int32_t>(l_Planes.m_Desc.m_Strides[2]) };
+                const double l_SwsMs = MeasureMilliseconds([&]()
+                    {
+                        sws_scale(l_Sws, l_SourcePlanes, l_SourceStrides, 0, static_cast<int32_t>(height), l_DestinationPlanes, l_DestinationStrides);
+                    });
+                const double l_ThreadedMs = MeasureMilliseconds([&]() { converter.Convert(l_Planes.m_Desc); });
+                std::cout << "H.264 I420 limited: swscale " << l_SwsMs << " ms (" << 1000.0 / l_SwsMs << " FPS), threaded " << l_ThreadedMs << " ms ("
+                    << 1000.0 / l_ThreadedMs << " FPS, " << l_SwsMs / l_ThreadedMs << "x)" << std::endl;
+                sws_freeContext(l_Sws);
+            }
+
+            PlaneSet l_Full = MakePlanes(l_Source.data(), width, height, { "", Trident::YuvChromaLayout::I420, true });
+            std::vector<uint8_t> l_LegacyPlanes;
+            const double l_LegacyMs = MeasureMilliseconds([&]()
+                {
+                    std::vector<uint8_t> l_Buffer(l_Full.m_Storage.size());
+                    ConvertRgbaToYuv420Legacy(l_Source.data(), width, height, l_Buffer);
+                    l_LegacyPlanes = std::move(l_Buffer);
+                });
+            const double l_ThreadedMs = MeasureMilliseconds([&]() { converter.Convert(l_Full.m_Desc); });
+
+            // The new weights are the double weights rounded to 1/32768, so samples may differ from the old loop by one.
+            int32_t l_MaxDeviation = 0;
+            for (size_t it_Index = 0; it_Index < l_LegacyPlanes.size(); ++it_Index)
+            {
+                l_MaxDeviation = std::max(l_MaxDeviation, std::abs(static_cast<int32_t>(l_LegacyPlanes[it_Index]) - static_cast<int32_t>(l_Full.m_Storage[it_Index])));
+            }
+            if (l_MaxDeviation > 1)
+            {
+                l_Result = 2;
+            }
+
+            std::cout << "Y4M I420 full: double loop " << l_LegacyMs << " ms (" << 1000.0 / l_LegacyMs << " FPS), threaded " << l_ThreadedMs << " ms ("
+                << 1000.0 / l_ThreadedMs << " FPS, " << l_LegacyMs / l_ThreadedMs << "x), max deviation " << l_MaxDeviation << std::endl;
+        }
+
+        const std::array<LayoutCase, 4> l_Layouts{ {
+            { "I420 limited", Trident::YuvChromaLayout::I420, false },
+            { "I420 full", Trident::YuvChromaLayout::I420, true },
+            { "NV12 limited", Trident::YuvChromaLayout::Nv12, false },
+            { "YUV444 limited", Trident::YuvChromaLayout::Yuv444, false } } };
+
+        for (const LayoutCase& it_Layout : l_Layouts)
+        {
+            PlaneSet l_Reference = MakePlanes(l_Source.data(), width, height, it_Layout);
+            PlaneSet l_Simd = MakePlanes(l_Source.data(), width, height, it_Layout);
+            PlaneSet l_Threaded = MakePlanes(l_Source.data(), width, height, it_Layout);
+
+            const double l_ScalarMs = MeasureMilliseconds([&]() { Trident::YuvConverter::ConvertRowsScalar(l_Reference.m_Desc, 0, height); });
+            const double l_SimdMs = MeasureMilliseconds([&]() { Trident::YuvConverter::ConvertRows(l_Simd.m_Desc, 0, height); });
+            const double l_ThreadedMs = MeasureMilliseconds([&]() { converter.Convert(l_Threaded.m_Desc); });
+
+            const bool l_Match = l_Simd.m_Storage == l_Reference.m_Storage && l_Threaded.m_Storage == l_Reference.m_Storage;
+            if (!l_Match)
+            {
+                l_Result = 2;
+            }
+
+            std::cout << it_Layout.m_Name << ": scalar " << l_ScalarMs << " ms, simd " << l_SimdMs << " ms, threaded " << l_ThreadedMs << " ms ("
+                << l_ScalarMs / l_ThreadedMs << "x)" << (l_Match ? "" : " MISMATCH") << std::endl;
+        }
+
+        // Queue handoff: the old RecordedFrame owned a fresh vector that was copied again into the encoder queue; now a
+        // pooled buffer is filled once and only its reference moves through the queue.
+        {
+            std::queue<std::vector<uint8_t>> l_CopyQueue;
+            const double l_CopyMs = MeasureMilliseconds([&]()
+                {
+                    std::vector<uint8_t> l_Pixels(l_Source.begin(), l_Source.end());
+                    l_CopyQueue.push(l_Pixels);
+                    l_CopyQueue.pop();
+                });
+
+            const std::shared_ptr<Trident::PixelBufferPool> l_Pool = std::make_shared<Trident::PixelBufferPool>(4);
+            std::queue<std::shared_ptr<std::vector<uint8_t>>> l_PooledQueue;
+            const double l_PooledMs = MeasureMilliseconds([&]()
+                {
+                    std::shared_ptr<std::vector<uint8_t>> l_Pixels = l_Pool->Acquire(l_FrameBytes);
+                    std::memcpy(l_Pixels->data(), l_Source.data(), l_FrameBytes);
+                    l_PooledQueue.push(std::move(l_Pixels));
+                    l_PooledQueue.pop();
+                });
+
+            std::cout << "Frame handoff: allocate + queue copy " << l_CopyMs << " ms, pooled + moved " << l_PooledMs << " ms" << std::endl;
+        }
+
+        return l_Result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> l_Resolutions{ { 1920u, 1080u }, { 3840u, 2160u } };
+    if (argc > 2)
+    {
+        l_Resolutions = { { static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)), static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) } };
+        if (l_Resolutions[0].first == 0 || l_Resolutions[0].second == 0)
+        {
+            std::cerr << "Usage: trident_encoder_conversion_benchmark [width height]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Same helper count the encoder starts with.
+    Trident::YuvConverter l_Converter;
+    l_Converter.Init(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u) - 1);
+
+    int l_Result = 0;
+    for (const auto& [it_Width, it_Height] : l_Resolutions)
+    {
+        l_Result = std::max(l_Result, RunResolution(it_Width, it_Height, l_Converter));
+    }
+
+    l_Converter.Shutdown();
+
+    return l_Result;
+}
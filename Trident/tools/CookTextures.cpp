@@ -0,0 +1,261 @@
+#include "Loader/TextureLoader.h"
+
+#include <ktx.h>
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// Offline cooker that turns material images into KTX2 files with a full Basis Universal mip chain.
+// Usage: trident_texture_cooker [--etc1s|--uastc] [--quality N] [--linear] <file-or-directory>...
+// --linear cooks data maps (normals, metallic-roughness): UNORM storage and a chain averaged without gamma.
+// Each image is written next to its source as <name>.ktx2, which TextureLoader prefers while it is newer than the source.
+// The report compares stb_image decode against KTX2 load + transcode, and RGBA8 (with mips) against BC7/BC1 residency.
+namespace
+{
+    constexpr uint32_t s_DefaultEtc1sQuality = 128;
+    constexpr uint32_t s_UastcZstdLevel = 18;
+
+    struct CookOptions
+    {
+        bool m_UseEtc1s = false;
+        uint32_t m_Quality = s_DefaultEtc1sQuality;
+        bool m_Linear = false;
+    };
+
+    struct CookTotals
+    {
+        uint32_t m_Cooked = 0;
+        uint32_t m_Failed = 0;
+        double m_DecodeMs = 0.0;
+        double m_TranscodeMs = 0.0;
+        uint64_t m_Rgba8Bytes = 0;
+        uint64_t m_CompressedBytes = 0;
+    };
+
+    bool IsCookableImage(const std::filesystem::path& path)
+    {
+        std::string l_Extension = path.extension().string();
+        std::transform(l_Extension.begin(), l_Extension.end(), l_Extension.begin(), [](unsigned char character)
+            {
+                return static_cast<char>(std::tolower(character));
+            });
+
+        return l_Extension == ".png" || l_Extension == ".jpg" || l_Extension == ".jpeg" || l_Extension == ".tga" || l_Extension == ".bmp";
+    }
+
+    // Bytes a full mip chain occupies once uploaded; block formats round every level up to whole 4x4 blocks.
+    uint64_t ComputeChainBytes(uint32_t width, uint32_t height, uint32_t blockBytes, bool blockCompressed)
+    {
+        uint64_t l_Bytes = 0;
+        const uint32_t l_Levels = static_cast<uint32_t>(std::bit_width(std::max(width, height)));
+        for (uint32_t it_Level = 0; it_Level < l_Levels; ++it_Level)
+        {
+            const uint64_t l_Width = std::max(width >> it_Level, 1u);
+            const uint64_t l_Height = std::max(height >> it_Level, 1u);
+            if (blockCompressed)
+            {
+                l_Bytes += ((l_Width + 3) / 4) * ((l_Height + 3) / 4) * blockBytes;
+            }
+            else
+            {
+                l_Bytes += l_Width * l_Height * blockBytes;
+            }
+        }
+
+        return l_Bytes;
+    }
+
+    bool CookTexture(const std::filesystem::path& sourcePath, const CookOptions& options, CookTotals& totals)
+    {
+        const std::filesystem::path l_CookedPath = Trident::Loader::TextureLoader::GetCookedPath(sourcePath);
+
+        // Drop the previous cook first, otherwise the loader would hand it back instead of decoding the source.
+        std::error_code l_Error;
+        std::filesystem::remove(l_CookedPath, l_Error);
+
+        const auto l_DecodeStart = std::chrono::steady_clock::now();
+        Trident::Loader::TextureData l_Source = Trident::Loader::TextureLoader::Load(sourcePath.string(), options.m_Linear);
+        const double l_DecodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_DecodeStart).count();
+        if (l_Source.Pixels.empty())
+        {
+            std::cerr << "Failed to load '" << sourcePath.string() << "'" << std::endl;
+            return false;
+        }
+
+        const uint32_t l_Width = static_cast<uint32_t>(l_Source.Width);
+        const uint32_t l_Height = static_cast<uint32_t>(l_Source.Height);
+        const uint32_t l_LevelCount = static_cast<uint32_t>(std::bit_width(std::max(l_Width, l_Height)));
+
+        ktxTextureCreateInfo l_CreateInfo{};
+        l_CreateInfo.vkFormat = l_Source.Format;
+        l_CreateInfo.baseWidth = l_Width;
+        l_CreateInfo.baseHeight = l_Height;
+        l_CreateInfo.baseDepth = 1;
+        l_CreateInfo.numDimensions = 2;
+        l_CreateInfo.numLevels = l_LevelCount;
+        l_CreateInfo.numLayers = 1;
+        l_CreateInfo.numFaces = 1;
+        l_CreateInfo.isArray = KTX_FALSE;
+        l_CreateInfo.generateMipmaps = KTX_FALSE;
+
+        ktxTexture2* l_Ktx = nullptr;
+        if (ktxTexture2_Create(&l_CreateInfo, KTX_TEXTURE_CREATE_ALLOC_STORAGE, &l_Ktx) != KTX_SUCCESS)
+        {
+            std::cerr << "Failed to allocate KTX2 storage for '" << sourcePath.string() << "'" << std::endl;
+            return false;
+        }
+
+        // The chain is filtered by the same helper the renderer uses for uncooked textures, following the source's colour space.
+        Trident::Loader::TextureData l_Level = std::move(l_Source);
+        for (uint32_t it_Level = 0; it_Level < l_LevelCount; ++it_Level)
+        {
+            if (it_Level > 0)
+            {
+                l_Level = Trident::Loader::TextureLoader::Downsample(l_Level);
+            }
+
+            if (ktxTexture_SetImageFromMemory(ktxTexture(l_Ktx), it_Level, 0, 0, l_Level.Pixels.data(), l_Level.Pixels.size()) != KTX_SUCCESS)
+            {
+                std::cerr << "Failed to store mip " << it_Level << " of '" << sourcePath.string() << "'" << std::endl;
+                ktxTexture_Destroy(ktxTexture(l_Ktx));
+                return false;
+            }
+        }
+
+        ktxBasisParams l_Params{};
+        l_Params.structSize = sizeof(l_Params);
+        l_Params.uastc = options.m_UseEtc1s ? KTX_FALSE : KTX_TRUE;
+        l_Params.qualityLevel = options.m_Quality;
+        l_Params.uastcFlags = KTX_PACK_UASTC_LEVEL_DEFAULT;
+        l_Params.threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        ktx_error_code_e l_Result = ktxTexture2_CompressBasisEx(l_Ktx, &l_Params);
+        if (l_Result == KTX_SUCCESS && !options.m_UseEtc1s)
+        {
+            // UASTC is large on disk; supercompression keeps it close to ETC1S without touching the transcoded blocks.
+            l_Result = ktxTexture2_DeflateZstd(l_Ktx, s_UastcZstdLevel);
+        }
+
+        if (l_Result == KTX_SUCCESS)
+        {
+            l_Result = ktxTexture2_WriteToNamedFile(l_Ktx, l_CookedPath.string().c_str());
+        }
+        ktxTexture_Destroy(ktxTexture(l_Ktx));
+
+        if (l_Result != KTX_SUCCESS)
+        {
+            std::cerr << "Failed to cook '" << sourcePath.string() << "': " << ktxErrorString(l_Result) << std::endl;
+            return false;
+        }
+
+        // Load the result back through the engine path so the timing includes transcoding to the device format.
+        const auto l_TranscodeStart = std::chrono::steady_clock::now();
+        const Trident::Loader::TextureData l_Cooked = Trident::Loader::TextureLoader::Load(l_CookedPath.string(), options.m_Linear);
+        const double l_TranscodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_TranscodeStart).count();
+        if (l_Cooked.Pixels.empty())
+        {
+            std::cerr << "Cooked file '" << l_CookedPath.string() << "' could not be read back" << std::endl;
+            return false;
+        }
+
+        const bool l_IsBc1 = l_Cooked.Format == VK_FORMAT_BC1_RGB_SRGB_BLOCK || l_Cooked.Format == VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        const uint64_t l_Rgba8Bytes = ComputeChainBytes(l_Width, l_Height, 4, false);
+        const uint64_t l_CompressedBytes = ComputeChainBytes(l_Width, l_Height, l_IsBc1 ? 8u : 16u, true);
+
+        std::cout << sourcePath.string() << " (" << l_Width << "x" << l_Height << ", " << l_LevelCount << " mips): decode " << l_DecodeMs
+            << " ms, KTX2 " << l_TranscodeMs << " ms, VRAM " << l_Rgba8Bytes / 1024 << " KiB -> " << l_CompressedBytes / 1024 << " KiB ("
+            << (l_IsBc1 ? "BC1" : "BC7") << ")" << std::endl;
+
+        ++totals.m_Cooked;
+        totals.m_DecodeMs += l_DecodeMs;
+        totals.m_TranscodeMs += l_TranscodeMs;
+        totals.m_Rgba8Bytes += l_Rgba8Bytes;
+        totals.m_CompressedBytes += l_CompressedBytes;
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CookOptions l_Options{};
+    std::vector<std::filesystem::path> l_Sources;
+
+    for (int it_Argument = 1; it_Argument < argc; ++it_Argument)
+    {
+        const std::string l_Argument = argv[it_Argument];
+        if (l_Argument == "--etc1s")
+        {
+            l_Options.m_UseEtc1s = true;
+        }
+        else if (l_Argument == "--uastc")
+        {
+            l_Options.m_UseEtc1s = false;
+        }
+        else if (l_Argument == "--quality" && it_Argument + 1 < argc)
+        {
+            l_Options.m_Quality = static_cast<uint32_t>(std::clamp(std::atoi(argv[++it_Argument]), 1, 255));
+        }
+        else if (l_Argument == "--linear")
+        {
+            l_Options.m_Linear = true;
+        }
+        else
+        {
+            std::error_code l_Error;
+            const std::filesystem::path l_Path{ l_Argument };
+            if (std::filesystem::is_directory(l_Path, l_Error))
+            {
+                for (const auto& it_Entry : std::filesystem::recursive_directory_iterator(l_Path, l_Error))
+                {
+                    if (it_Entry.is_regular_file(l_Error) && IsCookableImage(it_Entry.path()))
+                    {
+                        l_Sources.push_back(it_Entry.path());
+                    }
+                }
+            }
+            else if (IsCookableImage(l_Path))
+            {
+                l_Sources.push_back(l_Path);
+            }
+        }
+    }
+
+    if (l_Sources.empty())
+    {
+        std::cerr << "Usage: trident_texture_cooker [--etc1s|--uastc] [--quality N] [--linear] <file-or-directory>..." << std::endl;
+        return 1;
+    }
+
+    // Transcode as a BC-capable desktop GPU would; devices without BC support fall back to RGBA8 and keep the old footprint.
+    Trident::Loader::TextureLoader::SetBlockCompressionSupported(true);
+
+    CookTotals l_Totals{};
+    for (const std::filesystem::path& it_Source : l_Sources)
+    {
+        if (!CookTexture(it_Source, l_Options, l_Totals))
+        {
+            ++l_Totals.m_Failed;
+        }
+    }
+
+    std::cout << "Cooked " << l_Totals.m_Cooked << " textures (" << l_Totals.m_Failed << " failed) as " << (l_Options.m_UseEtc1s ? "ETC1S" : "UASTC") << std::endl;
+    if (l_Totals.m_Cooked > 0)
+    {
+        std::cout << "Load time: " << l_Totals.m_DecodeMs << " ms decoded -> " << l_Totals.m_TranscodeMs << " ms cooked" << std::endl;
+        std::cout << "Texture VRAM: " << l_Totals.m_Rgba8Bytes / (1024 * 1024) << " MiB RGBA8 -> " << l_Totals.m_CompressedBytes / (1024 * 1024)
+            << " MiB block compressed" << std::endl;
+    }
+
+    return l_Totals.m_Failed == 0 ? 0 : 2;
+}